@@ -4,14 +4,18 @@
 #include "ITKImageProcessing/Filters/ITKImageReaderFilter.hpp"
 
 #include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/TypesUtility.hpp"
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/IDataArray.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <cmath>
 #include <filesystem>
 #include <sstream>
 
@@ -25,6 +29,201 @@ const Uuid k_SimplnxCorePluginId = *Uuid::FromString("05cc618b-781f-4ac0-b9ac-43
 const Uuid k_ColorToGrayScaleFilterId = *Uuid::FromString("d938a2aa-fee2-4db9-aa2f-2c34a9736580");
 const FilterHandle k_ColorToGrayScaleFilterHandle(k_ColorToGrayScaleFilterId, k_SimplnxCorePluginId);
 
+// -----------------------------------------------------------------------------
+template <typename SourceT, typename DestT>
+void CopyTileValues(const SourceT* source, DestT* destination, usize count)
+{
+  if constexpr(std::is_same_v<SourceT, DestT>)
+  {
+    std::copy(source, source + count, destination);
+  }
+  else if constexpr(!std::is_signed_v<SourceT> && !std::is_signed_v<DestT> && !std::is_same_v<DestT, bool>)
+  {
+    // Same scaling as ITK::ConvertImageToDataStore()
+    constexpr auto destMaxV = static_cast<float64>(std::numeric_limits<DestT>::max());
+    constexpr auto originMaxV = static_cast<float64>(std::numeric_limits<SourceT>::max());
+    std::transform(source, source + count, destination, [](SourceT value) { return static_cast<DestT>(static_cast<float64>(value) / originMaxV * destMaxV); });
+  }
+  else
+  {
+    std::transform(source, source + count, destination, [](SourceT value) { return static_cast<DestT>(value); });
+  }
+}
+
+/**
+ * @brief Returns, for each tile, the tiles that overlap it and take precedence over it under the overlap policy.
+ */
+std::vector<std::vector<usize>> FindOccludingTiles(const MontageLayout& layout, MontageOverlapPolicy overlapPolicy)
+{
+  const usize numTiles = layout.tiles.size();
+  std::vector<std::vector<usize>> occluders(numTiles);
+  for(usize i = 0; i < numTiles; i++)
+  {
+    const MontageTileLayout& tile = layout.tiles[i];
+    for(usize j = 0; j < numTiles; j++)
+    {
+      const bool takesPrecedence = overlapPolicy == MontageOverlapPolicy::LastTileWins ? j > i : j < i;
+      if(!takesPrecedence)
+      {
+        continue;
+      }
+      const MontageTileLayout& other = layout.tiles[j];
+      const bool overlapsX = other.Offset[0] < tile.Offset[0] + tile.Dims[0] && tile.Offset[0] < other.Offset[0] + other.Dims[0];
+      const bool overlapsY = other.Offset[1] < tile.Offset[1] + tile.Dims[1] && tile.Offset[1] < other.Offset[1] + other.Dims[1];
+      if(overlapsX && overlapsY)
+      {
+        occluders[i].push_back(j);
+      }
+    }
+  }
+  return occluders;
+}
+
+template <typename DestT>
+struct MontageTileTarget
+{
+  DestT* montageData = nullptr;
+  const MontageLayout* layout = nullptr;
+  usize tileIndex = 0;
+  const std::vector<usize>* occluders = nullptr;
+};
+
+/**
+ * @brief Copies the rows of a decoded tile into the montage, skipping the cells owned by an occluding tile.
+ * Since every cell is written by exactly one tile, tiles can be written concurrently.
+ */
+template <typename SourceT, typename DestT>
+void WriteTileRows(const SourceT* tileData, const MontageTileTarget<DestT>& target)
+{
+  const MontageLayout& layout = *target.layout;
+  const MontageTileLayout& tile = layout.tiles[target.tileIndex];
+  const usize numComps = layout.numComponents;
+  const usize tileEndX = tile.Offset[0] + tile.Dims[0];
+
+  auto copySegment = [&](usize row, usize startX, usize endX) {
+    const usize sourceIndex = (row * tile.Dims[0] + (startX - tile.Offset[0])) * numComps;
+    const usize destIndex = ((tile.Offset[1] + row) * layout.dims[0] + startX) * numComps;
+    CopyTileValues(tileData + sourceIndex, target.montageData + destIndex, (endX - startX) * numComps);
+  };
+
+  std::vector<std::pair<usize, usize>> coveredSegments;
+  for(usize row = 0; row < tile.Dims[1]; row++)
+  {
+    const usize montageRow = tile.Offset[1] + row;
+    coveredSegments.clear();
+    for(usize occluderIndex : *target.occluders)
+    {
+      const MontageTileLayout& other = layout.tiles[occluderIndex];
+      if(montageRow >= other.Offset[1] && montageRow < other.Offset[1] + other.Dims[1])
+      {
+        coveredSegments.emplace_back(std::max(other.Offset[0], tile.Offset[0]), std::min(other.Offset[0] + other.Dims[0], tileEndX));
+      }
+    }
+    std::sort(coveredSegments.begin(), coveredSegments.end());
+
+    usize x = tile.Offset[0];
+    for(const auto& [startX, endX] : coveredSegments)
+    {
+      if(startX > x)
+      {
+        copySegment(row, x, startX);
+      }
+      x = std::max(x, endX);
+    }
+    if(x < tileEndX)
+    {
+      copySegment(row, x, tileEndX);
+    }
+  }
+}
+
+template <typename DestT>
+struct ReadTileIntoMontageFunctor
+{
+  template <class PixelT, uint32 Dimension>
+  Result<> operator()(const MontageTileTarget<DestT>& target) const
+  {
+    using ImageType = itk::Image<PixelT, Dimension>;
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    using T = ITK::UnderlyingType_t<PixelT>;
+
+    const MontageTileLayout& tile = target.layout->tiles[target.tileIndex];
+
+    typename ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName(tile.Filepath.string());
+    reader->Update();
+    typename ImageType::Pointer tileImage = reader->GetOutput();
+
+    typename ImageType::SizeType imageSize = tileImage->GetLargestPossibleRegion().GetSize();
+    usize sizeY = 1;
+    if constexpr(Dimension > 1)
+    {
+      sizeY = static_cast<usize>(imageSize[1]);
+    }
+    if(static_cast<usize>(imageSize[0]) != tile.Dims[0] || sizeY != tile.Dims[1] || itk::NumericTraits<PixelT>::GetLength() != target.layout->numComponents)
+    {
+      return MakeErrorResult(-18556, fmt::format("Tile '{}' changed on disk since the montage was preflighted", tile.Filepath.string()));
+    }
+
+    WriteTileRows(reinterpret_cast<const T*>(tileImage->GetBufferPointer()), target);
+    return {};
+  }
+};
+
+template <typename DestT>
+class ReadTilesIntoMontageImpl
+{
+public:
+  ReadTilesIntoMontageImpl(DestT* montageData, const MontageLayout& layout, const std::vector<std::vector<usize>>& occluders, const std::atomic_bool& shouldCancel, std::vector<Result<>>& tileResults)
+  : m_MontageData(montageData)
+  , m_Layout(layout)
+  , m_Occluders(occluders)
+  , m_ShouldCancel(shouldCancel)
+  , m_TileResults(tileResults)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize tileIndex = range.min(); tileIndex < range.max(); tileIndex++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      MontageTileTarget<DestT> target{m_MontageData, &m_Layout, tileIndex, &m_Occluders[tileIndex]};
+      m_TileResults[tileIndex] = cxItkImageReaderFilter::ReadImageExecute<ReadTileIntoMontageFunctor<DestT>>(m_Layout.tiles[tileIndex].Filepath.string(), target);
+    }
+  }
+
+private:
+  DestT* m_MontageData = nullptr;
+  const MontageLayout& m_Layout;
+  const std::vector<std::vector<usize>>& m_Occluders;
+  const std::atomic_bool& m_ShouldCancel;
+  std::vector<Result<>>& m_TileResults;
+};
+
+struct AssembleMontageFunctor
+{
+  template <typename T>
+  Result<> operator()(IDataArray& montageArray, const MontageLayout& layout, MontageOverlapPolicy overlapPolicy, const std::atomic_bool& shouldCancel, std::vector<Result<>>& tileResults)
+  {
+    T* montageData = DataStoreUtilities::GetContiguousData(dynamic_cast<DataArray<T>&>(montageArray).getDataStoreRef());
+    if(montageData == nullptr)
+    {
+      return MakeErrorResult(-18557, fmt::format("Montage array '{}' is not held in contiguous memory", montageArray.getName()));
+    }
+
+    std::vector<std::vector<usize>> occluders = FindOccludingTiles(layout, overlapPolicy);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, layout.tiles.size());
+    dataAlg.execute(ReadTilesIntoMontageImpl<T>(montageData, layout, occluders, shouldCancel, tileResults));
+    return {};
+  }
+};
+
 template <bool GenerateCache = true>
 class IOHandler
 {
@@ -176,27 +375,31 @@ private:
     m_Cache.montageInformation = ss.str();
   }
 
+  // -----------------------------------------------------------------------------
+  DataPath createImageDataPath(const std::string& imageName) const
+  {
+    if(m_InputValues->parentDataGroup)
+    {
+      return DataPath({m_InputValues->DataGroupName, imageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
+    }
+    return DataPath({imageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
+  }
+
   // -----------------------------------------------------------------------------
   Result<> readImages()
   {
-    Result<> outputResult = {};
+    if(m_InputValues->assembleMontage)
+    {
+      return assembleMontage();
+    }
 
-    auto* filterListPtr = Application::Instance()->getFilterList();
-    // auto imageImportFilter = ITKImageReaderFilter();
+    Result<> outputResult = {};
 
     for(const auto& bound : m_Cache.bounds)
     {
       m_Filter->sendUpdate(("Importing " + bound.Filepath.filename().string()));
 
-      DataPath imageDataPath = {};
-      if(m_InputValues->parentDataGroup)
-      {
-        imageDataPath = DataPath({m_InputValues->DataGroupName, bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
-      }
-      else
-      {
-        imageDataPath = DataPath({bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
-      }
+      DataPath imageDataPath = createImageDataPath(bound.ImageName);
 
       // Ensure that we are dealing with in-core memory ONLY
       const IDataArray* inputArrayPtr = m_DataStructure.getDataAs<IDataArray>(imageDataPath);
@@ -235,58 +438,132 @@ private:
       // Check if we need to convert to grayscale
       if(m_InputValues->convertToGrayScale)
       {
-        if(!filterListPtr->containsPlugin(k_SimplnxCorePluginId))
+        Result<> grayScaleResult = convertToGrayScale(imageDataPath);
+        if(grayScaleResult.invalid())
         {
-          return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
-        }
-        auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
-        if(nullptr == grayScaleFilter.get())
-        {
-          continue;
+          return grayScaleResult;
         }
+        outputResult = MergeResults(std::move(outputResult), std::move(grayScaleResult));
+      }
+    }
 
-        if(m_DataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() != DataType::uint8)
-        {
-          outputResult.warnings().emplace_back(
-              Warning{-74320, fmt::format("The array ({}) is not a UIntArray, so it will not be converted to grayscale. Continuing...", imageDataPath.getTargetName())});
-          continue;
-        }
+    return outputResult;
+  }
+
+  // -----------------------------------------------------------------------------
+  Result<> assembleMontage()
+  {
+    Result<MontageLayout> layoutResult = ITKImportFijiMontage::ComputeMontageLayout(m_Cache.bounds, m_InputValues->changeDataType, m_InputValues->destType);
+    if(layoutResult.invalid())
+    {
+      return ConvertResult(std::move(layoutResult));
+    }
+    const MontageLayout& layout = layoutResult.value();
 
-        // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-        Arguments colorToGrayscaleArgs;
-        colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
-        colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(m_InputValues->colorWeights));
-        colorToGrayscaleArgs.insertOrAssign("input_data_array_vector", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
-        colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
+    DataPath imageDataPath = createImageDataPath(m_InputValues->montageName);
 
-        // Run grayscale filter and process results and messages
-        auto result = grayScaleFilter->execute(m_DataStructure, colorToGrayscaleArgs).result;
-        if(result.invalid())
-        {
-          return result;
-        }
+    // Ensure that we are dealing with in-core memory ONLY
+    auto& montageArray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPath);
+    if(!montageArray.getDataFormat().empty())
+    {
+      return MakeErrorResult(-9999, fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported within ITK filters.", imageDataPath.toString()));
+    }
+    if(montageArray.getDataType() != layout.dataType || montageArray.getNumberOfTuples() != layout.dims[0] * layout.dims[1] * layout.dims[2] ||
+       montageArray.getNumberOfComponents() != layout.numComponents)
+    {
+      return MakeErrorResult(-18558, "The tiles changed on disk since the montage was preflighted");
+    }
 
-        // deletion of non-grayscale array
-        DataObject::IdType id;
-        { // scoped for safety since this reference will be nonexistent in a moment
-          auto& oldArray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPath);
-          id = oldArray.getId();
-        }
-        m_DataStructure.removeData(id);
+    auto* image = m_DataStructure.getDataAs<ImageGeom>(imageDataPath.getParent().getParent());
+    image->setUnits(m_InputValues->lengthUnit);
+    image->setOrigin(layout.origin);
+    image->setSpacing(FloatVec3(1.0f, 1.0f, 1.0f));
 
-        // rename grayscale array to reflect original
-        {
-          auto& gray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
-          if(gray.canRename(imageDataPath.getTargetName()) == false)
-          {
-            return MakeErrorResult(-18543, fmt::format("Unable to rename the grayscale array to {}", imageDataPath.getTargetName()));
-          }
-          gray.rename(imageDataPath.getTargetName());
-        }
+    m_Filter->sendUpdate(fmt::format("Assembling {} tiles into a {} x {} montage", layout.tiles.size(), layout.dims[0], layout.dims[1]));
+
+    // Each tile is decoded on its own thread and copied straight into the cells it owns
+    std::vector<Result<>> tileResults(layout.tiles.size());
+    Result<> assembleResult = ExecuteDataFunction(AssembleMontageFunctor{}, layout.dataType, montageArray, layout, m_InputValues->overlapPolicy, m_Filter->getCancel(), tileResults);
+    if(assembleResult.invalid())
+    {
+      return assembleResult;
+    }
+    // A tile that failed to decode leaves its cells unwritten, so every tile error fails the filter
+    for(usize i = 0; i < tileResults.size(); i++)
+    {
+      if(tileResults[i].valid())
+      {
+        continue;
+      }
+      for(auto& error : tileResults[i].errors())
+      {
+        error.message = fmt::format("Error Reading Image '{}': {}", layout.tiles[i].Filepath.filename().string(), error.message);
       }
     }
+    Result<> tilesResult = MergeResults(std::move(tileResults));
+    if(tilesResult.invalid())
+    {
+      return tilesResult;
+    }
 
-    return outputResult;
+    if(m_InputValues->convertToGrayScale)
+    {
+      return convertToGrayScale(imageDataPath);
+    }
+    return {};
+  }
+
+  // -----------------------------------------------------------------------------
+  Result<> convertToGrayScale(const DataPath& imageDataPath)
+  {
+    auto* filterListPtr = Application::Instance()->getFilterList();
+    if(!filterListPtr->containsPlugin(k_SimplnxCorePluginId))
+    {
+      return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
+    }
+    auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
+    if(nullptr == grayScaleFilter.get())
+    {
+      return {};
+    }
+
+    if(m_DataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() != DataType::uint8)
+    {
+      return MakeWarningVoidResult(-74320, fmt::format("The array ({}) is not a UIntArray, so it will not be converted to grayscale. Continuing...", imageDataPath.getTargetName()));
+    }
+
+    // This same filter was used to preflight so as long as nothing changes on disk this really should work....
+    Arguments colorToGrayscaleArgs;
+    colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
+    colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(m_InputValues->colorWeights));
+    colorToGrayscaleArgs.insertOrAssign("input_data_array_vector", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
+    colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
+
+    // Run grayscale filter and process results and messages
+    auto result = grayScaleFilter->execute(m_DataStructure, colorToGrayscaleArgs).result;
+    if(result.invalid())
+    {
+      return result;
+    }
+
+    // deletion of non-grayscale array
+    DataObject::IdType id;
+    { // scoped for safety since this reference will be nonexistent in a moment
+      auto& oldArray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPath);
+      id = oldArray.getId();
+    }
+    m_DataStructure.removeData(id);
+
+    // rename grayscale array to reflect original
+    {
+      auto& gray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
+      if(gray.canRename(imageDataPath.getTargetName()) == false)
+      {
+        return MakeErrorResult(-18543, fmt::format("Unable to rename the grayscale array to {}", imageDataPath.getTargetName()));
+      }
+      gray.rename(imageDataPath.getTargetName());
+    }
+    return {};
   }
 };
 } // namespace
@@ -302,6 +579,86 @@ ITKImportFijiMontage::ITKImportFijiMontage(DataStructure& dataStructure, const I
 {
 }
 
+// -----------------------------------------------------------------------------
+Result<MontageLayout> ITKImportFijiMontage::ComputeMontageLayout(const std::vector<BoundsType>& bounds, bool changeDataType, DataType destType)
+{
+  if(bounds.empty())
+  {
+    return MakeErrorResult<MontageLayout>(-18550, "The Fiji configuration file does not list any tiles to assemble");
+  }
+
+  FloatVec3 minCoord = {std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), 0.0f};
+  for(const auto& bound : bounds)
+  {
+    minCoord[0] = std::min(bound.Origin[0], minCoord[0]);
+    minCoord[1] = std::min(bound.Origin[1], minCoord[1]);
+  }
+
+  MontageLayout layout;
+  layout.origin = minCoord;
+  for(usize i = 0; i < bounds.size(); i++)
+  {
+    const BoundsType& bound = bounds[i];
+    const std::string fileName = bound.Filepath.string();
+    try
+    {
+      itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(fileName.c_str(), itk::CommonEnums::IOFileMode::ReadMode);
+      if(imageIO == nullptr)
+      {
+        return MakeErrorResult<MontageLayout>(-18551, fmt::format("ITK could not read the given file \"{}\". Format is likely unsupported.", fileName));
+      }
+      imageIO->SetFileName(fileName);
+      imageIO->ReadImageInformation();
+
+      std::optional<DataType> dataType = ITK::ConvertIOComponentToDataType(imageIO->GetComponentType());
+      if(!dataType.has_value())
+      {
+        return MakeErrorResult<MontageLayout>(-18552, fmt::format("Unsupported pixel component: {}", imageIO->GetComponentTypeAsString(imageIO->GetComponentType())));
+      }
+
+      MontageTileLayout tile;
+      tile.Filepath = bound.Filepath;
+      tile.Dims = {1, 1, 1};
+      const uint32 nDims = std::min(imageIO->GetNumberOfDimensions(), 3u);
+      for(uint32 d = 0; d < nDims; d++)
+      {
+        tile.Dims[d] = static_cast<usize>(imageIO->GetDimensions(d));
+      }
+      if(tile.Dims[2] != 1)
+      {
+        return MakeErrorResult<MontageLayout>(-18553, fmt::format("Tile '{}' is not a 2D image and cannot be assembled into a montage", fileName));
+      }
+
+      const usize numComponents = imageIO->GetNumberOfComponents();
+      if(i == 0)
+      {
+        layout.dataType = *dataType;
+        layout.numComponents = numComponents;
+      }
+      else if(*dataType != layout.dataType || numComponents != layout.numComponents)
+      {
+        return MakeErrorResult<MontageLayout>(-18554, fmt::format("Tile '{}' has {} {} component(s) per cell while the first tile has {} {} component(s). All tiles must match to be assembled",
+                                                                  fileName, numComponents, DataTypeToString(*dataType), layout.numComponents, DataTypeToString(layout.dataType)));
+      }
+
+      tile.Offset = {static_cast<usize>(std::lround(bound.Origin[0] - minCoord[0])), static_cast<usize>(std::lround(bound.Origin[1] - minCoord[1])), 0};
+      layout.dims[0] = std::max(layout.dims[0], tile.Offset[0] + tile.Dims[0]);
+      layout.dims[1] = std::max(layout.dims[1], tile.Offset[1] + tile.Dims[1]);
+      layout.tiles.push_back(std::move(tile));
+    } catch(const itk::ExceptionObject& err)
+    {
+      return MakeErrorResult<MontageLayout>(-55557, fmt::format("ITK exception was thrown while processing input file: {}", err.what()));
+    }
+  }
+
+  if(changeDataType && ExecuteNeighborFunction(ITK::detail::PreflightTypeConversionValidateFunctor{}, layout.dataType, destType))
+  {
+    layout.dataType = destType;
+  }
+
+  return {std::move(layout)};
+}
+
 // -----------------------------------------------------------------------------
 const std::atomic_bool& ITKImportFijiMontage::getCancel()
 {
@@ -12,9 +12,21 @@ namespace fs = std::filesystem;
 
 namespace nx::core
 {
+/**
+ * @brief Decides which tile provides the value of a cell that is covered by more than one tile
+ * when the tiles are assembled into a single montage. Tiles are ordered as listed in the configuration file.
+ */
+enum class MontageOverlapPolicy : uint64
+{
+  FirstTileWins = 0,
+  LastTileWins = 1
+};
+
 struct ITKIMAGEPROCESSING_EXPORT ITKImportFijiMontageInputValues
 {
   bool allocate = false;
+  bool assembleMontage = false;
+  MontageOverlapPolicy overlapPolicy = MontageOverlapPolicy::LastTileWins;
   bool changeOrigin = false;
   bool convertToGrayScale = false;
   bool parentDataGroup = false;
@@ -28,6 +40,7 @@ struct ITKIMAGEPROCESSING_EXPORT ITKImportFijiMontageInputValues
   std::string imagePrefix = "";
   std::string cellAMName = "";
   std::string imageDataArrayName = "";
+  std::string montageName = "";
 };
 
 struct ITKIMAGEPROCESSING_EXPORT BoundsType
@@ -37,6 +50,28 @@ struct ITKIMAGEPROCESSING_EXPORT BoundsType
   std::string ImageName;
 };
 
+/**
+ * @brief The cells a tile occupies in the assembled montage. Offset and Dims are in cells (X, Y, Z).
+ */
+struct ITKIMAGEPROCESSING_EXPORT MontageTileLayout
+{
+  fs::path Filepath;
+  SizeVec3 Offset;
+  SizeVec3 Dims;
+};
+
+/**
+ * @brief The geometry and array layout of a montage assembled from the tiles of a Fiji configuration file.
+ */
+struct ITKIMAGEPROCESSING_EXPORT MontageLayout
+{
+  std::vector<MontageTileLayout> tiles;
+  SizeVec3 dims = {0, 0, 1};
+  FloatVec3 origin = {0.0f, 0.0f, 0.0f};
+  DataType dataType = DataType::uint8;
+  usize numComponents = 1;
+};
+
 struct ITKIMAGEPROCESSING_EXPORT FijiCache
 {
   fs::path inputFile;
@@ -103,6 +138,16 @@ public:
 
   Result<> operator()();
 
+  /**
+   * @brief Reads the header of each tile and places the tiles into a single montage with a spacing of 1,
+   * the tile origins rounded to whole cells. All tiles must be 2D and share their component type and count.
+   * @param bounds The tiles as found in the cache
+   * @param changeDataType Whether the montage should be converted to destType
+   * @param destType
+   * @return Result<MontageLayout>
+   */
+  static Result<MontageLayout> ComputeMontageLayout(const std::vector<BoundsType>& bounds, bool changeDataType, DataType destType);
+
   const std::atomic_bool& getCancel();
 
   FijiCache& getCache();
@@ -7,7 +7,9 @@
 
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/CreateDataGroupAction.hpp"
+#include "simplnx/Filter/Actions/CreateImageGeometryAction.hpp"
 #include "simplnx/Filter/Actions/UpdateImageGeomAction.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
@@ -89,10 +91,16 @@ Parameters ITKImportFijiMontageFilter::parameters() const
   params.insert(std::make_unique<ChoicesParameter>(k_ImageDataType_Key, "Output Data Type", "Numeric Type of data to create", 0ULL,
                                                    ChoicesParameter::Choices{"uint8", "uint16", "uint32"})); // Sequence Dependent DO NOT REORDER
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ParentDataGroup_Key, "Parent Imported Images Under a DataGroup", "Create a new DataGroup to hold the  imported images", true));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_AssembleMontage_Key, "Assemble Montage",
+                                                                 "Stitch the tiles into a single Image Geometry instead of creating one Image Geometry per tile", false));
+  params.insert(std::make_unique<ChoicesParameter>(k_OverlapPolicy_Key, "Overlap Policy", "Which tile provides the value of a cell that is covered by more than one tile",
+                                                   to_underlying(MontageOverlapPolicy::LastTileWins),
+                                                   ChoicesParameter::Choices{"First Tile Wins", "Last Tile Wins"})); // Sequence Dependent DO NOT REORDER
 
   params.insertSeparator(Parameters::Separator{"Output Data Object(s)"});
   params.insert(std::make_unique<StringParameter>(k_DataGroupName_Key, "Name of Created DataGroup", "Name of the overarching parent DataGroup", "Zen DataGroup"));
   params.insert(std::make_unique<StringParameter>(k_DataContainerPath_Key, "Image Geometry Prefix", "A prefix that can be used for each Image Geometry", "Mosaic-"));
+  params.insert(std::make_unique<StringParameter>(k_MontageGeometryName_Key, "Montage Image Geometry Name", "The name of the assembled Image Geometry", "Montage"));
   params.insert(std::make_unique<StringParameter>(k_CellAttributeMatrixName_Key, "Cell Attribute Matrix Name", "The name of the Cell Attribute Matrix", "Tile Data"));
   params.insert(std::make_unique<StringParameter>(k_ImageDataArrayName_Key, "Image DataArray Name", "The name of the import image data", "Image"));
 
@@ -101,6 +109,8 @@ Parameters ITKImportFijiMontageFilter::parameters() const
   params.linkParameters(k_ChangeOrigin_Key, k_Origin_Key, true);
   params.linkParameters(k_ConvertToGrayScale_Key, k_ColorWeights_Key, true);
   params.linkParameters(k_ParentDataGroup_Key, k_DataGroupName_Key, true);
+  params.linkParameters(k_AssembleMontage_Key, k_OverlapPolicy_Key, true);
+  params.linkParameters(k_AssembleMontage_Key, k_MontageGeometryName_Key, true);
 
   return params;
 }
@@ -108,7 +118,14 @@ Parameters ITKImportFijiMontageFilter::parameters() const
 //------------------------------------------------------------------------------
 IFilter::VersionType ITKImportFijiMontageFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added - k_AssembleMontage_Key = "assemble_montage";
+  // Added - k_OverlapPolicy_Key = "overlap_policy_index";
+  // Added - k_MontageGeometryName_Key = "montage_geometry_name";
+  // Solution - Pipelines written with version 1 never assembled the montage, so `k_AssembleMontage_Key Value` = false;
 }
 
 //------------------------------------------------------------------------------
@@ -133,6 +150,8 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
   auto pImageDataArrayNameValue = filterArgs.value<StringParameter::ValueType>(k_ImageDataArrayName_Key);
   auto pChangeDataType = filterArgs.value<bool>(k_ChangeDataType_Key);
   auto pChoiceType = filterArgs.value<ChoicesParameter::ValueType>(k_ImageDataType_Key);
+  auto pAssembleMontageValue = filterArgs.value<bool>(k_AssembleMontage_Key);
+  auto pMontageGeometryNameValue = filterArgs.value<StringParameter::ValueType>(k_MontageGeometryName_Key);
 
   PreflightResult preflightResult;
   nx::core::Result<OutputActions> resultOutputActions = {};
@@ -171,38 +190,60 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
   }
 
   auto* filterListPtr = Application::Instance()->getFilterList();
-  for(const auto& bound : s_HeaderCache[m_InstanceId].bounds)
+  if(pAssembleMontageValue)
   {
-    auto imageImportFilter = ITKImageReaderFilter();
-
-    DataPath imageDataProxy = {};
-    if(pParentDataGroupValue)
-    {
-      imageDataProxy = DataPath({pDataGroupNameValue, bound.ImageName, pCellAttributeMatrixNameValue, pImageDataArrayNameValue});
-    }
-    else
+    Result<MontageLayout> layoutResult = ITKImportFijiMontage::ComputeMontageLayout(s_HeaderCache[m_InstanceId].bounds, pChangeDataType, inputValues.destType);
+    if(layoutResult.invalid())
     {
-      imageDataProxy = DataPath({bound.ImageName, pCellAttributeMatrixNameValue, pImageDataArrayNameValue});
+      return {ConvertResultTo<OutputActions>(ConvertResult(std::move(layoutResult)), {})};
     }
-
-    Arguments imageImportArgs;
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(bound.Filepath));
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageDataProxy.getParent().getParent()));
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(imageDataProxy.getParent().getTargetName()));
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageDataProxy.getTargetName()));
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(pChangeDataType));
-    imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(pChoiceType));
-
-    auto result = imageImportFilter.preflight(dataStructure, imageImportArgs, messageHandler, shouldCancel);
-    if(result.outputActions.invalid())
+    const MontageLayout& layout = layoutResult.value();
+
+    DataPath imageGeomPath = pParentDataGroupValue ? DataPath({pDataGroupNameValue, pMontageGeometryNameValue}) : DataPath({pMontageGeometryNameValue});
+    DataPath imageDataPath = imageGeomPath.createChildPath(pCellAttributeMatrixNameValue).createChildPath(pImageDataArrayNameValue);
+    resultOutputActions.value().appendAction(std::make_unique<CreateImageGeometryAction>(imageGeomPath, CreateImageGeometryAction::DimensionType{layout.dims[0], layout.dims[1], layout.dims[2]},
+                                                                                         layout.origin.toContainer<CreateImageGeometryAction::OriginType>(),
+                                                                                         CreateImageGeometryAction::SpacingType{1.0f, 1.0f, 1.0f}, pCellAttributeMatrixNameValue));
+    // DataArray dimensions are stored slowest to fastest, the opposite of ImageGeometry
+    resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(layout.dataType, std::vector<usize>{layout.dims[2], layout.dims[1], layout.dims[0]},
+                                                                                 std::vector<usize>{layout.numComponents}, imageDataPath));
+    preflightUpdatedValues.push_back({"Montage Dimensions", fmt::format("{} x {} cells assembled from {} tiles", layout.dims[0], layout.dims[1], layout.tiles.size())});
+  }
+  else
+  {
+    for(const auto& bound : s_HeaderCache[m_InstanceId].bounds)
     {
-      return result;
+      auto imageImportFilter = ITKImageReaderFilter();
+
+      DataPath imageDataProxy = {};
+      if(pParentDataGroupValue)
+      {
+        imageDataProxy = DataPath({pDataGroupNameValue, bound.ImageName, pCellAttributeMatrixNameValue, pImageDataArrayNameValue});
+      }
+      else
+      {
+        imageDataProxy = DataPath({bound.ImageName, pCellAttributeMatrixNameValue, pImageDataArrayNameValue});
+      }
+
+      Arguments imageImportArgs;
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(bound.Filepath));
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageDataProxy.getParent().getParent()));
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(imageDataProxy.getParent().getTargetName()));
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageDataProxy.getTargetName()));
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(pChangeDataType));
+      imageImportArgs.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(pChoiceType));
+
+      auto result = imageImportFilter.preflight(dataStructure, imageImportArgs, messageHandler, shouldCancel);
+      if(result.outputActions.invalid())
+      {
+        return result;
+      }
+
+      std::optional<FloatVec3> originVec = FloatVec3(bound.Origin[0], bound.Origin[1], bound.Origin[2]);
+      std::optional<FloatVec3> spacingVec;
+      result.outputActions.value().appendAction(std::make_unique<UpdateImageGeomAction>(originVec, spacingVec, imageDataProxy.getParent().getParent()));
+      resultOutputActions = MergeOutputActionResults(resultOutputActions, result.outputActions);
     }
-
-    std::optional<FloatVec3> originVec = FloatVec3(bound.Origin[0], bound.Origin[1], bound.Origin[2]);
-    std::optional<FloatVec3> spacingVec;
-    result.outputActions.value().appendAction(std::make_unique<UpdateImageGeomAction>(originVec, spacingVec, imageDataProxy.getParent().getParent()));
-    resultOutputActions = MergeOutputActionResults(resultOutputActions, result.outputActions);
   }
 
   if(pConvertToGrayScaleValue)
@@ -249,9 +290,10 @@ Result<> ITKImportFijiMontageFilter::executeImpl(DataStructure& dataStructure, c
   inputValues.imageDataArrayName = filterArgs.value<StringParameter::ValueType>(k_ImageDataArrayName_Key);
   inputValues.changeDataType = filterArgs.value<bool>(k_ChangeDataType_Key);
   inputValues.destType = ITK::detail::ConvertChoiceToDataType(filterArgs.value<ChoicesParameter::ValueType>(k_ImageDataType_Key));
+  inputValues.assembleMontage = filterArgs.value<bool>(k_AssembleMontage_Key);
+  inputValues.overlapPolicy = static_cast<MontageOverlapPolicy>(filterArgs.value<ChoicesParameter::ValueType>(k_OverlapPolicy_Key));
+  inputValues.montageName = filterArgs.value<StringParameter::ValueType>(k_MontageGeometryName_Key);
 
-  ITKImportFijiMontage(dataStructure, messageHandler, shouldCancel, &inputValues, s_HeaderCache.find(m_InstanceId)->second)();
-
-  return {};
+  return ITKImportFijiMontage(dataStructure, messageHandler, shouldCancel, &inputValues, s_HeaderCache.find(m_InstanceId)->second)();
 }
 } // namespace nx::core
@@ -42,6 +42,9 @@ public:
   static inline constexpr StringLiteral k_DataContainerPath_Key = "data_container_path";
   static inline constexpr StringLiteral k_CellAttributeMatrixName_Key = "cell_attribute_matrix_name";
   static inline constexpr StringLiteral k_ImageDataArrayName_Key = "image_data_array_name";
+  static inline constexpr StringLiteral k_AssembleMontage_Key = "assemble_montage";
+  static inline constexpr StringLiteral k_OverlapPolicy_Key = "overlap_policy_index";
+  static inline constexpr StringLiteral k_MontageGeometryName_Key = "montage_geometry_name";
 
   /**
    * @brief Returns the name of the filter.
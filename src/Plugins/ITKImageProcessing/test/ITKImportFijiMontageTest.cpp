@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include "ITKImageProcessing/Filters/Algorithms/ITKImportFijiMontage.hpp"
 #include "ITKImageProcessing/Filters/ITKImportFijiMontageFilter.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_test_dirs.hpp"
 
@@ -9,8 +10,11 @@
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <cmath>
 #include <filesystem>
+#include <fstream>
 #include <sstream>
 
 using namespace nx::core;
@@ -23,6 +27,64 @@ const std::string k_SmallZeissZenDir = fmt::format("{}/fiji_montage/small_zeiss_
 
 const std::string k_DataGroupName = "Zen DataGroup";
 const DataPath k_DataGroupPath = {{k_DataGroupName}};
+
+Arguments CreateSmallZeissZenArgs()
+{
+  Arguments args;
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_InputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(fmt::format("{}/TileConfiguration.registered.txt", k_SmallZeissZenDir))));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_DataGroupName_Key, std::make_any<std::string>(k_DataGroupName));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_LengthUnit_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(IGeometry::LengthUnit::Micrometer)));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ChangeOrigin_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ConvertToGrayScale_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ParentDataGroup_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_DataContainerPath_Key, std::make_any<std::string>("Mosaic-"));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_CellAttributeMatrixName_Key, std::make_any<std::string>("Tile Data"));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ImageDataArrayName_Key, std::make_any<std::string>("Image"));
+  return args;
+}
+
+/**
+ * @brief Returns the names of the tile geometries in the order the configuration file lists them, which is the order the overlap policy uses.
+ */
+std::vector<std::string> ReadSmallZeissZenTileNames()
+{
+  std::ifstream configStream(fmt::format("{}/TileConfiguration.registered.txt", k_SmallZeissZenDir));
+  std::vector<std::string> tileNames;
+  bool dataFound = false;
+  std::string line;
+  while(std::getline(configStream, line))
+  {
+    line = StringUtilities::trimmed(line);
+    if(StringUtilities::starts_with(line, "# Define the image coordinates"))
+    {
+      dataFound = true;
+      continue;
+    }
+    std::vector<std::string> tokens = StringUtilities::split(line, ';');
+    if(dataFound && tokens.size() == 3)
+    {
+      tileNames.push_back(fmt::format("Mosaic-{}", fs::path(tokens[0]).stem().string()));
+    }
+  }
+  return tileNames;
+}
+
+DataStructure AssembleSmallZeissZenMontage(MontageOverlapPolicy overlapPolicy)
+{
+  ITKImportFijiMontageFilter filter;
+  DataStructure dataStructure;
+  Arguments args = CreateSmallZeissZenArgs();
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_AssembleMontage_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_OverlapPolicy_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(overlapPolicy)));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_MontageGeometryName_Key, std::make_any<std::string>("Montage"));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  return dataStructure;
+}
 } // namespace
 
 TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Basic 2x2 Grid Montage", "[ITKImageProcessing][ITKImportFijiMontage]")
@@ -70,3 +132,168 @@ TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Basic 2x2 Grid Montage", "[
     UnitTest::CompareImageGeometry(exemplarDataStructure.getDataAs<ImageGeom>(exemplarGroup[i]), dataStructure.getDataAs<ImageGeom>(generatedGroup[i]));
   }
 }
+
+TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Assemble 2x2 Grid Montage", "[ITKImageProcessing][ITKImportFijiMontage]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "fiji_montage.tar.gz", "fiji_montage");
+
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  auto overlapPolicy = GENERATE(MontageOverlapPolicy::FirstTileWins, MontageOverlapPolicy::LastTileWins);
+
+  // Import the tiles separately to compare against
+  DataStructure tileDataStructure;
+  {
+    ITKImportFijiMontageFilter filter;
+    Arguments args = CreateSmallZeissZenArgs();
+    auto executeResult = filter.execute(tileDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  }
+
+  DataStructure dataStructure = AssembleSmallZeissZenMontage(overlapPolicy);
+
+  const auto& montage = dataStructure.getDataRefAs<ImageGeom>(k_DataGroupPath.createChildPath("Montage"));
+  const auto& montageArray = dataStructure.getDataRefAs<UInt8Array>(k_DataGroupPath.createChildPath("Montage").createChildPath("Tile Data").createChildPath("Image"));
+  const SizeVec3 montageDims = montage.getDimensions();
+  const usize numComps = montageArray.getNumberOfComponents();
+
+  std::vector<DataPath> tileGeomPaths = GetAllChildDataPaths(tileDataStructure, k_DataGroupPath, DataObject::Type::ImageGeom).value();
+  REQUIRE(tileGeomPaths.size() == 4);
+
+  // Every cell of the montage must come from one of the tiles covering it and cells covered by a single tile must match it
+  std::vector<usize> coverCount(montageDims[0] * montageDims[1], 0);
+  std::vector<usize> matchCount(montageDims[0] * montageDims[1], 0);
+  for(const auto& tileGeomPath : tileGeomPaths)
+  {
+    const auto& tile = tileDataStructure.getDataRefAs<ImageGeom>(tileGeomPath);
+    const auto& tileArray = tileDataStructure.getDataRefAs<UInt8Array>(tileGeomPath.createChildPath("Tile Data").createChildPath("Image"));
+    REQUIRE(tileArray.getNumberOfComponents() == numComps);
+    const SizeVec3 tileDims = tile.getDimensions();
+    const auto offsetX = static_cast<usize>(std::lround(tile.getOrigin()[0] - montage.getOrigin()[0]));
+    const auto offsetY = static_cast<usize>(std::lround(tile.getOrigin()[1] - montage.getOrigin()[1]));
+    REQUIRE(offsetX + tileDims[0] <= montageDims[0]);
+    REQUIRE(offsetY + tileDims[1] <= montageDims[1]);
+
+    for(usize y = 0; y < tileDims[1]; y++)
+    {
+      for(usize x = 0; x < tileDims[0]; x++)
+      {
+        const usize montageIndex = (offsetY + y) * montageDims[0] + offsetX + x;
+        const usize tileIndex = y * tileDims[0] + x;
+        bool matches = true;
+        for(usize c = 0; c < numComps; c++)
+        {
+          matches = matches && montageArray[montageIndex * numComps + c] == tileArray[tileIndex * numComps + c];
+        }
+        coverCount[montageIndex]++;
+        matchCount[montageIndex] += matches ? 1 : 0;
+      }
+    }
+  }
+
+  for(usize i = 0; i < coverCount.size(); i++)
+  {
+    if(coverCount[i] == 1)
+    {
+      REQUIRE(matchCount[i] == 1);
+    }
+    else if(coverCount[i] > 1)
+    {
+      REQUIRE(matchCount[i] >= 1);
+    }
+  }
+}
+
+TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Montage Overlap Policy", "[ITKImageProcessing][ITKImportFijiMontage]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "fiji_montage.tar.gz", "fiji_montage");
+
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  // Import the tiles separately to know the pixels each tile contributes
+  DataStructure tileDataStructure;
+  {
+    ITKImportFijiMontageFilter filter;
+    Arguments args = CreateSmallZeissZenArgs();
+    auto executeResult = filter.execute(tileDataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  }
+  const std::vector<std::string> tileNames = ReadSmallZeissZenTileNames();
+  REQUIRE(tileNames.size() == 4);
+
+  const DataPath montagePath = k_DataGroupPath.createChildPath("Montage");
+  const DataPath montageArrayPath = montagePath.createChildPath("Tile Data").createChildPath("Image");
+  DataStructure firstDataStructure = AssembleSmallZeissZenMontage(MontageOverlapPolicy::FirstTileWins);
+  DataStructure lastDataStructure = AssembleSmallZeissZenMontage(MontageOverlapPolicy::LastTileWins);
+  const auto& montage = firstDataStructure.getDataRefAs<ImageGeom>(montagePath);
+  const auto& firstArray = firstDataStructure.getDataRefAs<UInt8Array>(montageArrayPath);
+  const auto& lastArray = lastDataStructure.getDataRefAs<UInt8Array>(montageArrayPath);
+  REQUIRE(firstArray.getSize() == lastArray.getSize());
+  const SizeVec3 montageDims = montage.getDimensions();
+  const usize numComps = firstArray.getNumberOfComponents();
+
+  // Walk the tiles in configuration order. A cell keeps the pixel of the first tile covering it for FirstTileWins
+  // and takes the pixel of every later tile covering it for LastTileWins.
+  std::vector<uint8> expectedFirst(firstArray.getSize(), 0);
+  std::vector<uint8> expectedLast(lastArray.getSize(), 0);
+  std::vector<usize> coverCount(montageDims[0] * montageDims[1], 0);
+  for(const auto& tileName : tileNames)
+  {
+    const DataPath tileGeomPath = k_DataGroupPath.createChildPath(tileName);
+    const auto& tile = tileDataStructure.getDataRefAs<ImageGeom>(tileGeomPath);
+    const auto& tileArray = tileDataStructure.getDataRefAs<UInt8Array>(tileGeomPath.createChildPath("Tile Data").createChildPath("Image"));
+    REQUIRE(tileArray.getNumberOfComponents() == numComps);
+    const SizeVec3 tileDims = tile.getDimensions();
+    const auto offsetX = static_cast<usize>(std::lround(tile.getOrigin()[0] - montage.getOrigin()[0]));
+    const auto offsetY = static_cast<usize>(std::lround(tile.getOrigin()[1] - montage.getOrigin()[1]));
+    REQUIRE(offsetX + tileDims[0] <= montageDims[0]);
+    REQUIRE(offsetY + tileDims[1] <= montageDims[1]);
+
+    for(usize y = 0; y < tileDims[1]; y++)
+    {
+      for(usize x = 0; x < tileDims[0]; x++)
+      {
+        const usize montageIndex = (offsetY + y) * montageDims[0] + offsetX + x;
+        const usize tileIndex = y * tileDims[0] + x;
+        for(usize c = 0; c < numComps; c++)
+        {
+          if(coverCount[montageIndex] == 0)
+          {
+            expectedFirst[montageIndex * numComps + c] = tileArray[tileIndex * numComps + c];
+          }
+          expectedLast[montageIndex * numComps + c] = tileArray[tileIndex * numComps + c];
+        }
+        coverCount[montageIndex]++;
+      }
+    }
+  }
+
+  // Check the overlap region cell by cell. It must contain pixels where the first and last tiles differ, otherwise swapping the policies would go unnoticed.
+  usize numOverlapCells = 0;
+  usize numDistinguishingCells = 0;
+  usize numFirstMismatches = 0;
+  usize numLastMismatches = 0;
+  for(usize cell = 0; cell < coverCount.size(); cell++)
+  {
+    if(coverCount[cell] < 2)
+    {
+      continue;
+    }
+    numOverlapCells++;
+    bool distinguishing = false;
+    for(usize c = 0; c < numComps; c++)
+    {
+      const usize index = cell * numComps + c;
+      distinguishing = distinguishing || expectedFirst[index] != expectedLast[index];
+      numFirstMismatches += firstArray[index] != expectedFirst[index] ? 1 : 0;
+      numLastMismatches += lastArray[index] != expectedLast[index] ? 1 : 0;
+    }
+    numDistinguishingCells += distinguishing ? 1 : 0;
+  }
+  REQUIRE(numOverlapCells > 0);
+  REQUIRE(numDistinguishingCells > 0);
+  REQUIRE(numFirstMismatches == 0);
+  REQUIRE(numLastMismatches == 0);
+}
@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/MaskView.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
@@ -52,13 +53,11 @@ std::vector<DataPath> AlignSectionsMisorientation::getSelectedDataPaths() const
 // -----------------------------------------------------------------------------
 Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts, std::vector<int64_t>& yShifts)
 {
-  std::unique_ptr<MaskCompare> maskCompare = nullptr;
+  const IDataArray* maskArray = nullptr;
   if(m_InputValues->UseMask)
   {
-    try
-    {
-      maskCompare = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-    } catch(const std::out_of_range& exception)
+    maskArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath);
+    if(maskArray == nullptr)
     {
       // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
       // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -111,114 +110,123 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
 
   double deg2Rad = (nx::core::numbers::pi / 180.0);
   auto start = std::chrono::steady_clock::now();
-  // Loop over the Z Direction
-  for(int64_t iter = 1; iter < dims[2]; iter++)
-  {
-    progInt = static_cast<float>(iter) / static_cast<float>(dims[2]) * 100.0f;
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      std::string message = fmt::format("Determining Shifts || {}% Complete", progInt);
-      m_MessageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, progInt});
-      start = std::chrono::steady_clock::now();
-    }
-    if(getCancel())
+  // The mask view is a template parameter of the loop, so the mask test inlines and disappears entirely without a mask
+  Result<> shiftsResult = ExecuteWithMaskView(maskArray, [&](const auto& maskView) -> Result<> {
+    using MaskViewType = std::decay_t<decltype(maskView)>;
+    // Loop over the Z Direction
+    for(int64_t iter = 1; iter < dims[2]; iter++)
     {
-      return {};
-    }
-    float minDisorientation = std::numeric_limits<float>::max();
-    // Work from the largest Slice Value to the lowest Slice Value.
-    int64_t slice = (dims[2] - 1) - iter;
-    int64_t oldxshift = -1;
-    int64_t oldyshift = -1;
-    int64_t newxshift = 0;
-    int64_t newyshift = 0;
+      progInt = static_cast<float>(iter) / static_cast<float>(dims[2]) * 100.0f;
+      auto now = std::chrono::steady_clock::now();
+      // Only send updates every 1 second
+      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+      {
+        std::string message = fmt::format("Determining Shifts || {}% Complete", progInt);
+        m_MessageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, progInt});
+        start = std::chrono::steady_clock::now();
+      }
+      if(getCancel())
+      {
+        return {};
+      }
+      float minDisorientation = std::numeric_limits<float>::max();
+      // Work from the largest Slice Value to the lowest Slice Value.
+      int64_t slice = (dims[2] - 1) - iter;
+      int64_t oldxshift = -1;
+      int64_t oldyshift = -1;
+      int64_t newxshift = 0;
+      int64_t newyshift = 0;
 
-    // Initialize everything to false
-    std::fill(misorients.begin(), misorients.end(), false);
+      // Initialize everything to false
+      std::fill(misorients.begin(), misorients.end(), false);
 
-    float misorientationTolerance = static_cast<float>(m_InputValues->misorientationTolerance * deg2Rad);
+      float misorientationTolerance = static_cast<float>(m_InputValues->misorientationTolerance * deg2Rad);
 
-    while(newxshift != oldxshift || newyshift != oldyshift)
-    {
-      oldxshift = newxshift;
-      oldyshift = newyshift;
-      for(int32_t j = -3; j < 4; j++)
+      while(newxshift != oldxshift || newyshift != oldyshift)
       {
-        for(int32_t k = -3; k < 4; k++)
+        oldxshift = newxshift;
+        oldyshift = newyshift;
+        for(int32_t j = -3; j < 4; j++)
         {
-          float disorientation = 0.0f;
-          float count = 0.0f;
-          int64_t xIdx = k + oldxshift + halfDim0;
-          int64_t yIdx = j + oldyshift + halfDim1;
-          int64_t idx = (dims[0] * yIdx) + xIdx;
-          if(!misorients[idx] && llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1)
+          for(int32_t k = -3; k < 4; k++)
           {
-            for(int64_t l = 0; l < dims[1]; l = l + 4)
+            float disorientation = 0.0f;
+            float count = 0.0f;
+            int64_t xIdx = k + oldxshift + halfDim0;
+            int64_t yIdx = j + oldyshift + halfDim1;
+            int64_t idx = (dims[0] * yIdx) + xIdx;
+            if(!misorients[idx] && llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1)
             {
-              for(int64_t n = 0; n < dims[0]; n = n + 4)
+              for(int64_t l = 0; l < dims[1]; l = l + 4)
               {
-                if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
+                for(int64_t n = 0; n < dims[0]; n = n + 4)
                 {
-                  count++;
-                  int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
-                  int64_t curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
-                  if(!m_InputValues->UseMask || maskCompare->bothTrue(refposition, curposition))
+                  if((l + j + oldyshift) >= 0 && (l + j + oldyshift) < dims[1] && (n + k + oldxshift) >= 0 && (n + k + oldxshift) < dims[0])
                   {
-                    float angle = std::numeric_limits<float>::max();
-                    if(cellPhases[refposition] > 0 && cellPhases[curposition] > 0)
+                    count++;
+                    int64_t refposition = ((slice + 1) * dims[0] * dims[1]) + (l * dims[0]) + n;
+                    int64_t curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
+                    if(maskView.bothTrue(refposition, curposition))
                     {
-                      QuatF quat1(quats[refposition * 4], quats[refposition * 4 + 1], quats[refposition * 4 + 2], quats[refposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase1 = static_cast<int32_t>(crystalStructures[cellPhases[refposition]]);
-                      QuatF quat2(quats[curposition * 4], quats[curposition * 4 + 1], quats[curposition * 4 + 2], quats[curposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase2 = static_cast<int32_t>(crystalStructures[cellPhases[curposition]]);
-                      if(phase1 == phase2 && phase1 < static_cast<uint32_t>(orientationOps.size()))
+                      float angle = std::numeric_limits<float>::max();
+                      if(cellPhases[refposition] > 0 && cellPhases[curposition] > 0)
                       {
-                        OrientationF axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                        angle = axisAngle[3];
+                        QuatF quat1(quats[refposition * 4], quats[refposition * 4 + 1], quats[refposition * 4 + 2], quats[refposition * 4 + 3]); // Makes a copy into voxQuat!!!!
+                        auto phase1 = static_cast<int32_t>(crystalStructures[cellPhases[refposition]]);
+                        QuatF quat2(quats[curposition * 4], quats[curposition * 4 + 1], quats[curposition * 4 + 2], quats[curposition * 4 + 3]); // Makes a copy into voxQuat!!!!
+                        auto phase2 = static_cast<int32_t>(crystalStructures[cellPhases[curposition]]);
+                        if(phase1 == phase2 && phase1 < static_cast<uint32_t>(orientationOps.size()))
+                        {
+                          OrientationF axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
+                          angle = axisAngle[3];
+                        }
+                      }
+                      if(angle > misorientationTolerance)
+                      {
+                        disorientation++;
                       }
                     }
-                    if(angle > misorientationTolerance)
-                    {
-                      disorientation++;
-                    }
-                  }
-                  if(m_InputValues->UseMask)
-                  {
-                    if(maskCompare->isTrue(refposition) && !maskCompare->isTrue(curposition))
-                    {
-                      disorientation++;
-                    }
-                    if(!maskCompare->isTrue(refposition) && maskCompare->isTrue(curposition))
+                    if constexpr(!MaskViewType::k_AlwaysTrue)
                     {
-                      disorientation++;
+                      if(maskView.isTrue(refposition) && !maskView.isTrue(curposition))
+                      {
+                        disorientation++;
+                      }
+                      if(!maskView.isTrue(refposition) && maskView.isTrue(curposition))
+                      {
+                        disorientation++;
+                      }
                     }
                   }
                 }
               }
-            }
-            disorientation = disorientation / count;
-            xIdx = k + oldxshift + halfDim0;
-            yIdx = j + oldyshift + halfDim1;
-            idx = (dims[0] * yIdx) + xIdx;
-            misorients[idx] = true;
-            if(disorientation < minDisorientation || (disorientation == minDisorientation && ((llabs(k + oldxshift) < llabs(newxshift)) || (llabs(j + oldyshift) < llabs(newyshift)))))
-            {
-              newxshift = k + oldxshift;
-              newyshift = j + oldyshift;
-              minDisorientation = disorientation;
+              disorientation = disorientation / count;
+              xIdx = k + oldxshift + halfDim0;
+              yIdx = j + oldyshift + halfDim1;
+              idx = (dims[0] * yIdx) + xIdx;
+              misorients[idx] = true;
+              if(disorientation < minDisorientation || (disorientation == minDisorientation && ((llabs(k + oldxshift) < llabs(newxshift)) || (llabs(j + oldyshift) < llabs(newyshift)))))
+              {
+                newxshift = k + oldxshift;
+                newyshift = j + oldyshift;
+                minDisorientation = disorientation;
+              }
             }
           }
         }
       }
+      xShifts[iter] = xShifts[iter - 1] + newxshift;
+      yShifts[iter] = yShifts[iter - 1] + newyshift;
+      if(m_InputValues->writeAlignmentShifts)
+      {
+        outFile << slice << "\t" << slice + 1 << "\t" << newxshift << "\t" << newyshift << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
+      }
     }
-    xShifts[iter] = xShifts[iter - 1] + newxshift;
-    yShifts[iter] = yShifts[iter - 1] + newyshift;
-    if(m_InputValues->writeAlignmentShifts)
-    {
-      outFile << slice << "\t" << slice + 1 << "\t" << newxshift << "\t" << newyshift << "\t" << xShifts[iter] << "\t" << yShifts[iter] << "\n";
-    }
+    return {};
+  });
+  if(shiftsResult.invalid() || getCancel())
+  {
+    return shiftsResult;
   }
   if(m_InputValues->writeAlignmentShifts)
   {
@@ -3,11 +3,24 @@
 #include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/FeatureReduction.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Running sum of the nearest symmetric equivalent quaternions of a single feature.
+ */
+struct AvgQuatAccumulator
+{
+  std::array<float32, 4> quat = {0.0F, 0.0F, 0.0F, 1.0F};
+  float32 count = 0.0f;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeAvgOrientations::ComputeAvgOrientations(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                ComputeAvgOrientationsInputValues* inputValues)
@@ -36,67 +49,61 @@ Result<> ComputeAvgOrientations::operator()()
   nx::core::Float32Array& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->avgQuatsArrayPath);
   nx::core::Float32Array& avgEuler = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->avgEulerAnglesArrayPath);
 
-  size_t totalPoints = featureIds.getNumberOfTuples();
-
   auto numFeatResults = ValidateNumFeaturesInArray(m_DataStructure, m_InputValues->avgQuatsArrayPath, featureIds);
   if(numFeatResults.invalid())
   {
     return numFeatResults;
   }
   size_t totalFeatures = avgQuats.getNumberOfTuples();
-  std::vector<float> counts(totalFeatures, 0.0f);
 
   // initialize the output arrays
   avgQuats.fill(0.0F);
   // Initialize all Euler Angles to Zero
   avgEuler.fill(0.0F);
 
-  // Get the DataStore for each output array
-  auto* avgQuatDataStore = avgQuats.getDataStore();
-
-  // Get the Identity Quaternion
-  std::array<float, 4> identityQuat = {0.0F, 0.0F, 0.0F, 1.0F};
-
-  // Initialize all Average Quats to Identity
-  for(size_t tupleIndex = 1; tupleIndex < totalFeatures; tupleIndex++)
+  // The nearest quaternion depends on the running average, so every feature must see its voxels in ascending order.
+  // Average Quats start at the Identity Quaternion.
+  FeatureReduction<AvgQuatAccumulator> featureReduction(featureIds.getDataStoreRef(), totalFeatures, AvgQuatAccumulator{});
+  featureReduction.requireArraysInMemory({&featureIds, &phases, &quats, &crystalStructures});
+  auto reductionResult = featureReduction.executeInElementOrder(
+      [&](AvgQuatAccumulator& accumulator, usize featureId, usize i) {
+        if(featureId == 0 || phases[i] <= 0)
+        {
+          return;
+        }
+        int32 phase = phases[i];
+        accumulator.count += 1.0f;
+
+        float32 count = accumulator.count;
+        QuatF curAvgQuat(accumulator.quat[0] / count, accumulator.quat[1] / count, accumulator.quat[2] / count, accumulator.quat[3] / count);
+
+        // Make a copy of the current quaternion from the DataArray into a QuatF object
+        QuatF voxQuat(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
+        QuatF nearestQuat = orientationOps[crystalStructures[phase]]->getNearestQuat(curAvgQuat, voxQuat);
+
+        // Add the running average quat with the current quat
+        curAvgQuat = curAvgQuat + nearestQuat;
+        accumulator.quat = {curAvgQuat.x(), curAvgQuat.y(), curAvgQuat.z(), curAvgQuat.w()};
+      },
+      m_ShouldCancel);
+  if(reductionResult.invalid())
   {
-    avgQuatDataStore->setTuple(tupleIndex, identityQuat);
+    return ConvertResult(std::move(reductionResult));
   }
-
-  for(size_t i = 0; i < totalPoints; i++)
+  if(m_ShouldCancel)
   {
-    if(featureIds[i] > 0 && phases[i] > 0)
-    {
-      int32 phase = phases[i];
-      size_t featureId = static_cast<size_t>(featureIds[i]);
-
-      size_t featureIdOffset = featureId * 4;
-      counts[featureId] += 1.0f;
-
-      float32 count = counts[featureId];
-      QuatF curAvgQuat(avgQuats[featureIdOffset] / count, avgQuats[featureIdOffset + 1] / count, avgQuats[featureIdOffset + 2] / count, avgQuats[featureIdOffset + 3] / count);
-
-      // Make a copy of the current quaternion from the DataArray into a QuatF object
-      QuatF voxQuat(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-      QuatF nearestQuat = orientationOps[crystalStructures[phase]]->getNearestQuat(curAvgQuat, voxQuat);
-
-      // Add the running average quat with the current quat
-      curAvgQuat = curAvgQuat + nearestQuat;
-      // Copy the new curAvgQuat back into the output array
-      avgQuats[featureIdOffset] = curAvgQuat.x();
-      avgQuats[featureIdOffset + 1] = curAvgQuat.y();
-      avgQuats[featureIdOffset + 2] = curAvgQuat.z();
-      avgQuats[featureIdOffset + 3] = curAvgQuat.w();
-    }
+    return {};
   }
+  const std::vector<AvgQuatAccumulator>& featureQuats = reductionResult.value();
 
   for(size_t featureId = 1; featureId < totalFeatures; featureId++)
   {
     size_t featureIdOffset = featureId * 4;
-    float32 count = counts[featureId];
+    const AvgQuatAccumulator& accumulator = featureQuats[featureId];
+    float32 count = accumulator.count;
 
     // Create a copy of the quaternion
-    QuatF curAvgQuat(avgQuats[featureIdOffset] / count, avgQuats[featureIdOffset + 1] / count, avgQuats[featureIdOffset + 2] / count, avgQuats[featureIdOffset + 3] / count);
+    QuatF curAvgQuat(accumulator.quat[0] / count, accumulator.quat[1] / count, accumulator.quat[2] / count, accumulator.quat[3] / count);
     curAvgQuat = curAvgQuat.unitQuaternion();
 
     avgQuats[featureIdOffset] = curAvgQuat.x();
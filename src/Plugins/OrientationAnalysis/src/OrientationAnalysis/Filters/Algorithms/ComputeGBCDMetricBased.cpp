@@ -1,6 +1,7 @@
 #include "ComputeGBCDMetricBased.hpp"
 
 #include "OrientationAnalysis/utilities/OrientationUtilities.hpp"
+#include "OrientationAnalysis/utilities/SphereBins.hpp"
 
 #include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
@@ -237,7 +238,9 @@ private:
 
 /**
  * @brief The ProbeDistribution class implements a threaded algorithm that determines the distribution values
- * for the GBCD
+ * for the GBCD. A selected triangle only contributes to a sampling point if its first normal is within
+ * sqrt(2) * plane resolution of the (inverted) sampling point, so only the triangles of the nearby cells
+ * of the SphereBins built over those normals are tested.
  */
 class ProbeDistribution
 {
@@ -249,13 +252,14 @@ public:
 #else
                     const std::vector<TriAreaAndNormals>& selectedTriangles,
 #endif
-                    float64 planeResolutionSq, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, const Matrix3dR& gFixedT)
+                    const SphereBins& triangleBins, float64 planeResolutionSq, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, const Matrix3dR& gFixedT)
   : m_DistributionValues(distributionValues)
   , m_ErrorValues(errorValues)
   , m_SamplePtsX(samplePtsX)
   , m_SamplePtsY(samplePtsY)
   , m_SamplePtsZ(samplePtsZ)
   , m_SelectedTriangles(selectedTriangles)
+  , m_TriangleBins(triangleBins)
   , m_PlaneResolutionSq(planeResolutionSq)
   , m_TotalFaceArea(totalFaceArea)
   , m_NumDistinctGBs(numDistinctGBs)
@@ -266,32 +270,39 @@ public:
 
   void probe(usize start, usize end) const
   {
+    // distSq < planeResolutionSq requires theta1 < sqrt(2) * plane resolution
+    const float64 maxTheta1 = std::sqrt(2.0 * m_PlaneResolutionSq);
+    std::vector<usize> candidates;
 
     for(usize ptIdx = start; ptIdx < end; ptIdx++)
     {
       Eigen::Vector3d fixedNormal1 = {m_SamplePtsX.at(ptIdx), m_SamplePtsY.at(ptIdx), m_SamplePtsZ.at(ptIdx)};
       Eigen::Vector3d fixedNormal2 = m_GFixedT * fixedNormal1;
 
-      for(const auto& selectedTriangle : m_SelectedTriangles)
+      // Candidates are encoded as 2 * triangle + inversion and sorted so the areas are summed in the same order as a full sweep
+      candidates.clear();
+      m_TriangleBins.forEachCandidate(fixedNormal1[0], fixedNormal1[1], fixedNormal1[2], maxTheta1, [&candidates](usize triIdx) { candidates.push_back(2 * triIdx); });
+      m_TriangleBins.forEachCandidate(-fixedNormal1[0], -fixedNormal1[1], -fixedNormal1[2], maxTheta1, [&candidates](usize triIdx) { candidates.push_back(2 * triIdx + 1); });
+      std::sort(candidates.begin(), candidates.end());
+
+      for(const usize candidate : candidates)
       {
-        for(int32 inversion = 0; inversion <= 1; inversion++)
+        const auto& selectedTriangle = m_SelectedTriangles[candidate / 2];
+        float64 sign = 1.0f;
+        if(candidate % 2 == 1)
         {
-          float64 sign = 1.0f;
-          if(inversion == 1)
-          {
-            sign = -1.0f;
-          }
+          sign = -1.0f;
+        }
 
-          const float64 theta1 =
-              std::acos(sign * (selectedTriangle.normalGrain1X * fixedNormal1[0] + selectedTriangle.normalGrain1Y * fixedNormal1[1] + selectedTriangle.normalGrain1Z * fixedNormal1[2]));
-          const float64 theta2 =
-              std::acos(-sign * (selectedTriangle.normalGrain2X * fixedNormal2[0] + selectedTriangle.normalGrain2Y * fixedNormal2[1] + selectedTriangle.normalGrain2Z * fixedNormal2[2]));
-          const float64 distSq = 0.5f * (theta1 * theta1 + theta2 * theta2);
+        const float64 theta1 =
+            std::acos(sign * (selectedTriangle.normalGrain1X * fixedNormal1[0] + selectedTriangle.normalGrain1Y * fixedNormal1[1] + selectedTriangle.normalGrain1Z * fixedNormal1[2]));
+        const float64 theta2 =
+            std::acos(-sign * (selectedTriangle.normalGrain2X * fixedNormal2[0] + selectedTriangle.normalGrain2Y * fixedNormal2[1] + selectedTriangle.normalGrain2Z * fixedNormal2[2]));
+        const float64 distSq = 0.5f * (theta1 * theta1 + theta2 * theta2);
 
-          if(distSq < m_PlaneResolutionSq)
-          {
-            m_DistributionValues[ptIdx] += selectedTriangle.Area;
-          }
+        if(distSq < m_PlaneResolutionSq)
+        {
+          m_DistributionValues[ptIdx] += selectedTriangle.Area;
         }
       }
       m_ErrorValues[ptIdx] = sqrt(m_DistributionValues[ptIdx] / m_TotalFaceArea / static_cast<float64>(m_NumDistinctGBs)) / m_BallVolume;
@@ -309,14 +320,15 @@ public:
 private:
   std::vector<float64>& m_DistributionValues;
   std::vector<float64>& m_ErrorValues;
-  std::vector<float64> m_SamplePtsX;
-  std::vector<float64> m_SamplePtsY;
-  std::vector<float64> m_SamplePtsZ;
+  const std::vector<float64>& m_SamplePtsX;
+  const std::vector<float64>& m_SamplePtsY;
+  const std::vector<float64>& m_SamplePtsZ;
 #ifdef SIMPLNX_ENABLE_MULTICORE
   const tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
 #else
   const std::vector<TriAreaAndNormals>& m_SelectedTriangles;
 #endif
+  const SphereBins& m_TriangleBins;
   float64 m_PlaneResolutionSq;
   float64 m_TotalFaceArea;
   int32 m_NumDistinctGBs;
@@ -533,6 +545,13 @@ Result<> ComputeGBCDMetricBased::operator()()
   std::vector<float64> distributionValues(samplePtsX.size(), 0.0);
   std::vector<float64> errorValues(samplePtsX.size(), 0.0);
 
+  // Bin the first normal of every selected triangle so each sampling point only tests the nearby triangles
+  const float64 maxTheta1 = std::sqrt(2.0 * planeResolutionSq);
+  const SphereBins triangleBins = SphereBins::Create(maxTheta1, selectedTriangles.size(), [&selectedTriangles](usize triIdx) {
+    const auto& selectedTriangle = selectedTriangles[triIdx];
+    return std::array<float64, 3>{selectedTriangle.normalGrain1X, selectedTriangle.normalGrain1Y, selectedTriangle.normalGrain1Z};
+  });
+
   usize pointsChunkSize = 100;
   if(samplePtsX.size() < pointsChunkSize)
   {
@@ -555,8 +574,8 @@ Result<> ComputeGBCDMetricBased::operator()()
     ParallelDataAlgorithm dataAlg;
     dataAlg.setRange(i, i + pointsChunkSize);
     dataAlg.setParallelizationEnabled(true);
-    dataAlg.execute(GBCDMetricBased::ProbeDistribution(distributionValues, errorValues, samplePtsX, samplePtsY, samplePtsZ, selectedTriangles, planeResolutionSq, totalFaceArea, numDistinctGBs,
-                                                       ballVolume, gFixedT));
+    dataAlg.execute(GBCDMetricBased::ProbeDistribution(distributionValues, errorValues, samplePtsX, samplePtsY, samplePtsZ, selectedTriangles, triangleBins, planeResolutionSq, totalFaceArea,
+                                                       numDistinctGBs, ballVolume, gFixedT));
   }
 
   // ------------------------------------------- writing the output --------------------------------
@@ -1,6 +1,7 @@
 #include "ComputeGBPDMetricBased.hpp"
 
 #include "OrientationAnalysis/utilities/OrientationUtilities.hpp"
+#include "OrientationAnalysis/utilities/SphereBins.hpp"
 
 #include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
@@ -171,7 +172,8 @@ private:
 
 /**
  * @brief The ProbeDistribution class implements a threaded algorithm that determines the distribution values
- * for the GBPD
+ * for the GBPD. The symmetry operators are applied to the sampling point instead of the triangle normals, so
+ * a single SphereBins built over the unsymmetrized normals gives the candidates for every operator.
  */
 class ProbeDistribution
 {
@@ -183,69 +185,83 @@ public:
 #else
                     const std::vector<TriAreaAndNormals>& selectedTriangles,
 #endif
-                    float64 limitDist, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, int32 crystal)
+                    const SphereBins& normalBins, float64 limitDist, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, int32 crystal)
   : m_DistributionValues(distributionValues)
   , m_ErrorValues(errorValues)
   , m_SamplePtsX(samplePtsX)
   , m_SamplePtsY(samplePtsY)
   , m_SamplePtsZ(samplePtsZ)
   , m_SelectedTriangles(selectedTriangles)
+  , m_NormalBins(normalBins)
   , m_LimitDist(limitDist)
   , m_TotalFaceArea(totalFaceArea)
   , m_NumDistinctGBs(numDistinctGBs)
   , m_BallVolume(ballVolume)
-  , m_Crystal(crystal)
   {
-    m_OrientationOps = LaueOps::GetAllOrientationOps();
-    m_NSym = m_OrientationOps[crystal]->getNumSymOps();
+    LaueOpsContainerType orientationOps = LaueOps::GetAllOrientationOps();
+    const int32 nSym = orientationOps[crystal]->getNumSymOps();
+    for(int32 j = 0; j < nSym; j++)
+    {
+      m_SymOps.push_back(EbsdLibMatrixToEigenMatrix(orientationOps[crystal]->getMatSymOpD(j)));
+    }
   }
 
   void probe(usize start, usize end) const
   {
+    const usize nSym = m_SymOps.size();
+    std::vector<usize> candidates;
+
     for(usize ptIdx = start; ptIdx < end; ptIdx++)
     {
       float64 c = 0.0;
       const float64 probeNormal[3] = {m_SamplePtsX[ptIdx], m_SamplePtsY[ptIdx], m_SamplePtsZ[ptIdx]};
+      const Eigen::Vector3d probeVector = {probeNormal[0], probeNormal[1], probeNormal[2]};
 
-      for(const auto& selectedTriangle : m_SelectedTriangles)
+      // The binned items are 2 * triangle + (0 for the first normal, 1 for the second). The candidates add the
+      // symmetry operator and inversion as ((triangle * nSym + j) * 2 + inversion) * 2 + normal and are sorted
+      // so the areas are summed in the same order as a full sweep.
+      candidates.clear();
+      for(usize j = 0; j < nSym; j++)
       {
-        const Eigen::Vector3d normal1 = {selectedTriangle.NormalGrain1X, selectedTriangle.NormalGrain1Y, selectedTriangle.NormalGrain1Z};
-        const Eigen::Vector3d normal2 = {selectedTriangle.NormalGrain2X, selectedTriangle.NormalGrain2Y, selectedTriangle.NormalGrain2Z};
+        const Eigen::Vector3d symProbe = m_SymOps[j].transpose() * probeVector;
+        for(usize inversion = 0; inversion <= 1; inversion++)
+        {
+          const float64 sign = inversion == 0 ? 1.0 : -1.0;
+          m_NormalBins.forEachCandidate(sign * symProbe[0], sign * symProbe[1], sign * symProbe[2], m_LimitDist, [&candidates, nSym, j, inversion](usize item) {
+            candidates.push_back((((item / 2) * nSym + j) * 2 + inversion) * 2 + item % 2);
+          });
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+
+      for(const usize candidate : candidates)
+      {
+        const usize which = candidate % 2;
+        const usize inversion = (candidate / 2) % 2;
+        const usize j = (candidate / 4) % nSym;
+        const auto& selectedTriangle = m_SelectedTriangles[candidate / 4 / nSym];
+
+        Eigen::Vector3d normal = {selectedTriangle.NormalGrain1X, selectedTriangle.NormalGrain1Y, selectedTriangle.NormalGrain1Z};
+        if(which == 1)
+        {
+          normal = {selectedTriangle.NormalGrain2X, selectedTriangle.NormalGrain2Y, selectedTriangle.NormalGrain2Z};
+        }
+        Eigen::Vector3d symNormal = m_SymOps[j] * normal;
+
+        float64 sign = 1.0f;
+        if(inversion == 1)
+        {
+          sign = -1.0f;
+        }
 
-        for(int32 j = 0; j < m_NSym; j++)
+        const float64 gamma = std::acos(sign * (probeNormal[0] * symNormal[0] + probeNormal[1] * symNormal[1] + probeNormal[2] * symNormal[2]));
+        if(gamma < m_LimitDist)
         {
-          const Matrix3dR sym = EbsdLibMatrixToEigenMatrix(m_OrientationOps[m_Crystal]->getMatSymOpD(j));
-
-          Eigen::Vector3d symNormal1 = sym * normal1;
-          Eigen::Vector3d symNormal2 = sym * normal2;
-
-          for(int32 inversion = 0; inversion <= 1; inversion++)
-          {
-            float64 sign = 1.0f;
-            if(inversion == 1)
-            {
-              sign = -1.0f;
-            }
-
-            const float64 gamma1 = std::acos(sign * (probeNormal[0] * symNormal1[0] + probeNormal[1] * symNormal1[1] + probeNormal[2] * symNormal1[2]));
-            const float64 gamma2 = std::acos(sign * (probeNormal[0] * symNormal2[0] + probeNormal[1] * symNormal2[1] + probeNormal[2] * symNormal2[2]));
-
-            if(gamma1 < m_LimitDist)
-            {
-              // Kahan summation algorithm
-              const float64 y = selectedTriangle.Area - c;
-              const float64 t = m_DistributionValues[ptIdx] + y;
-              c = (t - m_DistributionValues[ptIdx]) - y;
-              m_DistributionValues[ptIdx] = t;
-            }
-            if(gamma2 < m_LimitDist)
-            {
-              const float64 y = selectedTriangle.Area - c;
-              const float64 t = m_DistributionValues[ptIdx] + y;
-              c = (t - m_DistributionValues[ptIdx]) - y;
-              m_DistributionValues[ptIdx] = t;
-            }
-          }
+          // Kahan summation algorithm
+          const float64 y = selectedTriangle.Area - c;
+          const float64 t = m_DistributionValues[ptIdx] + y;
+          c = (t - m_DistributionValues[ptIdx]) - y;
+          m_DistributionValues[ptIdx] = t;
         }
       }
       m_ErrorValues[ptIdx] = sqrt(m_DistributionValues[ptIdx] / m_TotalFaceArea / static_cast<float64>(m_NumDistinctGBs)) / m_BallVolume;
@@ -262,21 +278,20 @@ public:
 private:
   std::vector<float64>& m_DistributionValues;
   std::vector<float64>& m_ErrorValues;
-  std::vector<float64> m_SamplePtsX;
-  std::vector<float64> m_SamplePtsY;
-  std::vector<float64> m_SamplePtsZ;
+  const std::vector<float64>& m_SamplePtsX;
+  const std::vector<float64>& m_SamplePtsY;
+  const std::vector<float64>& m_SamplePtsZ;
 #ifdef SIMPLNX_ENABLE_MULTICORE
   const tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
 #else
   const std::vector<TriAreaAndNormals>& m_SelectedTriangles;
 #endif
+  const SphereBins& m_NormalBins;
   float64 m_LimitDist;
   float64 m_TotalFaceArea;
   int32 m_NumDistinctGBs;
   float64 m_BallVolume;
-  LaueOpsContainerType m_OrientationOps;
-  uint32 m_Crystal;
-  int32 m_NSym;
+  std::vector<Matrix3dR> m_SymOps;
 };
 
 } // namespace gbpd_metric_based
@@ -629,6 +644,16 @@ Result<> ComputeGBPDMetricBased::operator()()
   std::vector<float64> distributionValues(samplePtsX.size(), 0.0);
   std::vector<float64> errorValues(samplePtsX.size(), 0.0);
 
+  // Bin both normals of every selected triangle so each sampling point only tests the nearby normals
+  const SphereBins normalBins = SphereBins::Create(limitDist, 2 * selectedTriangles.size(), [&selectedTriangles](usize item) {
+    const auto& selectedTriangle = selectedTriangles[item / 2];
+    if(item % 2 == 0)
+    {
+      return std::array<float64, 3>{selectedTriangle.NormalGrain1X, selectedTriangle.NormalGrain1Y, selectedTriangle.NormalGrain1Z};
+    }
+    return std::array<float64, 3>{selectedTriangle.NormalGrain2X, selectedTriangle.NormalGrain2Y, selectedTriangle.NormalGrain2Z};
+  });
+
   usize pointsChunkSize = 20;
   if(samplePtsX.size() < pointsChunkSize)
   {
@@ -649,8 +674,8 @@ Result<> ComputeGBPDMetricBased::operator()()
 
     ParallelDataAlgorithm dataAlg;
     dataAlg.setRange(i, i + pointsChunkSize);
-    dataAlg.execute(
-        gbpd_metric_based::ProbeDistribution(distributionValues, errorValues, samplePtsX, samplePtsY, samplePtsZ, selectedTriangles, limitDist, totalFaceArea, numDistinctGBs, ballVolume, crystal));
+    dataAlg.execute(gbpd_metric_based::ProbeDistribution(distributionValues, errorValues, samplePtsX, samplePtsY, samplePtsZ, selectedTriangles, normalBins, limitDist, totalFaceArea, numDistinctGBs,
+                                                         ballVolume, crystal));
   }
 
   // ------------------------------------------- writing the output --------------------------------
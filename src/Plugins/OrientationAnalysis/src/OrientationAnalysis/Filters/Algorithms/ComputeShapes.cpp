@@ -5,6 +5,7 @@
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/FeatureReduction.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
@@ -89,6 +90,15 @@ std::array<size_t, 3> TripletSort(T a, T b, T c, bool lowToHigh)
   return idx;
 }
 
+/**
+ * @brief Second order moment sums and voxel count of a single feature.
+ */
+struct FeatureMomentSums
+{
+  std::array<double, 6> moments = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  float volume = 0.0f;
+};
+
 } // namespace
 using namespace nx::core;
 
@@ -139,13 +149,21 @@ Result<> ComputeShapes::operator()()
 
   if(imageGeom.getNumXCells() > 1 && imageGeom.getNumYCells() > 1 && imageGeom.getNumZCells() > 1)
   {
-    find_moments();
+    Result<> result = find_moments();
+    if(result.invalid() || m_ShouldCancel)
+    {
+      return result;
+    }
     find_axes();
     find_axiseulers();
   }
   if(imageGeom.getNumXCells() == 1 || imageGeom.getNumYCells() == 1 || imageGeom.getNumZCells() == 1)
   {
-    find_moments2D();
+    Result<> result = find_moments2D();
+    if(result.invalid() || m_ShouldCancel)
+    {
+      return result;
+    }
     find_axes2D();
     find_axiseulers2D();
   }
@@ -154,7 +172,7 @@ Result<> ComputeShapes::operator()()
 }
 
 // -----------------------------------------------------------------------------
-void ComputeShapes::find_moments()
+Result<> ComputeShapes::find_moments()
 {
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
@@ -169,11 +187,9 @@ void ComputeShapes::find_moments()
   float u110 = 0.0f;
   float u011 = 0.0f;
   float u101 = 0.0f;
-  float xx = 0.0f, yy = 0.0f, zz = 0.0f, xy = 0.0f, xz = 0.0f, yz = 0.0f;
 
   size_t xPoints = imageGeom.getNumXCells();
   size_t yPoints = imageGeom.getNumYCells();
-  size_t zPoints = imageGeom.getNumZCells();
   FloatVec3 spacing = imageGeom.getSpacing();
   FloatVec3 origin = imageGeom.getOrigin();
 
@@ -185,80 +201,89 @@ void ComputeShapes::find_moments()
 
   size_t numfeatures = centroids.getNumberOfTuples();
 
-  float x = 0.0f, y = 0.0f, z = 0.0f, x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f, z1 = 0.0f, z2 = 0.0f;
-  float xdist1 = 0.0f, xdist2 = 0.0f, xdist3 = 0.0f, xdist4 = 0.0f, xdist5 = 0.0f, xdist6 = 0.0f, xdist7 = 0.0f, xdist8 = 0.0f;
-  float ydist1 = 0.0f, ydist2 = 0.0f, ydist3 = 0.0f, ydist4 = 0.0f, ydist5 = 0.0f, ydist6 = 0.0f, ydist7 = 0.0f, ydist8 = 0.0f;
-  float zdist1 = 0.0f, zdist2 = 0.0f, zdist3 = 0.0f, zdist4 = 0.0f, zdist5 = 0.0f, zdist6 = 0.0f, zdist7 = 0.0f, zdist8 = 0.0f;
-  size_t zStride = 0, yStride = 0;
-  for(size_t i = 0; i < zPoints; i++)
+  const float scaleFactor = static_cast<float>(m_ScaleFactor);
+
+  FeatureReduction<FeatureMomentSums> featureReduction(featureIds.getDataStoreRef(), numfeatures, FeatureMomentSums{});
+  featureReduction.requireArraysInMemory({&featureIds, &centroids});
+  auto reductionResult = featureReduction.executeInElementOrder(
+      [&](FeatureMomentSums& featureSums, usize gnum, usize voxelIndex) {
+        const usize k = voxelIndex % xPoints;
+        const usize j = (voxelIndex / xPoints) % yPoints;
+        const usize i = voxelIndex / (xPoints * yPoints);
+        const float x = float(k * modXRes) + (origin[0] * scaleFactor);
+        const float y = float(j * modYRes) + (origin[1] * scaleFactor);
+        const float z = float(i * modZRes) + (origin[2] * scaleFactor);
+        const float x1 = x + (modXRes / 4.0f);
+        const float x2 = x - (modXRes / 4.0f);
+        const float y1 = y + (modYRes / 4.0f);
+        const float y2 = y - (modYRes / 4.0f);
+        const float z1 = z + (modZRes / 4.0f);
+        const float z2 = z - (modZRes / 4.0f);
+        const float xdist1 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist1 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist1 = (z1 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist2 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist2 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist2 = (z2 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist3 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist3 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist3 = (z1 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist4 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist4 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist4 = (z2 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist5 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist5 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist5 = (z1 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist6 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist6 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist6 = (z2 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist7 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist7 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist7 = (z1 - (centroids[gnum * 3 + 2] * scaleFactor));
+        const float xdist8 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        const float ydist8 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        const float zdist8 = (z2 - (centroids[gnum * 3 + 2] * scaleFactor));
+
+        const float xx = ((ydist1) * (ydist1)) + ((zdist1) * (zdist1)) + ((ydist2) * (ydist2)) + ((zdist2) * (zdist2)) + ((ydist3) * (ydist3)) + ((zdist3) * (zdist3)) + ((ydist4) * (ydist4)) +
+                         ((zdist4) * (zdist4)) + ((ydist5) * (ydist5)) + ((zdist5) * (zdist5)) + ((ydist6) * (ydist6)) + ((zdist6) * (zdist6)) + ((ydist7) * (ydist7)) + ((zdist7) * (zdist7)) +
+                         ((ydist8) * (ydist8)) + ((zdist8) * (zdist8));
+        const float yy = ((xdist1) * (xdist1)) + ((zdist1) * (zdist1)) + ((xdist2) * (xdist2)) + ((zdist2) * (zdist2)) + ((xdist3) * (xdist3)) + ((zdist3) * (zdist3)) + ((xdist4) * (xdist4)) +
+                         ((zdist4) * (zdist4)) + ((xdist5) * (xdist5)) + ((zdist5) * (zdist5)) + ((xdist6) * (xdist6)) + ((zdist6) * (zdist6)) + ((xdist7) * (xdist7)) + ((zdist7) * (zdist7)) +
+                         ((xdist8) * (xdist8)) + ((zdist8) * (zdist8));
+        const float zz = ((xdist1) * (xdist1)) + ((ydist1) * (ydist1)) + ((xdist2) * (xdist2)) + ((ydist2) * (ydist2)) + ((xdist3) * (xdist3)) + ((ydist3) * (ydist3)) + ((xdist4) * (xdist4)) +
+                         ((ydist4) * (ydist4)) + ((xdist5) * (xdist5)) + ((ydist5) * (ydist5)) + ((xdist6) * (xdist6)) + ((ydist6) * (ydist6)) + ((xdist7) * (xdist7)) + ((ydist7) * (ydist7)) +
+                         ((xdist8) * (xdist8)) + ((ydist8) * (ydist8));
+        const float xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4)) + ((xdist5) * (ydist5)) + ((xdist6) * (ydist6)) + ((xdist7) * (ydist7)) +
+                         ((xdist8) * (ydist8));
+        const float yz = ((ydist1) * (zdist1)) + ((ydist2) * (zdist2)) + ((ydist3) * (zdist3)) + ((ydist4) * (zdist4)) + ((ydist5) * (zdist5)) + ((ydist6) * (zdist6)) + ((ydist7) * (zdist7)) +
+                         ((ydist8) * (zdist8));
+        const float xz = ((xdist1) * (zdist1)) + ((xdist2) * (zdist2)) + ((xdist3) * (zdist3)) + ((xdist4) * (zdist4)) + ((xdist5) * (zdist5)) + ((xdist6) * (zdist6)) + ((xdist7) * (zdist7)) +
+                         ((xdist8) * (zdist8));
+
+        featureSums.moments[0] += static_cast<double>(xx);
+        featureSums.moments[1] += static_cast<double>(yy);
+        featureSums.moments[2] += static_cast<double>(zz);
+        featureSums.moments[3] += static_cast<double>(xy);
+        featureSums.moments[4] += static_cast<double>(yz);
+        featureSums.moments[5] += static_cast<double>(xz);
+        featureSums.volume += 1.0f;
+      },
+      m_ShouldCancel);
+  if(reductionResult.invalid())
   {
-    zStride = i * xPoints * yPoints;
-    for(size_t j = 0; j < yPoints; j++)
-    {
-      yStride = j * xPoints;
-      for(size_t k = 0; k < xPoints; k++)
-      {
-        int32_t gnum = featureIds[zStride + yStride + k];
-        x = float(k * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-        y = float(j * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-        z = float(i * modZRes) + (origin[2] * static_cast<float>(m_ScaleFactor));
-        x1 = x + (modXRes / 4.0f);
-        x2 = x - (modXRes / 4.0f);
-        y1 = y + (modYRes / 4.0f);
-        y2 = y - (modYRes / 4.0f);
-        z1 = z + (modZRes / 4.0f);
-        z2 = z - (modZRes / 4.0f);
-        xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist1 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist2 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist2 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist3 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist3 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist3 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist4 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist4 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist5 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist5 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist5 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist6 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist6 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist6 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist7 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist7 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist7 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist8 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist8 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist8 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-
-        xx = ((ydist1) * (ydist1)) + ((zdist1) * (zdist1)) + ((ydist2) * (ydist2)) + ((zdist2) * (zdist2)) + ((ydist3) * (ydist3)) + ((zdist3) * (zdist3)) + ((ydist4) * (ydist4)) +
-             ((zdist4) * (zdist4)) + ((ydist5) * (ydist5)) + ((zdist5) * (zdist5)) + ((ydist6) * (ydist6)) + ((zdist6) * (zdist6)) + ((ydist7) * (ydist7)) + ((zdist7) * (zdist7)) +
-             ((ydist8) * (ydist8)) + ((zdist8) * (zdist8));
-        yy = ((xdist1) * (xdist1)) + ((zdist1) * (zdist1)) + ((xdist2) * (xdist2)) + ((zdist2) * (zdist2)) + ((xdist3) * (xdist3)) + ((zdist3) * (zdist3)) + ((xdist4) * (xdist4)) +
-             ((zdist4) * (zdist4)) + ((xdist5) * (xdist5)) + ((zdist5) * (zdist5)) + ((xdist6) * (xdist6)) + ((zdist6) * (zdist6)) + ((xdist7) * (xdist7)) + ((zdist7) * (zdist7)) +
-             ((xdist8) * (xdist8)) + ((zdist8) * (zdist8));
-        zz = ((xdist1) * (xdist1)) + ((ydist1) * (ydist1)) + ((xdist2) * (xdist2)) + ((ydist2) * (ydist2)) + ((xdist3) * (xdist3)) + ((ydist3) * (ydist3)) + ((xdist4) * (xdist4)) +
-             ((ydist4) * (ydist4)) + ((xdist5) * (xdist5)) + ((ydist5) * (ydist5)) + ((xdist6) * (xdist6)) + ((ydist6) * (ydist6)) + ((xdist7) * (xdist7)) + ((ydist7) * (ydist7)) +
-             ((xdist8) * (xdist8)) + ((ydist8) * (ydist8));
-        xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4)) + ((xdist5) * (ydist5)) + ((xdist6) * (ydist6)) + ((xdist7) * (ydist7)) +
-             ((xdist8) * (ydist8));
-        yz = ((ydist1) * (zdist1)) + ((ydist2) * (zdist2)) + ((ydist3) * (zdist3)) + ((ydist4) * (zdist4)) + ((ydist5) * (zdist5)) + ((ydist6) * (zdist6)) + ((ydist7) * (zdist7)) +
-             ((ydist8) * (zdist8));
-        xz = ((xdist1) * (zdist1)) + ((xdist2) * (zdist2)) + ((xdist3) * (zdist3)) + ((xdist4) * (zdist4)) + ((xdist5) * (zdist5)) + ((xdist6) * (zdist6)) + ((xdist7) * (zdist7)) +
-             ((xdist8) * (zdist8));
-
-        m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + static_cast<double>(xx);
-        m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + static_cast<double>(yy);
-        m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + static_cast<double>(zz);
-        m_FeatureMoments[gnum * 6 + 3] = m_FeatureMoments[gnum * 6 + 3] + static_cast<double>(xy);
-        m_FeatureMoments[gnum * 6 + 4] = m_FeatureMoments[gnum * 6 + 4] + static_cast<double>(yz);
-        m_FeatureMoments[gnum * 6 + 5] = m_FeatureMoments[gnum * 6 + 5] + static_cast<double>(xz);
-        volumes[gnum] = volumes[gnum] + 1.0;
-      }
-    }
+    return ConvertResult(std::move(reductionResult));
   }
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+  const std::vector<FeatureMomentSums>& featureSums = reductionResult.value();
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
+  {
+    std::copy(featureSums[featureId].moments.cbegin(), featureSums[featureId].moments.cend(), m_FeatureMoments.begin() + featureId * 6);
+    volumes[featureId] = volumes[featureId] + featureSums[featureId].volume;
+  }
+
   double sphere = (2000.0 * M_PI * M_PI) / 9.0;
   // constant for moments because voxels are broken into smaller voxels
   double konst1 = static_cast<double>((modXRes / 2.0) * (modYRes / 2.0) * (modZRes / 2.0));
@@ -335,12 +360,13 @@ void ComputeShapes::find_moments()
     }
     omega3s[featureId] = static_cast<float>(omega3);
   }
+  return {};
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ComputeShapes::find_moments2D()
+Result<> ComputeShapes::find_moments2D()
 {
 
   const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
@@ -349,7 +375,6 @@ void ComputeShapes::find_moments2D()
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
-  float xx = 0.0f, yy = 0.0f, xy = 0.0f;
   size_t numfeatures = centroids.getNumberOfTuples();
 
   size_t xPoints = 0, yPoints = 0;
@@ -379,41 +404,52 @@ void ComputeShapes::find_moments2D()
 
   FloatVec3 origin = imageGeom.getOrigin();
 
-  for(size_t featureId = 0; featureId < 6 * numfeatures; featureId++)
+  const float scaleFactor = static_cast<float>(m_ScaleFactor);
+
+  FeatureReduction<FeatureMomentSums> featureReduction(featureIds.getDataStoreRef(), numfeatures, FeatureMomentSums{});
+  featureReduction.requireArraysInMemory({&featureIds, &centroids});
+  auto reductionResult = featureReduction.executeInElementOrder(
+      [&](FeatureMomentSums& featureSums, usize gnum, usize pixelIndex) {
+        const usize xPoint = pixelIndex % xPoints;
+        const usize yPoint = pixelIndex / xPoints;
+        float x = static_cast<float>(xPoint * modXRes) + (origin[0] * scaleFactor);
+        float y = static_cast<float>(yPoint * modYRes) + (origin[1] * scaleFactor);
+        float x1 = x + (modXRes / 4.0f);
+        float x2 = x - (modXRes / 4.0f);
+        float y1 = y + (modYRes / 4.0f);
+        float y2 = y - (modYRes / 4.0f);
+        float xdist1 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        float ydist1 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        float xdist2 = (x1 - (centroids[gnum * 3 + 0] * scaleFactor));
+        float ydist2 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        float xdist3 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        float ydist3 = (y1 - (centroids[gnum * 3 + 1] * scaleFactor));
+        float xdist4 = (x2 - (centroids[gnum * 3 + 0] * scaleFactor));
+        float ydist4 = (y2 - (centroids[gnum * 3 + 1] * scaleFactor));
+        float xx = ((ydist1) * (ydist1)) + ((ydist2) * (ydist2)) + ((ydist3) * (ydist3)) + ((ydist4) * (ydist4));
+        float yy = ((xdist1) * (xdist1)) + ((xdist2) * (xdist2)) + ((xdist3) * (xdist3)) + ((xdist4) * (xdist4));
+        float xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4));
+        featureSums.moments[0] += xx;
+        featureSums.moments[1] += yy;
+        featureSums.moments[2] += xy;
+        featureSums.volume += 1.0f;
+      },
+      m_ShouldCancel);
+  if(reductionResult.invalid())
   {
-    m_FeatureMoments[featureId] = 0.0;
+    return ConvertResult(std::move(reductionResult));
   }
-
-  size_t yStride = 0;
-  for(size_t yPoint = 0; yPoint < yPoints; yPoint++)
+  if(m_ShouldCancel)
   {
-    yStride = yPoint * xPoints;
-    for(size_t xPoint = 0; xPoint < xPoints; xPoint++)
-    {
-      int32_t gnum = featureIds[yStride + xPoint];
-      float x = static_cast<float>(xPoint * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-      float y = static_cast<float>(yPoint * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-      float x1 = x + (modXRes / 4.0f);
-      float x2 = x - (modXRes / 4.0f);
-      float y1 = y + (modYRes / 4.0f);
-      float y2 = y - (modYRes / 4.0f);
-      float xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist2 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist3 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist3 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist4 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      xx = ((ydist1) * (ydist1)) + ((ydist2) * (ydist2)) + ((ydist3) * (ydist3)) + ((ydist4) * (ydist4));
-      yy = ((xdist1) * (xdist1)) + ((xdist2) * (xdist2)) + ((xdist3) * (xdist3)) + ((xdist4) * (xdist4));
-      xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4));
-      m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + xx;
-      m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + yy;
-      m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + xy;
-      volumes[gnum] = volumes[gnum] + 1.0;
-    }
+    return {};
+  }
+  const std::vector<FeatureMomentSums>& featureSums = reductionResult.value();
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
+  {
+    std::copy(featureSums[featureId].moments.cbegin(), featureSums[featureId].moments.cend(), m_FeatureMoments.begin() + featureId * 6);
+    volumes[featureId] = volumes[featureId] + featureSums[featureId].volume;
   }
+
   double konst1 = static_cast<double>((modXRes / 2.0f) * (modYRes / 2.0f));
   double konst2 = static_cast<double>(spacing[0] * spacing[1]);
   for(size_t featureId = 1; featureId < numfeatures; featureId++)
@@ -427,6 +463,7 @@ void ComputeShapes::find_moments2D()
     m_FeatureMoments[featureId * 6 + 1] = m_FeatureMoments[featureId * 6 + 1] * konst1;  // u02
     m_FeatureMoments[featureId * 6 + 2] = -m_FeatureMoments[featureId * 6 + 2] * konst1; // u11
   }
+  return {};
 }
 
 // -----------------------------------------------------------------------------
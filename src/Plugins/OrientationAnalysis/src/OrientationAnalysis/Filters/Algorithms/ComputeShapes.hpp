@@ -56,12 +56,12 @@ private:
   /**
    * @brief find_moments Determines the second order moments for each Feature
    */
-  void find_moments();
+  Result<> find_moments();
 
   /**
    * @brief find_moments2D Determines the second order moments for each Feature (2D version)
    */
-  void find_moments2D();
+  Result<> find_moments2D();
 
   /**
    * @brief find_axes Determine principal axis lengths for each Feature
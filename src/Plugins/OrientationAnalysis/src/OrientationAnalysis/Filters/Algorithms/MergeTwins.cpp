@@ -4,106 +4,153 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/FeatureGrouping.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/EbsdLibConstants.h"
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 
+#include <atomic>
 #include <random>
 
 using namespace nx::core;
 
-// -----------------------------------------------------------------------------
-MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
-: m_DataStructure(dataStructure)
-, m_InputValues(inputValues)
-, m_ShouldCancel(shouldCancel)
-, m_MessageHandler(mesgHandler)
+namespace
 {
-  m_OrientationOps = LaueOps::GetAllOrientationOps();
-}
+/**
+ * @brief Tests whether two neighboring features are in a Sigma 3 twin relationship, which is a 60 degree
+ * misorientation about a <111> axis. Only m3m features are compared and feature 0 is never merged.
+ */
+class TwinPredicate
+{
+public:
+  TwinPredicate(const Int32AbstractDataStore& phases, const UInt32AbstractDataStore& crystalStructures, const Float32AbstractDataStore& avgQuats, const std::vector<LaueOps::Pointer>& orientationOps,
+                float32 axisTolerance, float32 angleTolerance)
+  : m_Phases(phases)
+  , m_CrystalStructures(crystalStructures)
+  , m_AvgQuats(avgQuats)
+  , m_OrientationOps(orientationOps)
+  , m_AxisToleranceRad(axisTolerance * numbers::pi_v<float32> / 180.0f)
+  , m_AngleTolerance(angleTolerance)
+  {
+  }
 
-// -----------------------------------------------------------------------------
-MergeTwins::~MergeTwins() noexcept = default;
+  bool operator()(int32 referenceFeature, int32 neighborFeature) const
+  {
+    if(referenceFeature == 0 || neighborFeature == 0 || m_Phases[referenceFeature] <= 0 || m_Phases[neighborFeature] <= 0)
+    {
+      return false;
+    }
 
-// -----------------------------------------------------------------------------
-int MergeTwins::getSeed(int32 newFid) const
-{
-  auto& phases = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath)->getDataStoreRef();
-  auto& featureParentIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureParentIdsArrayPath)->getDataStoreRef();
-  auto& cellFeaturesAttMatrix = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->NewCellFeatureAttributeMatrixPath);
+    const uint32 phase1 = m_CrystalStructures[m_Phases[referenceFeature]];
+    const uint32 phase2 = m_CrystalStructures[m_Phases[neighborFeature]];
+    if(phase1 != phase2 || phase1 != EbsdLib::CrystalStructure::Cubic_High)
+    {
+      return false;
+    }
 
-  auto numFeatures = static_cast<int32>(phases.getNumberOfTuples());
+    QuatF q1(m_AvgQuats[referenceFeature * 4], m_AvgQuats[referenceFeature * 4 + 1], m_AvgQuats[referenceFeature * 4 + 2], m_AvgQuats[referenceFeature * 4 + 3]);
+    QuatF q2(m_AvgQuats[neighborFeature * 4], m_AvgQuats[neighborFeature * 4 + 1], m_AvgQuats[neighborFeature * 4 + 2], m_AvgQuats[neighborFeature * 4 + 3]);
 
-  int32 seed = -1;
+    OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+    double w = axisAngle[3];
+    w *= (180.0f / numbers::pi);
+    double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
+    double angDiff60 = std::fabs(w - 60.0f);
+    return axisDiff111 < m_AxisToleranceRad && angDiff60 < m_AngleTolerance;
+  }
 
-  // Precalculate some constants
-  int32 totalFMinus1 = numFeatures - 1;
+private:
+  const Int32AbstractDataStore& m_Phases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  float32 m_AxisToleranceRad = 0.0f;
+  float32 m_AngleTolerance = 0.0f;
+};
 
-  usize counter = 0;
-  std::mt19937_64 generator(m_InputValues->Seed); // Standard mersenne_twister_engine seeded
-  std::uniform_real_distribution<float32> distribution(0, 1);
-  auto randFeature = static_cast<int32>(distribution(generator) * static_cast<float32>(totalFMinus1));
-  while(seed == -1 && counter < numFeatures)
+/**
+ * @brief Flags every feature that is the Feature Id of at least one cell.
+ */
+class MarkFeaturesInUseImpl
+{
+public:
+  MarkFeaturesInUseImpl(const Int32AbstractDataStore& featureIds, std::vector<uint8>& featureInUse)
+  : m_FeatureIds(featureIds)
+  , m_FeatureInUse(featureInUse)
   {
-    if(randFeature > totalFMinus1)
-    {
-      randFeature = randFeature - numFeatures;
-    }
-    if(featureParentIds[randFeature] == -1)
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize cellIndex = range.min(); cellIndex < range.max(); cellIndex++)
     {
-      seed = randFeature;
+      // Every thread stores the same value, so the relaxed atomic store only guards against torn writes
+      std::atomic_ref<uint8>(m_FeatureInUse[m_FeatureIds[cellIndex]]).store(1, std::memory_order_relaxed);
     }
-    randFeature++;
-    counter++;
   }
-  if(seed >= 0)
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  std::vector<uint8>& m_FeatureInUse;
+};
+
+/**
+ * @brief Sets the parent of every cell to the shuffled parent of its feature.
+ */
+class RelabelCellsImpl
+{
+public:
+  RelabelCellsImpl(const Int32AbstractDataStore& featureIds, const Int32AbstractDataStore& featureParentIds, const std::vector<int32>& parentIds, Int32AbstractDataStore& cellParentIds)
+  : m_FeatureIds(featureIds)
+  , m_FeatureParentIds(featureParentIds)
+  , m_ParentIds(parentIds)
+  , m_CellParentIds(cellParentIds)
   {
-    featureParentIds[seed] = newFid;
-    std::vector<usize> tDims(1, newFid + 1);
-    cellFeaturesAttMatrix.resizeTuples(tDims); // this will resize the active array as well
   }
-  return seed;
-}
+
+  void operator()(const Range& range) const
+  {
+    for(usize cellIndex = range.min(); cellIndex < range.max(); cellIndex++)
+    {
+      m_CellParentIds[cellIndex] = m_ParentIds[m_FeatureParentIds[m_FeatureIds[cellIndex]]];
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const Int32AbstractDataStore& m_FeatureParentIds;
+  const std::vector<int32>& m_ParentIds;
+  Int32AbstractDataStore& m_CellParentIds;
+};
+} // namespace
 
 // -----------------------------------------------------------------------------
-bool MergeTwins::determineGrouping(int32 referenceFeature, int32 neighborFeature, int32 newFid)
+MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
 {
-  auto& phases = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath)->getDataStoreRef();
-  auto& featureParentIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureParentIdsArrayPath)->getDataStoreRef();
-  auto& crystalStructures = m_DataStructure.getDataAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath)->getDataStoreRef();
-  auto& avgQuats = m_DataStructure.getDataAs<Float32Array>(m_InputValues->AvgQuatsArrayPath)->getDataStoreRef();
-  auto axisToleranceRad = m_InputValues->AxisTolerance * numbers::pi_v<float32> / 180.0f;
+  m_OrientationOps = LaueOps::GetAllOrientationOps();
+}
 
-  bool twin = false;
+// -----------------------------------------------------------------------------
+MergeTwins::~MergeTwins() noexcept = default;
 
-  if(featureParentIds[neighborFeature] == -1 && phases[referenceFeature] > 0 && phases[neighborFeature] > 0)
+// -----------------------------------------------------------------------------
+usize MergeTwins::getSeedFeature(usize numFeatures) const
+{
+  if(numFeatures == 0)
   {
-    uint32 phase1 = crystalStructures[phases[referenceFeature]];
-
-    QuatF q1(avgQuats[referenceFeature * 4], avgQuats[referenceFeature * 4 + 1], avgQuats[referenceFeature * 4 + 2], avgQuats[referenceFeature * 4 + 3]);
-    QuatF q2(avgQuats[neighborFeature * 4], avgQuats[neighborFeature * 4 + 1], avgQuats[neighborFeature * 4 + 2], avgQuats[neighborFeature * 4 + 3]);
-
-    uint32 phase2 = crystalStructures[phases[neighborFeature]];
-    if(phase1 == phase2 && (phase1 == EbsdLib::CrystalStructure::Cubic_High))
-    {
-      OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      double w = axisAngle[3];
-      w *= (180.0f / numbers::pi);
-      double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
-      double angDiff60 = std::fabs(w - 60.0f);
-      if(axisDiff111 < axisToleranceRad && angDiff60 < m_InputValues->AngleTolerance)
-      {
-        twin = true;
-      }
-      if(twin)
-      {
-        featureParentIds[neighborFeature] = newFid;
-        return true;
-      }
-    }
+    return 0;
   }
-  return false;
+  // Parents are numbered in the order their features are met when scanning from this feature
+  std::mt19937_64 generator(m_InputValues->Seed); // Standard mersenne_twister_engine seeded
+  std::uniform_real_distribution<float32> distribution(0, 1);
+  auto randFeature = static_cast<int32>(distribution(generator) * static_cast<float32>(numFeatures - 1));
+  return static_cast<usize>(randFeature) % numFeatures;
 }
 
 // -----------------------------------------------------------------------------
@@ -134,33 +181,32 @@ Result<> MergeTwins::operator()()
   featureParentIds[0] = 0; // set feature 0 to be parent 0
 
   { // This code used to be in GroupFeatures Superclass
-    auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
+    const auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
+    const auto& phasesArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
+    const auto& avgQuatsArray = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
+    const auto& crystalStructuresArray = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
+    const usize numFeatures = phasesArray.getNumberOfTuples();
 
-    int32 parentCount = 1;
-    int32 seed = getSeed(parentCount);
-    int32 neigh;
-    while(seed >= 0)
+    // Every twin pair is tested once in parallel and the twins are merged into parents with a union-find
+    const TwinPredicate isTwin(phasesArray.getDataStoreRef(), crystalStructuresArray.getDataStoreRef(), avgQuatsArray.getDataStoreRef(), m_OrientationOps, m_InputValues->AxisTolerance,
+                               m_InputValues->AngleTolerance);
+    FeatureGrouping featureGrouping(contNeighborList, numFeatures);
+    featureGrouping.requireArraysInMemory({&phasesArray, &avgQuatsArray, &crystalStructuresArray});
+    Result<std::vector<int32>> groupsResult = featureGrouping.execute(isTwin, m_ShouldCancel);
+    if(groupsResult.invalid())
     {
-      std::vector<int32> groupList = {seed};
-      for(std::vector<int32>::size_type j = 0; j < groupList.size(); j++)
-      {
-        int32 firstFeature = groupList[j];
-        auto list1size = static_cast<int32>(contNeighborList[firstFeature].size());
-        for(int32 l = 0; l < list1size; l++)
-        {
-          neigh = contNeighborList[firstFeature][l];
-          if(neigh != firstFeature)
-          {
-            if(determineGrouping(firstFeature, neigh, parentCount))
-            {
-              groupList.push_back(neigh);
-            }
-          }
-        }
-      }
+      return MergeResults(result, ConvertResult(std::move(groupsResult)));
+    }
+    if(m_ShouldCancel)
+    {
+      return result;
+    }
 
-      parentCount++;
-      seed = getSeed(parentCount);
+    const int32 parentCount = FeatureGrouping::LabelGroups(groupsResult.value(), getSeedFeature(numFeatures), 1, featureParentIds);
+    if(parentCount > 1)
+    {
+      auto& cellFeaturesAttMatrix = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->NewCellFeatureAttributeMatrixPath);
+      cellFeaturesAttMatrix.resizeTuples({static_cast<usize>(parentCount)}); // this will resize the active array as well
     }
   }
 
@@ -171,15 +217,22 @@ Result<> MergeTwins::operator()()
         result, ConvertResult(MakeErrorResult<OutputActions>(-23501, "The number of grouped Features was 0 or 1 which means no grouped Features were detected. A grouping value may be set too high")));
   }
 
+  // Find which features are used by the cells and the largest parent among them
+  const usize totalPoints = featureIds.getNumberOfTuples();
+  const usize numFeatures = featureParentIds.getNumberOfTuples();
+  std::vector<uint8> featureInUse(numFeatures, 0);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.requireArraysInMemory({m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)});
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.execute(MarkFeaturesInUseImpl(featureIds, featureInUse));
+  }
   int32 numParents = 0;
-  usize totalPoints = featureIds.getNumberOfTuples();
-  for(usize k = 0; k < totalPoints; k++)
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
   {
-    int32 featureName = featureIds[k];
-    cellParentIds[k] = featureParentIds[featureName];
-    if(featureParentIds[featureName] > numParents)
+    if(featureInUse[featureId] != 0 && featureParentIds[featureId] > numParents)
     {
-      numParents = featureParentIds[featureName];
+      numParents = featureParentIds[featureId];
     }
   }
   numParents += 1;
@@ -210,10 +263,19 @@ Result<> MergeTwins::operator()()
 
     m_MessageHandler({IFilter::Message::Type::Info, "Adjusting Feature Ids Array...."});
     // Now adjust all the Feature ID values for each Voxel
-    for(usize i = 0; i < totalPoints; ++i)
     {
-      cellParentIds[i] = parentIds[cellParentIds[i]];
-      featureParentIds[featureIds[i]] = cellParentIds[i];
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.requireArraysInMemory({m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath), m_DataStructure.getDataAs<Int32Array>(m_InputValues->CellParentIdsArrayPath),
+                                     m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureParentIdsArrayPath)});
+      dataAlg.setRange(0, totalPoints);
+      dataAlg.execute(RelabelCellsImpl(featureIds, featureParentIds, parentIds, cellParentIds));
+    }
+    for(usize featureId = 0; featureId < numFeatures; featureId++)
+    {
+      if(featureInUse[featureId] != 0)
+      {
+        featureParentIds[featureId] = parentIds[featureParentIds[featureId]];
+      }
     }
   }
 
@@ -43,8 +43,7 @@ public:
 
   const std::atomic_bool& getCancel();
 
-  int getSeed(int32 newFid) const;
-  bool determineGrouping(int32 referenceFeature, int32 neighborFeature, int32 newFid);
+  usize getSeedFeature(usize numFeatures) const;
 
 private:
   DataStructure& m_DataStructure;
@@ -1,5 +1,7 @@
 #include "ReadAngData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdColumnCopy.hpp"
+
 #include "simplnx/Common/RgbColor.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
@@ -42,9 +44,7 @@ Result<> ReadAngData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return copyRawEbsdData(&reader);
 }
 
 // -----------------------------------------------------------------------------
@@ -96,82 +96,30 @@ std::pair<int32, std::string> ReadAngData::loadMaterialInfo(AngReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadAngData::copyRawEbsdData(AngReader* reader) const
+Result<> ReadAngData::copyRawEbsdData(AngReader* reader) const
 {
   const DataPath CellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
 
-  std::vector<size_t> cDims = {1};
-
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
   const size_t totalCells = imageGeom.getNumberOfCells();
 
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
+  EbsdColumnCopy columnCopy(totalCells, 0);
 
-  // Adjust the values of the 'phase' data to correct for invalid values and assign the read Phase Data into the actual DataArray
-  {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      if(phasePtr[i] < 1)
-      {
-        phasePtr[i] = 1;
-      }
-      targetArray[i] = phasePtr[i];
-    }
-  }
+  // Adjust the values of the 'phase' data to correct for invalid values
+  const auto* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
+  columnCopy.addColumn(phasePtr, m_DataStructure.getDataRefAs<Int32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases)).getDataStoreRef(),
+                       [](usize, int32 phase) { return phase < 1 ? 1 : phase; });
 
   // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
-  {
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
-    cDims[0] = 3;
-
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-    }
-  }
-
-  cDims[0] = 1;
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ImageQuality));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ImageQuality));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  const std::array<const float*, 3> eulerPtrs = {reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1)), reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi)),
+                                                 reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2))};
+  columnCopy.addComponents(eulerPtrs, m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles)).getDataStoreRef());
 
+  for(const std::string& arrayName : {EbsdLib::Ang::ImageQuality, EbsdLib::Ang::ConfidenceIndex, EbsdLib::Ang::SEMSignal, EbsdLib::Ang::Fit, EbsdLib::Ang::XPosition, EbsdLib::Ang::YPosition})
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ConfidenceIndex));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(arrayName));
+    columnCopy.addColumn(fComp0, m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(arrayName)).getDataStoreRef());
   }
 
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::SEMSignal));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::SEMSignal));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Fit));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::Fit));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::XPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::XPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::YPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::YPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return columnCopy.execute(m_ShouldCancel);
 }
@@ -84,8 +84,9 @@ private:
   /**
    * @brief
    * @param reader
+   * @return Result<>
    */
-  void copyRawEbsdData(AngReader* reader) const;
+  Result<> copyRawEbsdData(AngReader* reader) const;
 };
 
 } // namespace nx::core
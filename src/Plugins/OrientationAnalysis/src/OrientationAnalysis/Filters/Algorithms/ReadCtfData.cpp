@@ -1,5 +1,7 @@
 #include "ReadCtfData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdColumnCopy.hpp"
+
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
@@ -46,9 +48,7 @@ Result<> ReadCtfData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return copyRawEbsdData(&reader);
 }
 
 // -----------------------------------------------------------------------------
@@ -97,98 +97,54 @@ std::pair<int32, std::string> ReadCtfData::loadMaterialInfo(CtfReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadCtfData::copyRawEbsdData(CtfReader* reader) const
+Result<> ReadCtfData::copyRawEbsdData(CtfReader* reader) const
 {
   const DataPath cellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
   const DataPath cellEnsembleAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellEnsembleAttributeMatrixName);
-  std::vector<size_t> cDims = {1};
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
   const size_t totalCells = imageGeom.getNumberOfCells();
 
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
+  EbsdColumnCopy columnCopy(totalCells, 0);
 
   // Copy the Phase Array
+  const auto* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Phase));
+  columnCopy.addColumn(phasePtr, m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases)).getDataStoreRef());
+
+  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array. The phases are read from the reader
+  // since the Phase Array is being filled in the same pass.
+  const auto& crystalStructuresStore = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures)).getDataStoreRef();
+  std::vector<uint32> crystalStructures(crystalStructuresStore.getSize());
+  for(usize i = 0; i < crystalStructures.size(); i++)
   {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Phase));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      targetArray[i] = phasePtr[i];
-    }
-  }
-
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
-  {
-    auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures));
-    auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
-
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3));
-    cDims[0] = 3;
-
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-      if(crystalStructures[cellPhases[i]] == EbsdLib::CrystalStructure::Hexagonal_High && m_InputValues->EdaxHexagonalAlignment)
-      {
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + 30.0F; // See the documentation for this correction factor
-      }
-      // Now convert to radians if requested by the user
-      if(m_InputValues->DegreesToRadians)
-      {
-        cellEulerAngles[3 * i] = cellEulerAngles[3 * i] * EbsdLib::Constants::k_PiOver180F;
-        cellEulerAngles[3 * i + 1] = cellEulerAngles[3 * i + 1] * EbsdLib::Constants::k_PiOver180F;
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] * EbsdLib::Constants::k_PiOver180F;
-      }
-    }
-  }
-
-  cDims[0] = 1;
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Bands));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Bands));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    crystalStructures[i] = crystalStructuresStore[i];
   }
-
+  const bool hexagonalAlignment = m_InputValues->EdaxHexagonalAlignment;
+  const float32 degToRad = m_InputValues->DegreesToRadians ? EbsdLib::Constants::k_PiOver180F : 1.0F;
+
+  const std::array<const float*, 3> eulerPtrs = {reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1)), reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2)),
+                                                 reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3))};
+  columnCopy.addComponents(eulerPtrs, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles)).getDataStoreRef(),
+                           [&crystalStructures, phasePtr, hexagonalAlignment, degToRad](usize cellIndex, usize comp, float32 angle) {
+                             if(comp == 2 && hexagonalAlignment && crystalStructures[phasePtr[cellIndex]] == EbsdLib::CrystalStructure::Hexagonal_High)
+                             {
+                               angle = angle + 30.0F; // See the documentation for this correction factor
+                             }
+                             // Now convert to radians if requested by the user
+                             return angle * degToRad;
+                           });
+
+  for(const std::string& arrayName : {EbsdLib::Ctf::Bands, EbsdLib::Ctf::Error, EbsdLib::Ctf::BC, EbsdLib::Ctf::BS})
   {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Error));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Error));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    const auto* iComp0 = reinterpret_cast<int32*>(reader->getPointerByName(arrayName));
+    columnCopy.addColumn(iComp0, m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(arrayName)).getDataStoreRef());
   }
 
+  for(const std::string& arrayName : {EbsdLib::Ctf::MAD, EbsdLib::Ctf::X, EbsdLib::Ctf::Y})
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::MAD));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::MAD));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(arrayName));
+    columnCopy.addColumn(fComp0, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(arrayName)).getDataStoreRef());
   }
 
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BC));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BC));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BS));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BS));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::X));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::X));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Y));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Y));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return columnCopy.execute(m_ShouldCancel);
 }
@@ -89,8 +89,9 @@ private:
   /**
    * @brief
    * @param reader
+   * @return Result<>
    */
-  void copyRawEbsdData(CtfReader* reader) const;
+  Result<> copyRawEbsdData(CtfReader* reader) const;
 };
 
 } // namespace nx::core
@@ -0,0 +1,340 @@
+#include "ReadEbsdStack.hpp"
+
+#include "OrientationAnalysis/Filters/Algorithms/EbsdToH5Ebsd.hpp"
+
+#include "simplnx/Common/Numbers.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/StringArray.hpp"
+#include "simplnx/Utilities/Math/MatrixMath.hpp"
+#include "simplnx/Utilities/OrderedPipeline.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/IO/HKL/CtfFields.h"
+#include "EbsdLib/IO/HKL/CtfReader.h"
+#include "EbsdLib/IO/TSL/AngFields.h"
+#include "EbsdLib/IO/TSL/AngReader.h"
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_SliceSizeError = -60910;
+constexpr int32 k_MissingColumnError = -60911;
+constexpr int32 k_SliceCountError = -60912;
+constexpr int32 k_PhaseInfoError = -60913;
+
+/**
+ * @brief The slice data that travels through the pipeline. The reader fills the phases and the Euler angles
+ * straight from the file, the conversion stage corrects them in place and computes the quaternions.
+ */
+struct EbsdSlice
+{
+  std::vector<int32> phases;
+  std::vector<float32> eulers;
+  std::vector<float32> quats;
+};
+
+/**
+ * @brief Parses one slice file and copies out the phase and Euler angle columns. The reader, and with it the
+ * rest of the file's columns, is released before the slice moves on to the conversion stage.
+ */
+template <typename EbsdReaderType>
+Result<EbsdSlice> ReadSlice(const std::string& filePath, usize numCells, const std::string& phaseName, const std::array<std::string, 3>& eulerNames)
+{
+  EbsdReaderType reader;
+  reader.setFileName(filePath);
+  if(reader.readFile() < 0)
+  {
+    return MakeErrorResult<EbsdSlice>(reader.getErrorCode(), fmt::format("Error reading slice file '{}': {}", filePath, reader.getErrorMessage()));
+  }
+
+  const usize sliceCells = static_cast<usize>(reader.getXDimension()) * static_cast<usize>(reader.getYDimension());
+  if(sliceCells != numCells)
+  {
+    return MakeErrorResult<EbsdSlice>(k_SliceSizeError, fmt::format("Slice file '{}' has {} cells but the first slice file has {} cells. All slices must have the same dimensions.", filePath,
+                                                                    sliceCells, numCells));
+  }
+
+  const auto* phasePtr = reinterpret_cast<int32*>(reader.getPointerByName(phaseName));
+  std::array<const float32*, 3> eulerPtrs = {nullptr, nullptr, nullptr};
+  for(usize comp = 0; comp < 3; comp++)
+  {
+    eulerPtrs[comp] = reinterpret_cast<float32*>(reader.getPointerByName(eulerNames[comp]));
+  }
+  if(phasePtr == nullptr || eulerPtrs[0] == nullptr || eulerPtrs[1] == nullptr || eulerPtrs[2] == nullptr)
+  {
+    return MakeErrorResult<EbsdSlice>(k_MissingColumnError, fmt::format("Slice file '{}' is missing the phase or Euler angle columns.", filePath));
+  }
+
+  EbsdSlice slice;
+  slice.phases.assign(phasePtr, phasePtr + numCells);
+  slice.eulers.resize(numCells * 3);
+  for(usize cellIndex = 0; cellIndex < numCells; cellIndex++)
+  {
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      slice.eulers[cellIndex * 3 + comp] = eulerPtrs[comp][cellIndex];
+    }
+  }
+  return {std::move(slice)};
+}
+
+/**
+ * @brief Fills the ensemble arrays from the header of the first slice file. Every slice of the stack is
+ * expected to share these phases.
+ */
+template <typename EbsdReaderType, typename EbsdPhaseType>
+Result<> LoadEnsembleInfo(DataStructure& dataStructure, const DataPath& cellEnsembleAttributeMatrixPath, const std::string& filePath)
+{
+  EbsdReaderType reader;
+  reader.setFileName(filePath);
+  if(reader.readHeaderOnly() < 0)
+  {
+    return MakeErrorResult(reader.getErrorCode(), fmt::format("Error reading the header of slice file '{}': {}", filePath, reader.getErrorMessage()));
+  }
+
+  const std::vector<typename EbsdPhaseType::Pointer> phases = reader.getPhaseVector();
+  if(phases.empty())
+  {
+    return MakeErrorResult(k_PhaseInfoError, fmt::format("Slice file '{}' does not contain any phase information.", filePath));
+  }
+
+  auto& crystalStructures = dataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::CrystalStructures));
+  auto& materialNames = dataStructure.getDataRefAs<StringArray>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::MaterialName));
+  auto& latticeConstants = dataStructure.getDataRefAs<Float32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::LatticeConstants));
+
+  // Initialize the zero'th element to unknowns. The other elements will
+  // be filled in based on values from the data file
+  crystalStructures[0] = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+  materialNames[0] = "Invalid Phase";
+  for(usize i = 0; i < 6; i++)
+  {
+    latticeConstants.getDataStoreRef().setComponent(0, i, 0.0F);
+  }
+
+  for(const auto& phase : phases)
+  {
+    const int32 phaseID = phase->getPhaseIndex();
+    if(phaseID < 1 || static_cast<usize>(phaseID) >= crystalStructures.getNumberOfTuples())
+    {
+      return MakeErrorResult(k_PhaseInfoError, fmt::format("Slice file '{}' has a phase index of {} but only {} phases.", filePath, phaseID, phases.size()));
+    }
+    crystalStructures[phaseID] = phase->determineOrientationOpsIndex();
+    std::string materialName = StringUtilities::replace(phase->getMaterialName(), "MaterialName", "");
+    materialNames[phaseID] = StringUtilities::trimmed(materialName);
+
+    std::vector<float32> lattConst = phase->getLatticeConstants();
+    for(usize i = 0; i < 6 && i < lattConst.size(); i++)
+    {
+      latticeConstants.getDataStoreRef().setComponent(phaseID, i, lattConst[i]);
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief The conversion stage. It only touches the slice it is given, so several slices are converted at once.
+ */
+class ConvertSlice
+{
+public:
+  ConvertSlice(std::vector<uint32> crystalStructures, bool isCtf, const std::vector<float32>& eulerTransform, bool computeQuaternions)
+  : m_CrystalStructures(std::move(crystalStructures))
+  , m_IsCtf(isCtf)
+  , m_ComputeQuaternions(computeQuaternions)
+  {
+    const float32 angle = eulerTransform[EbsdToH5EbsdInputConstants::k_AngleIndex];
+    m_RotateEulers = angle > 0.0F;
+    if(m_RotateEulers)
+    {
+      std::array<float32, 3> axis = {eulerTransform[0], eulerTransform[1], eulerTransform[2]};
+      MatrixMath::Normalize3x1(axis.data());
+      OrientationTransformation::ax2om<OrientationF, OrientationF>(OrientationF(axis[0], axis[1], axis[2], angle * numbers::pi_v<float32> / 180.0F)).toGMatrix(m_RotMat);
+    }
+  }
+
+  Result<> operator()(usize, EbsdSlice& slice) const
+  {
+    const usize numCells = slice.phases.size();
+    const auto numPhases = static_cast<int32>(m_CrystalStructures.size());
+    if(m_ComputeQuaternions)
+    {
+      slice.quats.resize(numCells * 4);
+    }
+
+    // MatrixMath takes non-const matrices, so every call works on its own copy of the rotation
+    float32 rotMat[3][3] = {{0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}};
+    std::copy(&m_RotMat[0][0], &m_RotMat[0][0] + 9, &rotMat[0][0]);
+    float32 g[3][3] = {{0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}};
+    float32 gNew[3][3] = {{0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 0.0F}};
+    for(usize cellIndex = 0; cellIndex < numCells; cellIndex++)
+    {
+      // Phase remap: .ang files mark unindexed points with phase 0 which is treated as the first phase,
+      // and any phase that is not in the header is mapped to the unknown phase 0
+      int32& phase = slice.phases[cellIndex];
+      if(!m_IsCtf && phase < 1)
+      {
+        phase = 1;
+      }
+      if(phase < 0 || phase >= numPhases)
+      {
+        phase = 0;
+      }
+
+      float32* euler = slice.eulers.data() + cellIndex * 3;
+      if(m_IsCtf)
+      {
+        if(m_CrystalStructures[phase] == EbsdLib::CrystalStructure::Hexagonal_High)
+        {
+          euler[2] = euler[2] + 30.0F; // See the documentation for this correction factor
+        }
+        for(usize comp = 0; comp < 3; comp++)
+        {
+          euler[comp] = euler[comp] * numbers::pi_v<float32> / 180.0F;
+        }
+      }
+
+      if(m_RotateEulers)
+      {
+        OrientationTransformation::eu2om<OrientationF, OrientationF>(OrientationF(euler[0], euler[1], euler[2])).toGMatrix(g);
+        MatrixMath::Multiply3x3with3x3(g, rotMat, gNew);
+        MatrixMath::Normalize3x3(gNew);
+        OrientationF eu = OrientationTransformation::om2eu<OrientationF, OrientationF>(OrientationF(gNew));
+        euler[0] = eu[0];
+        euler[1] = eu[1];
+        euler[2] = eu[2];
+      }
+
+      if(m_ComputeQuaternions)
+      {
+        QuatF quat = OrientationTransformation::eu2qu<OrientationF, QuatF>(OrientationF(euler[0], euler[1], euler[2]));
+        for(usize comp = 0; comp < 4; comp++)
+        {
+          slice.quats[cellIndex * 4 + comp] = quat[comp];
+        }
+      }
+    }
+    return {};
+  }
+
+private:
+  std::vector<uint32> m_CrystalStructures;
+  bool m_IsCtf = false;
+  bool m_ComputeQuaternions = false;
+  bool m_RotateEulers = false;
+  float32 m_RotMat[3][3] = {{1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 1.0F}};
+};
+
+const std::vector<float32>& EulerTransform(ChoicesParameter::ValueType referenceFrame)
+{
+  switch(referenceFrame)
+  {
+  case EbsdToH5EbsdInputConstants::k_Edax:
+    return EbsdToH5EbsdInputConstants::k_EdaxEulerTransform;
+  case EbsdToH5EbsdInputConstants::k_Oxford:
+    return EbsdToH5EbsdInputConstants::k_OxfordEulerTransform;
+  case EbsdToH5EbsdInputConstants::k_Hedm:
+    return EbsdToH5EbsdInputConstants::k_HedmEulerTransform;
+  default:
+    return EbsdToH5EbsdInputConstants::k_NoEulerTransform;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ReadEbsdStack::ReadEbsdStack(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ReadEbsdStackInputValues* inputValues)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+}
+
+// -----------------------------------------------------------------------------
+ReadEbsdStack::~ReadEbsdStack() noexcept = default;
+
+// -----------------------------------------------------------------------------
+const std::atomic_bool& ReadEbsdStack::getCancel()
+{
+  return m_ShouldCancel;
+}
+
+// -----------------------------------------------------------------------------
+Result<> ReadEbsdStack::operator()()
+{
+  const std::vector<std::string> fileList = m_InputValues->InputFileListInfo.generate();
+  const bool isCtf = m_InputValues->InputFileListInfo.fileExtension == ".ctf";
+
+  const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
+  const SizeVec3 dims = imageGeom.getDimensions();
+  const usize numSlices = fileList.size();
+  const usize numCells = dims[0] * dims[1];
+  if(dims[2] != numSlices)
+  {
+    return MakeErrorResult(k_SliceCountError, fmt::format("The file list has {} slice files but the Image Geometry has {} slices.", numSlices, dims[2]));
+  }
+
+  const DataPath cellAttributeMatrixPath = m_InputValues->ImageGeometryPath.createChildPath(m_InputValues->CellAttributeMatrixName);
+  const DataPath cellEnsembleAttributeMatrixPath = m_InputValues->ImageGeometryPath.createChildPath(m_InputValues->CellEnsembleAttributeMatrixName);
+
+  Result<> ensembleResult = isCtf ? LoadEnsembleInfo<CtfReader, CtfPhase>(m_DataStructure, cellEnsembleAttributeMatrixPath, fileList.front())
+                                  : LoadEnsembleInfo<AngReader, AngPhase>(m_DataStructure, cellEnsembleAttributeMatrixPath, fileList.front());
+  if(ensembleResult.invalid())
+  {
+    return ensembleResult;
+  }
+
+  const auto& crystalStructuresStore = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::CrystalStructures)).getDataStoreRef();
+  std::vector<uint32> crystalStructures(crystalStructuresStore.getSize());
+  for(usize i = 0; i < crystalStructures.size(); i++)
+  {
+    crystalStructures[i] = crystalStructuresStore[i];
+  }
+
+  auto& phasesStore = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::Phases)).getDataStoreRef();
+  auto& eulersStore = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::EulerAngles)).getDataStoreRef();
+  Float32AbstractDataStore* quatsStore = nullptr;
+  if(m_InputValues->ComputeQuaternions)
+  {
+    quatsStore = &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(m_InputValues->QuatsArrayName)).getDataStoreRef();
+  }
+
+  const bool highToLow = m_InputValues->StackingOrder == EbsdToH5EbsdInputConstants::k_HighToLow;
+  const std::string phaseName = isCtf ? EbsdLib::Ctf::Phase : EbsdLib::Ang::PhaseData;
+  const std::array<std::string, 3> eulerNames =
+      isCtf ? std::array<std::string, 3>{EbsdLib::Ctf::Euler1, EbsdLib::Ctf::Euler2, EbsdLib::Ctf::Euler3} : std::array<std::string, 3>{EbsdLib::Ang::Phi1, EbsdLib::Ang::Phi, EbsdLib::Ang::Phi2};
+
+  auto readSlice = [&](usize index) -> Result<EbsdSlice> {
+    return isCtf ? ReadSlice<CtfReader>(fileList[index], numCells, phaseName, eulerNames) : ReadSlice<AngReader>(fileList[index], numCells, phaseName, eulerNames);
+  };
+
+  const ConvertSlice convertSlice(std::move(crystalStructures), isCtf, EulerTransform(m_InputValues->ReferenceFrame), m_InputValues->ComputeQuaternions);
+
+  // The file list is always ordered from low to high, so the stacking order decides which Z plane each file lands in
+  auto writeSlice = [&](usize index, EbsdSlice& slice) -> Result<> {
+    const usize z = highToLow ? numSlices - 1 - index : index;
+    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Importing slice {}/{} into Z = {}", index + 1, numSlices, z));
+
+    Result<> result = phasesStore.copyFromBuffer(z * numCells, nonstd::span<const int32>(slice.phases.data(), slice.phases.size()));
+    if(result.invalid())
+    {
+      return result;
+    }
+    result = eulersStore.copyFromBuffer(z * numCells * 3, nonstd::span<const float32>(slice.eulers.data(), slice.eulers.size()));
+    if(result.invalid() || quatsStore == nullptr)
+    {
+      return result;
+    }
+    return quatsStore->copyFromBuffer(z * numCells * 4, nonstd::span<const float32>(slice.quats.data(), slice.quats.size()));
+  };
+
+  OrderedPipeline<EbsdSlice> pipeline(numSlices);
+  // Only the writer stage touches the DataStructure, so the stages can overlap even for out-of-core arrays
+  pipeline.setParallelizationEnabled(true);
+  return pipeline.execute(readSlice, convertSlice, writeSlice, m_ShouldCancel);
+}
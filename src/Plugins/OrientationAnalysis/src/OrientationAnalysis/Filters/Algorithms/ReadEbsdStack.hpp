@@ -0,0 +1,57 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/GeneratedFileListParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
+
+namespace nx::core
+{
+
+struct ORIENTATIONANALYSIS_EXPORT ReadEbsdStackInputValues
+{
+  GeneratedFileListParameter::ValueType InputFileListInfo;
+  Float32Parameter::ValueType ZSpacing;
+  ChoicesParameter::ValueType StackingOrder;
+  ChoicesParameter::ValueType ReferenceFrame;
+  bool ComputeQuaternions;
+  DataPath ImageGeometryPath;
+  std::string CellAttributeMatrixName;
+  std::string CellEnsembleAttributeMatrixName;
+  std::string QuatsArrayName;
+};
+
+/**
+ * @class ReadEbsdStack
+ * @brief This algorithm reads a stack of .ang or .ctf slice files into a single Image Geometry. A reader
+ * stage parses one slice file at a time, the conversion stage (phase remap, Oxford Euler angle corrections,
+ * Euler reference frame rotation and optional Euler to quaternion conversion) runs on several slices at
+ * once and the writer stage copies each converted slice into its Z plane of the volume, in file order.
+ */
+class ORIENTATIONANALYSIS_EXPORT ReadEbsdStack
+{
+public:
+  ReadEbsdStack(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ReadEbsdStackInputValues* inputValues);
+  ~ReadEbsdStack() noexcept;
+
+  ReadEbsdStack(const ReadEbsdStack&) = delete;
+  ReadEbsdStack(ReadEbsdStack&&) noexcept = delete;
+  ReadEbsdStack& operator=(const ReadEbsdStack&) = delete;
+  ReadEbsdStack& operator=(ReadEbsdStack&&) noexcept = delete;
+
+  Result<> operator()();
+
+  const std::atomic_bool& getCancel();
+
+private:
+  DataStructure& m_DataStructure;
+  const ReadEbsdStackInputValues* m_InputValues = nullptr;
+  const std::atomic_bool& m_ShouldCancel;
+  const IFilter::MessageHandler& m_MessageHandler;
+};
+
+} // namespace nx::core
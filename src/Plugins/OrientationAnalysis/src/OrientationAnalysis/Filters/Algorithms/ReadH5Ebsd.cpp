@@ -1,6 +1,7 @@
 #include "ReadH5Ebsd.hpp"
 
 #include "OrientationAnalysis/Filters/RotateEulerRefFrameFilter.hpp"
+#include "OrientationAnalysis/utilities/EbsdColumnCopy.hpp"
 
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/Common/StringLiteral.hpp"
@@ -106,21 +107,18 @@ nx::core::Result<> LoadInfo(const nx::core::ReadH5EbsdInputValues* mInputValues,
 }
 
 template <typename H5EbsdReaderType, typename T>
-void CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdReader, const std::vector<std::string>& arrayNames, std::set<std::string> selectedArrayNames,
-              const nx::core::DataPath& cellAttributeMatrixPath, size_t totalPoints)
+void AddColumns(nx::core::EbsdColumnCopy& columnCopy, nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdReader, const std::vector<std::string>& arrayNames,
+                const std::set<std::string>& selectedArrayNames, const nx::core::DataPath& cellAttributeMatrixPath)
 {
   using DataArrayType = nx::core::DataArray<T>;
   for(const auto& arrayName : arrayNames)
   {
     if(selectedArrayNames.find(arrayName) != selectedArrayNames.end())
     {
-      T* source = reinterpret_cast<T*>(ebsdReader->getPointerByName(arrayName));
+      const T* source = reinterpret_cast<T*>(ebsdReader->getPointerByName(arrayName));
       nx::core::DataPath dataPath = cellAttributeMatrixPath.createChildPath(arrayName); // get the data from the DataStructure
       auto& destination = dataStructure.getDataRefAs<DataArrayType>(dataPath);
-      for(size_t tupleIndex = 0; tupleIndex < totalPoints; tupleIndex++)
-      {
-        destination[tupleIndex] = source[tupleIndex];
-      }
+      columnCopy.addColumn(source, destination.getDataStoreRef());
     }
   }
 }
@@ -135,12 +133,13 @@ void CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdRead
  * @param dcDims
  * @param floatArrays
  * @param intArrays
+ * @param shouldCancel
  * @return
  */
 template <typename H5EbsdReaderType, typename PhaseType>
 nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputValues, nx::core::DataStructure& dataStructure, const std::vector<std::string>& eulerNames,
                                 const nx::core::IFilter::MessageHandler& mMessageHandler, std::set<std::string> selectedArrayNames, const std::array<size_t, 3>& dcDims,
-                                const std::vector<std::string>& floatArrayNames, const std::vector<std::string>& intArrayNames)
+                                const std::vector<std::string>& floatArrayNames, const std::vector<std::string>& intArrayNames, const std::atomic_bool& shouldCancel)
 {
   int32_t err = 0;
   std::shared_ptr<H5EbsdReaderType> ebsdReader = std::dynamic_pointer_cast<H5EbsdReaderType>(H5EbsdReaderType::New());
@@ -192,27 +191,23 @@ nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputVal
   nx::core::DataPath xtalDataPath = cellEnsembleMatrixPath.createChildPath(EbsdLib::EnsembleData::CrystalStructures);
   auto& xtalData = dataStructure.getDataRefAs<nx::core::UInt32Array>(xtalDataPath);
 
+  nx::core::EbsdColumnCopy columnCopy(totalPoints, 0);
+
   // Copy the Phase Values from the EBSDReader to the DataStructure
-  auto* phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(eulerNames[3]));            // get the phase data from the EbsdReader
+  const auto* phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(eulerNames[3]));     // get the phase data from the EbsdReader
   nx::core::DataPath phaseDataPath = cellAttributeMatrixPath.createChildPath(EbsdLib::H5Ebsd::Phases); // get the phase data from the DataStructure
-  nx::core::Int32Array* phaseDataArrayPtr = nullptr;
+  const bool copyPhases = selectedArrayNames.find(eulerNames[3]) != selectedArrayNames.end();
 
-  if(selectedArrayNames.find(eulerNames[3]) != selectedArrayNames.end())
+  if(copyPhases)
   {
-    phaseDataArrayPtr = dataStructure.getDataAs<nx::core::Int32Array>(phaseDataPath);
-    for(size_t tupleIndex = 0; tupleIndex < totalPoints; tupleIndex++)
-    {
-      (*phaseDataArrayPtr)[tupleIndex] = phasePtr[tupleIndex];
-    }
+    columnCopy.addColumn(phasePtr, dataStructure.getDataRefAs<nx::core::Int32Array>(phaseDataPath).getDataStoreRef());
   }
 
   if(selectedArrayNames.find(EbsdLib::CellData::EulerAngles) != selectedArrayNames.end())
   {
     //  radian conversion = M_PI / 180.0;
-    auto* euler0 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[0]));
-    auto* euler1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[1]));
-    auto* euler2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[2]));
-    //  std::vector<size_t> cDims = {3};
+    const std::array<const float*, 3> eulerPtrs = {reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[0])), reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[1])),
+                                                   reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[2]))};
     nx::core::DataPath eulerDataPath = cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::EulerAngles); // get the Euler data from the DataStructure
     auto& eulerData = dataStructure.getDataRefAs<nx::core::Float32Array>(eulerDataPath);
 
@@ -221,30 +216,33 @@ nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputVal
     {
       degToRad = nx::core::numbers::pi_v<float> / 180.0F;
     }
-    for(size_t elementIndex = 0; elementIndex < totalPoints; elementIndex++)
-    {
-      eulerData[3 * elementIndex] = euler0[elementIndex] * degToRad;
-      eulerData[3 * elementIndex + 1] = euler1[elementIndex] * degToRad;
-      eulerData[3 * elementIndex + 2] = euler2[elementIndex] * degToRad;
-    }
+
     // THIS IS ONLY TO BRING OXFORD DATA INTO THE SAME HEX REFERENCE AS EDAX HEX REFERENCE
-    if(manufacturer == EbsdLib::Ctf::Manufacturer && phaseDataArrayPtr != nullptr)
+    // The phases are read from the reader since the phase array is being filled in the same pass.
+    std::vector<uint32_t> hexCrystalStructures;
+    if(manufacturer == EbsdLib::Ctf::Manufacturer && copyPhases)
     {
-      for(size_t elementIndex = 0; elementIndex < totalPoints; elementIndex++)
+      hexCrystalStructures.resize(xtalData.getNumberOfTuples());
+      for(size_t i = 0; i < hexCrystalStructures.size(); i++)
       {
-        if(xtalData[(*phaseDataArrayPtr)[elementIndex]] == EbsdLib::CrystalStructure::Hexagonal_High)
-        {
-          eulerData[3 * elementIndex + 2] = eulerData[3 * elementIndex + 2] + (30.0F * degToRad);
-        }
+        hexCrystalStructures[i] = xtalData[i];
       }
     }
+    columnCopy.addComponents(eulerPtrs, eulerData.getDataStoreRef(), [hexCrystalStructures = std::move(hexCrystalStructures), phasePtr, degToRad](size_t elementIndex, size_t comp, float angle) {
+      angle = angle * degToRad;
+      if(comp == 2 && !hexCrystalStructures.empty() && hexCrystalStructures[phasePtr[elementIndex]] == EbsdLib::CrystalStructure::Hexagonal_High)
+      {
+        angle = angle + (30.0F * degToRad);
+      }
+      return angle;
+    });
   }
 
   // Copy the EBSD Data from its temp location into the final DataStructure location.
-  ::CopyData<H5EbsdReaderType, float>(dataStructure, ebsdReader.get(), floatArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
-  ::CopyData<H5EbsdReaderType, int>(dataStructure, ebsdReader.get(), intArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
+  ::AddColumns<H5EbsdReaderType, float>(columnCopy, dataStructure, ebsdReader.get(), floatArrayNames, selectedArrayNames, cellAttributeMatrixPath);
+  ::AddColumns<H5EbsdReaderType, int>(columnCopy, dataStructure, ebsdReader.get(), intArrayNames, selectedArrayNames, cellAttributeMatrixPath);
 
-  return {};
+  return columnCopy.execute(shouldCancel);
 }
 
 } // namespace
@@ -305,7 +303,7 @@ Result<> ReadH5Ebsd::operator()()
     std::vector<std::string> eulerPhaseArrays = {EbsdLib::Ang::Phi1, EbsdLib::Ang::Phi, EbsdLib::Ang::Phi2, EbsdLib::Ang::PhaseData};
     std::vector<std::string> floatArrays = {EbsdLib::Ang::ImageQuality, EbsdLib::Ang::ConfidenceIndex, EbsdLib::Ang::SEMSignal, EbsdLib::Ang::Fit, EbsdLib::Ang::XPosition, EbsdLib::Ang::YPosition};
     std::vector<std::string> intArrays = {};
-    Result<> result = LoadEbsdData<H5AngVolumeReader, AngPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays);
+    Result<> result = LoadEbsdData<H5AngVolumeReader, AngPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays, m_ShouldCancel);
     if(result.invalid())
     {
       return result;
@@ -316,7 +314,7 @@ Result<> ReadH5Ebsd::operator()()
     std::vector<std::string> eulerPhaseArrays = {EbsdLib::Ctf::Euler1, EbsdLib::Ctf::Euler2, EbsdLib::Ctf::Euler3, EbsdLib::Ctf::Phase};
     std::vector<std::string> floatArrays = {EbsdLib::Ctf::MAD, EbsdLib::Ctf::X, EbsdLib::Ctf::Y};
     std::vector<std::string> intArrays = {EbsdLib::Ctf::Bands, EbsdLib::Ctf::Error, EbsdLib::Ctf::BC, EbsdLib::Ctf::BS};
-    Result<> result = LoadEbsdData<H5CtfVolumeReader, CtfPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays);
+    Result<> result = LoadEbsdData<H5CtfVolumeReader, CtfPhase>(m_InputValues, m_DataStructure, eulerPhaseArrays, m_MessageHandler, mSelectedArrayNames, dcDims, floatArrays, intArrays, m_ShouldCancel);
     if(result.invalid())
     {
       return result;
@@ -1,5 +1,7 @@
 #include "ReadH5OimData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdColumnCopy.hpp"
+
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 
@@ -27,47 +29,24 @@ Result<> ReadH5OimData::copyRawEbsdData(int index)
   const usize totalPoints = imageGeom.getNumXCells() * imageGeom.getNumYCells();
   const usize offset = index * totalPoints;
 
+  EbsdColumnCopy columnCopy(totalPoints, offset);
+
   // Adjust the values of the 'phase' data to correct for invalid values
+  const auto* phasePtr = reinterpret_cast<int32*>(m_Reader->getPointerByName(EbsdLib::Ang::PhaseData));
   auto& phases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases));
-  auto* phasePtr = reinterpret_cast<int32*>(m_Reader->getPointerByName(EbsdLib::Ang::PhaseData));
+  columnCopy.addColumn(phasePtr, phases.getDataStoreRef(), [](usize, int32 phase) { return phase < 1 ? 1 : phase; });
 
-  const auto* phi1 = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi1));
-  const auto* phi = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi));
-  const auto* phi2 = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi2));
+  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
+  const std::array<const float32*, 3> eulerPtrs = {reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi1)), reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi)),
+                                                   reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Phi2))};
   auto& eulerAngles = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles));
+  columnCopy.addComponents(eulerPtrs, eulerAngles.getDataStoreRef());
 
-  const auto* imageQual = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::ImageQuality));
-  auto& imageQuality = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ImageQuality));
-
-  const auto* confIndex = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
-  auto& confidenceIndex = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ConfidenceIndex));
-
-  const auto* semSig = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::SEMSignal));
-  auto& semSignal = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::SEMSignal));
-
-  const auto* f1 = reinterpret_cast<float32*>(m_Reader->getPointerByName(EbsdLib::Ang::Fit));
-  auto& fit = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::Fit));
-
-  for(size_t i = 0; i < totalPoints; i++)
+  for(const std::string& arrayName : {EbsdLib::Ang::ImageQuality, EbsdLib::Ang::ConfidenceIndex, EbsdLib::Ang::SEMSignal, EbsdLib::Ang::Fit})
   {
-    if(phasePtr[i] < 1)
-    {
-      phasePtr[i] = 1;
-    }
-    phases[offset + i] = phasePtr[i];
-
-    // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
-    eulerAngles[offset + 3 * i] = phi1[i];
-    eulerAngles[offset + 3 * i + 1] = phi[i];
-    eulerAngles[offset + 3 * i + 2] = phi2[i];
-
-    imageQuality[offset + i] = imageQual[i];
-
-    confidenceIndex[offset + i] = confIndex[i];
-
-    semSignal[offset + i] = semSig[i];
-
-    fit[offset + i] = f1[i];
+    const auto* source = reinterpret_cast<float32*>(m_Reader->getPointerByName(arrayName));
+    auto& destination = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(arrayName));
+    columnCopy.addColumn(source, destination.getDataStoreRef());
   }
 
   if(m_InputValues->ReadPatternData)
@@ -77,20 +56,10 @@ Result<> ReadH5OimData::copyRawEbsdData(int index)
     m_Reader->getPatternDims(pDims);
     if(pDims[0] != 0 && pDims[1] != 0)
     {
-      std::vector<usize> pDimsV(2);
-      pDimsV[0] = pDims[0];
-      pDimsV[1] = pDims[1];
       auto& patternData = m_DataStructure.getDataRefAs<UInt8Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::PatternData));
-      const usize numComponents = patternData.getNumberOfComponents();
-      for(usize i = 0; i < totalPoints; i++)
-      {
-        for(usize j = 0; j < numComponents; ++j)
-        {
-          patternData[offset + numComponents * i + j] = patternDataPtr[numComponents * i + j];
-        }
-      }
+      columnCopy.addTuples(patternDataPtr, patternData.getDataStoreRef());
     }
   }
 
-  return {};
+  return columnCopy.execute(m_ShouldCancel);
 }
@@ -15,6 +15,7 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
 #include "simplnx/Utilities/RTree.hpp"
@@ -48,6 +49,174 @@ namespace
 {
 const bool k_UseDiscreteHeatMap = false;
 
+using TriangleRTreeType = RTree<size_t, float, 2, float>;
+
+/**
+ * @brief The StereographicProjectionImpl class fills rows of a stereographic intensity image from a modified
+ * Lambert projection. It computes the same values as ModifiedLambertProjection::createStereographicProjection()
+ * but the rows are independent, so they are split across threads.
+ */
+class StereographicProjectionImpl
+{
+public:
+  StereographicProjectionImpl(const ModifiedLambertProjection& lambert, int32 dimension, double* intensity)
+  : m_Lambert(lambert)
+  , m_Dimension(dimension)
+  , m_Intensity(intensity)
+  {
+  }
+
+  void convert(usize start, usize end) const
+  {
+    const int32 halfDimension = m_Dimension / 2;
+    const float32 resolution = 2.0f / static_cast<float32>(m_Dimension);
+    std::array<float32, 3> xyz = {0.0f, 0.0f, 0.0f};
+    std::array<float32, 2> sqCoord = {0.0f, 0.0f};
+
+    for(usize y = start; y < end; y++)
+    {
+      const float32 yStereo = static_cast<float32>(static_cast<int32>(y) - halfDimension) * resolution + (resolution * 0.5f);
+      for(int32 x = 0; x < m_Dimension; x++)
+      {
+        const float32 xStereo = static_cast<float32>(x - halfDimension) * resolution + (resolution * 0.5f);
+        const float32 radiusSq = xStereo * xStereo + yStereo * yStereo;
+        if(radiusSq > 1.0f)
+        {
+          continue;
+        }
+        const usize index = y * static_cast<usize>(m_Dimension) + static_cast<usize>(x);
+
+        // Project the stereographic point onto the unit sphere, then average both hemispheres of the Lambert projection
+        xyz[2] = -(radiusSq - 1) / (radiusSq + 1);
+        xyz[0] = xStereo * (1 + xyz[2]);
+        xyz[1] = yStereo * (1 + xyz[2]);
+        for(int32 hemisphere = 0; hemisphere < 2; hemisphere++)
+        {
+          if(hemisphere == 1)
+          {
+            xyz[0] = -xyz[0];
+            xyz[1] = -xyz[1];
+            xyz[2] = -xyz[2];
+          }
+          const bool northern = m_Lambert.getSquareCoord(xyz.data(), sqCoord.data());
+          m_Intensity[index] += m_Lambert.getInterpolatedValue(northern ? ModifiedLambertProjection::NorthSquare : ModifiedLambertProjection::SouthSquare, sqCoord.data());
+        }
+        m_Intensity[index] = m_Intensity[index] * 0.5;
+      }
+    }
+  }
+
+  void operator()(const Range& range) const
+  {
+    convert(range.min(), range.max());
+  }
+
+private:
+  const ModifiedLambertProjection& m_Lambert;
+  int32 m_Dimension = 0;
+  double* m_Intensity = nullptr;
+};
+
+/**
+ * @brief Builds the RTree of the 2D bounding boxes of every triangle in the geometry. The tree only depends
+ * on the triangulation, so it is built once and shared by every interpolation over that mesh.
+ * @param triangleGeom
+ * @return TriangleRTreeType
+ */
+TriangleRTreeType CreateTriangleRTree(TriangleGeom& triangleGeom)
+{
+  TriangleRTreeType rTree;
+  const usize numTris = triangleGeom.getNumberOfFaces();
+  for(usize tIndex = 0; tIndex < numTris; tIndex++)
+  {
+    std::array<float, 6> boundBox = nx::IntersectionUtilities::GetBoundingBoxAtTri(triangleGeom, tIndex);
+    rTree.Insert(boundBox.data(), boundBox.data() + 3, tIndex); // Note, all values including zero are fine in this version
+  }
+  return rTree;
+}
+
+/**
+ * @brief The UnstructuredGridInterpolatorImpl class linearly interpolates the vertex values of a triangle mesh
+ * at a range of XY positions, looking up the candidate triangles of each position in a shared RTree.
+ */
+template <typename V, typename T, typename W>
+class UnstructuredGridInterpolatorImpl
+{
+public:
+  UnstructuredGridInterpolatorImpl(const TriangleGeom& delaunayGeom, const TriangleRTreeType& rTree, const std::vector<V>& xPositions, const std::vector<V>& yPositions, const T* xyValues,
+                                   std::vector<W>& outputValues)
+  : m_DelaunayGeom(delaunayGeom)
+  , m_RTree(rTree)
+  , m_XPositions(xPositions)
+  , m_YPositions(yPositions)
+  , m_XYValues(xyValues)
+  , m_OutputValues(outputValues)
+  {
+  }
+
+  void interpolate(usize start, usize end) const
+  {
+    using Vec3f = nx::core::Vec3<float>;
+
+    const Vec3f rayDirection(0.0F, 0.0F, -1.0F);
+    // Create these reusable variables to save the reallocation each time through the loop
+    std::vector<size_t> hitTriangleIds;
+    std::function<bool(size_t)> func = [&hitTriangleIds](size_t id) {
+      hitTriangleIds.push_back(id);
+      return true; // keep going
+    };
+
+    for(usize vertIndex = start; vertIndex < end; vertIndex++)
+    {
+      Vec3f rayOrigin(m_XPositions[vertIndex], m_YPositions[vertIndex], 1.0F);
+
+      hitTriangleIds.clear();
+      m_RTree.Search(rayOrigin.data(), rayOrigin.data(), func);
+      for(auto triIndex : hitTriangleIds)
+      {
+        Vec3f barycentricCoord(0.0F, 0.0F, 0.0F);
+        std::array<size_t, 3> triVertIndices;
+        // Get the Vertex Coordinates for each of the 3 vertices
+        std::array<nx::core::Point3Df, 3> verts;
+        m_DelaunayGeom.getFaceCoordinates(triIndex, verts);
+        Vec3f v0 = verts[0];
+        Vec3f v1 = verts[1];
+        Vec3f v2 = verts[2];
+
+        // Get the vertex Indices from the triangle
+        m_DelaunayGeom.getFacePointIds(triIndex, triVertIndices);
+        bool inTriangle = nx::IntersectionUtilities::RayTriangleIntersect2(rayOrigin, rayDirection, v0, v1, v2, barycentricCoord);
+        if(inTriangle)
+        {
+          // Linear Interpolate dx and dy values using the barycentric coordinates
+          float f0 = m_XYValues[triVertIndices[0]];
+          float f1 = m_XYValues[triVertIndices[1]];
+          float f2 = m_XYValues[triVertIndices[2]];
+
+          float interpolatedVal = (barycentricCoord[0] * f0) + (barycentricCoord[1] * f1) + (barycentricCoord[2] * f2);
+
+          m_OutputValues[vertIndex] = interpolatedVal;
+
+          break;
+        }
+      }
+    }
+  }
+
+  void operator()(const Range& range) const
+  {
+    interpolate(range.min(), range.max());
+  }
+
+private:
+  const TriangleGeom& m_DelaunayGeom;
+  const TriangleRTreeType& m_RTree;
+  const std::vector<V>& m_XPositions;
+  const std::vector<V>& m_YPositions;
+  const T* m_XYValues = nullptr;
+  std::vector<W>& m_OutputValues;
+};
+
 class ComputeIntensityStereographicProjection
 {
 public:
@@ -96,7 +265,11 @@ public:
       {
         lambert->normalizeSquaresToMRD();
       }
-      lambert->createStereographicProjection(m_Config->imageDim, *m_Intensity);
+
+      // Each row of the stereographic image is independent, so they are filled in parallel
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, static_cast<usize>(m_Config->imageDim));
+      dataAlg.execute(StereographicProjectionImpl(*lambert, m_Config->imageDim, m_Intensity->getPointer(0)));
 
       // This next function (writeLambertData) is experimental but should be left in to
       // make sure it will still compile. At some point I will get back to the development
@@ -106,84 +279,13 @@ public:
   }
 
   template <typename V, typename T, typename W>
-  void unstructuredGridInterpolator(nx::core::IFilter* filter, nx::core::TriangleGeom* delaunayGeom, std::vector<V>& xPositionsPtr, std::vector<V>& yPositionsPtr, T* xyValues,
-                                    typename std::vector<W>& outputValues) const
+  void unstructuredGridInterpolator(nx::core::IFilter* filter, nx::core::TriangleGeom* delaunayGeom, const TriangleRTreeType& rTree, std::vector<V>& xPositionsPtr, std::vector<V>& yPositionsPtr,
+                                    T* xyValues, typename std::vector<W>& outputValues) const
   {
-    using Vec3f = nx::core::Vec3<float>;
-    using RTreeType = RTree<size_t, float, 2, float>;
-
     // filter->notifyStatusMessage(QString("Starting Interpolation...."));
-    nx::core::IGeometry::SharedFaceList& delTriangles = delaunayGeom->getFacesRef();
-    size_t numTriangles = delaunayGeom->getNumberOfFaces();
-    int percent = 0;
-    int counter = xPositionsPtr.size() / 100;
-    RTreeType m_RTree;
-    // Populate the RTree
-
-    size_t numTris = delaunayGeom->getNumberOfFaces();
-    for(size_t tIndex = 0; tIndex < numTris; tIndex++)
-    {
-      std::array<float, 6> boundBox = nx::IntersectionUtilities::GetBoundingBoxAtTri(*delaunayGeom, tIndex);
-      m_RTree.Insert(boundBox.data(), boundBox.data() + 3, tIndex); // Note, all values including zero are fine in this version
-    }
-
-    for(size_t vertIndex = 0; vertIndex < xPositionsPtr.size(); vertIndex++)
-    {
-      Vec3f rayOrigin(xPositionsPtr[vertIndex], yPositionsPtr[vertIndex], 1.0F);
-      Vec3f rayDirection(0.0F, 0.0F, -1.0F);
-      Vec3f barycentricCoord(0.0F, 0.0F, 0.0F);
-      //      int xPos = xPositionsPtr[vertIndex];
-      //      int yPos = yPositionsPtr[vertIndex];
-      if(counter != 0)
-      {
-
-        if(vertIndex % counter == 0)
-        {
-          //          QString ss = QObject::tr("Interpolating || %1% Complete").arg(percent);
-          //          filter->notifyStatusMessage(ss);
-          percent += 1;
-        }
-      }
-
-      // Create these reusable variables to save the reallocation each time through the loop
-
-      std::vector<size_t> hitTriangleIds;
-      std::function<bool(size_t)> func = [&](size_t id) {
-        hitTriangleIds.push_back(id);
-        return true; // keep going
-      };
-
-      int nhits = m_RTree.Search(rayOrigin.data(), rayOrigin.data(), func);
-      for(auto triIndex : hitTriangleIds)
-      {
-        barycentricCoord = {0.0F, 0.0F, 0.0F};
-        std::array<size_t, 3> triVertIndices;
-        // Get the Vertex Coordinates for each of the 3 vertices
-        std::array<nx::core::Point3Df, 3> verts;
-        delaunayGeom->getFaceCoordinates(triIndex, verts);
-        Vec3f v0 = verts[0];
-        Vec3f v1 = verts[1];
-        Vec3f v2 = verts[2];
-
-        // Get the vertex Indices from the triangle
-        delaunayGeom->getFacePointIds(triIndex, triVertIndices);
-        bool inTriangle = nx::IntersectionUtilities::RayTriangleIntersect2(rayOrigin, rayDirection, v0, v1, v2, barycentricCoord);
-        if(inTriangle)
-        {
-          // Linear Interpolate dx and dy values using the barycentric coordinates
-          delaunayGeom->getFaceCoordinates(triIndex, verts);
-          float f0 = xyValues[triVertIndices[0]];
-          float f1 = xyValues[triVertIndices[1]];
-          float f2 = xyValues[triVertIndices[2]];
-
-          float interpolatedVal = (barycentricCoord[0] * f0) + (barycentricCoord[1] * f1) + (barycentricCoord[2] * f2);
-
-          outputValues[vertIndex] = interpolatedVal;
-
-          break;
-        }
-      }
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, xPositionsPtr.size());
+    dataAlg.execute(UnstructuredGridInterpolatorImpl<V, T, W>(*delaunayGeom, rTree, xPositionsPtr, yPositionsPtr, xyValues, outputValues));
   }
 
   int writeLambertData(ModifiedLambertProjection::Pointer lambert) const
@@ -366,7 +468,8 @@ public:
     }
 
     std::vector<double> outputValues(numSteps * numSteps);
-    unstructuredGridInterpolator<float32, double, double>(nullptr, &triangleGeom, xcoords, ycoords, m_NorthSquare->data(), outputValues);
+    const TriangleRTreeType rTree = CreateTriangleRTree(triangleGeom);
+    unstructuredGridInterpolator<float32, double, double>(nullptr, &triangleGeom, rTree, xcoords, ycoords, m_NorthSquare->data(), outputValues);
 
     //******************************************************************************************************************************
 
@@ -1,11 +1,13 @@
 #include "ConvertOrientationsFilter.hpp"
 
+#include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/Orientation.hpp"
@@ -17,6 +19,13 @@
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <mutex>
 
 #ifndef _MSC_VER
 #pragma clang diagnostic push
@@ -156,16 +165,318 @@ struct StereographicCheck
   }
 };
 
+/**
+ * @brief Kernel for the pairs without a direct implementation below. Every tuple is converted by EbsdLib.
+ */
+struct NoConversionKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* input, OutT* output)
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief The kernels below convert one tuple of the most common pairs in double precision, without the
+ * temporary Orientation objects of the OrientationTransformation functions, and follow the same conventions.
+ * Quaternions are in VectorScalar order. Convert() returns false for an input on or near a special case of
+ * the conversion (identity, 180 degree rotations, gimbal lock, axes that are not unit vectors) so that those
+ * tuples are still converted by EbsdLib.
+ */
+constexpr float64 k_KernelTolerance = 1.0E-6;
+constexpr float64 k_AxisLengthTolerance = 1.0E-4;
+
+struct EulerToQuaternionKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* eu, OutT* qu)
+  {
+    const float64 halfPhi = 0.5 * static_cast<float64>(eu[1]);
+    const float64 halfSum = 0.5 * (static_cast<float64>(eu[0]) + static_cast<float64>(eu[2]));
+    const float64 halfDiff = 0.5 * (static_cast<float64>(eu[0]) - static_cast<float64>(eu[2]));
+    const float64 cPhi = std::cos(halfPhi);
+    const float64 sPhi = std::sin(halfPhi);
+    const float64 w = cPhi * std::cos(halfSum);
+    // The rotation angle is kept in [0, Pi] by making the scalar part positive
+    const float64 sign = w < 0.0 ? -1.0 : 1.0;
+    qu[0] = static_cast<OutT>(-sign * sPhi * std::cos(halfDiff));
+    qu[1] = static_cast<OutT>(-sign * sPhi * std::sin(halfDiff));
+    qu[2] = static_cast<OutT>(-sign * cPhi * std::sin(halfSum));
+    qu[3] = static_cast<OutT>(sign * w);
+    return true;
+  }
+};
+
+struct EulerToOrientationMatrixKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* eu, OutT* om)
+  {
+    const float64 c1 = std::cos(static_cast<float64>(eu[0]));
+    const float64 s1 = std::sin(static_cast<float64>(eu[0]));
+    const float64 c = std::cos(static_cast<float64>(eu[1]));
+    const float64 s = std::sin(static_cast<float64>(eu[1]));
+    const float64 c2 = std::cos(static_cast<float64>(eu[2]));
+    const float64 s2 = std::sin(static_cast<float64>(eu[2]));
+    om[0] = static_cast<OutT>(c1 * c2 - s1 * s2 * c);
+    om[1] = static_cast<OutT>(s1 * c2 + c1 * s2 * c);
+    om[2] = static_cast<OutT>(s2 * s);
+    om[3] = static_cast<OutT>(-c1 * s2 - s1 * c2 * c);
+    om[4] = static_cast<OutT>(-s1 * s2 + c1 * c2 * c);
+    om[5] = static_cast<OutT>(c2 * s);
+    om[6] = static_cast<OutT>(s1 * s);
+    om[7] = static_cast<OutT>(-c1 * s);
+    om[8] = static_cast<OutT>(c);
+    return true;
+  }
+};
+
+struct QuaternionToEulerKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* qu, OutT* eu)
+  {
+    const auto q1 = static_cast<float64>(qu[0]);
+    const auto q2 = static_cast<float64>(qu[1]);
+    const auto q3 = static_cast<float64>(qu[2]);
+    const auto q0 = static_cast<float64>(qu[3]);
+    const float64 q03 = q0 * q0 + q3 * q3;
+    const float64 q12 = q1 * q1 + q2 * q2;
+    const float64 chi = std::sqrt(q03 * q12);
+    if(chi < k_KernelTolerance)
+    {
+      return false;
+    }
+    std::array<float64, 3> angles = {std::atan2((q1 * q3 - q0 * q2) / chi, (-q0 * q1 - q2 * q3) / chi), std::atan2(2.0 * chi, q03 - q12),
+                                     std::atan2((q0 * q2 + q1 * q3) / chi, (q2 * q3 - q0 * q1) / chi)};
+    for(usize index = 0; index < 3; index++)
+    {
+      if(angles[index] < 0.0)
+      {
+        angles[index] += Constants::k_2PiD;
+      }
+      eu[index] = static_cast<OutT>(angles[index]);
+    }
+    return true;
+  }
+};
+
+struct QuaternionToOrientationMatrixKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* qu, OutT* om)
+  {
+    const auto x = static_cast<float64>(qu[0]);
+    const auto y = static_cast<float64>(qu[1]);
+    const auto z = static_cast<float64>(qu[2]);
+    const auto w = static_cast<float64>(qu[3]);
+    const float64 qq = w * w - (x * x + y * y + z * z);
+    om[0] = static_cast<OutT>(qq + 2.0 * x * x);
+    om[1] = static_cast<OutT>(2.0 * (x * y - w * z));
+    om[2] = static_cast<OutT>(2.0 * (x * z + w * y));
+    om[3] = static_cast<OutT>(2.0 * (x * y + w * z));
+    om[4] = static_cast<OutT>(qq + 2.0 * y * y);
+    om[5] = static_cast<OutT>(2.0 * (y * z - w * x));
+    om[6] = static_cast<OutT>(2.0 * (x * z - w * y));
+    om[7] = static_cast<OutT>(2.0 * (y * z + w * x));
+    om[8] = static_cast<OutT>(qq + 2.0 * z * z);
+    return true;
+  }
+};
+
+/**
+ * @brief Shared by the axis-angle and Rodrigues kernels: the unit rotation axis and the half angle of a
+ * quaternion that is not near the identity or a 180 degree rotation.
+ */
+template <typename InT>
+bool QuaternionAxisHalfAngle(const InT* qu, std::array<float64, 3>& axis, float64& halfAngle)
+{
+  const auto w = static_cast<float64>(qu[3]);
+  const float64 length = std::sqrt(static_cast<float64>(qu[0]) * qu[0] + static_cast<float64>(qu[1]) * qu[1] + static_cast<float64>(qu[2]) * qu[2]);
+  if(w <= k_KernelTolerance || w >= 1.0 - k_KernelTolerance || length <= k_KernelTolerance)
+  {
+    return false;
+  }
+  for(usize index = 0; index < 3; index++)
+  {
+    axis[index] = static_cast<float64>(qu[index]) / length;
+  }
+  halfAngle = std::acos(w);
+  return true;
+}
+
+struct QuaternionToAxisAngleKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* qu, OutT* ax)
+  {
+    std::array<float64, 3> axis = {};
+    float64 halfAngle = 0.0;
+    if(!QuaternionAxisHalfAngle(qu, axis, halfAngle))
+    {
+      return false;
+    }
+    ax[0] = static_cast<OutT>(axis[0]);
+    ax[1] = static_cast<OutT>(axis[1]);
+    ax[2] = static_cast<OutT>(axis[2]);
+    ax[3] = static_cast<OutT>(2.0 * halfAngle);
+    return true;
+  }
+};
+
+struct QuaternionToRodriguesKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* qu, OutT* ro)
+  {
+    std::array<float64, 3> axis = {};
+    float64 halfAngle = 0.0;
+    if(!QuaternionAxisHalfAngle(qu, axis, halfAngle))
+    {
+      return false;
+    }
+    ro[0] = static_cast<OutT>(axis[0]);
+    ro[1] = static_cast<OutT>(axis[1]);
+    ro[2] = static_cast<OutT>(axis[2]);
+    ro[3] = static_cast<OutT>(std::tan(halfAngle));
+    return true;
+  }
+};
+
+/**
+ * @brief Shared by the axis-angle and Rodrigues kernels: the quaternion of a unit axis and a rotation angle in (0, Pi).
+ */
+template <typename InT, typename OutT>
+bool AxisAngleToQuaternion(const InT* axis, float64 angle, OutT* qu)
+{
+  const float64 length = std::sqrt(static_cast<float64>(axis[0]) * axis[0] + static_cast<float64>(axis[1]) * axis[1] + static_cast<float64>(axis[2]) * axis[2]);
+  if(!(angle > k_KernelTolerance && angle < Constants::k_PiD - k_KernelTolerance) || std::abs(length - 1.0) > k_AxisLengthTolerance)
+  {
+    return false;
+  }
+  const float64 s = std::sin(0.5 * angle);
+  qu[0] = static_cast<OutT>(axis[0] * s);
+  qu[1] = static_cast<OutT>(axis[1] * s);
+  qu[2] = static_cast<OutT>(axis[2] * s);
+  qu[3] = static_cast<OutT>(std::cos(0.5 * angle));
+  return true;
+}
+
+struct AxisAngleToQuaternionKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* ax, OutT* qu)
+  {
+    return AxisAngleToQuaternion(ax, static_cast<float64>(ax[3]), qu);
+  }
+};
+
+struct RodriguesToQuaternionKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* ro, OutT* qu)
+  {
+    return std::isfinite(ro[3]) && AxisAngleToQuaternion(ro, 2.0 * std::atan(static_cast<float64>(ro[3])), qu);
+  }
+};
+
+/**
+ * @brief Converts through an intermediate quaternion held in double precision.
+ */
+template <class ToQuaternionKernelT, class FromQuaternionKernelT>
+struct ThroughQuaternionKernel
+{
+  template <typename InT, typename OutT>
+  static bool Convert(const InT* input, OutT* output)
+  {
+    std::array<float64, 4> qu = {};
+    return ToQuaternionKernelT::Convert(input, qu.data()) && FromQuaternionKernelT::Convert(qu.data(), output);
+  }
+};
+
+using EulerToAxisAngleKernel = ThroughQuaternionKernel<EulerToQuaternionKernel, QuaternionToAxisAngleKernel>;
+using EulerToRodriguesKernel = ThroughQuaternionKernel<EulerToQuaternionKernel, QuaternionToRodriguesKernel>;
+
+constexpr usize k_BlockTuples = 4096;
+
+/**
+ * @brief The first failed block read or write of the conversion. The flag lets the other ranges stop without taking the lock.
+ */
+struct ConversionError
+{
+  std::atomic_bool failed = false;
+  std::mutex mutex;
+  Result<> result;
+
+  void record(Result<>&& error)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!failed)
+    {
+      result = std::move(error);
+      failed = true;
+    }
+  }
+};
+
+/**
+ * @brief Calls tupleFunc(T* inTuple, T* outTuple) for every tuple in range, a block of tuples at a time. The input
+ * tuples are always a copy of the input values because the checks may adjust them. Contiguous output is written in
+ * place, any other output store is written a block at a time with AbstractDataStore::copyFromBuffer(). Returns the
+ * first failed block read or write and stops early once another range has failed.
+ */
+template <typename T, usize InCompSize, usize OutCompSize, class TupleFuncT>
+Result<> ConvertTupleBlocks(const AbstractDataStore<T>& inDataStore, AbstractDataStore<T>& outDataStore, const Range& range, const ConversionError& conversionError, TupleFuncT&& tupleFunc)
+{
+  const T* inData = DataStoreUtilities::GetContiguousData(inDataStore);
+  T* outData = DataStoreUtilities::GetContiguousData(outDataStore);
+  const usize numBlockTuples = std::min(k_BlockTuples, range.size());
+  std::vector<T> inBlock(numBlockTuples * InCompSize);
+  std::vector<T> outBlock(outData == nullptr ? numBlockTuples * OutCompSize : 0);
+  for(usize blockStart = range.min(); blockStart < range.max() && !conversionError.failed; blockStart += k_BlockTuples)
+  {
+    const usize numTuples = std::min(k_BlockTuples, range.max() - blockStart);
+    if(inData != nullptr)
+    {
+      std::copy(inData + blockStart * InCompSize, inData + (blockStart + numTuples) * InCompSize, inBlock.begin());
+    }
+    else
+    {
+      Result<> readResult = inDataStore.copyIntoBuffer(blockStart * InCompSize, nonstd::span<T>(inBlock.data(), numTuples * InCompSize));
+      if(readResult.invalid())
+      {
+        return readResult;
+      }
+    }
+    T* outValues = outData != nullptr ? outData + blockStart * OutCompSize : outBlock.data();
+    for(usize tIndex = 0; tIndex < numTuples; tIndex++)
+    {
+      tupleFunc(inBlock.data() + tIndex * InCompSize, outValues + tIndex * OutCompSize);
+    }
+    if(outData == nullptr)
+    {
+      Result<> writeResult = outDataStore.copyFromBuffer(blockStart * OutCompSize, nonstd::span<const T>(outBlock.data(), numTuples * OutCompSize));
+      if(writeResult.invalid())
+      {
+        return writeResult;
+      }
+    }
+  }
+  return {};
+}
+
 /**
  *
  */
-template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0>
+template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0, class ConversionKernel = NoConversionKernel>
 class ConvertOrientation
 {
 public:
-  ConvertOrientation(const DataArray<T>& inputArray, DataArray<T>& outputArray, TransformFunc transformFunc, CheckFunc checkFunc)
+  ConvertOrientation(const DataArray<T>& inputArray, DataArray<T>& outputArray, ConversionError& conversionError, TransformFunc transformFunc, CheckFunc checkFunc)
   : m_InputArray(inputArray)
   , m_OutputArray(outputArray)
+  , m_ConversionError(conversionError)
   , m_TransformFunc(std::move(transformFunc))
   , m_CheckFunc(std::move(checkFunc))
   {
@@ -173,31 +484,35 @@ public:
 
   void operator()(const Range& range) const
   {
-    auto& inDataStore = m_InputArray.getDataStoreRef();
-    auto& outDataStore = m_OutputArray.getDataStoreRef();
-
     Orientation<T> input(InCompSize);
-    for(size_t tIndex = range.min(); tIndex < range.max(); tIndex++)
-    {
-
+    const auto& inDataStore = m_InputArray.getDataStoreRef();
+    auto& outDataStore = m_OutputArray.getDataStoreRef();
+    Result<> result = ConvertTupleBlocks<T, InCompSize, OutCompSize>(inDataStore, outDataStore, range, m_ConversionError, [this, &input](T* inTuple, T* outTuple) {
+      m_CheckFunc(inTuple);
+      if(ConversionKernel::Convert(inTuple, outTuple))
+      {
+        return;
+      }
       for(size_t cIndex = 0; cIndex < InCompSize; cIndex++)
       {
-        input[cIndex] = inDataStore.getValue(tIndex * InCompSize + cIndex);
+        input[cIndex] = inTuple[cIndex];
       }
-
-      m_CheckFunc(input.data());
-
       Orientation<T> output = m_TransformFunc(input); // Do the actual Conversion
       for(size_t cIndex = 0; cIndex < OutCompSize; cIndex++)
       {
-        outDataStore.setValue(tIndex * OutCompSize + cIndex, output[cIndex]);
+        outTuple[cIndex] = output[cIndex];
       }
+    });
+    if(result.invalid())
+    {
+      m_ConversionError.record(std::move(result));
     }
   }
 
 private:
   const DataArray<T>& m_InputArray;
   DataArray<T>& m_OutputArray;
+  ConversionError& m_ConversionError;
   TransformFunc m_TransformFunc;
   CheckFunc m_CheckFunc;
 };
@@ -205,13 +520,14 @@ private:
 /**
  *
  */
-template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0>
+template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0, class ConversionKernel = NoConversionKernel>
 class ToQuaternion
 {
 public:
-  ToQuaternion(DataArray<T>& inputArray, DataArray<T>& outputArray, TransformFunc transformFunc, CheckFunc checkFunc, typename Quaternion<T>::Order layout)
+  ToQuaternion(DataArray<T>& inputArray, DataArray<T>& outputArray, ConversionError& conversionError, TransformFunc transformFunc, CheckFunc checkFunc, typename Quaternion<T>::Order layout)
   : m_InputArray(inputArray)
   , m_OutputArray(outputArray)
+  , m_ConversionError(conversionError)
   , m_TransformFunc(std::move(transformFunc))
   , m_CheckFunc(std::move(checkFunc))
   , m_Layout(layout)
@@ -221,29 +537,37 @@ public:
   void operator()(const Range& range) const
   {
     using QuaterionType = Quaternion<float>;
-    size_t numTuples = m_InputArray.getNumberOfTuples();
-    auto& inDataStore = m_InputArray.getDataStoreRef();
-    auto& outDataStore = m_OutputArray.getDataStoreRef();
-
+    // The conversion kernels write quaternions in VectorScalar order
+    const bool useKernel = m_Layout == Quaternion<T>::Order::VectorScalar;
     Orientation<T> input(InCompSize);
-    for(size_t tIndex = range.min(); tIndex < range.max(); tIndex++)
-    {
+    const auto& inDataStore = m_InputArray.getDataStoreRef();
+    auto& outDataStore = m_OutputArray.getDataStoreRef();
+    Result<> result = ConvertTupleBlocks<T, InCompSize, OutCompSize>(inDataStore, outDataStore, range, m_ConversionError, [this, useKernel, &input](T* inTuple, T* outTuple) {
+      m_CheckFunc(inTuple);
+      if(useKernel && ConversionKernel::Convert(inTuple, outTuple))
+      {
+        return;
+      }
       for(size_t cIndex = 0; cIndex < InCompSize; cIndex++)
       {
-        input[cIndex] = inDataStore.getValue(tIndex * InCompSize + cIndex);
+        input[cIndex] = inTuple[cIndex];
       }
-      m_CheckFunc(input.data());
       QuaterionType output = m_TransformFunc(input, m_Layout); // Do the actual Conversion
       for(size_t cIndex = 0; cIndex < OutCompSize; cIndex++)
       {
-        outDataStore.setValue(tIndex * OutCompSize + cIndex, output[cIndex]);
+        outTuple[cIndex] = output[cIndex];
       }
+    });
+    if(result.invalid())
+    {
+      m_ConversionError.record(std::move(result));
     }
   }
 
 private:
   const DataArray<T>& m_InputArray;
   DataArray<T>& m_OutputArray;
+  ConversionError& m_ConversionError;
   TransformFunc m_TransformFunc;
   CheckFunc m_CheckFunc;
   typename Quaternion<T>::Order m_Layout;
@@ -252,13 +576,14 @@ private:
 /**
  *
  */
-template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0>
+template <typename T, typename TransformFunc, typename CheckFunc, size_t InCompSize = 0, size_t OutCompSize = 0, class ConversionKernel = NoConversionKernel>
 class FromQuaternion
 {
 public:
-  FromQuaternion(const DataArray<T>& inputArray, DataArray<T>& outputArray, TransformFunc transformFunc, CheckFunc checkFunc, typename Quaternion<T>::Order layout)
+  FromQuaternion(const DataArray<T>& inputArray, DataArray<T>& outputArray, ConversionError& conversionError, TransformFunc transformFunc, CheckFunc checkFunc, typename Quaternion<T>::Order layout)
   : m_InputArray(inputArray)
   , m_OutputArray(outputArray)
+  , m_ConversionError(conversionError)
   , m_TransformFunc(std::move(transformFunc))
   , m_CheckFunc(std::move(checkFunc))
   , m_Layout(layout)
@@ -268,29 +593,32 @@ public:
   void operator()(const Range& range) const
   {
     using QuaterionType = Quaternion<T>;
-    auto& inDataStore = m_InputArray.getDataStoreRef();
+    // The conversion kernels read quaternions in VectorScalar order
+    const bool useKernel = m_Layout == Quaternion<T>::Order::VectorScalar;
+    const auto& inDataStore = m_InputArray.getDataStoreRef();
     auto& outDataStore = m_OutputArray.getDataStoreRef();
-
-    std::array<T, 4> input;
-    for(size_t tIndex = range.min(); tIndex < range.max(); tIndex++)
-    {
-      for(size_t cIndex = 0; cIndex < InCompSize; cIndex++)
+    Result<> result = ConvertTupleBlocks<T, InCompSize, OutCompSize>(inDataStore, outDataStore, range, m_ConversionError, [this, useKernel](T* inTuple, T* outTuple) {
+      m_CheckFunc(inTuple);
+      if(useKernel && ConversionKernel::Convert(inTuple, outTuple))
       {
-        input[cIndex] = inDataStore.getValue(tIndex * InCompSize + cIndex);
+        return;
       }
-      m_CheckFunc(input.data());
-
-      Orientation<T> output = m_TransformFunc(QuaterionType(input[0], input[1], input[2], input[3]), m_Layout); // Do the actual Conversion
+      Orientation<T> output = m_TransformFunc(QuaterionType(inTuple[0], inTuple[1], inTuple[2], inTuple[3]), m_Layout); // Do the actual Conversion
       for(size_t cIndex = 0; cIndex < OutCompSize; cIndex++)
       {
-        outDataStore.setValue(tIndex * OutCompSize + cIndex, output[cIndex]);
+        outTuple[cIndex] = output[cIndex];
       }
+    });
+    if(result.invalid())
+    {
+      m_ConversionError.record(std::move(result));
     }
   }
 
 private:
   const DataArray<T>& m_InputArray;
   DataArray<T>& m_OutputArray;
+  ConversionError& m_ConversionError;
   TransformFunc m_TransformFunc;
   CheckFunc m_CheckFunc;
   typename Quaternion<T>::Order m_Layout;
@@ -450,359 +778,376 @@ Result<> ConvertOrientationsFilter::executeImpl(DataStructure& dataStructure, co
   // Allow data-based parallelization
   ParallelDataAlgorithm parallelAlgorithm;
   parallelAlgorithm.setRange(0, totalPoints);
-  // This next block of code was generated from the ConvertOrientationsTest::_make_code() function.
+  parallelAlgorithm.requireArraysInMemory({&inputDataArray, &outputDataArray});
+  ConversionError conversionError;
+  // This next block of code was generated from the ConvertOrientationsTest::_make_code() function. The Euler, Quaternion,
+  // AxisAngle and Rodrigues pairs were then given a ConversionKernel and their check type by hand.
   if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to OrientationMatrix"});
     ConversionFunctionType eu2om = OrientationTransformation::eu2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, eu2om, euCheck));
+    parallelAlgorithm.execute(
+        ::ConvertOrientation<float, ConversionFunctionType, ::EulerCheck<float>, 3, 9, ::EulerToOrientationMatrixKernel>(inputDataArray, outputDataArray, conversionError, eu2om,
+                                                                                                                         ::EulerCheck<float>()));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to Quaternion"});
     ToQuaternionFunctionType eu2qu = OrientationTransformation::eu2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, eu2qu, euCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ::EulerCheck<float>, 3, 4, ::EulerToQuaternionKernel>(inputDataArray, outputDataArray, conversionError, eu2qu,
+                                                                                                              ::EulerCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to AxisAngle"});
     ConversionFunctionType eu2ax = OrientationTransformation::eu2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, eu2ax, euCheck));
+    parallelAlgorithm.execute(
+        ::ConvertOrientation<float, ConversionFunctionType, ::EulerCheck<float>, 3, 4, ::EulerToAxisAngleKernel>(inputDataArray, outputDataArray, conversionError, eu2ax, ::EulerCheck<float>()));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to Rodrigues"});
     ConversionFunctionType eu2ro = OrientationTransformation::eu2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, eu2ro, euCheck));
+    parallelAlgorithm.execute(
+        ::ConvertOrientation<float, ConversionFunctionType, ::EulerCheck<float>, 3, 4, ::EulerToRodriguesKernel>(inputDataArray, outputDataArray, conversionError, eu2ro, ::EulerCheck<float>()));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to Homochoric"});
     ConversionFunctionType eu2ho = OrientationTransformation::eu2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, eu2ho, euCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, eu2ho, euCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to Cubochoric"});
     ConversionFunctionType eu2cu = OrientationTransformation::eu2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, eu2cu, euCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, eu2cu, euCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Euler && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Euler to Stereographic"});
     ConversionFunctionType eu2st = OrientationTransformation::eu2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, eu2st, euCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, eu2st, euCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Euler"});
     ConversionFunctionType om2eu = OrientationTransformation::om2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, om2eu, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, conversionError, om2eu, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Quaternion"});
     ToQuaternionFunctionType om2qu = OrientationTransformation::om2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, om2qu, omCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, conversionError, om2qu, omCheck, QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to AxisAngle"});
     ConversionFunctionType om2ax = OrientationTransformation::om2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, om2ax, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, conversionError, om2ax, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Rodrigues"});
     ConversionFunctionType om2ro = OrientationTransformation::om2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, om2ro, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 4>(inputDataArray, outputDataArray, conversionError, om2ro, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Homochoric"});
     ConversionFunctionType om2ho = OrientationTransformation::om2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, om2ho, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, conversionError, om2ho, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Cubochoric"});
     ConversionFunctionType om2cu = OrientationTransformation::om2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, om2cu, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, conversionError, om2cu, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::OrientationMatrix && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting OrientationMatrix to Stereographic"});
     ConversionFunctionType om2st = OrientationTransformation::om2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, om2st, omCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 9, 3>(inputDataArray, outputDataArray, conversionError, om2st, omCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to Euler"});
     FromQuaternionFunctionType qu2eu = OrientationTransformation::qu2eu<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, qu2eu, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ::QuaternionCheck<float>, 4, 3, ::QuaternionToEulerKernel>(inputDataArray, outputDataArray, conversionError, qu2eu,
+                                                                                                                       ::QuaternionCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to OrientationMatrix"});
     FromQuaternionFunctionType qu2om = OrientationTransformation::qu2om<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 9>(inputDataArray, outputDataArray, qu2om, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ::QuaternionCheck<float>, 4, 9, ::QuaternionToOrientationMatrixKernel>(inputDataArray, outputDataArray, conversionError, qu2om,
+                                                                                                                                   ::QuaternionCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to AxisAngle"});
     FromQuaternionFunctionType qu2ax = OrientationTransformation::qu2ax<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, qu2ax, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ::QuaternionCheck<float>, 4, 4, ::QuaternionToAxisAngleKernel>(inputDataArray, outputDataArray, conversionError, qu2ax,
+                                                                                                                           ::QuaternionCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to Rodrigues"});
     FromQuaternionFunctionType qu2ro = OrientationTransformation::qu2ro<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, qu2ro, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ::QuaternionCheck<float>, 4, 4, ::QuaternionToRodriguesKernel>(inputDataArray, outputDataArray, conversionError, qu2ro,
+                                                                                                                           ::QuaternionCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to Homochoric"});
     FromQuaternionFunctionType qu2ho = OrientationTransformation::qu2ho<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, qu2ho, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, qu2ho, quCheck,
+                                                                                                 QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to Cubochoric"});
     FromQuaternionFunctionType qu2cu = OrientationTransformation::qu2cu<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, qu2cu, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, qu2cu, quCheck,
+                                                                                                 QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Quaternion && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Quaternion to Stereographic"});
     FromQuaternionFunctionType qu2st = OrientationTransformation::qu2st<QuaternionType, OutputType>;
     parallelAlgorithm.execute(
-        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, qu2st, quCheck, QuaternionType::Order::VectorScalar));
+        ::FromQuaternion<float, FromQuaternionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, qu2st, quCheck,
+                                                                                                 QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Euler"});
     ConversionFunctionType ax2eu = OrientationTransformation::ax2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ax2eu, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ax2eu, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to OrientationMatrix"});
     ConversionFunctionType ax2om = OrientationTransformation::ax2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 9>(inputDataArray, outputDataArray, ax2om, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 9>(inputDataArray, outputDataArray, conversionError, ax2om, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Quaternion"});
     ToQuaternionFunctionType ax2qu = OrientationTransformation::ax2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, ax2qu, axCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ::AxisAngleCheck<float>, 4, 4, ::AxisAngleToQuaternionKernel>(inputDataArray, outputDataArray, conversionError, ax2qu,
+                                                                                                                      ::AxisAngleCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Rodrigues"});
     ConversionFunctionType ax2ro = OrientationTransformation::ax2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, ax2ro, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, conversionError, ax2ro, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Homochoric"});
     ConversionFunctionType ax2ho = OrientationTransformation::ax2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ax2ho, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ax2ho, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Cubochoric"});
     ConversionFunctionType ax2cu = OrientationTransformation::ax2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ax2cu, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ax2cu, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::AxisAngle && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting AxisAngle to Stereographic"});
     ConversionFunctionType ax2st = OrientationTransformation::ax2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ax2st, axCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ax2st, axCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to Euler"});
     ConversionFunctionType ro2eu = OrientationTransformation::ro2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ro2eu, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ro2eu, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to OrientationMatrix"});
     ConversionFunctionType ro2om = OrientationTransformation::ro2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 9>(inputDataArray, outputDataArray, ro2om, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 9>(inputDataArray, outputDataArray, conversionError, ro2om, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to Quaternion"});
     ToQuaternionFunctionType ro2qu = OrientationTransformation::ro2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, ro2qu, roCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ::RodriguesCheck<float>, 4, 4, ::RodriguesToQuaternionKernel>(inputDataArray, outputDataArray, conversionError, ro2qu,
+                                                                                                                      ::RodriguesCheck<float>(), QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to AxisAngle"});
     ConversionFunctionType ro2ax = OrientationTransformation::ro2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, ro2ax, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 4>(inputDataArray, outputDataArray, conversionError, ro2ax, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to Homochoric"});
     ConversionFunctionType ro2ho = OrientationTransformation::ro2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ro2ho, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ro2ho, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to Cubochoric"});
     ConversionFunctionType ro2cu = OrientationTransformation::ro2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ro2cu, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ro2cu, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Rodrigues && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Rodrigues to Stereographic"});
     ConversionFunctionType ro2st = OrientationTransformation::ro2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, ro2st, roCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 4, 3>(inputDataArray, outputDataArray, conversionError, ro2st, roCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to Euler"});
     ConversionFunctionType ho2eu = OrientationTransformation::ho2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, ho2eu, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, ho2eu, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to OrientationMatrix"});
     ConversionFunctionType ho2om = OrientationTransformation::ho2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, ho2om, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, conversionError, ho2om, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to Quaternion"});
     ToQuaternionFunctionType ho2qu = OrientationTransformation::ho2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, ho2qu, hoCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, ho2qu, hoCheck, QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to AxisAngle"});
     ConversionFunctionType ho2ax = OrientationTransformation::ho2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, ho2ax, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, ho2ax, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to Rodrigues"});
     ConversionFunctionType ho2ro = OrientationTransformation::ho2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, ho2ro, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, ho2ro, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to Cubochoric"});
     ConversionFunctionType ho2cu = OrientationTransformation::ho2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, ho2cu, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, ho2cu, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Homochoric && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Homochoric to Stereographic"});
     ConversionFunctionType ho2st = OrientationTransformation::ho2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, ho2st, hoCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, ho2st, hoCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to Euler"});
     ConversionFunctionType cu2eu = OrientationTransformation::cu2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, cu2eu, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, cu2eu, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to OrientationMatrix"});
     ConversionFunctionType cu2om = OrientationTransformation::cu2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, cu2om, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, conversionError, cu2om, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to Quaternion"});
     ToQuaternionFunctionType cu2qu = OrientationTransformation::cu2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, cu2qu, cuCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, cu2qu, cuCheck, QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to AxisAngle"});
     ConversionFunctionType cu2ax = OrientationTransformation::cu2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, cu2ax, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, cu2ax, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to Rodrigues"});
     ConversionFunctionType cu2ro = OrientationTransformation::cu2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, cu2ro, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, cu2ro, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to Homochoric"});
     ConversionFunctionType cu2ho = OrientationTransformation::cu2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, cu2ho, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, cu2ho, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Cubochoric && outputType == OrientationRepresentation::Type::Stereographic)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Cubochoric to Stereographic"});
     ConversionFunctionType cu2st = OrientationTransformation::cu2st<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, cu2st, cuCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, cu2st, cuCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::Euler)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to Euler"});
     ConversionFunctionType st2eu = OrientationTransformation::st2eu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, st2eu, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, st2eu, stCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::OrientationMatrix)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to OrientationMatrix"});
     ConversionFunctionType st2om = OrientationTransformation::st2om<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, st2om, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 9>(inputDataArray, outputDataArray, conversionError, st2om, stCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::Quaternion)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to Quaternion"});
     ToQuaternionFunctionType st2qu = OrientationTransformation::st2qu<InputType, QuaternionType>;
     parallelAlgorithm.execute(
-        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, st2qu, stCheck, QuaternionType::Order::VectorScalar));
+        ::ToQuaternion<float, ToQuaternionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, st2qu, stCheck, QuaternionType::Order::VectorScalar));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::AxisAngle)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to AxisAngle"});
     ConversionFunctionType st2ax = OrientationTransformation::st2ax<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, st2ax, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, st2ax, stCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::Rodrigues)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to Rodrigues"});
     ConversionFunctionType st2ro = OrientationTransformation::st2ro<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, st2ro, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 4>(inputDataArray, outputDataArray, conversionError, st2ro, stCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::Homochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to Homochoric"});
     ConversionFunctionType st2ho = OrientationTransformation::st2ho<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, st2ho, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, st2ho, stCheck));
   }
   else if(inputType == OrientationRepresentation::Type::Stereographic && outputType == OrientationRepresentation::Type::Cubochoric)
   {
     messageHandler(nx::core::IFilter::Message{nx::core::IFilter::Message::Type::Info, "Converting Stereographic to Cubochoric"});
     ConversionFunctionType st2cu = OrientationTransformation::st2cu<InputType, OutputType>;
-    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, st2cu, stCheck));
+    parallelAlgorithm.execute(::ConvertOrientation<float, ConversionFunctionType, ValidateInputDataFunctionType, 3, 3>(inputDataArray, outputDataArray, conversionError, st2cu, stCheck));
   }
 
-  return {};
+  return std::move(conversionError.result);
 }
 } // namespace nx::core
 
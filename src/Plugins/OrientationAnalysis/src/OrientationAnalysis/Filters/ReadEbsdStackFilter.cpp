@@ -0,0 +1,230 @@
+#include "ReadEbsdStackFilter.hpp"
+
+#include "OrientationAnalysis/Filters/Algorithms/EbsdToH5Ebsd.hpp"
+#include "OrientationAnalysis/Filters/Algorithms/ReadEbsdStack.hpp"
+
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
+#include "simplnx/Filter/Actions/CreateAttributeMatrixAction.hpp"
+#include "simplnx/Filter/Actions/CreateImageGeometryAction.hpp"
+#include "simplnx/Filter/Actions/CreateStringArrayAction.hpp"
+#include "simplnx/Parameters/BoolParameter.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/DataGroupCreationParameter.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/GeneratedFileListParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/IO/HKL/CtfReader.h"
+#include "EbsdLib/IO/TSL/AngReader.h"
+
+#include <filesystem>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+
+namespace
+{
+struct SliceHeader
+{
+  usize xDim = 0;
+  usize yDim = 0;
+  float32 xStep = 1.0F;
+  float32 yStep = 1.0F;
+  usize numPhases = 0;
+};
+
+template <typename EbsdReaderType>
+Result<SliceHeader> ReadSliceHeader(const std::string& filePath)
+{
+  EbsdReaderType reader;
+  reader.setFileName(filePath);
+  if(reader.readHeaderOnly() < 0)
+  {
+    return MakeErrorResult<SliceHeader>(reader.getErrorCode(), reader.getErrorMessage());
+  }
+  return {SliceHeader{static_cast<usize>(reader.getXDimension()), static_cast<usize>(reader.getYDimension()), reader.getXStep(), reader.getYStep(), reader.getPhaseVector().size()}};
+}
+} // namespace
+
+namespace nx::core
+{
+//------------------------------------------------------------------------------
+std::string ReadEbsdStackFilter::name() const
+{
+  return FilterTraits<ReadEbsdStackFilter>::name.str();
+}
+
+//------------------------------------------------------------------------------
+std::string ReadEbsdStackFilter::className() const
+{
+  return FilterTraits<ReadEbsdStackFilter>::className;
+}
+
+//------------------------------------------------------------------------------
+Uuid ReadEbsdStackFilter::uuid() const
+{
+  return FilterTraits<ReadEbsdStackFilter>::uuid;
+}
+
+//------------------------------------------------------------------------------
+std::string ReadEbsdStackFilter::humanName() const
+{
+  return "Read EBSD Slice Stack (.ang/.ctf)";
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> ReadEbsdStackFilter::defaultTags() const
+{
+  return {className(), "IO", "Input", "Read", "Import", "Ebsd", "EDAX", "Oxford", "Stack"};
+}
+
+//------------------------------------------------------------------------------
+Parameters ReadEbsdStackFilter::parameters() const
+{
+  Parameters params;
+  params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
+  params.insert(std::make_unique<Float32Parameter>(k_ZSpacing_Key, "Z Spacing (Microns)", "The spacing between each slice of data", 1.0F));
+  params.insert(std::make_unique<ChoicesParameter>(k_StackingOrder_Key, "Stacking Order", "Whether the lowest or the highest file index is placed at Z = 0", EbsdToH5EbsdInputConstants::k_LowToHigh,
+                                                   EbsdToH5EbsdInputConstants::k_StackingChoices));
+  params.insert(std::make_unique<ChoicesParameter>(k_ReferenceFrame_Key, "Reference Frame Options",
+                                                   "The Euler reference frame transformation. 0=EDAX(.ang), 1=Oxford(.ctf), 2=No/Unknown Transformation, 3=HEDM-IceNine",
+                                                   EbsdToH5EbsdInputConstants::k_Edax, EbsdToH5EbsdInputConstants::k_TransformChoices));
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ComputeQuaternions_Key, "Compute Quaternions", "Whether to also convert the Euler angles to quaternions", true));
+
+  params.insertSeparator(Parameters::Separator{"Input Data Files"});
+  params.insert(std::make_unique<GeneratedFileListParameter>(k_InputFileListInfo_Key, "Input File List",
+                                                             "The values that are used to generate the input file list. See GeneratedFileListParameter for more information.",
+                                                             GeneratedFileListParameter::ValueType{}));
+
+  params.insertSeparator(Parameters::Separator{"Output Image Geometry"});
+  params.insert(std::make_unique<DataGroupCreationParameter>(k_CreatedImageGeometryPath_Key, "Image Geometry", "The path to the created Image Geometry", DataPath({ImageGeom::k_TypeName})));
+  params.insertSeparator(Parameters::Separator{"Output Cell Attribute Matrix"});
+  params.insert(std::make_unique<DataObjectNameParameter>(k_CellAttributeMatrixName_Key, "Cell Attribute Matrix", "The name of the cell data attribute matrix for the created Image Geometry",
+                                                          ImageGeom::k_CellDataName));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_QuatsArrayName_Key, "Quaternions", "The name of the created cell quaternions array", "Quats"));
+  params.insertSeparator(Parameters::Separator{"Output Ensemble Attribute Matrix"});
+  params.insert(std::make_unique<DataObjectNameParameter>(k_CellEnsembleAttributeMatrixName_Key, "Ensemble Attribute Matrix", "The Attribute Matrix where the phase information is stored.",
+                                                          "Cell Ensemble Data"));
+
+  // Associate the Linkable Parameter(s) to the children parameters that they control
+  params.linkParameters(k_ComputeQuaternions_Key, k_QuatsArrayName_Key, true);
+
+  return params;
+}
+
+//------------------------------------------------------------------------------
+IFilter::VersionType ReadEbsdStackFilter::parametersVersion() const
+{
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+IFilter::UniquePointer ReadEbsdStackFilter::clone() const
+{
+  return std::make_unique<ReadEbsdStackFilter>();
+}
+
+//------------------------------------------------------------------------------
+IFilter::PreflightResult ReadEbsdStackFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
+                                                            const std::atomic_bool& shouldCancel) const
+{
+  auto generatedFileListInfo = filterArgs.value<GeneratedFileListParameter::ValueType>(k_InputFileListInfo_Key);
+  auto pZSpacingValue = filterArgs.value<Float32Parameter::ValueType>(k_ZSpacing_Key);
+  auto pComputeQuaternionsValue = filterArgs.value<bool>(k_ComputeQuaternions_Key);
+  auto pQuatsArrayNameValue = filterArgs.value<std::string>(k_QuatsArrayName_Key);
+  auto pImageGeometryPath = filterArgs.value<DataPath>(k_CreatedImageGeometryPath_Key);
+  auto pCellAttributeMatrixNameValue = filterArgs.value<std::string>(k_CellAttributeMatrixName_Key);
+  auto pCellEnsembleAttributeMatrixNameValue = filterArgs.value<std::string>(k_CellEnsembleAttributeMatrixName_Key);
+
+  if(generatedFileListInfo.fileExtension != ".ang" && generatedFileListInfo.fileExtension != ".ctf")
+  {
+    return {MakePreflightErrorResult(-60900, "Only .ang and .ctf files are supported")};
+  }
+
+  generatedFileListInfo.ordering = nx::core::FilePathGenerator::Ordering::LowToHigh;
+  std::vector<std::string> fileList = generatedFileListInfo.generate();
+  if(fileList.empty())
+  {
+    return {MakePreflightErrorResult(-60901, "Generated file list is empty.")};
+  }
+  for(const auto& filePath : fileList)
+  {
+    if(!fs::exists(filePath))
+    {
+      return {MakePreflightErrorResult(-60902, fmt::format("Slice file '{}' does not exist.", filePath))};
+    }
+  }
+
+  // Every slice is expected to match the header of the first one. The slices are checked again while they are read.
+  Result<SliceHeader> headerResult = generatedFileListInfo.fileExtension == ".ctf" ? ReadSliceHeader<CtfReader>(fileList.front()) : ReadSliceHeader<AngReader>(fileList.front());
+  if(headerResult.invalid())
+  {
+    return {ConvertInvalidResult<OutputActions>(std::move(headerResult))};
+  }
+  const SliceHeader& header = headerResult.value();
+
+  CreateImageGeometryAction::DimensionType imageGeomDims = {header.xDim, header.yDim, fileList.size()};
+  std::vector<usize> tupleDims = {imageGeomDims[2], imageGeomDims[1], imageGeomDims[0]};
+  CreateImageGeometryAction::SpacingType spacing = {header.xStep, header.yStep, pZSpacingValue};
+  CreateImageGeometryAction::OriginType origin = {0.0F, 0.0F, 0.0F};
+
+  nx::core::Result<OutputActions> resultOutputActions;
+  resultOutputActions.value().appendAction(
+      std::make_unique<CreateImageGeometryAction>(pImageGeometryPath, imageGeomDims, origin, spacing, pCellAttributeMatrixNameValue, IGeometry::LengthUnit::Micrometer));
+
+  const DataPath cellAttributeMatrixPath = pImageGeometryPath.createChildPath(pCellAttributeMatrixNameValue);
+  resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(DataType::int32, tupleDims, std::vector<usize>{1}, cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::Phases)));
+  resultOutputActions.value().appendAction(
+      std::make_unique<CreateArrayAction>(DataType::float32, tupleDims, std::vector<usize>{3}, cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::EulerAngles)));
+  if(pComputeQuaternionsValue)
+  {
+    resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(DataType::float32, tupleDims, std::vector<usize>{4}, cellAttributeMatrixPath.createChildPath(pQuatsArrayNameValue)));
+  }
+
+  // Create the Ensemble AttributeMatrix, always with 1 extra slot for the unknown phase
+  std::vector<usize> ensembleTupleDims = {header.numPhases + 1};
+  const DataPath ensembleAttributeMatrixPath = pImageGeometryPath.createChildPath(pCellEnsembleAttributeMatrixNameValue);
+  resultOutputActions.value().appendAction(std::make_unique<CreateAttributeMatrixAction>(ensembleAttributeMatrixPath, ensembleTupleDims));
+  resultOutputActions.value().appendAction(
+      std::make_unique<CreateArrayAction>(DataType::uint32, ensembleTupleDims, std::vector<usize>{1}, ensembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::CrystalStructures)));
+  resultOutputActions.value().appendAction(
+      std::make_unique<CreateArrayAction>(DataType::float32, ensembleTupleDims, std::vector<usize>{6}, ensembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::LatticeConstants)));
+  resultOutputActions.value().appendAction(std::make_unique<CreateStringArrayAction>(ensembleTupleDims, ensembleAttributeMatrixPath.createChildPath(EbsdLib::EnsembleData::MaterialName)));
+
+  std::stringstream ss;
+  ss << "Slices: " << fileList.size() << "\n"
+     << "X Step: " << header.xStep << "    Y Step: " << header.yStep << "\n"
+     << "Num Cols: " << header.xDim << "    "
+     << "Num Rows: " << header.yDim << "\n";
+  std::vector<PreflightValue> preflightUpdatedValues = {{"Slice Stack Information", ss.str()}};
+
+  return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
+}
+
+//------------------------------------------------------------------------------
+Result<> ReadEbsdStackFilter::executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                                          const std::atomic_bool& shouldCancel) const
+{
+  ReadEbsdStackInputValues inputValues;
+
+  inputValues.InputFileListInfo = filterArgs.value<GeneratedFileListParameter::ValueType>(k_InputFileListInfo_Key);
+  inputValues.ZSpacing = filterArgs.value<Float32Parameter::ValueType>(k_ZSpacing_Key);
+  inputValues.StackingOrder = filterArgs.value<ChoicesParameter::ValueType>(k_StackingOrder_Key);
+  inputValues.ReferenceFrame = filterArgs.value<ChoicesParameter::ValueType>(k_ReferenceFrame_Key);
+  inputValues.ComputeQuaternions = filterArgs.value<bool>(k_ComputeQuaternions_Key);
+  inputValues.QuatsArrayName = filterArgs.value<std::string>(k_QuatsArrayName_Key);
+  inputValues.ImageGeometryPath = filterArgs.value<DataPath>(k_CreatedImageGeometryPath_Key);
+  inputValues.CellAttributeMatrixName = filterArgs.value<std::string>(k_CellAttributeMatrixName_Key);
+  inputValues.CellEnsembleAttributeMatrixName = filterArgs.value<std::string>(k_CellEnsembleAttributeMatrixName_Key);
+  // ALWAYS use LowToHigh (no matter what the user happened to click in the UI). The Stacking Order
+  // decides which Z plane each file of the low to high list is written into.
+  inputValues.InputFileListInfo.ordering = nx::core::FilePathGenerator::Ordering::LowToHigh;
+
+  return ReadEbsdStack(dataStructure, messageHandler, shouldCancel, &inputValues)();
+}
+} // namespace nx::core
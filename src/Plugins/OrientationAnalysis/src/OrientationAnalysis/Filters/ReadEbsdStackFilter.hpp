@@ -0,0 +1,114 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Filter/FilterTraits.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+
+namespace nx::core
+{
+/**
+ * @class ReadEbsdStackFilter
+ * @brief This filter reads a stack of .ang or .ctf slice files directly into an Image Geometry. Slice files are
+ * parsed, converted and copied into their Z plane by a pipeline so that reading the next file overlaps with
+ * converting the previous ones.
+ */
+class ORIENTATIONANALYSIS_EXPORT ReadEbsdStackFilter : public IFilter
+{
+public:
+  ReadEbsdStackFilter() = default;
+  ~ReadEbsdStackFilter() noexcept override = default;
+
+  ReadEbsdStackFilter(const ReadEbsdStackFilter&) = delete;
+  ReadEbsdStackFilter(ReadEbsdStackFilter&&) noexcept = delete;
+
+  ReadEbsdStackFilter& operator=(const ReadEbsdStackFilter&) = delete;
+  ReadEbsdStackFilter& operator=(ReadEbsdStackFilter&&) noexcept = delete;
+
+  // Parameter Keys
+  static inline constexpr StringLiteral k_InputFileListInfo_Key = "input_file_list_object";
+  static inline constexpr StringLiteral k_ZSpacing_Key = "z_spacing";
+  static inline constexpr StringLiteral k_StackingOrder_Key = "stacking_order_index";
+  static inline constexpr StringLiteral k_ReferenceFrame_Key = "reference_frame_index";
+  static inline constexpr StringLiteral k_ComputeQuaternions_Key = "compute_quaternions";
+  static inline constexpr StringLiteral k_QuatsArrayName_Key = "quats_array_name";
+  static inline constexpr StringLiteral k_CreatedImageGeometryPath_Key = "output_image_geometry_path";
+  static inline constexpr StringLiteral k_CellAttributeMatrixName_Key = "cell_attribute_matrix_name";
+  static inline constexpr StringLiteral k_CellEnsembleAttributeMatrixName_Key = "cell_ensemble_attribute_matrix_name";
+
+  /**
+   * @brief Returns the name of the filter.
+   * @return
+   */
+  std::string name() const override;
+
+  /**
+   * @brief Returns the C++ classname of this filter.
+   * @return
+   */
+  std::string className() const override;
+
+  /**
+   * @brief Returns the uuid of the filter.
+   * @return
+   */
+  Uuid uuid() const override;
+
+  /**
+   * @brief Returns the human readable name of the filter.
+   * @return
+   */
+  std::string humanName() const override;
+
+  /**
+   * @brief Returns the default tags for this filter.
+   * @return
+   */
+  std::vector<std::string> defaultTags() const override;
+
+  /**
+   * @brief Returns the parameters of the filter (i.e. its inputs)
+   * @return
+   */
+  Parameters parameters() const override;
+
+  /**
+   * @brief Returns parameters version integer.
+   * Initial version should always be 1.
+   * Should be incremented everytime the parameters change.
+   * @return VersionType
+   */
+  VersionType parametersVersion() const override;
+
+  /**
+   * @brief Returns a copy of the filter.
+   * @return
+   */
+  UniquePointer clone() const override;
+
+protected:
+  /**
+   * @brief Takes in a DataStructure and checks that the filter can be run on it with the given arguments.
+   * Returns any warnings/errors. Also returns the changes that would be applied to the DataStructure.
+   * Some parts of the actions may not be completely filled out if all the required information is not available at preflight time.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override;
+
+  /**
+   * @brief Applies the filter's algorithm to the DataStructure with the given arguments. Returns any warnings/errors.
+   * On failure, there is no guarantee that the DataStructure is in a correct state.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override;
+};
+} // namespace nx::core
+
+SIMPLNX_DEF_FILTER_TRAITS(nx::core, ReadEbsdStackFilter, "d506c3f3-9c9f-4cdc-85cf-6d66407a4d90");
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class EbsdColumnCopy
+ * @brief Copies the columns that an EbsdLib reader has parsed into its own arrays into their destination data
+ * stores. The cells are split into blocks and each block writes every added column, in parallel over the blocks,
+ * so the columns are read and written once instead of once per serial loop. Values go straight into stores held
+ * in contiguous memory. Any other store is written a block at a time with AbstractDataStore::copyFromBuffer(),
+ * in which case the copy runs serially.
+ *
+ * Cell i of a column is written to tuple (tupleOffset + i) of its destination, so readers that load one slice
+ * at a time pass the first tuple of the slice.
+ */
+class EbsdColumnCopy : public IParallelAlgorithm
+{
+public:
+  EbsdColumnCopy(usize numCells, usize tupleOffset)
+  : m_NumCells(numCells)
+  , m_TupleOffset(tupleOffset)
+  {
+  }
+
+  ~EbsdColumnCopy() noexcept = default;
+
+  EbsdColumnCopy(const EbsdColumnCopy&) = delete;
+  EbsdColumnCopy(EbsdColumnCopy&&) noexcept = delete;
+  EbsdColumnCopy& operator=(const EbsdColumnCopy&) = delete;
+  EbsdColumnCopy& operator=(EbsdColumnCopy&&) noexcept = delete;
+
+  /**
+   * @brief Adds a column whose value for cell i is static_cast<DestT>(source[i]).
+   * @param source
+   * @param destination
+   */
+  template <typename SourceT, typename DestT>
+  void addColumn(const SourceT* source, AbstractDataStore<DestT>& destination)
+  {
+    addColumn(source, destination, [](usize, SourceT value) { return static_cast<DestT>(value); });
+  }
+
+  /**
+   * @brief Adds a column whose value for cell i is convert(i, source[i]). The conversion must be thread safe.
+   * @param source
+   * @param destination
+   * @param convert
+   */
+  template <typename SourceT, typename DestT, class ConvertT>
+  void addColumn(const SourceT* source, AbstractDataStore<DestT>& destination, ConvertT convert)
+  {
+    addComponents<1>(std::array<const SourceT*, 1>{source}, destination, [convert](usize cellIndex, usize, SourceT value) { return convert(cellIndex, value); });
+  }
+
+  /**
+   * @brief Adds N columns that are interleaved into the N components of the destination, such as the three Euler
+   * angle columns. Component k of cell i is static_cast<DestT>(sources[k][i]).
+   * @param sources
+   * @param destination
+   */
+  template <usize N, typename SourceT, typename DestT>
+  void addComponents(const std::array<const SourceT*, N>& sources, AbstractDataStore<DestT>& destination)
+  {
+    addComponents(sources, destination, [](usize, usize, SourceT value) { return static_cast<DestT>(value); });
+  }
+
+  /**
+   * @brief Adds N columns that are interleaved into the N components of the destination, such as the three Euler
+   * angle columns. Component k of cell i is convert(i, k, sources[k][i]). The conversion must be thread safe.
+   * @param sources
+   * @param destination
+   * @param convert
+   */
+  template <usize N, typename SourceT, typename DestT, class ConvertT>
+  void addComponents(const std::array<const SourceT*, N>& sources, AbstractDataStore<DestT>& destination, ConvertT convert)
+  {
+    Column column;
+    column.store = &destination;
+    column.numComponents = N;
+    column.write = [sources, &destination, convert, tupleOffset = m_TupleOffset](usize cellStart, usize cellEnd) -> Result<> {
+      const usize valueStart = (tupleOffset + cellStart) * N;
+      DestT* data = DataStoreUtilities::GetContiguousData(destination);
+      std::vector<DestT> buffer;
+      if(data == nullptr)
+      {
+        buffer.resize((cellEnd - cellStart) * N);
+      }
+      DestT* values = data != nullptr ? data + valueStart : buffer.data();
+      for(usize cellIndex = cellStart; cellIndex < cellEnd; cellIndex++)
+      {
+        for(usize comp = 0; comp < N; comp++)
+        {
+          values[(cellIndex - cellStart) * N + comp] = convert(cellIndex, comp, sources[comp][cellIndex]);
+        }
+      }
+      if(data == nullptr)
+      {
+        return destination.copyFromBuffer(valueStart, nonstd::span<const DestT>(buffer.data(), buffer.size()));
+      }
+      return {};
+    };
+    m_Columns.push_back(std::move(column));
+  }
+
+  /**
+   * @brief Adds a column that already holds whole tuples, such as pattern data, so that component k of cell i is
+   * static_cast<DestT>(source[i * numComponents + k]) where numComponents is that of the destination.
+   * @param source
+   * @param destination
+   */
+  template <typename SourceT, typename DestT>
+  void addTuples(const SourceT* source, AbstractDataStore<DestT>& destination)
+  {
+    addTuples(source, destination, [](usize, usize, SourceT value) { return static_cast<DestT>(value); });
+  }
+
+  /**
+   * @brief Adds a column that already holds whole tuples, so that component k of cell i is
+   * convert(i, k, source[i * numComponents + k]). The conversion must be thread safe.
+   * @param source
+   * @param destination
+   * @param convert
+   */
+  template <typename SourceT, typename DestT, class ConvertT>
+  void addTuples(const SourceT* source, AbstractDataStore<DestT>& destination, ConvertT convert)
+  {
+    Column column;
+    column.store = &destination;
+    column.numComponents = destination.getNumberOfComponents();
+    column.write = [source, &destination, convert, numComponents = column.numComponents, tupleOffset = m_TupleOffset](usize cellStart, usize cellEnd) -> Result<> {
+      const usize valueStart = (tupleOffset + cellStart) * numComponents;
+      const usize numValues = (cellEnd - cellStart) * numComponents;
+      DestT* data = DataStoreUtilities::GetContiguousData(destination);
+      // Tuples can be large, so the staging buffer is bounded by values rather than cells
+      std::vector<DestT> buffer;
+      if(data == nullptr)
+      {
+        buffer.resize(std::min(numValues, DataStoreUtilities::k_DefaultBlockSize));
+      }
+      const usize chunkCapacity = data != nullptr ? numValues : buffer.size();
+      usize cellIndex = cellStart;
+      usize comp = 0;
+      for(usize chunkStart = 0; chunkStart < numValues; chunkStart += chunkCapacity)
+      {
+        const usize chunkSize = std::min(chunkCapacity, numValues - chunkStart);
+        DestT* values = data != nullptr ? data + valueStart + chunkStart : buffer.data();
+        const SourceT* sourceValues = source + cellStart * numComponents + chunkStart;
+        for(usize valueIndex = 0; valueIndex < chunkSize; valueIndex++)
+        {
+          values[valueIndex] = convert(cellIndex, comp, sourceValues[valueIndex]);
+          if(++comp == numComponents)
+          {
+            comp = 0;
+            cellIndex++;
+          }
+        }
+        if(data == nullptr)
+        {
+          Result<> writeResult = destination.copyFromBuffer(valueStart + chunkStart, nonstd::span<const DestT>(buffer.data(), chunkSize));
+          if(writeResult.invalid())
+          {
+            return writeResult;
+          }
+        }
+      }
+      return {};
+    };
+    m_Columns.push_back(std::move(column));
+  }
+
+  /**
+   * @brief Writes every added column into its destination. Returns the first error of a failed write into a
+   * store that is not held in contiguous memory.
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> execute(const std::atomic_bool& shouldCancel)
+  {
+    AlgorithmStores stores;
+    for(const Column& column : m_Columns)
+    {
+      if(column.store->getNumberOfComponents() != column.numComponents || column.store->getNumberOfTuples() < m_TupleOffset + m_NumCells)
+      {
+        return MakeErrorResult(-8990, fmt::format("Unable to copy {} cells with {} components starting at tuple {} into a data store with {} tuples of {} components.", m_NumCells,
+                                                  column.numComponents, m_TupleOffset, column.store->getNumberOfTuples(), column.store->getNumberOfComponents()));
+      }
+      stores.push_back(column.store);
+    }
+    requireStoresInMemory(stores);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(getParallelizationEnabled());
+    dataAlg.setRange(0, (m_NumCells + k_BlockSize - 1) / k_BlockSize);
+    WriteError writeError;
+    dataAlg.execute(CopyBlocksImpl(m_Columns, m_NumCells, writeError, shouldCancel));
+    return std::move(writeError.result);
+  }
+
+private:
+  static inline constexpr usize k_BlockSize = DataStoreUtilities::k_DefaultBlockSize;
+
+  struct Column
+  {
+    const IDataStore* store = nullptr;
+    usize numComponents = 1;
+    std::function<Result<>(usize, usize)> write;
+  };
+
+  /**
+   * @brief The first failed write of the copy. The flag lets the other blocks stop without taking the lock.
+   */
+  struct WriteError
+  {
+    std::atomic_bool failed = false;
+    std::mutex mutex;
+    Result<> result;
+  };
+
+  class CopyBlocksImpl
+  {
+  public:
+    CopyBlocksImpl(const std::vector<Column>& columns, usize numCells, WriteError& writeError, const std::atomic_bool& shouldCancel)
+    : m_Columns(columns)
+    , m_NumCells(numCells)
+    , m_WriteError(writeError)
+    , m_ShouldCancel(shouldCancel)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize block = range.min(); block < range.max(); block++)
+      {
+        if(m_ShouldCancel || m_WriteError.failed)
+        {
+          return;
+        }
+        const usize cellStart = block * k_BlockSize;
+        const usize cellEnd = std::min(cellStart + k_BlockSize, m_NumCells);
+        for(const Column& column : m_Columns)
+        {
+          Result<> writeResult = column.write(cellStart, cellEnd);
+          if(writeResult.invalid())
+          {
+            std::lock_guard<std::mutex> lock(m_WriteError.mutex);
+            if(!m_WriteError.failed)
+            {
+              m_WriteError.result = std::move(writeResult);
+              m_WriteError.failed = true;
+            }
+            return;
+          }
+        }
+      }
+    }
+
+  private:
+    const std::vector<Column>& m_Columns;
+    usize m_NumCells = 0;
+    WriteError& m_WriteError;
+    const std::atomic_bool& m_ShouldCancel;
+  };
+
+  usize m_NumCells = 0;
+  usize m_TupleOffset = 0;
+  std::vector<Column> m_Columns;
+};
+} // namespace nx::core
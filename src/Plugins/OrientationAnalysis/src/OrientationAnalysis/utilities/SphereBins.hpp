@@ -0,0 +1,174 @@
+#pragma once
+
+#include "simplnx/Common/Constants.hpp"
+#include "simplnx/Common/Types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief SphereBins sorts a set of directions into the cells of a Lambert cylindrical equal-area grid on
+ * the unit sphere: the z axis is split into bands of equal height and every band into sectors of equal
+ * azimuth, so every cell covers the same area. A query then only visits the cells that can hold directions
+ * within a given angle of a probe direction, instead of every direction in the set.
+ *
+ * The query is conservative: every direction within the angle is visited, along with some that are not, so
+ * callers apply their exact criterion to the candidates. Directions are expected to be unit vectors.
+ */
+class SphereBins
+{
+public:
+  /**
+   * @brief Angle (radians) added to every query so that rounding in the callers' own angle calculation
+   * can never reject a direction the query skipped.
+   */
+  static inline constexpr float64 k_AngleMargin = 1.0E-4;
+  static inline constexpr usize k_MaxBands = 2048;
+  static inline constexpr usize k_MaxSectors = 4096;
+
+  /**
+   * @brief Creates the bins with cells of roughly cellAngle radians along each side and fills them with
+   * numItems directions, where direction(itemIndex) returns the direction of an item as std::array<float64, 3>.
+   * Inside each cell the items are kept in increasing index order.
+   * @param cellAngle
+   * @param numItems
+   * @param direction
+   * @return SphereBins
+   */
+  template <class DirectionFuncT>
+  static SphereBins Create(float64 cellAngle, usize numItems, DirectionFuncT&& direction)
+  {
+    cellAngle = std::max(cellAngle, 1.0E-3);
+    SphereBins bins;
+    bins.m_NumBands = std::clamp(static_cast<usize>(std::ceil(2.0 / cellAngle)), usize{1}, k_MaxBands);
+    bins.m_NumSectors = std::clamp(static_cast<usize>(std::ceil(Constants::k_2PiD / cellAngle)), usize{1}, k_MaxSectors);
+
+    // Counting sort of the items by cell
+    std::vector<usize> itemBins(numItems);
+    bins.m_BinOffsets.assign(bins.m_NumBands * bins.m_NumSectors + 1, 0);
+    for(usize itemIndex = 0; itemIndex < numItems; itemIndex++)
+    {
+      const std::array<float64, 3> itemDirection = direction(itemIndex);
+      itemBins[itemIndex] = bins.getBin(itemDirection[0], itemDirection[1], itemDirection[2]);
+      bins.m_BinOffsets[itemBins[itemIndex] + 1]++;
+    }
+    for(usize bin = 1; bin < bins.m_BinOffsets.size(); bin++)
+    {
+      bins.m_BinOffsets[bin] += bins.m_BinOffsets[bin - 1];
+    }
+    std::vector<usize> nextSlot(bins.m_BinOffsets.cbegin(), bins.m_BinOffsets.cend() - 1);
+    bins.m_Items.resize(numItems);
+    for(usize itemIndex = 0; itemIndex < numItems; itemIndex++)
+    {
+      bins.m_Items[nextSlot[itemBins[itemIndex]]++] = itemIndex;
+    }
+    return bins;
+  }
+
+  /**
+   * @brief Returns the cell that holds the direction (x, y, z). Directions that are not finite go into the first cell.
+   * @return usize
+   */
+  usize getBin(float64 x, float64 y, float64 z) const
+  {
+    if(!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z))
+    {
+      return 0;
+    }
+    const float64 length = std::sqrt(x * x + y * y + z * z);
+    if(length > 0.0)
+    {
+      z /= length;
+    }
+    return getBand(z) * m_NumSectors + getSector(std::atan2(y, x));
+  }
+
+  /**
+   * @brief Calls func(itemIndex) for every item whose direction may be within maxAngle radians of the
+   * unit vector (x, y, z). Every candidate is visited exactly once, but not in index order.
+   * @param x
+   * @param y
+   * @param z
+   * @param maxAngle
+   * @param func
+   */
+  template <class FuncT>
+  void forEachCandidate(float64 x, float64 y, float64 z, float64 maxAngle, FuncT&& func) const
+  {
+    const float64 angle = maxAngle + k_AngleMargin;
+    const float64 polarAngle = std::acos(std::clamp(z, -1.0, 1.0));
+    const float64 minPolarAngle = polarAngle - angle;
+    const float64 maxPolarAngle = polarAngle + angle;
+
+    const usize firstBand = maxPolarAngle >= Constants::k_PiD ? 0 : getBand(std::cos(maxPolarAngle));
+    const usize lastBand = minPolarAngle <= 0.0 ? m_NumBands - 1 : getBand(std::cos(minPolarAngle));
+
+    // A cap that holds a pole spans every azimuth, otherwise its azimuthal half width is asin(sin(angle) / sin(polarAngle))
+    usize firstSector = 0;
+    usize numSectors = m_NumSectors;
+    if(minPolarAngle > 0.0 && maxPolarAngle < Constants::k_PiD)
+    {
+      const float64 halfWidth = std::asin(std::min(std::sin(angle) / std::sin(polarAngle), 1.0));
+      const float64 azimuth = std::atan2(y, x);
+      const auto first = static_cast<int64>(std::floor((azimuth - halfWidth + Constants::k_PiD) * getSectorsPerRadian()));
+      const auto last = static_cast<int64>(std::floor((azimuth + halfWidth + Constants::k_PiD) * getSectorsPerRadian()));
+      const auto sectorCount = static_cast<int64>(m_NumSectors);
+      if(last - first + 1 < sectorCount)
+      {
+        firstSector = static_cast<usize>(((first % sectorCount) + sectorCount) % sectorCount);
+        numSectors = static_cast<usize>(last - first + 1);
+      }
+    }
+
+    for(usize band = firstBand; band <= lastBand; band++)
+    {
+      for(usize sectorOffset = 0; sectorOffset < numSectors; sectorOffset++)
+      {
+        const usize bin = band * m_NumSectors + (firstSector + sectorOffset) % m_NumSectors;
+        for(usize slot = m_BinOffsets[bin]; slot < m_BinOffsets[bin + 1]; slot++)
+        {
+          func(m_Items[slot]);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of cells.
+   * @return usize
+   */
+  usize getNumberOfBins() const
+  {
+    return m_NumBands * m_NumSectors;
+  }
+
+private:
+  SphereBins() = default;
+
+  float64 getSectorsPerRadian() const
+  {
+    return static_cast<float64>(m_NumSectors) / Constants::k_2PiD;
+  }
+
+  usize getBand(float64 z) const
+  {
+    const auto band = static_cast<usize>(std::max((std::clamp(z, -1.0, 1.0) + 1.0) * 0.5 * static_cast<float64>(m_NumBands), 0.0));
+    return std::min(band, m_NumBands - 1);
+  }
+
+  usize getSector(float64 azimuth) const
+  {
+    const auto sector = static_cast<usize>(std::max((azimuth + Constants::k_PiD) * getSectorsPerRadian(), 0.0));
+    return std::min(sector, m_NumSectors - 1);
+  }
+
+  usize m_NumBands = 1;
+  usize m_NumSectors = 1;
+  std::vector<usize> m_BinOffsets;
+  std::vector<usize> m_Items;
+};
+} // namespace nx::core
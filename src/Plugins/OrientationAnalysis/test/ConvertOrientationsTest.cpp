@@ -27,7 +27,14 @@
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+
 #include <catch2/catch.hpp>
+#include <fmt/format.h>
+
+#include <random>
 
 using namespace nx::core;
 
@@ -224,3 +231,167 @@ TEST_CASE("OrientationAnalysis::ConvertOrientations: Valid filter execution")
     }
   }
 }
+
+/**
+ * @brief TEST_CASE The Euler, Quaternion, AxisAngle and Rodrigues pairs are converted by the filter's own kernels. This
+ * test compares their output against EbsdLib's OrientationTransformation for random orientations and for the special
+ * cases that the kernels hand back to EbsdLib.
+ */
+TEST_CASE("OrientationAnalysis::ConvertOrientations: Conversion kernels match EbsdLib", "[OrientationAnalysis][ConvertOrientations]")
+{
+  using OrientationF = Orientation<float>;
+  using QuaternionF = Quaternion<float>;
+  // The indices of the input and output type choices
+  enum class RepType : ChoicesParameter::ValueType
+  {
+    Euler = 0,
+    OrientationMatrix = 1,
+    Quaternion = 2,
+    AxisAngle = 3,
+    Rodrigues = 4
+  };
+  const auto layout = QuaternionF::Order::VectorScalar;
+
+  // Identity, 180 degree rotations and Phi = 0, which the kernels do not convert themselves
+  std::vector<std::array<float, 3>> eulers = {{0.0F, 0.0F, 0.0F}, {numbers::pi_v<float> * 0.5F, 0.0F, numbers::pi_v<float> * 0.5F}, {1.0F, 1.0F, numbers::pi_v<float> - 1.0F}, {1.0F, 0.0F, 2.0F}};
+  // Random orientations away from the special cases, where float and double precision results agree to the tolerance
+  std::mt19937_64 generator(5489);
+  std::uniform_real_distribution<float> distribution(0.0F, 1.0F);
+  while(eulers.size() < 2000)
+  {
+    std::array<float, 3> euler = {distribution(generator) * numbers::pi_v<float> * 2.0F, distribution(generator) * numbers::pi_v<float>, distribution(generator) * numbers::pi_v<float> * 2.0F};
+    OrientationF eu(euler[0], euler[1], euler[2]);
+    QuaternionF qu = OrientationTransformation::eu2qu<OrientationF, QuaternionF>(eu, layout);
+    if(euler[1] > 0.05F && euler[1] < numbers::pi_v<float> - 0.05F && qu[3] > 0.05F)
+    {
+      eulers.push_back(euler);
+    }
+  }
+
+  auto toVector = [](const OrientationF& orientation) { return std::vector<float>(orientation.data(), orientation.data() + orientation.size()); };
+
+  // The input of every pair is the EbsdLib conversion of the Euler angles
+  auto toRepresentation = [layout, &toVector](const std::array<float, 3>& euler, RepType type) -> std::vector<float> {
+    OrientationF eu(euler[0], euler[1], euler[2]);
+    switch(type)
+    {
+    case RepType::Euler:
+      return {euler.cbegin(), euler.cend()};
+    case RepType::Quaternion: {
+      QuaternionF qu = OrientationTransformation::eu2qu<OrientationF, QuaternionF>(eu, layout);
+      return {qu[0], qu[1], qu[2], qu[3]};
+    }
+    case RepType::AxisAngle:
+      return toVector(OrientationTransformation::eu2ax<OrientationF, OrientationF>(eu));
+    case RepType::Rodrigues:
+      return toVector(OrientationTransformation::eu2ro<OrientationF, OrientationF>(eu));
+    default:
+      return {};
+    }
+  };
+
+  auto reference = [layout, &toVector](RepType inputType, RepType outputType, const std::vector<float>& input) -> std::vector<float> {
+    OrientationF orientation(input.size());
+    for(usize comp = 0; comp < input.size(); comp++)
+    {
+      orientation[comp] = input[comp];
+    }
+    if(inputType == RepType::Quaternion)
+    {
+      QuaternionF qu(input[0], input[1], input[2], input[3]);
+      OrientationF output;
+      switch(outputType)
+      {
+      case RepType::Euler:
+        output = OrientationTransformation::qu2eu<QuaternionF, OrientationF>(qu, layout);
+        break;
+      case RepType::OrientationMatrix:
+        output = OrientationTransformation::qu2om<QuaternionF, OrientationF>(qu, layout);
+        break;
+      case RepType::AxisAngle:
+        output = OrientationTransformation::qu2ax<QuaternionF, OrientationF>(qu, layout);
+        break;
+      default:
+        output = OrientationTransformation::qu2ro<QuaternionF, OrientationF>(qu, layout);
+        break;
+      }
+      return toVector(output);
+    }
+    if(outputType == RepType::Quaternion)
+    {
+      QuaternionF qu = inputType == RepType::Euler       ? OrientationTransformation::eu2qu<OrientationF, QuaternionF>(orientation, layout)
+                       : inputType == RepType::AxisAngle ? OrientationTransformation::ax2qu<OrientationF, QuaternionF>(orientation, layout)
+                                                         : OrientationTransformation::ro2qu<OrientationF, QuaternionF>(orientation, layout);
+      return {qu[0], qu[1], qu[2], qu[3]};
+    }
+    OrientationF output = outputType == RepType::OrientationMatrix ? OrientationTransformation::eu2om<OrientationF, OrientationF>(orientation)
+                          : outputType == RepType::AxisAngle       ? OrientationTransformation::eu2ax<OrientationF, OrientationF>(orientation)
+                                                                   : OrientationTransformation::eu2ro<OrientationF, OrientationF>(orientation);
+    return toVector(output);
+  };
+
+  const std::vector<std::pair<RepType, RepType>> pairs = {
+      {RepType::Euler, RepType::OrientationMatrix}, {RepType::Euler, RepType::Quaternion},        {RepType::Euler, RepType::AxisAngle},
+      {RepType::Euler, RepType::Rodrigues},         {RepType::Quaternion, RepType::Euler},        {RepType::Quaternion, RepType::OrientationMatrix},
+      {RepType::Quaternion, RepType::AxisAngle},    {RepType::Quaternion, RepType::Rodrigues},    {RepType::AxisAngle, RepType::Quaternion},
+      {RepType::Rodrigues, RepType::Quaternion}};
+  const std::vector<usize> strides = {3, 9, 4, 4, 4, 3, 3};
+
+  for(const auto& [inputType, outputType] : pairs)
+  {
+    const usize inStride = strides[static_cast<usize>(inputType)];
+    const usize outStride = strides[static_cast<usize>(outputType)];
+
+    ConvertOrientationsFilter filter;
+    DataStructure dataStructure;
+    Arguments args;
+
+    DataGroup* topLevelGroup = DataGroup::Create(dataStructure, Constants::k_SmallIN100);
+    DataGroup* scanData = DataGroup::Create(dataStructure, Constants::k_EbsdScanData, topLevelGroup->getId());
+    Float32Array* inputArray = UnitTest::CreateTestDataArray<float>(dataStructure, Constants::k_EulerAngles, {eulers.size()}, {inStride}, scanData->getId());
+
+    std::vector<std::vector<float>> expected;
+    for(usize tupleIndex = 0; tupleIndex < eulers.size(); tupleIndex++)
+    {
+      std::vector<float> input = toRepresentation(eulers[tupleIndex], inputType);
+      for(usize comp = 0; comp < inStride; comp++)
+      {
+        (*inputArray)[tupleIndex * inStride + comp] = input[comp];
+      }
+      expected.push_back(reference(inputType, outputType, input));
+    }
+
+    args.insertOrAssign(ConvertOrientationsFilter::k_InputType_Key, std::make_any<ChoicesParameter::ValueType>(static_cast<ChoicesParameter::ValueType>(inputType)));
+    args.insertOrAssign(ConvertOrientationsFilter::k_OutputType_Key, std::make_any<ChoicesParameter::ValueType>(static_cast<ChoicesParameter::ValueType>(outputType)));
+    args.insertOrAssign(ConvertOrientationsFilter::k_InputOrientationArrayPath_Key,
+                        std::make_any<DataPath>(DataPath({Constants::k_SmallIN100, Constants::k_EbsdScanData, Constants::k_EulerAngles})));
+    args.insertOrAssign(ConvertOrientationsFilter::k_OutputOrientationArrayName_Key, std::make_any<std::string>(Constants::k_AxisAngles));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    REQUIRE(preflightResult.outputActions.valid());
+    auto executeResult = filter.execute(dataStructure, args);
+    REQUIRE(executeResult.result.valid());
+
+    const auto& output = dataStructure.getDataRefAs<Float32Array>(DataPath({Constants::k_SmallIN100, Constants::k_EbsdScanData, Constants::k_AxisAngles}));
+    for(usize tupleIndex = 0; tupleIndex < eulers.size(); tupleIndex++)
+    {
+      for(usize comp = 0; comp < outStride; comp++)
+      {
+        const float value = output[tupleIndex * outStride + comp];
+        const float expectedValue = expected[tupleIndex][comp];
+        // Special cases, such as the infinite Rodrigues vector of a 180 degree rotation, come from EbsdLib in both
+        if(value == expectedValue || (std::isnan(value) && std::isnan(expectedValue)))
+        {
+          continue;
+        }
+        float absDif = std::fabs(value - expectedValue);
+        if(outputType == RepType::Euler)
+        {
+          absDif = std::min(absDif, std::fabs(numbers::pi_v<float> * 2.0F - absDif));
+        }
+        INFO(fmt::format("Pair {} -> {}, tuple {}, component {}", static_cast<int>(inputType), static_cast<int>(outputType), tupleIndex, comp));
+        REQUIRE(absDif < 0.0001F * std::max(1.0F, std::fabs(expectedValue)));
+      }
+    }
+  }
+}
@@ -6,17 +6,111 @@
 #include "OrientationAnalysis/OrientationAnalysis_test_dirs.hpp"
 #include "OrientationAnalysisTestUtils.hpp"
 
+#include "simplnx/Common/Numbers.hpp"
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataGroup.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include <cmath>
 #include <filesystem>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
 using namespace nx::core::Constants;
 
+TEST_CASE("Reconstruction::MergeTwinsFilter: Twin Groups", "[Reconstruction][MergeTwinsFilter]")
+{
+  // Features 1 to 6 form a chain of neighbors. Every orientation is a rotation about [111], so two neighbors are
+  // Sigma 3 twins exactly when their angles differ by 60 degrees: the groups are {1, 2}, {3, 4, 5} and {6}
+  constexpr usize k_NumFeatures = 7;
+  const std::vector<float32> k_AnglesDegrees = {0.0f, 0.0f, 60.0f, 15.0f, 75.0f, 135.0f, 150.0f};
+
+  const DataPath k_GroupPath({"Data"});
+  const DataPath k_CellDataPath = k_GroupPath.createChildPath("Cell Data");
+  const DataPath k_FeatureDataPath = k_GroupPath.createChildPath("Feature Data");
+  const DataPath k_EnsembleDataPath = k_GroupPath.createChildPath("Ensemble Data");
+
+  DataStructure dataStructure;
+  {
+    auto* group = DataGroup::Create(dataStructure, "Data");
+    auto* cellData = AttributeMatrix::Create(dataStructure, "Cell Data", {k_NumFeatures - 1}, group->getId());
+    auto* featureData = AttributeMatrix::Create(dataStructure, "Feature Data", {k_NumFeatures}, group->getId());
+    auto* ensembleData = AttributeMatrix::Create(dataStructure, "Ensemble Data", {2}, group->getId());
+
+    auto* featureIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, k_FeatureIds, {k_NumFeatures - 1}, {1}, cellData->getId());
+    auto* phases = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, k_Phases, {k_NumFeatures}, {1}, featureData->getId());
+    auto* avgQuats = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "AvgQuats", {k_NumFeatures}, {4}, featureData->getId());
+    auto* neighborList = NeighborList<int32>::Create(dataStructure, "NeighborList", k_NumFeatures, featureData->getId());
+    auto* crystalStructures = UInt32Array::CreateWithStore<UInt32DataStore>(dataStructure, "CrystalStructures", {2}, {1}, ensembleData->getId());
+    (*crystalStructures)[0] = EbsdLib::CrystalStructure::UnknownCrystalStructure;
+    (*crystalStructures)[1] = EbsdLib::CrystalStructure::Cubic_High;
+
+    for(int32 featureId = 1; featureId < static_cast<int32>(k_NumFeatures); featureId++)
+    {
+      (*featureIds)[featureId - 1] = featureId;
+      (*phases)[featureId] = 1;
+      const float32 halfAngle = k_AnglesDegrees[featureId] * numbers::pi_v<float32> / 360.0f;
+      const float32 axisComponent = std::sin(halfAngle) / std::sqrt(3.0f);
+      (*avgQuats)[featureId * 4 + 0] = axisComponent;
+      (*avgQuats)[featureId * 4 + 1] = axisComponent;
+      (*avgQuats)[featureId * 4 + 2] = axisComponent;
+      (*avgQuats)[featureId * 4 + 3] = std::cos(halfAngle);
+
+      auto neighbors = std::make_shared<std::vector<int32>>();
+      if(featureId > 1)
+      {
+        neighbors->push_back(featureId - 1);
+      }
+      if(featureId + 1 < static_cast<int32>(k_NumFeatures))
+      {
+        neighbors->push_back(featureId + 1);
+      }
+      neighborList->setList(featureId, neighbors);
+    }
+    (*avgQuats)[3] = 1.0f;
+  }
+
+  MergeTwinsFilter filter;
+  Arguments args;
+  args.insertOrAssign(MergeTwinsFilter::k_UseSeed_Key, std::make_any<bool>(true));
+  args.insertOrAssign(MergeTwinsFilter::k_ContiguousNeighborListArrayPath_Key, std::make_any<DataPath>(k_FeatureDataPath.createChildPath("NeighborList")));
+  args.insertOrAssign(MergeTwinsFilter::k_AxisTolerance_Key, std::make_any<float32>(1.0f));
+  args.insertOrAssign(MergeTwinsFilter::k_AngleTolerance_Key, std::make_any<float32>(1.0f));
+  args.insertOrAssign(MergeTwinsFilter::k_FeaturePhasesArrayPath_Key, std::make_any<DataPath>(k_FeatureDataPath.createChildPath(k_Phases)));
+  args.insertOrAssign(MergeTwinsFilter::k_AvgQuatsArrayPath_Key, std::make_any<DataPath>(k_FeatureDataPath.createChildPath("AvgQuats")));
+  args.insertOrAssign(MergeTwinsFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_CellDataPath.createChildPath(k_FeatureIds)));
+  args.insertOrAssign(MergeTwinsFilter::k_CrystalStructuresArrayPath_Key, std::make_any<DataPath>(k_EnsembleDataPath.createChildPath("CrystalStructures")));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // The parent ids are shuffled, so only which features share a parent is checked
+  const auto& featureParentIds = dataStructure.getDataRefAs<Int32Array>(k_FeatureDataPath.createChildPath("ParentIds"));
+  REQUIRE(featureParentIds[1] == featureParentIds[2]);
+  REQUIRE(featureParentIds[3] == featureParentIds[4]);
+  REQUIRE(featureParentIds[4] == featureParentIds[5]);
+  REQUIRE(featureParentIds[1] != featureParentIds[3]);
+  REQUIRE(featureParentIds[1] != featureParentIds[6]);
+  REQUIRE(featureParentIds[3] != featureParentIds[6]);
+
+  const auto& cellParentIds = dataStructure.getDataRefAs<Int32Array>(k_CellDataPath.createChildPath("ParentIds"));
+  for(usize cellIndex = 0; cellIndex < k_NumFeatures - 1; cellIndex++)
+  {
+    REQUIRE(cellParentIds[cellIndex] == featureParentIds[cellIndex + 1]);
+  }
+
+  // Parent 0 and the three groups
+  REQUIRE(dataStructure.getDataRefAs<BoolArray>(k_GroupPath.createChildPath("NewGrain Data").createChildPath("Active")).getNumberOfTuples() == 4);
+}
+
 TEST_CASE("Reconstruction::MergeTwinsFilter: Valid Execution", "[Reconstruction][MergeTwinsFilter][.][UNIMPLEMENTED][!mayfail]")
 {
   Application::GetOrCreateInstance()->loadPlugins(unit_test::k_BuildDir.view(), true);
@@ -0,0 +1,170 @@
+#include "OrientationAnalysis/Filters/Algorithms/EbsdToH5Ebsd.hpp"
+#include "OrientationAnalysis/Filters/ReadAngDataFilter.hpp"
+#include "OrientationAnalysis/Filters/ReadEbsdStackFilter.hpp"
+#include "OrientationAnalysis/Filters/RotateEulerRefFrameFilter.hpp"
+#include "OrientationAnalysis/OrientationAnalysis_test_dirs.hpp"
+
+#include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Parameters/GeneratedFileListParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
+#include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/OrientationTransformation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+using namespace nx::core::Constants;
+using namespace nx::core::UnitTest;
+
+namespace
+{
+const int32 k_StartIndex = 1;
+const int32 k_EndIndex = 6;
+const usize k_NumSlices = k_EndIndex - k_StartIndex + 1;
+const std::string k_InputPath = fmt::format("{}/Small_IN100", unit_test::k_TestFilesDir);
+const GeneratedFileListParameter::ValueType k_FileListInfo = {k_StartIndex, k_EndIndex, 1, 1, GeneratedFileListParameter::Ordering::LowToHigh, k_InputPath, "Slice_", "", ".ang"};
+
+const DataPath k_SliceGeometryPath({"Slice"});
+const DataPath k_SliceCellDataPath = k_SliceGeometryPath.createChildPath(k_CellData);
+
+DataStructure ReadStack(ChoicesParameter::ValueType stackingOrder, ChoicesParameter::ValueType referenceFrame)
+{
+  ReadEbsdStackFilter filter;
+  DataStructure dataStructure;
+  Arguments args;
+
+  args.insertOrAssign(ReadEbsdStackFilter::k_InputFileListInfo_Key, std::make_any<GeneratedFileListParameter::ValueType>(k_FileListInfo));
+  args.insertOrAssign(ReadEbsdStackFilter::k_ZSpacing_Key, std::make_any<Float32Parameter::ValueType>(0.25F));
+  args.insertOrAssign(ReadEbsdStackFilter::k_StackingOrder_Key, std::make_any<ChoicesParameter::ValueType>(stackingOrder));
+  args.insertOrAssign(ReadEbsdStackFilter::k_ReferenceFrame_Key, std::make_any<ChoicesParameter::ValueType>(referenceFrame));
+  args.insertOrAssign(ReadEbsdStackFilter::k_ComputeQuaternions_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ReadEbsdStackFilter::k_QuatsArrayName_Key, std::make_any<std::string>(k_Quats));
+  args.insertOrAssign(ReadEbsdStackFilter::k_CreatedImageGeometryPath_Key, std::make_any<DataPath>(k_DataContainerPath));
+  args.insertOrAssign(ReadEbsdStackFilter::k_CellAttributeMatrixName_Key, std::make_any<std::string>(k_CellData));
+  args.insertOrAssign(ReadEbsdStackFilter::k_CellEnsembleAttributeMatrixName_Key, std::make_any<std::string>(k_EnsembleAttributeMatrix));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  return dataStructure;
+}
+
+// Reads a single slice file with Read Ang Data, optionally followed by Rotate Euler Reference Frame
+DataStructure ReadSlice(int32 fileIndex, const std::vector<float32>& eulerTransform)
+{
+  DataStructure dataStructure;
+  {
+    ReadAngDataFilter filter;
+    Arguments args;
+    args.insertOrAssign(ReadAngDataFilter::k_InputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(fmt::format("{}/Slice_{}.ang", k_InputPath, fileIndex))));
+    args.insertOrAssign(ReadAngDataFilter::k_CreatedImageGeometryPath_Key, std::make_any<DataPath>(k_SliceGeometryPath));
+    args.insertOrAssign(ReadAngDataFilter::k_CellAttributeMatrixName_Key, std::make_any<std::string>(k_CellData));
+    args.insertOrAssign(ReadAngDataFilter::k_CellEnsembleAttributeMatrixName_Key, std::make_any<std::string>(k_EnsembleAttributeMatrix));
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+  if(eulerTransform[EbsdToH5EbsdInputConstants::k_AngleIndex] > 0.0F)
+  {
+    RotateEulerRefFrameFilter filter;
+    Arguments args;
+    args.insertOrAssign(RotateEulerRefFrameFilter::k_RotationAxisAngle_Key, std::make_any<VectorFloat32Parameter::ValueType>(eulerTransform));
+    args.insertOrAssign(RotateEulerRefFrameFilter::k_EulerAnglesArrayPath_Key, std::make_any<DataPath>(k_SliceCellDataPath.createChildPath(EbsdLib::CellData::EulerAngles)));
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+  return dataStructure;
+}
+
+// Every Z plane of the stack must hold the slice file the stacking order puts there
+void CompareSlices(const DataStructure& stackDataStructure, ChoicesParameter::ValueType stackingOrder, const std::vector<float32>& eulerTransform, float32 tolerance)
+{
+  const auto& stackPhases = stackDataStructure.getDataRefAs<Int32Array>(k_CellAttributeMatrix.createChildPath(EbsdLib::CellData::Phases));
+  const auto& stackEulers = stackDataStructure.getDataRefAs<Float32Array>(k_CellAttributeMatrix.createChildPath(EbsdLib::CellData::EulerAngles));
+  const auto& stackQuats = stackDataStructure.getDataRefAs<Float32Array>(k_CellAttributeMatrix.createChildPath(k_Quats));
+
+  for(int32 fileIndex = k_StartIndex; fileIndex <= k_EndIndex; fileIndex++)
+  {
+    const usize z = stackingOrder == EbsdToH5EbsdInputConstants::k_HighToLow ? static_cast<usize>(k_EndIndex - fileIndex) : static_cast<usize>(fileIndex - k_StartIndex);
+    UNSCOPED_INFO(fmt::format("Slice_{}.ang at Z = {}", fileIndex, z));
+
+    DataStructure sliceDataStructure = ReadSlice(fileIndex, eulerTransform);
+    const auto& slicePhases = sliceDataStructure.getDataRefAs<Int32Array>(k_SliceCellDataPath.createChildPath(EbsdLib::CellData::Phases));
+    const auto& sliceEulers = sliceDataStructure.getDataRefAs<Float32Array>(k_SliceCellDataPath.createChildPath(EbsdLib::CellData::EulerAngles));
+    const usize numCells = slicePhases.getNumberOfTuples();
+    REQUIRE(stackPhases.getNumberOfTuples() == numCells * k_NumSlices);
+
+    const usize offset = z * numCells;
+    usize numMismatches = 0;
+    for(usize cellIndex = 0; cellIndex < numCells; cellIndex++)
+    {
+      if(stackPhases[offset + cellIndex] != slicePhases[cellIndex])
+      {
+        numMismatches++;
+      }
+      const OrientationF euler(sliceEulers[cellIndex * 3], sliceEulers[cellIndex * 3 + 1], sliceEulers[cellIndex * 3 + 2]);
+      const QuatF quat = OrientationTransformation::eu2qu<OrientationF, QuatF>(euler);
+      for(usize comp = 0; comp < 3; comp++)
+      {
+        if(std::abs(stackEulers[(offset + cellIndex) * 3 + comp] - euler[comp]) > tolerance)
+        {
+          numMismatches++;
+        }
+      }
+      for(usize comp = 0; comp < 4; comp++)
+      {
+        if(std::abs(stackQuats[(offset + cellIndex) * 4 + comp] - quat[comp]) > tolerance)
+        {
+          numMismatches++;
+        }
+      }
+    }
+    REQUIRE(numMismatches == 0);
+  }
+}
+} // namespace
+
+TEST_CASE("OrientationAnalysis::ReadEbsdStackFilter: Slice Order", "[OrientationAnalysis][ReadEbsdStackFilter]")
+{
+  Application::GetOrCreateInstance()->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "Small_IN100.tar.gz", "Small_IN100");
+
+  for(ChoicesParameter::ValueType stackingOrder : {EbsdToH5EbsdInputConstants::k_LowToHigh, EbsdToH5EbsdInputConstants::k_HighToLow})
+  {
+    DYNAMIC_SECTION("Stacking Order: " << EbsdToH5EbsdInputConstants::k_StackingChoices[stackingOrder])
+    {
+      DataStructure dataStructure = ReadStack(stackingOrder, EbsdToH5EbsdInputConstants::k_Unknown);
+
+      const auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(k_DataContainerPath);
+      REQUIRE(imageGeom.getDimensions()[2] == k_NumSlices);
+      REQUIRE(imageGeom.getSpacing()[2] == Approx(0.25F));
+
+      // Without a reference frame transformation the stack must match the slices exactly
+      CompareSlices(dataStructure, stackingOrder, EbsdToH5EbsdInputConstants::k_NoEulerTransform, 0.0F);
+    }
+  }
+}
+
+TEST_CASE("OrientationAnalysis::ReadEbsdStackFilter: Euler Reference Frame", "[OrientationAnalysis][ReadEbsdStackFilter]")
+{
+  Application::GetOrCreateInstance()->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "Small_IN100.tar.gz", "Small_IN100");
+
+  DataStructure dataStructure = ReadStack(EbsdToH5EbsdInputConstants::k_LowToHigh, EbsdToH5EbsdInputConstants::k_Edax);
+
+  CompareSlices(dataStructure, EbsdToH5EbsdInputConstants::k_LowToHigh, EbsdToH5EbsdInputConstants::k_EdaxEulerTransform, UnitTest::EPSILON);
+}
@@ -3,9 +3,7 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 using namespace nx::core;
 
@@ -60,13 +58,6 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
   auto selectedCellDataChildren = GetAllChildArrayDataPaths(m_DataStructure, srcImageGeom.getCellDataPath());
   auto selectedCellArrays = selectedCellDataChildren.has_value() ? selectedCellDataChildren.value() : std::vector<DataPath>{};
 
-  ImageRotationUtilities::FilterProgressCallback filterProgressCallback(m_MessageHandler, m_ShouldCancel);
-
-  // The actual rotating of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
-  taskRunner.setParallelizationEnabled(true);
-
   const DataPath srcCelLDataAMPath = srcImageGeom.getCellDataPath();
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
 
@@ -90,38 +81,30 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
     destCellDataAM.resizeTuples(dataArrayShape);
   }
 
+  std::vector<std::pair<const IDataArray*, IDataArray*>> cellArrays;
   for(const auto& [dataId, srcDataObject] : srcCellDataAM)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
     const auto* srcDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(srcCelLDataAMPath.createChildPath(srcDataObject->getName()));
     auto* destDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(destCellDataAMPath.createChildPath(srcDataObject->getName()));
-
-    if(m_InputValues->InterpolationSelection == detail::k_NearestNeighborInterpolationIdx)
+    if(srcDataArrayPtr == nullptr || destDataArrayPtr == nullptr)
     {
-      m_MessageHandler(fmt::format("Applying Transform || Nearest Neighbor Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithNearestNeighbor>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr, rotateArgs,
-                                                                                              m_TransformationMatrix, false, &filterProgressCallback);
-    }
-    else if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
-    {
-      m_MessageHandler(fmt::format("Applying Transform || Trilinear Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithTrilinearInterpolation, NoBooleanType>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr,
-                                                                                                                    rotateArgs, m_TransformationMatrix, &filterProgressCallback);
-    }
-
-    if(getCancel())
-    {
-      break;
+      continue;
     }
+    cellArrays.emplace_back(srcDataArrayPtr, destDataArrayPtr);
   }
 
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
+  // All cell arrays are resampled together so the mapping from the transformed cells back to the original cells is only computed once
+  ImageRotationUtilities::InterpolationType interpolation = ImageRotationUtilities::InterpolationType::NearestNeighbor;
+  if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
+  {
+    m_MessageHandler(fmt::format("Applying Transform || Trilinear Interpolation of {} Cell Arrays", cellArrays.size()));
+    interpolation = ImageRotationUtilities::InterpolationType::Trilinear;
+  }
+  else
+  {
+    m_MessageHandler(fmt::format("Applying Transform || Nearest Neighbor Interpolation of {} Cell Arrays", cellArrays.size()));
+  }
+  ImageRotationUtilities::TransformCellArrays(cellArrays, rotateArgs, m_TransformationMatrix, interpolation, false, m_MessageHandler, m_ShouldCancel);
 
   return {};
 }
@@ -6,100 +6,220 @@
 #include "simplnx/Utilities/HistogramUtilities.hpp"
 #include "simplnx/Utilities/Math/StatisticsCalculations.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
+#include <numeric>
 #include <unordered_map>
 
 using namespace nx::core;
 
 namespace
 {
-// -----------------------------------------------------------------------------
-bool CheckArraysInMemory(const nx::core::IParallelAlgorithm::AlgorithmArrays& arrays)
+/**
+ * @brief Storage type used for per-feature values. std::vector<bool> packs its elements
+ * so bool values are stored as bytes to allow features to be written from separate threads.
+ */
+template <typename T>
+using FeatureValueType = std::conditional_t<std::is_same_v<T, bool>, uint8, T>;
+
+/**
+ * @brief Per-feature running statistics. Each chunk of tuples owns one instance so that
+ * the tuples can be accumulated without any synchronization. The mean and M2 values are
+ * updated with Welford's algorithm so that chunks can be merged without a second pass.
+ */
+template <typename T>
+struct FeatureAccumulators
 {
-  if(arrays.empty())
+  explicit FeatureAccumulators(usize numFeatures)
+  : length(numFeatures, 0)
+  , min(numFeatures, static_cast<FeatureValueType<T>>(std::numeric_limits<T>::max()))
+  , max(numFeatures, static_cast<FeatureValueType<T>>(std::numeric_limits<T>::lowest()))
+  , sum(numFeatures, 0.0)
+  , mean(numFeatures, 0.0)
+  , m2(numFeatures, 0.0)
   {
-    return true;
   }
 
-  for(const auto* arrayPtr : arrays)
+  std::vector<uint64> length;
+  std::vector<FeatureValueType<T>> min;
+  std::vector<FeatureValueType<T>> max;
+  std::vector<float64> sum;
+  std::vector<float64> mean;
+  std::vector<float64> m2;
+};
+
+/**
+ * @brief Accumulates the tuples [start, end) into the chunk's FeatureAccumulators. Tuples
+ * that are masked out or that have a feature id outside [0, numFeatures) are skipped.
+ */
+template <typename T>
+class AccumulateFeatureChunkImpl
+{
+public:
+  AccumulateFeatureChunkImpl(const AbstractDataStore<T>& source, const AbstractDataStore<int32>& featureIds, const MaskCompare* mask, usize start, usize end, FeatureAccumulators<T>& accumulators,
+                             const std::atomic_bool& shouldCancel)
+  : m_Source(source)
+  , m_FeatureIds(featureIds)
+  , m_Mask(mask)
+  , m_Start(start)
+  , m_End(end)
+  , m_Accumulators(accumulators)
+  , m_ShouldCancel(shouldCancel)
   {
-    if(arrayPtr == nullptr)
+  }
+
+  void operator()() const
+  {
+    const auto numFeatures = static_cast<int64>(m_Accumulators.length.size());
+    for(usize i = m_Start; i < m_End; i++)
     {
-      continue;
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      if(m_Mask != nullptr && !m_Mask->isTrue(i))
+      {
+        continue;
+      }
+      const int32 featureId = m_FeatureIds[i];
+      if(featureId < 0 || featureId >= numFeatures)
+      {
+        continue;
+      }
+
+      const auto value = static_cast<FeatureValueType<T>>(m_Source[i]);
+      const uint64 length = ++m_Accumulators.length[featureId];
+      if(value < m_Accumulators.min[featureId])
+      {
+        m_Accumulators.min[featureId] = value;
+      }
+      if(value > m_Accumulators.max[featureId])
+      {
+        m_Accumulators.max[featureId] = value;
+      }
+      const auto floatValue = static_cast<float64>(value);
+      m_Accumulators.sum[featureId] += floatValue;
+      const float64 delta = floatValue - m_Accumulators.mean[featureId];
+      m_Accumulators.mean[featureId] += delta / static_cast<float64>(length);
+      m_Accumulators.m2[featureId] += delta * (floatValue - m_Accumulators.mean[featureId]);
     }
+  }
+
+private:
+  const AbstractDataStore<T>& m_Source;
+  const AbstractDataStore<int32>& m_FeatureIds;
+  const MaskCompare* m_Mask = nullptr;
+  usize m_Start;
+  usize m_End;
+  FeatureAccumulators<T>& m_Accumulators;
+  const std::atomic_bool& m_ShouldCancel;
+};
 
-    if(!arrayPtr->getIDataStoreRef().getDataFormat().empty())
+/**
+ * @brief Merges the chunk accumulators of each feature into a single set of accumulators.
+ * When the values are going to be grouped by feature, the chunk lengths are replaced with
+ * the position each chunk starts writing its values for that feature.
+ */
+template <typename T>
+class MergeFeatureAccumulatorsImpl
+{
+public:
+  MergeFeatureAccumulatorsImpl(std::vector<FeatureAccumulators<T>>& chunks, FeatureAccumulators<T>& merged)
+  : m_Chunks(chunks)
+  , m_Merged(merged)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
     {
-      return false;
+      for(const auto& chunk : m_Chunks)
+      {
+        const uint64 chunkLength = chunk.length[featureId];
+        if(chunkLength == 0)
+        {
+          continue;
+        }
+        const uint64 length = m_Merged.length[featureId];
+        const uint64 newLength = length + chunkLength;
+        const float64 delta = chunk.mean[featureId] - m_Merged.mean[featureId];
+        m_Merged.mean[featureId] += delta * static_cast<float64>(chunkLength) / static_cast<float64>(newLength);
+        m_Merged.m2[featureId] += chunk.m2[featureId] + delta * delta * static_cast<float64>(length) * static_cast<float64>(chunkLength) / static_cast<float64>(newLength);
+        m_Merged.length[featureId] = newLength;
+        m_Merged.sum[featureId] += chunk.sum[featureId];
+        m_Merged.min[featureId] = std::min(m_Merged.min[featureId], chunk.min[featureId]);
+        m_Merged.max[featureId] = std::max(m_Merged.max[featureId], chunk.max[featureId]);
+      }
     }
   }
 
-  return true;
-}
+private:
+  std::vector<FeatureAccumulators<T>>& m_Chunks;
+  FeatureAccumulators<T>& m_Merged;
+};
 
+/**
+ * @brief Converts each chunk's per-feature length into the index that chunk starts writing
+ * its values for that feature. Chunks are laid out in tuple order within each feature so the
+ * grouped values are identical no matter how many chunks were used.
+ */
 template <typename T>
-class ComputeArrayStatisticsByIndexImpl
+class ComputeChunkCursorsImpl
 {
 public:
-  ComputeArrayStatisticsByIndexImpl(bool length, bool min, bool max, bool mean, bool mode, bool stdDeviation, bool summation, bool hist, float64 histmin, float64 histmax, bool histfullrange,
-                                    int32 numBins, bool modalBinRanges, const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source,
-                                    BoolArray* featureHasDataArray, UInt64Array* lengthArray, DataArray<T>* minArray, DataArray<T>* maxArray, Float32Array* meanArray, NeighborList<T>* modeArray,
-                                    Float32Array* stdDevArray, Float32Array* summationArray, UInt64Array* histBinCountsArray, DataArray<T>* histBinRangesArray, UInt64Array* mostPopulatedBinArray,
-                                    NeighborList<T>* modalBinRangesArray, ComputeArrayStatistics* filter)
-  : m_Length(length)
-  , m_Min(min)
-  , m_Max(max)
-  , m_Mean(mean)
-  , m_Mode(mode)
-  , m_StdDeviation(stdDeviation)
-  , m_Summation(summation)
-  , m_Histogram(hist)
-  , m_HistMin(histmin)
-  , m_HistMax(histmax)
-  , m_HistFullRange(histfullrange)
-  , m_NumBins(numBins)
-  , m_ModalBinRanges(modalBinRanges)
-  , m_Mask(mask)
-  , m_FeatureIds(featureIds)
-  , m_Source(source)
-  , m_FeatureHasDataArray(featureHasDataArray)
-  , m_LengthArray(lengthArray)
-  , m_MinArray(minArray)
-  , m_MaxArray(maxArray)
-  , m_MeanArray(meanArray)
-  , m_ModeArray(modeArray)
-  , m_StdDevArray(stdDevArray)
-  , m_SummationArray(summationArray)
-  , m_HistBinCountsArray(histBinCountsArray)
-  , m_HistBinRangesArray(histBinRangesArray)
-  , m_MostPopulatedBinArray(mostPopulatedBinArray)
-  , m_ModalBinRangesArray(modalBinRangesArray)
-  , m_Filter(filter)
+  ComputeChunkCursorsImpl(std::vector<FeatureAccumulators<T>>& chunks, const std::vector<uint64>& featureOffsets)
+  : m_Chunks(chunks)
+  , m_FeatureOffsets(featureOffsets)
   {
   }
 
-  void compute(usize start, usize end) const
+  void operator()(const Range& range) const
   {
-    std::chrono::steady_clock::time_point initialTime = std::chrono::steady_clock::now();
-    auto now = std::chrono::steady_clock::now();
-    const usize milliDelay = 1000;
-
-    const std::atomic_bool& shouldCancel = m_Filter->getCancel();
-    const usize numTuples = m_FeatureIds->getNumberOfTuples();
-    const usize numCurrentFeatures = end - start;
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      uint64 cursor = m_FeatureOffsets[featureId];
+      for(auto& chunk : m_Chunks)
+      {
+        const uint64 chunkLength = chunk.length[featureId];
+        chunk.length[featureId] = cursor;
+        cursor += chunkLength;
+      }
+    }
+  }
 
-    std::vector<uint64> length(numCurrentFeatures, 0);
-    std::vector<T> min(numCurrentFeatures, std::numeric_limits<T>::max());
-    std::vector<T> max(numCurrentFeatures, std::numeric_limits<T>::min());
-    std::vector<float32> summation(numCurrentFeatures, 0);
-    std::vector<std::map<T, uint64>> modalMaps(numCurrentFeatures);
-    usize progressCount = 0;
+private:
+  std::vector<FeatureAccumulators<T>>& m_Chunks;
+  const std::vector<uint64>& m_FeatureOffsets;
+};
 
-    usize progressIncrement = numTuples / 100;
+/**
+ * @brief Scatters the tuples [start, end) into the feature grouped value buffer using the
+ * cursors computed by ComputeChunkCursorsImpl.
+ */
+template <typename T>
+class GroupFeatureValuesImpl
+{
+public:
+  GroupFeatureValuesImpl(const AbstractDataStore<T>& source, const AbstractDataStore<int32>& featureIds, const MaskCompare* mask, usize start, usize end, std::vector<uint64>& cursors,
+                         std::vector<FeatureValueType<T>>& groupedValues, const std::atomic_bool& shouldCancel)
+  : m_Source(source)
+  , m_FeatureIds(featureIds)
+  , m_Mask(mask)
+  , m_Start(start)
+  , m_End(end)
+  , m_Cursors(cursors)
+  , m_GroupedValues(groupedValues)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
 
-    for(usize i = 0; i < numTuples; ++i)
+  void operator()() const
+  {
+    const auto numFeatures = static_cast<int64>(m_Cursors.size());
+    for(usize i = m_Start; i < m_End; i++)
     {
-      if(shouldCancel)
+      if(m_ShouldCancel)
       {
         return;
       }
@@ -107,396 +227,369 @@ public:
       {
         continue;
       }
-      for(usize j = 0; j < numCurrentFeatures; j++)
+      const int32 featureId = m_FeatureIds[i];
+      if(featureId < 0 || featureId >= numFeatures)
       {
-        if((*m_FeatureIds)[i] != static_cast<int32>(start + j))
-        {
-          continue;
-        }
-
-        ++length[j];
-
-        if(m_Source[i] < min[j])
-        {
-          min[j] = m_Source[i];
-        }
-
-        if(m_Source[i] > max[j])
-        {
-          max[j] = m_Source[i];
-        }
+        continue;
+      }
+      m_GroupedValues[m_Cursors[featureId]++] = static_cast<FeatureValueType<T>>(m_Source[i]);
+    }
+  }
 
-        summation[j] = summation[j] + m_Source[i];
+private:
+  const AbstractDataStore<T>& m_Source;
+  const AbstractDataStore<int32>& m_FeatureIds;
+  const MaskCompare* m_Mask = nullptr;
+  usize m_Start;
+  usize m_End;
+  std::vector<uint64>& m_Cursors;
+  std::vector<FeatureValueType<T>>& m_GroupedValues;
+  const std::atomic_bool& m_ShouldCancel;
+};
 
-        modalMaps[j][m_Source[i]]++;
-      }
+/**
+ * @brief Writes the requested statistics for a range of features. The order statistics
+ * (median, modes, number of unique values and histogram) are computed from each feature's
+ * segment of the grouped value buffer, which is sorted in place when needed.
+ */
+template <typename T>
+class StoreFeatureStatisticsImpl
+{
+public:
+  StoreFeatureStatisticsImpl(const ComputeArrayStatisticsInputValues* inputValues, std::vector<IArray*>& arrays, const FeatureAccumulators<T>& merged, usize numTuples,
+                             const std::vector<uint64>& featureOffsets, std::vector<FeatureValueType<T>>& groupedValues, const std::atomic_bool& shouldCancel)
+  : m_InputValues(inputValues)
+  , m_Merged(merged)
+  , m_NumTuples(numTuples)
+  , m_FeatureOffsets(featureOffsets)
+  , m_GroupedValues(groupedValues)
+  , m_ShouldCancel(shouldCancel)
+  , m_FeatureHasData(dynamic_cast<BoolArray*>(arrays[13]))
+  , m_LengthArray(dynamic_cast<UInt64Array*>(arrays[0]))
+  , m_MinArray(dynamic_cast<DataArray<T>*>(arrays[1]))
+  , m_MaxArray(dynamic_cast<DataArray<T>*>(arrays[2]))
+  , m_MeanArray(dynamic_cast<Float32Array*>(arrays[3]))
+  , m_MedianArray(dynamic_cast<Float32Array*>(arrays[4]))
+  , m_ModeArray(dynamic_cast<NeighborList<T>*>(arrays[5]))
+  , m_StdDevArray(dynamic_cast<Float32Array*>(arrays[6]))
+  , m_SummationArray(dynamic_cast<Float32Array*>(arrays[7]))
+  , m_HistBinCountsArray(dynamic_cast<UInt64Array*>(arrays[8]))
+  , m_NumUniqueValuesArray(dynamic_cast<Int32Array*>(arrays[9]))
+  , m_MostPopulatedBinArray(dynamic_cast<UInt64Array*>(arrays[10]))
+  , m_ModalBinRangesArray(dynamic_cast<NeighborList<T>*>(arrays[11]))
+  , m_HistBinRangesArray(dynamic_cast<DataArray<T>*>(arrays[12]))
+  {
+  }
 
-      progressCount++;
-      now = std::chrono::steady_clock::now();
-      if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      if(m_ShouldCancel)
       {
-        m_Filter->sendThreadSafeInfoMessage(fmt::format("Calculating FeatureHasData Array [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(i) / static_cast<float>(numTuples)));
-        progressCount = 0;
-        initialTime = std::chrono::steady_clock::now();
+        return;
       }
+      storeMoments(featureId);
+      storeOrderStatistics(featureId);
     }
+  }
+
+private:
+  void storeMoments(usize featureId) const
+  {
+    const uint64 length = m_Merged.length[featureId];
+    const float64 sum = m_Merged.sum[featureId];
 
-    m_Filter->sendThreadSafeInfoMessage(fmt::format("Storing Results Feature/Ensemble Range [{}-{}]", start, end));
-    progressIncrement = numCurrentFeatures / 100;
-    progressCount = 0;
-    std::vector<float32> meanArray;
-    if(m_StdDeviation && !m_Mean)
+    m_FeatureHasData->setValue(featureId, length > 0);
+    if(m_InputValues->FindLength)
     {
-      meanArray.resize(numCurrentFeatures);
+      m_LengthArray->setValue(featureId, length);
     }
-    for(usize j = start; j < end; j++)
+    if(m_InputValues->FindSummation)
     {
-      if(shouldCancel)
-      {
-        return;
-      }
-      const usize localFeatureIndex = j - start;
-
-      m_FeatureHasDataArray->initializeTuple(j, (length[localFeatureIndex] > 0));
-      if(m_Length)
-      {
-        m_LengthArray->initializeTuple(j, length[localFeatureIndex]);
-      }
-      if(m_Min)
+      m_SummationArray->setValue(featureId, static_cast<float32>(sum));
+    }
+    if(length > 0)
+    {
+      if(m_InputValues->FindMin)
       {
-        m_MinArray->initializeTuple(j, min[localFeatureIndex]);
+        m_MinArray->setValue(featureId, static_cast<T>(m_Merged.min[featureId]));
       }
-      if(m_Max)
+      if(m_InputValues->FindMax)
       {
-        m_MaxArray->initializeTuple(j, max[localFeatureIndex]);
+        m_MaxArray->setValue(featureId, static_cast<T>(m_Merged.max[featureId]));
       }
-      if(m_Summation)
+    }
+
+    float64 mean = 0.0;
+    float64 sumOfSquaredDiffs = m_Merged.m2[featureId];
+    if constexpr(std::is_same_v<T, bool>)
+    {
+      // The mean of a bool feature is the majority value so the squared differences are the count of the other value
+      mean = static_cast<float64>(length > 0 && sum >= (static_cast<float64>(m_NumTuples) - sum));
+      sumOfSquaredDiffs = mean > 0.0 ? static_cast<float64>(length) - sum : sum;
+    }
+    else if(length > 0)
+    {
+      mean = m_Merged.mean[featureId];
+    }
+    if(m_InputValues->FindMean)
+    {
+      m_MeanArray->setValue(featureId, static_cast<float32>(mean));
+    }
+    if(m_InputValues->FindStdDeviation)
+    {
+      m_StdDevArray->setValue(featureId, static_cast<float32>(std::sqrt(sumOfSquaredDiffs / static_cast<float64>(length))));
+    }
+  }
+
+  void storeOrderStatistics(usize featureId) const
+  {
+    if(!m_InputValues->FindMedian && !m_InputValues->FindMode && !m_InputValues->FindNumUniqueValues && !m_InputValues->FindHistogram)
+    {
+      return;
+    }
+    const auto begin = m_GroupedValues.begin() + static_cast<int64>(m_FeatureOffsets[featureId]);
+    const auto end = m_GroupedValues.begin() + static_cast<int64>(m_FeatureOffsets[featureId + 1]);
+    const auto length = static_cast<usize>(end - begin);
+
+    const bool sorted = m_InputValues->FindMode || m_InputValues->FindNumUniqueValues;
+    if(sorted)
+    {
+      std::sort(begin, end);
+    }
+
+    if(m_InputValues->FindMedian && length > 0)
+    {
+      const auto upper = begin + static_cast<int64>(length / 2);
+      if(!sorted)
       {
-        m_SummationArray->initializeTuple(j, summation[localFeatureIndex]);
+        std::nth_element(begin, upper, end);
       }
-
-      float32 meanValue = 0.0f;
-      if(length[localFeatureIndex] > 0)
+      float32 median = static_cast<float32>(*upper);
+      if(length % 2 == 0)
       {
-        if constexpr(std::is_same_v<T, bool>)
-        {
-          meanValue = static_cast<float32>(summation[localFeatureIndex] >= (numTuples - summation[localFeatureIndex]));
-        }
-        else
-        {
-          meanValue = summation[localFeatureIndex] / static_cast<float32>(length[localFeatureIndex]);
-        }
+        const auto lower = std::max_element(begin, upper);
+        median = (*lower + *upper) * 0.5f;
       }
+      m_MedianArray->setValue(featureId, median);
+    }
 
-      if(m_Mean)
+    if(m_InputValues->FindMode || m_InputValues->FindNumUniqueValues)
+    {
+      int32 numUnique = 0;
+      usize maxCount = 0;
+      for(auto runStart = begin; runStart != end;)
       {
-        m_MeanArray->initializeTuple(j, meanValue);
+        const auto runEnd = std::upper_bound(runStart, end, *runStart);
+        maxCount = std::max(maxCount, static_cast<usize>(runEnd - runStart));
+        numUnique++;
+        runStart = runEnd;
       }
-      else if(m_StdDeviation)
+      if(m_InputValues->FindNumUniqueValues)
       {
-        meanArray[localFeatureIndex] = meanValue;
+        m_NumUniqueValuesArray->setValue(featureId, numUnique);
       }
-
-      if(m_Mode)
+      if(m_InputValues->FindMode)
       {
-        if(!modalMaps[localFeatureIndex].empty())
+        for(auto runStart = begin; runStart != end;)
         {
-          // Find the maximum occurrence
-          auto pr = std::max_element(modalMaps[localFeatureIndex].begin(), modalMaps[localFeatureIndex].end(), [](const auto& x, const auto& y) { return x.second < y.second; });
-          int maxCount = pr->second;
-
-          // Store all values that have this maximum occurrence under the proper feature id
-          for(const auto& modalPair : modalMaps[localFeatureIndex])
+          const auto runEnd = std::upper_bound(runStart, end, *runStart);
+          if(static_cast<usize>(runEnd - runStart) == maxCount)
           {
-            if(modalPair.second == maxCount)
-            {
-              m_ModeArray->addEntry(j, modalPair.first);
-            }
+            m_ModeArray->addEntry(static_cast<int32>(featureId), static_cast<T>(*runStart));
           }
+          runStart = runEnd;
         }
       }
+    }
 
-      AbstractDataStore<uint64>* binCountsStorePtr = nullptr;
-      if(m_HistBinCountsArray != nullptr)
-      {
-        binCountsStorePtr = m_HistBinCountsArray->getDataStore();
-      }
+    if(m_InputValues->FindHistogram)
+    {
+      storeHistogram(featureId, begin, end);
+    }
+  }
 
-      AbstractDataStore<T>* binRangesStorePtr = nullptr;
-      if(m_HistBinRangesArray != nullptr)
+  template <typename IteratorType>
+  void storeHistogram(usize featureId, IteratorType begin, IteratorType end) const
+  {
+    const int32 numBins = m_InputValues->NumBins;
+    const auto length = static_cast<uint64>(end - begin);
+    std::vector<T> ranges(numBins * 2);
+    std::vector<uint64> histogram(numBins, 0);
+    if(length > 0)
+    {
+      auto histMin = static_cast<T>(m_InputValues->MinRange);
+      auto histMax = static_cast<T>(m_InputValues->MaxRange);
+      if(m_InputValues->UseFullRange)
       {
-        binRangesStorePtr = m_HistBinRangesArray->getDataStore();
+        histMin = static_cast<T>(m_Merged.min[featureId]);
+        histMax = static_cast<T>(m_Merged.max[featureId]) + static_cast<T>(1.0);
       }
 
-      AbstractDataStore<uint64>* mostPopulatedBinDataStorePtr = nullptr;
-      if(m_MostPopulatedBinArray != nullptr)
+      HistogramUtilities::serial::FillBinRanges(ranges, std::make_pair(histMin, histMax), numBins);
+
+      const float32 increment = HistogramUtilities::serial::CalculateIncrement(histMin, histMax, numBins);
+      if(std::fabs(increment) < 1E-10)
       {
-        mostPopulatedBinDataStorePtr = m_MostPopulatedBinArray->getDataStore();
+        histogram[0] = length;
       }
-
-      if(m_Histogram && binCountsStorePtr != nullptr && binRangesStorePtr != nullptr)
+      else
       {
-        std::vector<T> ranges(m_NumBins * 2);
-        std::vector<uint64> histogram(m_NumBins, 0);
-        if(length[localFeatureIndex] > 0)
+        for(auto iter = begin; iter != end; ++iter)
         {
-          T histMin = static_cast<T>(m_HistMin);
-          T histMax = static_cast<T>(m_HistMax);
-
-          if(m_HistFullRange)
-          {
-            histMin = min[localFeatureIndex];
-            histMax = max[localFeatureIndex] + static_cast<T>(1.0);
-          }
-
-          HistogramUtilities::serial::FillBinRanges(ranges, std::make_pair(histMin, histMax), m_NumBins);
-
-          const float32 increment = HistogramUtilities::serial::CalculateIncrement(histMin, histMax, m_NumBins);
-          if(std::fabs(increment) < 1E-10)
-          {
-            histogram[0] = length[localFeatureIndex];
-          }
-          else
-          {
-            for(usize i = 0; i < numTuples; ++i)
-            {
-              if(shouldCancel)
-              {
-                return;
-              }
-              if(m_Mask != nullptr && !m_Mask->isTrue(i))
-              {
-                continue;
-              }
-              if((*m_FeatureIds)[i] != static_cast<int32>(j))
-              {
-                continue;
-              }
-              const T value = m_Source[i];
-              const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(value, histMin, increment)); // find bin for this input array value
-              if((bin >= 0) && (bin < m_NumBins))                                                                       // make certain bin is in range
-              {
-                histogram[bin]++; // increment histogram element corresponding to this input array value
-              }
-            } // end of numTuples loop
-          }   // end of increment else
-
-          if(m_ModalBinRanges)
+          const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(static_cast<T>(*iter), histMin, increment));
+          if((bin >= 0) && (bin < numBins))
           {
-            if(std::fabs(increment) < 1E-10)
-            {
-              m_ModalBinRangesArray->addEntry(j, histMin);
-              m_ModalBinRangesArray->addEntry(j, histMax);
-            }
-            else
-            {
-              auto modeList = m_ModeArray->getList(j);
-              for(int i = 0; i < modeList->size(); i++)
-              {
-                const T mode = modeList->at(i);
-                const auto modalBin = HistogramUtilities::serial::CalculateBin(mode, histMin, increment);
-                if((modalBin >= 0) && (modalBin < m_NumBins)) // make certain bin is in range
-                {
-                  m_ModalBinRangesArray->addEntry(j, ranges[modalBin]);
-                  m_ModalBinRangesArray->addEntry(j, ranges[modalBin + 1]);
-                }
-              }
-            }
+            histogram[bin]++;
           }
-        } // end of length if
-
-        binCountsStorePtr->setTuple(j, histogram);
-        binRangesStorePtr->setTuple(j, ranges);
-
-        auto maxElementIt = std::max_element(histogram.begin(), histogram.end());
-        uint64 index = std::distance(histogram.begin(), maxElementIt);
-        mostPopulatedBinDataStorePtr->setComponent(j, 0, index);
-        mostPopulatedBinDataStorePtr->setComponent(j, 1, histogram[index]);
-      } // end of m_Histogram if
-
-      progressCount++;
-      now = std::chrono::steady_clock::now();
-      if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
-      {
-        m_Filter->sendThreadSafeInfoMessage(fmt::format("Storing data for feature/ensembles [{}-{}] {}/{}", start, end, j, end));
-        progressCount = 0;
-        initialTime = std::chrono::steady_clock::now();
+        }
       }
-    }
 
-    if(m_StdDeviation)
-    {
-      // https://www.khanacademy.org/math/statistics-probability/summarizing-quantitative-data/variance-standard-deviation-population/a/calculating-standard-deviation-step-by-step
-      m_Filter->sendThreadSafeInfoMessage(fmt::format("Computing StdDev Feature/Ensemble [{}-{}]", start, end));
-      // This should probably be done with Kahan Summation instead
-      std::vector<float64> sumOfDiffs(numCurrentFeatures, 0.0f);
-      progressCount = 0;
-
-      for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+      if(m_InputValues->FindModalBinRanges)
       {
-        if(shouldCancel)
-        {
-          return;
-        }
-        // Is the value in a mask and if so, is that mask TRUE
-        if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
+        if(std::fabs(increment) < 1E-10)
         {
-          continue;
-        }
-        // Is the featureId within our range that we care about
-        const int32 featureId = (*m_FeatureIds)[tupleIndex];
-        if(featureId < start || featureId >= end)
-        {
-          continue;
+          m_ModalBinRangesArray->addEntry(static_cast<int32>(featureId), histMin);
+          m_ModalBinRangesArray->addEntry(static_cast<int32>(featureId), histMax);
         }
-
-        const float32 meanVal = m_Mean ? m_MeanArray->operator[](featureId) : meanArray[featureId - start];
-        sumOfDiffs[featureId - start] += static_cast<float64>((m_Source[tupleIndex] - meanVal) * (m_Source[tupleIndex] - meanVal));
-
-        progressCount++;
-        now = std::chrono::steady_clock::now();
-        if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+        else
         {
-          m_Filter->sendThreadSafeInfoMessage(fmt::format("StdDev Calculation Feature/Ensemble [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-          progressCount = 0;
-          initialTime = std::chrono::steady_clock::now();
+          auto modeList = m_ModeArray->getList(static_cast<int32>(featureId));
+          for(const T mode : *modeList)
+          {
+            const auto modalBin = HistogramUtilities::serial::CalculateBin(mode, histMin, increment);
+            if((modalBin >= 0) && (modalBin < numBins))
+            {
+              m_ModalBinRangesArray->addEntry(static_cast<int32>(featureId), ranges[modalBin]);
+              m_ModalBinRangesArray->addEntry(static_cast<int32>(featureId), ranges[modalBin + 1]);
+            }
+          }
         }
       }
-
-      for(usize j = 0; j < numCurrentFeatures; j++)
-      {
-        // Set the value into the output array
-        const uint64 lengthVal = m_Length ? m_LengthArray->operator[](j + start) : length[j];
-        m_StdDevArray->operator[](j + start) = static_cast<float32>(std::sqrt(sumOfDiffs[j] / static_cast<float64>(lengthVal)));
-      }
     }
 
-  } // end of compute
+    m_HistBinCountsArray->getDataStoreRef().setTuple(featureId, histogram);
+    m_HistBinRangesArray->getDataStoreRef().setTuple(featureId, ranges);
 
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
+    auto maxElementIt = std::max_element(histogram.begin(), histogram.end());
+    const auto index = static_cast<uint64>(std::distance(histogram.begin(), maxElementIt));
+    auto& mostPopulatedBinStore = m_MostPopulatedBinArray->getDataStoreRef();
+    mostPopulatedBinStore.setComponent(featureId, 0, index);
+    mostPopulatedBinStore.setComponent(featureId, 1, histogram[index]);
   }
 
-private:
-  bool m_Length;
-  bool m_Min;
-  bool m_Max;
-  bool m_Mean;
-  bool m_Mode;
-  bool m_StdDeviation;
-  bool m_Summation;
-  bool m_Histogram;
-  bool m_ModalBinRanges;
-  float64 m_HistMin;
-  float64 m_HistMax;
-  bool m_HistFullRange;
-  int32 m_NumBins;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
-  const Int32Array* m_FeatureIds = nullptr;
-  const DataArray<T>& m_Source;
-  BoolArray* m_FeatureHasDataArray = nullptr;
+  const ComputeArrayStatisticsInputValues* m_InputValues = nullptr;
+  const FeatureAccumulators<T>& m_Merged;
+  usize m_NumTuples;
+  const std::vector<uint64>& m_FeatureOffsets;
+  std::vector<FeatureValueType<T>>& m_GroupedValues;
+  const std::atomic_bool& m_ShouldCancel;
+  BoolArray* m_FeatureHasData = nullptr;
   UInt64Array* m_LengthArray = nullptr;
   DataArray<T>* m_MinArray = nullptr;
   DataArray<T>* m_MaxArray = nullptr;
   Float32Array* m_MeanArray = nullptr;
+  Float32Array* m_MedianArray = nullptr;
   NeighborList<T>* m_ModeArray = nullptr;
   Float32Array* m_StdDevArray = nullptr;
   Float32Array* m_SummationArray = nullptr;
   UInt64Array* m_HistBinCountsArray = nullptr;
-  DataArray<T>* m_HistBinRangesArray = nullptr;
+  Int32Array* m_NumUniqueValuesArray = nullptr;
   UInt64Array* m_MostPopulatedBinArray = nullptr;
   NeighborList<T>* m_ModalBinRangesArray = nullptr;
-  ComputeArrayStatistics* m_Filter = nullptr;
+  DataArray<T>* m_HistBinRangesArray = nullptr;
 };
 
+/**
+ * @brief Computes all of the requested per-feature statistics. The tuples are split into
+ * contiguous chunks that accumulate the moments of every feature in a single pass, the chunks
+ * are merged per feature and, only when an order statistic is requested, a second pass
+ * groups the values by feature so each feature can be processed on its own.
+ */
 template <typename T>
-class FindArrayMedianUniqueByIndexImpl
+void FindStatisticsByIndex(const DataArray<T>& source, const Int32Array& featureIdsArray, const MaskCompare* mask, const ComputeArrayStatisticsInputValues* inputValues,
+                           std::vector<IArray*>& arrays, usize numFeatures, ComputeArrayStatistics* filter)
 {
-public:
-  FindArrayMedianUniqueByIndexImpl(const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source, bool findMedian, bool findNumUnique, Float32Array* medianArray,
-                                   Int32Array* numUniqueValuesArray, DataArray<uint64>* lengthArray, ComputeArrayStatistics* filter)
-  : m_FindMedian(findMedian)
-  , m_FindNumUniqueValues(findNumUnique)
-  , m_MedianArray(medianArray)
-  , m_NumUniqueValuesArray(numUniqueValuesArray)
-  , m_Mask(mask)
-  , m_FeatureIds(featureIds)
-  , m_Source(source)
-  , m_LengthArray(lengthArray)
-  , m_Filter(filter)
+  const std::atomic_bool& shouldCancel = filter->getCancel();
+  const auto& sourceStore = source.getDataStoreRef();
+  const auto& featureIds = featureIdsArray.getDataStoreRef();
+  const usize numTuples = source.getNumberOfTuples();
+
+  IParallelAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(&source);
+  algArrays.push_back(&featureIdsArray);
+  for(const auto* array : arrays)
+  {
+    if(const auto* dataArray = dynamic_cast<const IDataArray*>(array); dataArray != nullptr)
+    {
+      algArrays.push_back(dataArray);
+    }
+  }
+
+  // Pass 1: accumulate the moments of each feature over contiguous chunks of tuples.
+  // The chunk count is limited so the chunk accumulators never outgrow the input.
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.requireArraysInMemory(algArrays);
+  const usize numChunks =
+      taskRunner.getParallelizationEnabled() ? std::max<usize>(1, std::min<usize>(taskRunner.getMaxThreads(), numTuples / std::max<usize>(numFeatures, 1))) : 1;
+  const usize chunkSize = (numTuples + numChunks - 1) / numChunks;
+
+  filter->sendThreadSafeInfoMessage(fmt::format("Accumulating statistics for {} features using {} chunks", numFeatures, numChunks));
+  std::vector<FeatureAccumulators<T>> chunks(numChunks, FeatureAccumulators<T>(numFeatures));
+  for(usize chunk = 0; chunk < numChunks; chunk++)
+  {
+    const usize start = std::min(chunk * chunkSize, numTuples);
+    const usize end = std::min(start + chunkSize, numTuples);
+    taskRunner.execute(AccumulateFeatureChunkImpl<T>(sourceStore, featureIds, mask, start, end, chunks[chunk], shouldCancel));
+  }
+  taskRunner.wait();
+  if(shouldCancel)
   {
+    return;
   }
 
-  virtual ~FindArrayMedianUniqueByIndexImpl() = default;
+  FeatureAccumulators<T> merged(numFeatures);
+  ParallelDataAlgorithm mergeAlg;
+  mergeAlg.setRange(0, numFeatures);
+  mergeAlg.requireArraysInMemory(algArrays);
+  mergeAlg.execute(MergeFeatureAccumulatorsImpl<T>(chunks, merged));
 
-  FindArrayMedianUniqueByIndexImpl(const FindArrayMedianUniqueByIndexImpl&) = default;           // Copy Constructor Not Implemented
-  FindArrayMedianUniqueByIndexImpl(FindArrayMedianUniqueByIndexImpl&&) noexcept = default;       // Move Constructor Not Implemented
-  FindArrayMedianUniqueByIndexImpl& operator=(const FindArrayMedianUniqueByIndexImpl&) = delete; // Copy Assignment Not Implemented
-  FindArrayMedianUniqueByIndexImpl& operator=(FindArrayMedianUniqueByIndexImpl&&) = delete;      // Move Assignment Not Implemented
+  std::vector<uint64> featureOffsets(numFeatures + 1, 0);
+  std::partial_sum(merged.length.begin(), merged.length.end(), featureOffsets.begin() + 1);
 
-  void compute(usize start, usize end) const
+  // Pass 2: group the values by feature for the median, mode, unique value and histogram calculations
+  std::vector<FeatureValueType<T>> groupedValues;
+  if(inputValues->FindMedian || inputValues->FindMode || inputValues->FindNumUniqueValues || inputValues->FindHistogram)
   {
-    m_Filter->sendThreadSafeInfoMessage(fmt::format("Starting Median Array Calculation: Feature/Ensemble [{}-{}]", start, end));
+    filter->sendThreadSafeInfoMessage("Grouping values by feature");
+    groupedValues.resize(featureOffsets.back());
 
-    const usize numFeatureSources = end - start;
-    // Create the arrays that will collect the values from the arrays. allocate them to the correct size based on the length array
-    std::vector<std::vector<T>> featureSources(numFeatureSources);
-    for(usize featureSourceIndex = 0; featureSourceIndex < numFeatureSources; featureSourceIndex++)
-    {
-      featureSources[featureSourceIndex].reserve(m_LengthArray->operator[](featureSourceIndex + start));
-    }
-    const usize numTuples = m_Source.getNumberOfTuples();
-    const auto& featureIds = m_FeatureIds->getDataStoreRef();
-    const auto& source = m_Source.getDataStoreRef();
+    ParallelDataAlgorithm cursorAlg;
+    cursorAlg.setRange(0, numFeatures);
+    cursorAlg.requireArraysInMemory(algArrays);
+    cursorAlg.execute(ComputeChunkCursorsImpl<T>(chunks, featureOffsets));
 
-    for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+    for(usize chunk = 0; chunk < numChunks; chunk++)
     {
-      // Is the value in a mask and if so, is that mask TRUE
-      if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
-      {
-        continue;
-      }
-      // Is the featureId within our range that we care about
-      const int32 featureId = featureIds[tupleIndex];
-      if(featureId < start || featureId >= end)
-      {
-        continue;
-      }
-      featureSources[featureId - start].push_back(source[tupleIndex]);
+      const usize start = std::min(chunk * chunkSize, numTuples);
+      const usize end = std::min(start + chunkSize, numTuples);
+      taskRunner.execute(GroupFeatureValuesImpl<T>(sourceStore, featureIds, mask, start, end, chunks[chunk].length, groupedValues, shouldCancel));
     }
-
-    for(usize featureSourceIndex = 0; featureSourceIndex < numFeatureSources; featureSourceIndex++)
+    taskRunner.wait();
+    if(shouldCancel)
     {
-      if(m_FindMedian)
-      {
-        const float32 val = StatisticsCalculations::findMedian(featureSources[featureSourceIndex]);
-        m_MedianArray->setValue(featureSourceIndex + start, val);
-      }
-      if(m_FindNumUniqueValues)
-      {
-        const auto val = StatisticsCalculations::findNumUniqueValues(featureSources[featureSourceIndex]);
-        m_NumUniqueValuesArray->setValue(featureSourceIndex + start, val);
-      }
+      return;
     }
   }
+  chunks.clear();
 
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
-  }
-
-private:
-  bool m_FindMedian;
-  bool m_FindNumUniqueValues;
-  Float32Array* m_MedianArray;
-  Int32Array* m_NumUniqueValuesArray;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
-  const Int32Array* m_FeatureIds = nullptr;
-  const DataArray<T>& m_Source;
-  const DataArray<uint64>* m_LengthArray = nullptr;
-  ComputeArrayStatistics* m_Filter = nullptr;
-};
+  filter->sendThreadSafeInfoMessage("Storing per-feature statistics");
+  ParallelDataAlgorithm storeAlg;
+  storeAlg.setRange(0, numFeatures);
+  storeAlg.requireArraysInMemory(algArrays);
+  storeAlg.execute(StoreFeatureStatisticsImpl<T>(inputValues, arrays, merged, numTuples, featureOffsets, groupedValues, shouldCancel));
+}
 
 // -----------------------------------------------------------------------------
 template <class ContainerType, typename T>
@@ -696,81 +789,7 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
 {
   if(inputValues->ComputeByIndex)
   {
-    auto* lengthArrayPtr = dynamic_cast<DataArray<uint64>*>(arrays[0]);
-    auto* minArrayPtr = dynamic_cast<DataArray<T>*>(arrays[1]);
-    auto* maxArrayPtr = dynamic_cast<DataArray<T>*>(arrays[2]);
-    auto* meanArrayPtr = dynamic_cast<Float32Array*>(arrays[3]);
-    auto* modeArrayPtr = dynamic_cast<NeighborList<T>*>(arrays[5]);
-    auto* stdDevArrayPtr = dynamic_cast<Float32Array*>(arrays[6]);
-    auto* summationArrayPtr = dynamic_cast<Float32Array*>(arrays[7]);
-
-    auto* histBinCountsArrayPtr = dynamic_cast<UInt64Array*>(arrays[8]);
-    auto* histBinRangesArrayPtr = dynamic_cast<DataArray<T>*>(arrays[12]);
-    auto* mostPopulatedBinPtr = dynamic_cast<UInt64Array*>(arrays[10]);
-    auto* modalBinsArrayPtr = dynamic_cast<NeighborList<T>*>(arrays[11]);
-
-    auto* featureHasDataPtr = dynamic_cast<BoolArray*>(arrays[13]);
-
-    IParallelAlgorithm::AlgorithmArrays indexAlgArrays;
-    indexAlgArrays.push_back(&source);
-    indexAlgArrays.push_back(featureHasDataPtr);
-    indexAlgArrays.push_back(lengthArrayPtr);
-    indexAlgArrays.push_back(minArrayPtr);
-    indexAlgArrays.push_back(maxArrayPtr);
-    indexAlgArrays.push_back(meanArrayPtr);
-    indexAlgArrays.push_back(stdDevArrayPtr);
-    indexAlgArrays.push_back(summationArrayPtr);
-    indexAlgArrays.push_back(histBinCountsArrayPtr);
-    indexAlgArrays.push_back(histBinRangesArrayPtr);
-    indexAlgArrays.push_back(mostPopulatedBinPtr);
-
-#ifdef SIMPLNX_ENABLE_MULTICORE
-    if(CheckArraysInMemory(indexAlgArrays))
-    {
-      const tbb::simple_partitioner simplePartitioner;
-      const size_t grainSize = 500;
-      const tbb::blocked_range<size_t> tbbRange(0, numFeatures, grainSize);
-      tbb::parallel_for(tbbRange,
-                        ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
-                                                             inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
-                                                             inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
-                                                             lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
-                                                             histBinRangesArrayPtr, mostPopulatedBinPtr, modalBinsArrayPtr, filter),
-                        simplePartitioner);
-    }
-    else
-    {
-      ParallelDataAlgorithm indexAlg;
-      indexAlg.setRange(0, numFeatures);
-      indexAlg.requireArraysInMemory(indexAlgArrays);
-      indexAlg.execute(ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
-                                                            inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
-                                                            inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
-                                                            lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
-                                                            histBinRangesArrayPtr, mostPopulatedBinPtr, modalBinsArrayPtr, filter));
-    }
-#endif
-
-    if(inputValues->FindMedian || inputValues->FindNumUniqueValues)
-    {
-      filter->sendThreadSafeInfoMessage("Starting Median Calculation..");
-
-      auto* medianArrayPtr = dynamic_cast<Float32Array*>(arrays[4]);
-      auto* numUniqueValuesArrayPtr = dynamic_cast<Int32Array*>(arrays[9]);
-
-      IParallelAlgorithm::AlgorithmArrays medianAlgArrays;
-      medianAlgArrays.push_back(featureIds);
-      medianAlgArrays.push_back(&source);
-      medianAlgArrays.push_back(medianArrayPtr);
-      medianAlgArrays.push_back(numUniqueValuesArrayPtr);
-      medianAlgArrays.push_back(lengthArrayPtr);
-
-      ParallelDataAlgorithm medianDataAlg;
-      medianDataAlg.requireArraysInMemory(medianAlgArrays);
-      medianDataAlg.setRange(0, numFeatures);
-      medianDataAlg.execute(
-          FindArrayMedianUniqueByIndexImpl<T>(mask, featureIds, source, inputValues->FindMedian, inputValues->FindNumUniqueValues, medianArrayPtr, numUniqueValuesArrayPtr, lengthArrayPtr, filter));
-    }
+    FindStatisticsByIndex<T>(source, *featureIds, mask.get(), inputValues, arrays, numFeatures, filter);
   }
   else
   {
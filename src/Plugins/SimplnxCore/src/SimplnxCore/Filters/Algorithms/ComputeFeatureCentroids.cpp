@@ -3,84 +3,21 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/FeatureReduction.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-class ComputeFeatureCentroidsImpl1
+/**
+ * @brief Kahan compensated sum of the voxel centers of a single feature.
+ */
+struct CentroidAccumulator
 {
-public:
-  ComputeFeatureCentroidsImpl1(double* sum, double* center, size_t* count, std::array<size_t, 3> dims, const nx::core::ImageGeom& imageGeom, const Int32AbstractDataStore& featureIds)
-  : m_Sum(sum)
-  , m_Center(center)
-  , m_Count(count)
-  , m_Dims(dims)
-  , m_ImageGeom(imageGeom)
-  , m_FeatureIds(featureIds)
-  {
-  }
-  ~ComputeFeatureCentroidsImpl1() = default;
-  void compute(usize minFeatureId, usize maxFeatureId) const
-  {
-    for(size_t i = 0; i < m_Dims[2]; i++)
-    {
-      size_t zStride = i * m_Dims[0] * m_Dims[1];
-      for(size_t j = 0; j < m_Dims[1]; j++)
-      {
-        size_t yStride = j * m_Dims[0];
-        for(size_t k = 0; k < m_Dims[0]; k++)
-        {
-          int32 featureId = m_FeatureIds[zStride + yStride + k]; // Get the current FeatureId
-          if(featureId < minFeatureId || featureId >= maxFeatureId)
-          {
-            continue;
-          }
-          nx::core::Point3Dd voxel_center = m_ImageGeom.getCoords(k, j, i); // Get the voxel center based on XYZ index from Image Geom
-
-          // Kahan Sum for X Coord
-          size_t featureId_idx = featureId * 3ULL;
-          auto componentValue = static_cast<double>(voxel_center[0] - m_Center[featureId_idx]);
-          double temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-
-          // Kahan Sum for Y Coord
-          featureId_idx = featureId * 3ULL + 1;
-          componentValue = static_cast<double>(voxel_center[1] - m_Center[featureId_idx]);
-          temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-
-          // Kahan Sum for Z Coord
-          featureId_idx = featureId * 3ULL + 2;
-          componentValue = static_cast<double>(voxel_center[2] - m_Center[featureId_idx]);
-          temp = m_Sum[featureId_idx] + componentValue;
-          m_Center[featureId_idx] = (temp - m_Sum[featureId_idx]) - componentValue;
-          m_Sum[featureId_idx] = temp;
-          m_Count[featureId_idx]++;
-        }
-      }
-    }
-  }
-
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
-  }
-
-private:
-  double* m_Sum = nullptr;
-  double* m_Center = nullptr;
-  size_t* m_Count = nullptr;
-  std::array<size_t, 3> m_Dims = {0, 0, 0};
-  const nx::core::ImageGeom& m_ImageGeom;
-  const Int32AbstractDataStore& m_FeatureIds;
+  std::array<float64, 3> sum = {0.0, 0.0, 0.0};
+  std::array<float64, 3> compensation = {0.0, 0.0, 0.0};
+  usize count = 0;
 };
-
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -114,45 +51,49 @@ Result<> ComputeFeatureCentroids::operator()()
   // Required Geometry
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
-  size_t totalFeatures = centroids.getNumberOfTuples();
+  const usize totalFeatures = centroids.getNumberOfTuples();
 
-  size_t xPoints = imageGeom.getNumXCells();
-  size_t yPoints = imageGeom.getNumYCells();
-  size_t zPoints = imageGeom.getNumZCells();
+  const usize xPoints = imageGeom.getNumXCells();
+  const usize yPoints = imageGeom.getNumYCells();
 
-  std::vector<double> sum(totalFeatures * 3, 0.0);
-  std::vector<double> center(totalFeatures * 3, 0.0);
-  std::vector<size_t> count(totalFeatures * 3, 0.0);
-
-  // The first part can be expensive so parallelize the algorithm
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setRange(0, totalFeatures);
-  // This is OFF because we spend more time spinning up threads than actually
-  // computing things. Maybe if we were to break teh total number of features
-  // by the total number of cores/threads and do a ParallelTask Algorithm instead
-  // we might see some speedup.
-  dataAlg.setParallelizationEnabled(false);
-  dataAlg.execute(ComputeFeatureCentroidsImpl1(sum.data(), center.data(), count.data(), {xPoints, yPoints, zPoints}, imageGeom, featureIds));
+  FeatureReduction<CentroidAccumulator> featureReduction(featureIds, totalFeatures, CentroidAccumulator{});
+  auto reductionResult = featureReduction.executeInElementOrder(
+      [&imageGeom, xPoints, yPoints](CentroidAccumulator& accumulator, usize, usize voxelIndex) {
+        const usize xIndex = voxelIndex % xPoints;
+        const usize yIndex = (voxelIndex / xPoints) % yPoints;
+        const usize zIndex = voxelIndex / (xPoints * yPoints);
+        const Point3Dd voxelCenter = imageGeom.getCoords(xIndex, yIndex, zIndex); // Get the voxel center based on XYZ index from Image Geom
+        for(usize comp = 0; comp < 3; comp++)
+        {
+          const float64 componentValue = voxelCenter[comp] - accumulator.compensation[comp];
+          const float64 temp = accumulator.sum[comp] + componentValue;
+          accumulator.compensation[comp] = (temp - accumulator.sum[comp]) - componentValue;
+          accumulator.sum[comp] = temp;
+        }
+        accumulator.count++;
+      },
+      m_ShouldCancel);
+  if(reductionResult.invalid())
+  {
+    return ConvertResult(std::move(reductionResult));
+  }
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+  const std::vector<CentroidAccumulator>& featureSums = reductionResult.value();
 
   // Here we are only looping over the number of features so let this just go in serial mode.
-  for(size_t featureId = 0; featureId < totalFeatures; featureId++)
+  for(usize featureId = 0; featureId < totalFeatures; featureId++)
   {
-    auto featureId_idx = static_cast<size_t>(featureId * 3);
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
-    {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
-    }
-
-    featureId_idx++; // featureId * 3 + 1
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
+    const CentroidAccumulator& accumulator = featureSums[featureId];
+    if(accumulator.count == 0)
     {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
+      continue;
     }
-
-    featureId_idx++; // featureId * 3 + 2
-    if(static_cast<float>(count[featureId_idx]) > 0.0f)
+    for(usize comp = 0; comp < 3; comp++)
     {
-      centroids[featureId_idx] = static_cast<float>(sum[featureId_idx] / static_cast<double>(count[featureId_idx]));
+      centroids[featureId * 3 + comp] = static_cast<float32>(accumulator.sum[comp] / static_cast<float64>(accumulator.count));
     }
   }
 
@@ -1,16 +1,17 @@
 #include "ComputeFeatureRect.hpp"
 
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/FeatureReduction.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-// -----------------------------------------------------------------------------
-usize IndexFromCoord(const std::vector<usize>& tDims, usize x, usize y, usize z)
-{
-  return (tDims[1] * tDims[0] * z) + (tDims[0] * y) + x;
-}
+// Min X, Min Y, Min Z, Max X, Max Y, Max Z. Sequence dependent DO NOT REORDER
+using FeatureCorners = std::array<uint32, 6>;
+
+constexpr FeatureCorners k_EmptyCorners = {std::numeric_limits<uint32>::max(), std::numeric_limits<uint32>::max(), std::numeric_limits<uint32>::max(),
+                                           std::numeric_limits<uint32>::min(), std::numeric_limits<uint32>::min(), std::numeric_limits<uint32>::min()};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -39,16 +40,6 @@ Result<> ComputeFeatureRect::operator()()
   auto* corners = m_DataStructure.getDataAs<UInt32Array>(m_InputValues->FeatureRectArrayPath);
   auto& cornersStore = corners->getDataStoreRef();
 
-  // Create corners array, which stores pixel coordinates for the top-left and bottom-right coordinates of each feature object
-  for(usize i = 0; i < cornersStore.getNumberOfTuples(); i++)
-  {
-    cornersStore.setComponent(i, 0, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 1, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 2, std::numeric_limits<uint32>::max());
-    cornersStore.setComponent(i, 3, std::numeric_limits<uint32>::min());
-    cornersStore.setComponent(i, 4, std::numeric_limits<uint32>::min());
-    cornersStore.setComponent(i, 5, std::numeric_limits<uint32>::min());
-  }
   std::vector<usize> imageDims = featureIdsStore.getTupleShape();
 
   /*
@@ -59,51 +50,48 @@ Result<> ComputeFeatureRect::operator()()
 
   const usize xDim = imageDims[0];
   const usize yDim = imageDims[1];
-  const usize zDim = imageDims[2];
-
-  usize index = 0;
-  // Store the coordinates in the corners array
-  for(uint32 z = 0; z < zDim; z++)
-  {
-    if(getCancel())
-    {
-      return {};
-    }
-
-    for(uint32 y = 0; y < yDim; y++)
-    {
-      for(uint32 x = 0; x < xDim; x++)
-      {
-        index = IndexFromCoord(imageDims, x, y, z); // Index into featureIds array
-
-        const int32 featureId = featureIdsStore[index];
-        if(featureId == 0)
+  const usize numFeatures = cornersStore.getNumberOfTuples();
+
+  // Feature 0 is accumulated like every other feature but never written to the corners array.
+  FeatureReduction<FeatureCorners> featureReduction(featureIdsStore, numFeatures, k_EmptyCorners);
+  auto reductionResult = featureReduction.execute(
+      [xDim, yDim](FeatureCorners& featureRect, usize, usize index) {
+        const std::array<uint32, 3> indices = {static_cast<uint32>(index % xDim), static_cast<uint32>((index / xDim) % yDim), static_cast<uint32>(index / (xDim * yDim))};
+        for(usize l = 0; l < 3; l++)
         {
-          continue;
+          featureRect[l] = std::min(featureRect[l], indices[l]);
+          featureRect[l + 3] = std::max(featureRect[l + 3], indices[l]);
         }
-
-        if(featureId >= cornersStore.getNumberOfTuples())
+      },
+      [](FeatureCorners& featureRect, const FeatureCorners& otherRect) {
+        for(usize l = 0; l < 3; l++)
         {
-          const DataPath parentPath = m_InputValues->FeatureRectArrayPath.getParent();
-          return MakeErrorResult(-31000, fmt::format("The parent data object '{}' of output array '{}' has a smaller tuple count than the maximum feature id in '{}'", parentPath.getTargetName(),
-                                                     corners->getName(), featureIds->getName()));
+          featureRect[l] = std::min(featureRect[l], otherRect[l]);
+          featureRect[l + 3] = std::max(featureRect[l + 3], otherRect[l + 3]);
         }
+      },
+      m_ShouldCancel);
+  if(reductionResult.invalid() && reductionResult.errors().front().code == FeatureReduction<FeatureCorners>::k_FeatureIdOutOfRangeError)
+  {
+    const DataPath parentPath = m_InputValues->FeatureRectArrayPath.getParent();
+    return MakeErrorResult(-31000, fmt::format("The parent data object '{}' of output array '{}' has a smaller tuple count than the maximum feature id in '{}'", parentPath.getTargetName(),
+                                               corners->getName(), featureIds->getName()));
+  }
+  if(reductionResult.invalid())
+  {
+    return ConvertResult(std::move(reductionResult));
+  }
+  if(getCancel())
+  {
+    return {};
+  }
 
-        const uint32 indices[3] = {x, y, z}; // Sequence dependent DO NOT REORDER
-        const int32 featureShift = featureId * 6;
-        for(uint8 l = 0; l < 6; l++) // unsigned is faster with modulo
-        {
-          if(l > 2)
-          {
-            cornersStore[featureShift + l] = std::max(cornersStore[featureShift + l], indices[l - 3]);
-          }
-          else
-          {
-            cornersStore[featureShift + l] = std::min(cornersStore[featureShift + l], indices[l]);
-          }
-        }
-      }
-    }
+  // Store the coordinates in the corners array, which holds pixel coordinates for the top-left and bottom-right coordinates of each feature object
+  const std::vector<FeatureCorners>& featureCorners = reductionResult.value();
+  cornersStore.setTuple(0, k_EmptyCorners);
+  for(usize featureId = 1; featureId < numFeatures; featureId++)
+  {
+    cornersStore.setTuple(featureId, featureCorners[featureId]);
   }
 
   return {};
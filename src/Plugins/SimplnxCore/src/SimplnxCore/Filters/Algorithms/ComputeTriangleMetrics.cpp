@@ -0,0 +1,342 @@
+#include "ComputeTriangleMetrics.hpp"
+
+#include "simplnx/Common/Constants.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_ReadFacesError = -76980;
+constexpr int32 k_WriteMetricsError = -76981;
+
+constexpr usize k_TrianglesPerBlock = 2048;
+constexpr float64 k_RadToDeg = Constants::k_180OverPiD;
+
+/**
+ * @brief The corner coordinates of a block of triangles, one contiguous array per corner and axis, so that
+ * the metric loops below read consecutive triangles from consecutive memory and can be vectorized.
+ */
+struct TriangleBlock
+{
+  explicit TriangleBlock(usize capacity)
+  : faces(capacity * 3)
+  {
+    for(auto& values : coords)
+    {
+      values.resize(capacity);
+    }
+  }
+
+  const float32* x(usize corner) const
+  {
+    return coords[corner * 3].data();
+  }
+  const float32* y(usize corner) const
+  {
+    return coords[corner * 3 + 1].data();
+  }
+  const float32* z(usize corner) const
+  {
+    return coords[corner * 3 + 2].data();
+  }
+
+  std::vector<IGeometry::MeshIndexType> faces;
+  std::array<std::vector<float32>, 9> coords;
+};
+
+/**
+ * @brief The ComputeTriangleMetricsImpl class computes the selected metrics for a range of triangles. Each block of
+ * triangles reads its face list once, gathers the corner coordinates once and then runs every selected metric over them.
+ * The formulas match the ones of the single metric filters.
+ */
+class ComputeTriangleMetricsImpl
+{
+public:
+  ComputeTriangleMetricsImpl(const AbstractDataStore<IGeometry::MeshIndexType>& faces, const Float32AbstractDataStore& vertices, Float64AbstractDataStore* areas, Float64AbstractDataStore* normals,
+                             Float64AbstractDataStore* centroids, Float64AbstractDataStore* minDihedralAngles, std::atomic_bool& readFailed, std::atomic_bool& writeFailed,
+                             const std::atomic_bool& shouldCancel)
+  : m_Faces(faces)
+  , m_Vertices(vertices)
+  , m_InMemoryVertices(dynamic_cast<const DataStore<float32>*>(&vertices))
+  , m_Areas(areas)
+  , m_Normals(normals)
+  , m_Centroids(centroids)
+  , m_MinDihedralAngles(minDihedralAngles)
+  , m_ReadFailed(readFailed)
+  , m_WriteFailed(writeFailed)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    TriangleBlock block(std::min(k_TrianglesPerBlock, range.size()));
+    std::vector<float64> values(block.faces.size());
+
+    for(usize blockStart = range.min(); blockStart < range.max(); blockStart += k_TrianglesPerBlock)
+    {
+      if(m_ShouldCancel || m_ReadFailed || m_WriteFailed)
+      {
+        return;
+      }
+      const usize count = std::min(k_TrianglesPerBlock, range.max() - blockStart);
+
+      if(m_Faces.copyIntoBuffer(blockStart * 3, nonstd::span<IGeometry::MeshIndexType>(block.faces.data(), count * 3)).invalid())
+      {
+        m_ReadFailed = true;
+        return;
+      }
+      if(m_InMemoryVertices != nullptr)
+      {
+        gather(block, count, m_InMemoryVertices->data());
+      }
+      else
+      {
+        gather(block, count, m_Vertices);
+      }
+
+      if(m_Areas != nullptr)
+      {
+        computeAreas(block, count, values.data());
+        write(*m_Areas, blockStart, values.data(), count);
+      }
+      if(m_Normals != nullptr)
+      {
+        computeNormals(block, count, values.data());
+        write(*m_Normals, blockStart * 3, values.data(), count * 3);
+      }
+      if(m_Centroids != nullptr)
+      {
+        computeCentroids(block, count, values.data());
+        write(*m_Centroids, blockStart * 3, values.data(), count * 3);
+      }
+      if(m_MinDihedralAngles != nullptr)
+      {
+        computeMinDihedralAngles(block, count, values.data());
+        write(*m_MinDihedralAngles, blockStart, values.data(), count);
+      }
+    }
+  }
+
+private:
+  template <class VerticesT>
+  static void gather(TriangleBlock& block, usize count, const VerticesT& vertices)
+  {
+    for(usize corner = 0; corner < 3; corner++)
+    {
+      float32* x = block.coords[corner * 3].data();
+      float32* y = block.coords[corner * 3 + 1].data();
+      float32* z = block.coords[corner * 3 + 2].data();
+      for(usize i = 0; i < count; i++)
+      {
+        const usize vertexOffset = block.faces[i * 3 + corner] * 3;
+        x[i] = vertices[vertexOffset];
+        y[i] = vertices[vertexOffset + 1];
+        z[i] = vertices[vertexOffset + 2];
+      }
+    }
+  }
+
+  static void computeAreas(const TriangleBlock& block, usize count, float64* areas)
+  {
+    const float32* x0 = block.x(0);
+    const float32* y0 = block.y(0);
+    const float32* z0 = block.z(0);
+    const float32* x1 = block.x(1);
+    const float32* y1 = block.y(1);
+    const float32* z1 = block.z(1);
+    const float32* x2 = block.x(2);
+    const float32* y2 = block.y(2);
+    const float32* z2 = block.z(2);
+    for(usize i = 0; i < count; i++)
+    {
+      const float32 ax = x0[i] - x1[i];
+      const float32 ay = y0[i] - y1[i];
+      const float32 az = z0[i] - z1[i];
+      const float32 bx = x0[i] - x2[i];
+      const float32 by = y0[i] - y2[i];
+      const float32 bz = z0[i] - z2[i];
+      const float32 cx = ay * bz - az * by;
+      const float32 cy = az * bx - ax * bz;
+      const float32 cz = ax * by - ay * bx;
+      areas[i] = 0.5F * std::sqrt(cx * cx + cy * cy + cz * cz);
+    }
+  }
+
+  static void computeNormals(const TriangleBlock& block, usize count, float64* normals)
+  {
+    const float32* x0 = block.x(0);
+    const float32* y0 = block.y(0);
+    const float32* z0 = block.z(0);
+    const float32* x1 = block.x(1);
+    const float32* y1 = block.y(1);
+    const float32* z1 = block.z(1);
+    const float32* x2 = block.x(2);
+    const float32* y2 = block.y(2);
+    const float32* z2 = block.z(2);
+    for(usize i = 0; i < count; i++)
+    {
+      const float32 ax = x1[i] - x0[i];
+      const float32 ay = y1[i] - y0[i];
+      const float32 az = z1[i] - z0[i];
+      const float32 bx = x2[i] - x0[i];
+      const float32 by = y2[i] - y0[i];
+      const float32 bz = z2[i] - z0[i];
+      const float32 nx = ay * bz - az * by;
+      const float32 ny = az * bx - ax * bz;
+      const float32 nz = ax * by - ay * bx;
+      const float32 magnitude = std::sqrt(nx * nx + ny * ny + nz * nz);
+      normals[i * 3] = nx / magnitude;
+      normals[i * 3 + 1] = ny / magnitude;
+      normals[i * 3 + 2] = nz / magnitude;
+    }
+  }
+
+  static void computeCentroids(const TriangleBlock& block, usize count, float64* centroids)
+  {
+    const float32* x0 = block.x(0);
+    const float32* y0 = block.y(0);
+    const float32* z0 = block.z(0);
+    const float32* x1 = block.x(1);
+    const float32* y1 = block.y(1);
+    const float32* z1 = block.z(1);
+    const float32* x2 = block.x(2);
+    const float32* y2 = block.y(2);
+    const float32* z2 = block.z(2);
+    for(usize i = 0; i < count; i++)
+    {
+      centroids[i * 3] = (x0[i] + x1[i] + x2[i]) / 3.0F;
+      centroids[i * 3 + 1] = (y0[i] + y1[i] + y2[i]) / 3.0F;
+      centroids[i * 3 + 2] = (z0[i] + z1[i] + z2[i]) / 3.0F;
+    }
+  }
+
+  static void computeMinDihedralAngles(const TriangleBlock& block, usize count, float64* angles)
+  {
+    const float32* x0 = block.x(0);
+    const float32* y0 = block.y(0);
+    const float32* z0 = block.z(0);
+    const float32* x1 = block.x(1);
+    const float32* y1 = block.y(1);
+    const float32* z1 = block.z(1);
+    const float32* x2 = block.x(2);
+    const float32* y2 = block.y(2);
+    const float32* z2 = block.z(2);
+    for(usize i = 0; i < count; i++)
+    {
+      const float64 abX = x0[i] - x1[i];
+      const float64 abY = y0[i] - y1[i];
+      const float64 abZ = z0[i] - z1[i];
+      const float64 acX = x0[i] - x2[i];
+      const float64 acY = y0[i] - y2[i];
+      const float64 acZ = z0[i] - z2[i];
+      const float64 bcX = x1[i] - x2[i];
+      const float64 bcY = y1[i] - y2[i];
+      const float64 bcZ = z1[i] - z2[i];
+
+      const float64 magAB = std::sqrt(abX * abX + abY * abY + abZ * abZ);
+      const float64 magAC = std::sqrt(acX * acX + acY * acY + acZ * acZ);
+      const float64 magBC = std::sqrt(bcX * bcX + bcY * bcY + bcZ * bcZ);
+      if(magAB == 0.0 || magAC == 0.0 || magBC == 0.0)
+      {
+        angles[i] = std::nan("0");
+        continue;
+      }
+
+      const float64 angleA = k_RadToDeg * std::acos(std::fabs(abX * acX + abY * acY + abZ * acZ) / (magAB * magAC));
+      // 180 - angle because AB points out of the vertex and BC points into it, so the angle is the one outside of the triangle
+      const float64 angleB = 180.0 - (k_RadToDeg * std::acos(std::fabs(abX * bcX + abY * bcY + abZ * bcZ) / (magAB * magBC)));
+      const float64 angleC = k_RadToDeg * std::acos(std::fabs(bcX * acX + bcY * acY + bcZ * acZ) / (magBC * magAC));
+      angles[i] = std::min({angleA, angleB, angleC});
+    }
+  }
+
+  void write(Float64AbstractDataStore& store, usize startIndex, const float64* values, usize numValues) const
+  {
+    if(store.copyFromBuffer(startIndex, nonstd::span<const float64>(values, numValues)).invalid())
+    {
+      m_WriteFailed = true;
+    }
+  }
+
+  const AbstractDataStore<IGeometry::MeshIndexType>& m_Faces;
+  const Float32AbstractDataStore& m_Vertices;
+  const DataStore<float32>* m_InMemoryVertices = nullptr;
+  Float64AbstractDataStore* m_Areas = nullptr;
+  Float64AbstractDataStore* m_Normals = nullptr;
+  Float64AbstractDataStore* m_Centroids = nullptr;
+  Float64AbstractDataStore* m_MinDihedralAngles = nullptr;
+  std::atomic_bool& m_ReadFailed;
+  std::atomic_bool& m_WriteFailed;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+ComputeTriangleMetrics::ComputeTriangleMetrics(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
+                                               ComputeTriangleMetricsInputValues* inputValues)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+}
+
+// -----------------------------------------------------------------------------
+ComputeTriangleMetrics::~ComputeTriangleMetrics() noexcept = default;
+
+// -----------------------------------------------------------------------------
+const std::atomic_bool& ComputeTriangleMetrics::getCancel()
+{
+  return m_ShouldCancel;
+}
+
+// -----------------------------------------------------------------------------
+Result<> ComputeTriangleMetrics::operator()()
+{
+  const auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
+  const auto& faces = triangleGeom.getFacesRef().getDataStoreRef();
+  const auto& vertices = triangleGeom.getVerticesRef().getDataStoreRef();
+
+  IParallelAlgorithm::AlgorithmStores stores = {&faces, &vertices};
+  auto getOutputStore = [this, &stores](bool selected, const DataPath& arrayPath) -> Float64AbstractDataStore* {
+    if(!selected)
+    {
+      return nullptr;
+    }
+    auto& store = m_DataStructure.getDataRefAs<Float64Array>(arrayPath).getDataStoreRef();
+    stores.push_back(&store);
+    return &store;
+  };
+  Float64AbstractDataStore* areas = getOutputStore(m_InputValues->ComputeAreas, m_InputValues->AreasArrayPath);
+  Float64AbstractDataStore* normals = getOutputStore(m_InputValues->ComputeNormals, m_InputValues->NormalsArrayPath);
+  Float64AbstractDataStore* centroids = getOutputStore(m_InputValues->ComputeCentroids, m_InputValues->CentroidsArrayPath);
+  Float64AbstractDataStore* minDihedralAngles = getOutputStore(m_InputValues->ComputeMinDihedralAngles, m_InputValues->MinDihedralAnglesArrayPath);
+
+  std::atomic_bool readFailed = false;
+  std::atomic_bool writeFailed = false;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0ULL, static_cast<usize>(triangleGeom.getNumberOfFaces()));
+  dataAlg.requireStoresInMemory(stores);
+  dataAlg.execute(ComputeTriangleMetricsImpl(faces, vertices, areas, normals, centroids, minDihedralAngles, readFailed, writeFailed, m_ShouldCancel));
+
+  if(readFailed)
+  {
+    return MakeErrorResult(k_ReadFacesError, fmt::format("Could not read the faces of the Triangle Geometry '{}'", m_InputValues->TriangleGeometryPath.toString()));
+  }
+  if(writeFailed)
+  {
+    return MakeErrorResult(k_WriteMetricsError, fmt::format("Could not write the computed metrics of the Triangle Geometry '{}'", m_InputValues->TriangleGeometryPath.toString()));
+  }
+  return {};
+}
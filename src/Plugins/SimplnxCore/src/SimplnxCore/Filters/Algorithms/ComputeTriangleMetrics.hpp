@@ -0,0 +1,52 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+
+namespace nx::core
+{
+
+struct SIMPLNXCORE_EXPORT ComputeTriangleMetricsInputValues
+{
+  DataPath TriangleGeometryPath;
+  bool ComputeAreas;
+  DataPath AreasArrayPath;
+  bool ComputeNormals;
+  DataPath NormalsArrayPath;
+  bool ComputeCentroids;
+  DataPath CentroidsArrayPath;
+  bool ComputeMinDihedralAngles;
+  DataPath MinDihedralAnglesArrayPath;
+};
+
+/**
+ * @class ComputeTriangleMetrics
+ * @brief This algorithm computes any selected subset of the area, normal, centroid and minimum dihedral angle
+ * of each triangle in one parallel pass over the faces of a Triangle Geometry.
+ */
+class SIMPLNXCORE_EXPORT ComputeTriangleMetrics
+{
+public:
+  ComputeTriangleMetrics(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ComputeTriangleMetricsInputValues* inputValues);
+  ~ComputeTriangleMetrics() noexcept;
+
+  ComputeTriangleMetrics(const ComputeTriangleMetrics&) = delete;
+  ComputeTriangleMetrics(ComputeTriangleMetrics&&) noexcept = delete;
+  ComputeTriangleMetrics& operator=(const ComputeTriangleMetrics&) = delete;
+  ComputeTriangleMetrics& operator=(ComputeTriangleMetrics&&) noexcept = delete;
+
+  Result<> operator()();
+
+  const std::atomic_bool& getCancel();
+
+private:
+  DataStructure& m_DataStructure;
+  const ComputeTriangleMetricsInputValues* m_InputValues = nullptr;
+  const std::atomic_bool& m_ShouldCancel;
+  const IFilter::MessageHandler& m_MessageHandler;
+};
+
+} // namespace nx::core
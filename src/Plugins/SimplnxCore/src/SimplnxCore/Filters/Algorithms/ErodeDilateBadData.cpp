@@ -4,68 +4,11 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/TupleRemap.hpp"
 
-using namespace nx::core;
-namespace
-{
-class ErodeDilateBadDataTransferDataImpl
-{
-public:
-  ErodeDilateBadDataTransferDataImpl() = delete;
-  ErodeDilateBadDataTransferDataImpl(const ErodeDilateBadDataTransferDataImpl&) = default;
-
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadData* filterAlg, usize totalPoints, ChoicesParameter::ValueType operation, const Int32AbstractDataStore& featureIds,
-                                     const std::vector<int64>& neighbors, const std::shared_ptr<IDataArray>& dataArrayPtr)
-  : m_FilterAlg(filterAlg)
-  , m_TotalPoints(totalPoints)
-  , m_Operation(operation)
-  , m_FeatureIds(featureIds)
-  , m_Neighbors(neighbors)
-  , m_DataArrayPtr(dataArrayPtr)
-  {
-  }
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadDataTransferDataImpl&&) = default;                // Move Constructor Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(const ErodeDilateBadDataTransferDataImpl&) = delete; // Copy Assignment Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(ErodeDilateBadDataTransferDataImpl&&) = delete;      // Move Assignment Not Implemented
-
-  ~ErodeDilateBadDataTransferDataImpl() = default;
-
-  void operator()() const
-  {
-    auto start = std::chrono::steady_clock::now();
-    for(usize i = 0; i < m_TotalPoints; i++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      //// Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        const float progress = static_cast<float>(i) / static_cast<float>(m_TotalPoints) * 100.0f;
-        m_FilterAlg->updateProgress(fmt::format("Processing {}: {}% completed", m_DataArrayPtr->getName(), static_cast<int>(progress)));
-        start = std::chrono::steady_clock::now();
-      }
-
-      const int32 featureName = m_FeatureIds[i];
-      const int64 neighbor = m_Neighbors[i];
-      if(neighbor >= 0)
-      {
-        if((featureName == 0 && m_FeatureIds[neighbor] > 0 && m_Operation == detail::k_ErodeIndex) || (featureName > 0 && m_FeatureIds[neighbor] == 0 && m_Operation == detail::k_DilateIndex))
-        {
-          m_DataArrayPtr->copyTuple(neighbor, i);
-        }
-      }
-    }
-  }
+#include <algorithm>
 
-private:
-  ErodeDilateBadData* m_FilterAlg = nullptr;
-  usize m_TotalPoints = 0;
-  ChoicesParameter::ValueType m_Operation = 0;
-  std::vector<int64> m_Neighbors;
-  const std::shared_ptr<IDataArray> m_DataArrayPtr;
-  const Int32AbstractDataStore& m_FeatureIds;
-};
-} // namespace
+using namespace nx::core;
 
 // -----------------------------------------------------------------------------
 ErodeDilateBadData::ErodeDilateBadData(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ErodeDilateBadDataInputValues* inputValues)
@@ -221,28 +164,37 @@ Result<> ErodeDilateBadData::operator()()
       }
     }
 
-    // Build up a list of the DataArrays that we are going to operate on.
-    const std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
-
-    ParallelTaskAlgorithm taskRunner;
-    taskRunner.setParallelizationEnabled(true);
-    for(const auto& voxelArray : voxelArrays)
+    std::vector<int64> sourceIndices(totalPoints, -1);
+    for(usize i = 0; i < totalPoints; i++)
     {
-      // We need to skip updating the FeatureIds until all the other arrays are updated
-      // since we actually depend on the feature Ids values.
-      if(voxelArray->getName() == m_InputValues->FeatureIdsArrayPath.getTargetName())
+      const int32 featureName = featureIds[i];
+      const int64 neighbor = neighbors[i];
+      if(neighbor >= 0)
       {
-        continue;
+        if((featureName == 0 && featureIds[neighbor] > 0 && m_InputValues->Operation == detail::k_ErodeIndex) ||
+           (featureName > 0 && featureIds[neighbor] == 0 && m_InputValues->Operation == detail::k_DilateIndex))
+        {
+          sourceIndices[i] = neighbor;
+        }
       }
-
-      taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, voxelArray));
     }
-    taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
-    // Now update the feature Ids
+    // Build up a list of the DataArrays that we are going to operate on. The FeatureIds are always
+    // updated, and since the source index map was built first they can be updated with every other array.
+    std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
     auto featureIDataArray = m_DataStructure.getSharedDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath);
-    taskRunner.setParallelizationEnabled(false); // Do this to make the next call synchronous
-    taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, featureIDataArray));
+    if(std::find(voxelArrays.begin(), voxelArrays.end(), featureIDataArray) == voxelArrays.end())
+    {
+      voxelArrays.push_back(featureIDataArray);
+    }
+
+    const TupleRemap tupleRemap = TupleRemap::Create(sourceIndices);
+    updateProgress(fmt::format("Iteration {}: Transferring data for {} voxels", iteration + 1, tupleRemap.getNumberOfChangedTuples()));
+    Result<> remapResult = tupleRemap.apply(voxelArrays, m_ShouldCancel);
+    if(remapResult.invalid())
+    {
+      return remapResult;
+    }
   }
 
   return {};
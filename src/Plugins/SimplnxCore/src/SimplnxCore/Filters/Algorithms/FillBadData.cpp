@@ -4,49 +4,10 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/TupleRemap.hpp"
 
 using namespace nx::core;
 
-namespace
-{
-template <typename T>
-void FillBadDataUpdateTuples(const Int32AbstractDataStore& featureIds, AbstractDataStore<T>& outputDataStore, const std::vector<int32>& neighbors)
-{
-  usize start = 0;
-  usize stop = outputDataStore.getNumberOfTuples();
-  const usize numComponents = outputDataStore.getNumberOfComponents();
-  for(usize tupleIndex = start; tupleIndex < stop; tupleIndex++)
-  {
-    const int32 featureName = featureIds[tupleIndex];
-    const int32 neighbor = neighbors[tupleIndex];
-    if(neighbor == tupleIndex)
-    {
-      continue;
-    }
-
-    if(featureName < 0 && neighbor != -1 && featureIds[static_cast<size_t>(neighbor)] > 0)
-    {
-      for(usize i = 0; i < numComponents; i++)
-      {
-        auto value = outputDataStore[neighbor * numComponents + i];
-        outputDataStore[tupleIndex * numComponents + i] = value;
-      }
-    }
-  }
-}
-
-struct FillBadDataUpdateTuplesFunctor
-{
-  template <typename T>
-  void operator()(const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, const std::vector<int32>& neighbors)
-  {
-    auto& outputStore = outputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    FillBadDataUpdateTuples(featureIds, outputStore, neighbors);
-  }
-};
-} // namespace
-
 // -----------------------------------------------------------------------------
 FillBadData::FillBadData(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, FillBadDataInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -302,26 +263,36 @@ Result<> FillBadData::operator()()
       }
     }
 
-    std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
-    std::vector<DataPath> voxelArrayNames;
-    if(allChildArrays.has_value())
+    std::vector<int32> sourceIndices(totalPoints, -1);
+    for(usize tupleIndex = 0; tupleIndex < totalPoints; tupleIndex++)
     {
-      voxelArrayNames = allChildArrays.value();
+      const int32 neighbor = neighbors[tupleIndex];
+      if(featureIdsStore[tupleIndex] < 0 && neighbor >= 0 && static_cast<usize>(neighbor) != tupleIndex && featureIdsStore[neighbor] > 0)
+      {
+        sourceIndices[tupleIndex] = neighbor;
+      }
     }
 
-    for(const auto& cellArrayPath : voxelArrayNames)
+    // The FeatureIds are always updated, even if they are in the ignored list, and since the source
+    // index map was built before any array is modified they are updated along with every other array.
+    std::vector<std::shared_ptr<IDataArray>> voxelArrays = {m_DataStructure.getSharedDataAs<IDataArray>(m_InputValues->featureIdsArrayPath)};
+    std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
+    if(allChildArrays.has_value())
     {
-      if(cellArrayPath == m_InputValues->featureIdsArrayPath)
+      for(const auto& cellArrayPath : allChildArrays.value())
       {
-        continue;
+        if(cellArrayPath != m_InputValues->featureIdsArrayPath)
+        {
+          voxelArrays.push_back(m_DataStructure.getSharedDataAs<IDataArray>(cellArrayPath));
+        }
       }
-      auto* oldCellArray = m_DataStructure.getDataAs<IDataArray>(cellArrayPath);
-
-      ExecuteDataFunction(FillBadDataUpdateTuplesFunctor{}, oldCellArray->getDataType(), featureIdsStore, oldCellArray, neighbors);
     }
 
-    // We need to update the FeatureIds array _LAST_ since the above operations depend on that values in that array
-    FillBadDataUpdateTuples<int32>(featureIdsStore, featureIdsStore, neighbors);
+    Result<> remapResult = TupleRemap::Create(sourceIndices).apply(voxelArrays, m_ShouldCancel);
+    if(remapResult.invalid())
+    {
+      return remapResult;
+    }
   }
   return {};
 }
@@ -9,6 +9,7 @@
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/TupleRemap.hpp"
 
 using namespace nx::core;
 
@@ -159,31 +160,32 @@ std::vector<bool> FlagFeatures(Int32AbstractDataStore& featureIds, std::unique_p
   return activeObjects;
 }
 
-void FindVoxelArrays(const Int32AbstractDataStore& featureIds, const std::vector<int32>& neighbors, std::vector<std::shared_ptr<IDataArray>>& voxelArrays, const std::atomic_bool& shouldCancel)
+Result<> FindVoxelArrays(const Int32AbstractDataStore& featureIds, const std::vector<int32>& neighbors, std::vector<std::shared_ptr<IDataArray>>& voxelArrays, const std::atomic_bool& shouldCancel)
 {
   const usize totalPoints = featureIds.getNumberOfTuples();
 
-  int32 featureName, neighbor;
+  // Gather the copies in a source index map. A neighbor that was filled earlier in this
+  // pass counts as good, exactly as if the tuples were copied one at a time in place.
+  std::vector<int32> sourceIndices(totalPoints, -1);
   for(usize j = 0; j < totalPoints; j++)
   {
-    if(shouldCancel)
+    const int32 neighbor = neighbors[j];
+    if(neighbor >= 0 && featureIds[j] < 0)
     {
-      return;
-    }
-
-    featureName = featureIds[j];
-    neighbor = neighbors[j];
-    if(neighbor >= 0)
-    {
-      if(featureName < 0 && featureIds[neighbor] >= 0)
+      const int32 currentNeighbor = (static_cast<usize>(neighbor) < j && sourceIndices[neighbor] >= 0) ? sourceIndices[neighbor] : neighbor;
+      if(featureIds[currentNeighbor] >= 0)
       {
-        for(const auto& voxelArray : voxelArrays)
-        {
-          voxelArray->copyTuple(neighbor, j);
-        }
+        sourceIndices[j] = currentNeighbor;
       }
     }
   }
+
+  if(shouldCancel)
+  {
+    return {};
+  }
+
+  return TupleRemap::Create(sourceIndices).apply(voxelArrays, shouldCancel);
 }
 
 class RunCropImageGeometryImpl
@@ -416,7 +418,11 @@ Result<> RemoveFlaggedFeatures::operator()()
 
         m_MessageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Info, fmt::format("Filling bad voxels...")});
         std::vector<std::shared_ptr<IDataArray>> voxelArrays = GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
-        FindVoxelArrays(featureIds, neighbors, voxelArrays, getCancel());
+        Result<> voxelArraysResult = FindVoxelArrays(featureIds, neighbors, voxelArrays, getCancel());
+        if(voxelArraysResult.invalid())
+        {
+          return voxelArraysResult;
+        }
       } while(shouldLoop);
     }
 
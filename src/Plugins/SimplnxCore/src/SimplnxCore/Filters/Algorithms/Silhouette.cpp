@@ -4,6 +4,7 @@
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/MaskView.hpp"
 
 #include <unordered_set>
 
@@ -26,7 +27,7 @@ public:
     return Pointer(static_cast<Self*>(nullptr));
   }
 
-  SilhouetteTemplate(const IDataArray& inputIDataArray, Float64AbstractDataStore& outputDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
+  SilhouetteTemplate(const IDataArray& inputIDataArray, Float64AbstractDataStore& outputDataArray, const PackedMaskView& maskDataArray, usize numClusters,
                      const Int32AbstractDataStore& featureIds, ClusterUtilities::DistanceMetric distMetric)
   : m_InputData(inputIDataArray.template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_OutputData(outputDataArray)
@@ -57,7 +58,7 @@ public:
 
     for(usize i = 0; i < numTuples; i++)
     {
-      if(m_Mask->isTrue(i))
+      if(m_Mask.isTrue(i))
       {
         numTuplesPerFeature[m_FeatureIds[i]]++;
       }
@@ -65,11 +66,11 @@ public:
 
     for(usize i = 0; i < numTuples; i++)
     {
-      if(m_Mask->isTrue(i))
+      if(m_Mask.isTrue(i))
       {
         for(usize j = 0; j < numTuples; j++)
         {
-          if(m_Mask->isTrue(j))
+          if(m_Mask.isTrue(j))
           {
             clusterDist[i][m_FeatureIds[j]] += ClusterUtilities::GetDistance(m_InputData, (numCompDims * i), m_InputData, (numCompDims * j), numCompDims, m_DistMetric);
           }
@@ -79,7 +80,7 @@ public:
 
     for(usize i = 0; i < numTuples; i++)
     {
-      if(m_Mask->isTrue(i))
+      if(m_Mask.isTrue(i))
       {
         for(usize j = 1; j < totalClusters; j++)
         {
@@ -90,7 +91,7 @@ public:
 
     for(usize i = 0; i < numTuples; i++)
     {
-      if(m_Mask->isTrue(i))
+      if(m_Mask.isTrue(i))
       {
         int32 cluster = m_FeatureIds[i];
         inClusterDist[i] = clusterDist[i][cluster];
@@ -113,7 +114,7 @@ public:
 
     for(usize i = 0; i < numTuples; i++)
     {
-      if(m_Mask->isTrue(i))
+      if(m_Mask.isTrue(i))
       {
         m_OutputData[i] = (outClusterMinDist[i] - inClusterDist[i]) / (std::max(outClusterMinDist[i], inClusterDist[i]));
       }
@@ -125,7 +126,7 @@ private:
   const AbstractDataStoreT& m_InputData;
   Float64AbstractDataStore& m_OutputData;
   const Int32AbstractDataStore& m_FeatureIds;
-  const std::unique_ptr<MaskCompare>& m_Mask;
+  const PackedMaskView& m_Mask;
   usize m_NumClusters;
   ClusterUtilities::DistanceMetric m_DistMetric;
 };
@@ -168,19 +169,23 @@ Result<> Silhouette::operator()()
   }
 
   auto& clusteringArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->ClusteringArrayPath);
-  std::unique_ptr<MaskCompare> maskCompare;
-  try
-  {
-    maskCompare = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-  } catch(const std::out_of_range& exception)
+  const auto* maskArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath);
+  if(maskArray == nullptr)
   {
     // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
     // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54080, message);
   }
+  // The mask is read numTuples^2 times, so it is packed once up front.
+  Result<PackedMaskView> maskViewResult = PackedMaskView::Create(*maskArray);
+  if(maskViewResult.invalid())
+  {
+    return ConvertResult(std::move(maskViewResult));
+  }
   RunTemplateClass<SilhouetteTemplate, types::NoBooleanType>(clusteringArray.getDataType(), clusteringArray,
-                                                             m_DataStructure.getDataAs<Float64Array>(m_InputValues->SilhouetteArrayPath)->getDataStoreRef(), maskCompare, uniqueIds.size(), featureIds,
+                                                             m_DataStructure.getDataAs<Float64Array>(m_InputValues->SilhouetteArrayPath)->getDataStoreRef(), maskViewResult.value(),
+                                                             uniqueIds.size(), featureIds,
                                                              m_InputValues->DistanceMetric);
   return {};
 }
@@ -4,10 +4,12 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
-#include "simplnx/Utilities/StringUtilities.hpp"
+#include "simplnx/Utilities/OStreamUtilities.hpp"
 
 #include <algorithm>
+#include <array>
 #include <filesystem>
+#include <fstream>
 
 namespace fs = std::filesystem;
 
@@ -15,24 +17,9 @@ using namespace nx::core;
 
 namespace
 {
-std::string format_duration(std::chrono::milliseconds ms)
+std::array<int64, 8> getNodeIds(usize x, usize y, usize z, const usize* pDims)
 {
-  using namespace std::chrono;
-  auto secs = duration_cast<seconds>(ms);
-  ms -= duration_cast<milliseconds>(secs);
-  auto mins = duration_cast<minutes>(secs);
-  secs -= duration_cast<seconds>(mins);
-  auto hour = duration_cast<hours>(mins);
-  mins -= duration_cast<minutes>(hour);
-
-  std::stringstream ss;
-  ss << hour.count() << " Hours : " << mins.count() << " Minutes : " << secs.count() << " Seconds : " << ms.count() << " Milliseconds";
-  return ss.str();
-}
-
-std::vector<int64> getNodeIds(usize x, usize y, usize z, const usize* pDims)
-{
-  std::vector<int64> nodeId(8, 0);
+  std::array<int64, 8> nodeId = {};
 
   nodeId[0] = static_cast<int64>(1 + (pDims[0] * pDims[1] * z) + (pDims[0] * y) + x);
   nodeId[1] = static_cast<int64>(1 + (pDims[0] * pDims[1] * z) + (pDims[0] * y) + (x + 1));
@@ -60,209 +47,156 @@ std::vector<int64> getNodeIds(usize x, usize y, usize z, const usize* pDims)
   return nodeId;
 }
 
-int32 writeNodes(WriteAbaqusHexahedron* filter, const std::string& fileName, usize* cDims, const float32* origin, const float32* spacing, const std::atomic_bool& shouldCancel)
+int32 writeNodes(const IFilter::MessageHandler& mesgHandler, const std::string& fileName, usize* cDims, const float32* origin, const float32* spacing, const std::atomic_bool& shouldCancel)
 {
   usize pDims[3] = {cDims[0] + 1, cDims[1] + 1, cDims[2] + 1};
-  usize nodeIndex = 1;
   usize totalPoints = pDims[0] * pDims[1] * pDims[2];
-  auto increment = static_cast<usize>(totalPoints * 0.01f);
-  if(increment == 0) // check to prevent divide by 0
-  {
-    increment = 1;
-  }
 
-  int32 err = 0;
-  FILE* f = fopen(fileName.c_str(), "wb");
-  if(nullptr == f)
+  std::ofstream outStrm(fileName, std::ios_base::out | std::ios_base::binary);
+  if(!outStrm.is_open())
   {
     return -1;
   }
 
-  auto initialTime = std::chrono::steady_clock::now();
-  fprintf(f, "** ----------------------------------------------------------------\n**\n*Node\n");
-  for(usize z = 0; z < pDims[2]; z++)
-  {
-    for(usize y = 0; y < pDims[1]; y++)
+  outStrm << "** ----------------------------------------------------------------\n**\n*Node\n";
+  auto formatBlock = [&](std::string& buffer, usize begin, usize end) -> Result<> {
+    for(usize index = begin; index < end; index++)
     {
-      for(usize x = 0; x < pDims[0]; x++)
-      {
-        float32 xCoord = origin[0] + (x * spacing[0]);
-        float32 yCoord = origin[1] + (y * spacing[1]);
-        float32 zCoord = origin[2] + (z * spacing[2]);
-        fprintf(f, "%llu, %f, %f, %f\n", static_cast<unsigned long long int>(nodeIndex), xCoord, yCoord, zCoord);
-        if(nodeIndex % increment == 0)
-        {
-          auto now = std::chrono::steady_clock::now();
-          int64 milliDiff = std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count();
-          if(milliDiff > 1000)
-          {
-            std::string percentage =
-                "Writing Nodes (File 1/5) " + StringUtilities::number(static_cast<int32>(static_cast<float32>(nodeIndex) / static_cast<float32>(totalPoints) * 100.0f)) + "% Completed ";
-            float32 timeDiff = ((float32)nodeIndex / (float32)(milliDiff));
-            int64 estimatedTime = (float32)(totalPoints - nodeIndex) / timeDiff;
-            std::string timeRemaining = " || Est. Time Remain: " + format_duration(std::chrono::milliseconds(estimatedTime));
-            filter->sendMessage(percentage + timeRemaining);
-            initialTime = std::chrono::steady_clock::now();
-            if(shouldCancel) // Filter has been cancelled
-            {
-              fclose(f);
-              return 1;
-            }
-          }
-        }
-        ++nodeIndex;
-      }
+      const usize x = index % pDims[0];
+      const usize y = (index / pDims[0]) % pDims[1];
+      const usize z = index / (pDims[0] * pDims[1]);
+      float32 xCoord = origin[0] + (x * spacing[0]);
+      float32 yCoord = origin[1] + (y * spacing[1]);
+      float32 zCoord = origin[2] + (z * spacing[2]);
+      fmt::format_to(std::back_inserter(buffer), "{}, {:f}, {:f}, {:f}\n", index + 1, xCoord, yCoord, zCoord);
     }
+    return {};
+  };
+  Result<> result = OStreamUtilities::WriteBlocks(outStrm, totalPoints, formatBlock, mesgHandler, "Writing Nodes (File 1/5)", shouldCancel);
+  if(result.invalid())
+  {
+    return -1;
+  }
+  if(shouldCancel) // Filter has been cancelled
+  {
+    return 1;
   }
 
   // Write the last node, which is a dummy node used for stress - strain curves.
-  fprintf(f, "%d, %f, %f, %f\n", 999999, 0.0f, 0.0f, 0.0f);
-  fprintf(f, "**\n** ----------------------------------------------------------------\n**\n");
+  outStrm << fmt::format("{}, {:f}, {:f}, {:f}\n", 999999, 0.0f, 0.0f, 0.0f);
+  outStrm << "**\n** ----------------------------------------------------------------\n**\n";
 
-  // Close the file
-  fclose(f);
-  return err;
+  return outStrm.fail() ? -1 : 0;
 }
 
-int32 writeElems(WriteAbaqusHexahedron* filter, const std::string& fileName, const usize* cDims, usize* pDims, const std::atomic_bool& shouldCancel)
+int32 writeElems(const IFilter::MessageHandler& mesgHandler, const std::string& fileName, const usize* cDims, usize* pDims, const std::atomic_bool& shouldCancel)
 {
   usize totalPoints = cDims[0] * cDims[1] * cDims[2];
-  auto increment = static_cast<usize>(totalPoints * 0.01f);
-  if(increment == 0) // check to prevent divide by 0
-  {
-    increment = 1;
-  }
 
-  int32 err = 0;
-  FILE* f = fopen(fileName.c_str(), "wb");
-  if(nullptr == f)
+  std::ofstream outStrm(fileName, std::ios_base::out | std::ios_base::binary);
+  if(!outStrm.is_open())
   {
     return -1;
   }
 
-  // Get a typedef to shorten up the printf codes
-  using _lli_t_ = long long int;
-
-  auto initialTime = std::chrono::steady_clock::now();
-  usize index = 1;
-  fprintf(f, "** ----------------------------------------------------------------\n**\n*Element, type=C3D8\n");
-  for(usize z = 0; z < cDims[2]; z++)
-  {
-    for(usize y = 0; y < cDims[1]; y++)
+  outStrm << "** ----------------------------------------------------------------\n**\n*Element, type=C3D8\n";
+  auto formatBlock = [&](std::string& buffer, usize begin, usize end) -> Result<> {
+    for(usize index = begin; index < end; index++)
     {
-      for(usize x = 0; x < cDims[0]; x++)
-      {
-        std::vector<int64> nodeId = getNodeIds(x, y, z, pDims);
-        fprintf(f, "%llu, %lld, %lld, %lld, %lld, %lld, %lld, %lld, %lld\n", (_lli_t_)index, (_lli_t_)nodeId[5], (_lli_t_)nodeId[1], (_lli_t_)nodeId[0], (_lli_t_)nodeId[4], (_lli_t_)nodeId[7],
-                (_lli_t_)nodeId[3], (_lli_t_)nodeId[2], (_lli_t_)nodeId[6]);
-        if(index % increment == 0)
-        {
-          auto now = std::chrono::steady_clock::now();
-          int64 milliDiff = std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count();
-          if(milliDiff > 1000)
-          {
-            std::string percentage =
-                "Writing Elements (File 2/5) " + StringUtilities::number(static_cast<int32>(static_cast<float32>(index) / static_cast<float32>(totalPoints) * 100.0f)) + "% Completed ";
-            float32 timeDiff = ((float32)index / (float32)(milliDiff));
-            int64 estimatedTime = (float32)(totalPoints - index) / timeDiff;
-            std::string timeRemaining = " || Est. Time Remain: " + format_duration(std::chrono::milliseconds(estimatedTime));
-            filter->sendMessage(percentage + timeRemaining);
-            initialTime = std::chrono::steady_clock::now();
-            if(shouldCancel) // Filter has been cancelled
-            {
-              fclose(f);
-              return 1;
-            }
-          }
-        }
-        ++index;
-      }
+      const usize x = index % cDims[0];
+      const usize y = (index / cDims[0]) % cDims[1];
+      const usize z = index / (cDims[0] * cDims[1]);
+      std::array<int64, 8> nodeId = getNodeIds(x, y, z, pDims);
+      fmt::format_to(std::back_inserter(buffer), "{}, {}, {}, {}, {}, {}, {}, {}, {}\n", index + 1, nodeId[5], nodeId[1], nodeId[0], nodeId[4], nodeId[7], nodeId[3], nodeId[2], nodeId[6]);
     }
+    return {};
+  };
+  Result<> result = OStreamUtilities::WriteBlocks(outStrm, totalPoints, formatBlock, mesgHandler, "Writing Elements (File 2/5)", shouldCancel);
+  if(result.invalid())
+  {
+    return -1;
+  }
+  if(shouldCancel) // Filter has been cancelled
+  {
+    return 1;
   }
 
-  fprintf(f, "**\n** ----------------------------------------------------------------\n**\n");
+  outStrm << "**\n** ----------------------------------------------------------------\n**\n";
 
-  // Close the file
-  fclose(f);
-  return err;
+  return outStrm.fail() ? -1 : 0;
 }
 
-int32 writeElset(WriteAbaqusHexahedron* filter, const std::string& fileName, size_t totalPoints, const Int32AbstractDataStore& featureIds, const std::atomic_bool& shouldCancel)
+int32 writeElset(const IFilter::MessageHandler& mesgHandler, const std::string& fileName, size_t totalPoints, const Int32AbstractDataStore& featureIds, const std::atomic_bool& shouldCancel)
 {
-  int32 err = 0;
-  FILE* f = fopen(fileName.c_str(), "wb");
-  if(nullptr == f)
+  std::ofstream outStrm(fileName, std::ios_base::out | std::ios_base::binary);
+  if(!outStrm.is_open())
   {
     return -1;
   }
 
-  fprintf(f, "** ----------------------------------------------------------------\n**\n** The element sets\n");
-  fprintf(f, "*Elset, elset=cube, generate\n");
-  fprintf(f, "1, %llu, 1\n", static_cast<unsigned long long int>(totalPoints));
-  fprintf(f, "**\n** Each Grain is made up of multiple elements\n**");
+  outStrm << "** ----------------------------------------------------------------\n**\n** The element sets\n";
+  outStrm << "*Elset, elset=cube, generate\n";
+  outStrm << fmt::format("1, {}, 1\n", totalPoints);
+  outStrm << "**\n** Each Grain is made up of multiple elements\n**";
 
   // find total number of Grain Ids
   int32 maxGrainId = *std::max_element(std::begin(featureIds), std::end(featureIds));
+  const usize numGrains = maxGrainId > 0 ? static_cast<usize>(maxGrainId) : 0;
 
-  auto increment = static_cast<int32>(maxGrainId * 0.1f);
-  if(increment == 0) // check to prevent divide by 0
+  // Group the element ids by grain so that each grain's set is written without searching all elements again
+  std::vector<usize> grainOffsets(numGrains + 2, 0);
+  for(usize i = 0; i < featureIds.getSize(); i++)
   {
-    increment = 1;
+    const int32 grain = featureIds[i];
+    if(grain > 0)
+    {
+      grainOffsets[grain + 1]++;
+    }
   }
-
-  auto initialTime = std::chrono::steady_clock::now();
-  int32 voxelId = 1;
-  while(voxelId <= maxGrainId)
+  for(usize grain = 1; grain <= numGrains; grain++)
   {
-    usize elementPerLine = 0;
-    fprintf(f, "\n*Elset, elset=Grain%d_set\n", voxelId);
-
+    grainOffsets[grain + 1] += grainOffsets[grain];
+  }
+  std::vector<usize> grainElements(grainOffsets[numGrains + 1]);
+  {
+    std::vector<usize> nextElement(grainOffsets.begin(), grainOffsets.end() - 1);
     for(usize i = 0; i < featureIds.getSize(); i++)
     {
-      if(featureIds[i] == voxelId)
+      const int32 grain = featureIds[i];
+      if(grain > 0)
       {
-        if(elementPerLine != 0) // no comma at start
-        {
-          if((elementPerLine % 16) != 0u) // 16 per line
-          {
-            fprintf(f, ", ");
-          }
-          else
-          {
-            fprintf(f, ",\n");
-          }
-        }
-        fprintf(f, "%llu", static_cast<unsigned long long int>(i + 1));
-        elementPerLine++;
+        grainElements[nextElement[grain]++] = i + 1;
       }
     }
-    if(voxelId % increment == 0)
+  }
+
+  auto formatBlock = [&](std::string& buffer, usize begin, usize end) -> Result<> {
+    for(usize grain = begin + 1; grain <= end; grain++)
     {
-      auto now = std::chrono::steady_clock::now();
-      int64 milliDiff = std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count();
-      if(milliDiff > 1000)
+      fmt::format_to(std::back_inserter(buffer), "\n*Elset, elset=Grain{}_set\n", grain);
+      for(usize elementPerLine = 0; elementPerLine < grainOffsets[grain + 1] - grainOffsets[grain]; elementPerLine++)
       {
-        std::string percentage =
-            "Writing Element Sets (File 4/5) " + StringUtilities::number(static_cast<int32>(static_cast<float32>(voxelId) / static_cast<float32>(maxGrainId) * 100.0f)) + "% Completed ";
-        float32 timeDiff = ((float32)voxelId / (float32)(milliDiff));
-        auto estimatedTime = static_cast<int64>((float32)(maxGrainId - voxelId) / timeDiff);
-        std::string timeRemaining = " || Est. Time Remain: " + format_duration(std::chrono::milliseconds(estimatedTime));
-        filter->sendMessage(percentage + timeRemaining);
-        initialTime = std::chrono::steady_clock::now();
-        if(shouldCancel) // Filter has been cancelled
+        if(elementPerLine != 0) // no comma at start
         {
-          fclose(f);
-          return 1;
+          buffer.append((elementPerLine % 16) != 0u ? ", " : ",\n"); // 16 per line
         }
+        OStreamUtilities::AppendInteger(buffer, grainElements[grainOffsets[grain] + elementPerLine]);
       }
     }
-    voxelId++;
+    return {};
+  };
+  Result<> result = OStreamUtilities::WriteBlocks(outStrm, numGrains, formatBlock, mesgHandler, "Writing Element Sets (File 4/5)", shouldCancel, {}, 16);
+  if(result.invalid())
+  {
+    return -1;
+  }
+  if(shouldCancel) // Filter has been cancelled
+  {
+    return 1;
   }
-  fprintf(f, "\n**\n** ----------------------------------------------------------------\n**\n");
+  outStrm << "\n**\n** ----------------------------------------------------------------\n**\n";
 
-  // Close the file
-  fclose(f);
-  return err;
+  return outStrm.fail() ? -1 : 0;
 }
 
 int32 writeMaster(const std::string& file, const std::string& jobName, const std::string& filePrefix)
@@ -384,7 +318,7 @@ Result<> WriteAbaqusHexahedron::operator()()
     }
   }
 
-  int32 err = writeNodes(this, fileList[0].value().tempFilePath().string(), cDims.data(), origin.data(), spacing.data(), getCancel()); // Nodes file
+  int32 err = writeNodes(m_MessageHandler, fileList[0].value().tempFilePath().string(), cDims.data(), origin.data(), spacing.data(), getCancel()); // Nodes file
   if(err < 0)
   {
     return MakeErrorResult(-1113, fmt::format("Error writing output nodes file '{}'", fileList[0].value().tempFilePath().string()));
@@ -396,7 +330,7 @@ Result<> WriteAbaqusHexahedron::operator()()
   }
   m_MessageHandler(IFilter::Message::Type::Info, "Writing Sections (File 1/5) Complete");
 
-  err = writeElems(this, fileList[1].value().tempFilePath().string(), cDims.data(), pDims, getCancel()); // Elements file
+  err = writeElems(m_MessageHandler, fileList[1].value().tempFilePath().string(), cDims.data(), pDims, getCancel()); // Elements file
   if(err < 0)
   {
     return MakeErrorResult(-1114, fmt::format("Error writing output elems file '{}'", fileList[1].value().tempFilePath().string()));
@@ -420,7 +354,7 @@ Result<> WriteAbaqusHexahedron::operator()()
   }
   m_MessageHandler(IFilter::Message::Type::Info, "Writing Sections (File 3/5) Complete");
 
-  err = writeElset(this, fileList[3].value().tempFilePath().string(), totalPoints, featureIds, getCancel()); // Element set file
+  err = writeElset(m_MessageHandler, fileList[3].value().tempFilePath().string(), totalPoints, featureIds, getCancel()); // Element set file
   if(err < 0)
   {
     return MakeErrorResult(-1116, fmt::format("Error writing output elset file '{}'", fileList[3].value().tempFilePath().string()));
@@ -8,10 +8,12 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
 #include "simplnx/SIMPLNXVersion.hpp"
+#include "simplnx/Utilities/OStreamUtilities.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <algorithm>
 #include <filesystem>
+#include <fstream>
 
 namespace fs = std::filesystem;
 
@@ -20,22 +22,22 @@ using namespace nx::core;
 namespace
 {
 template <typename T>
-void WriteValue(std::ofstream& file, const T& value)
+void AppendValue(std::string& buffer, T value)
 {
   if constexpr(std::is_floating_point<T>::value)
   {
     // For floating-point numbers, use up to 4 decimal places
-    file << std::fixed << std::setprecision(4) << value;
+    fmt::format_to(std::back_inserter(buffer), "{:.4f}", value);
   }
   else
   {
-    // For non-floating-point types, reset to default format with no precision
-    file << std::defaultfloat << std::setprecision(0) << value;
+    OStreamUtilities::AppendInteger(buffer, value);
   }
 }
 
 template <typename T>
-Result<> WriteFile(const fs::path& outputFilePath, const DataArray<T>& array, bool includeArrayHeaders, std::vector<std::string_view> arrayHeaders, bool numberRows, bool includeComponentCount)
+Result<> WriteFile(const fs::path& outputFilePath, const DataArray<T>& array, bool includeArrayHeaders, std::vector<std::string_view> arrayHeaders, bool numberRows, bool includeComponentCount,
+                   const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel)
 {
   std::ofstream file(outputFilePath.string());
   if(!file.is_open())
@@ -43,40 +45,43 @@ Result<> WriteFile(const fs::path& outputFilePath, const DataArray<T>& array, bo
     return MakeErrorResult(to_underlying(WriteNodesAndElementsFiles::ErrorCodes::FailedToOpenOutputFile), fmt::format("Failed to open output file \"{}\".", outputFilePath.string()));
   }
 
-  file << fmt::format("# This file was created by simplnx v{}", Version::Complete()) << std::endl;
+  file << fmt::format("# This file was created by simplnx v{}", Version::Complete()) << "\n";
 
   if(includeArrayHeaders)
   {
-    WriteValue(file, StringUtilities::join(arrayHeaders, " "));
-    file << std::endl;
+    file << StringUtilities::join(arrayHeaders, " ") << "\n";
   }
+
+  const auto& dataStore = array.getDataStoreRef();
   usize numComps = array.getNumberOfComponents();
-  for(usize i = 0; i < array.getNumberOfTuples(); i++)
-  {
-    if(numberRows)
+  auto formatBlock = [&](std::string& buffer, usize begin, usize end) -> Result<> {
+    for(usize i = begin; i < end; i++)
     {
-      WriteValue(file, i);
-      file << " ";
-    }
+      if(numberRows)
+      {
+        AppendValue(buffer, i);
+        buffer.push_back(' ');
+      }
 
-    if(includeComponentCount)
-    {
-      WriteValue(file, numComps);
-      file << " ";
-    }
+      if(includeComponentCount)
+      {
+        AppendValue(buffer, numComps);
+        buffer.push_back(' ');
+      }
 
-    for(usize j = 0; j < numComps; j++)
-    {
-      WriteValue(file, array[i * numComps + j]);
-      if(j != numComps - 1)
+      for(usize j = 0; j < numComps; j++)
       {
-        file << " ";
+        AppendValue(buffer, dataStore[i * numComps + j]);
+        if(j != numComps - 1)
+        {
+          buffer.push_back(' ');
+        }
       }
+      buffer.push_back('\n');
     }
-    file << std::endl;
-  }
-
-  return {};
+    return {};
+  };
+  return OStreamUtilities::WriteBlocks(file, array.getNumberOfTuples(), formatBlock, mesgHandler, fmt::format("Writing {}", outputFilePath.filename().string()), shouldCancel, {&dataStore});
 }
 } // namespace
 
@@ -162,7 +167,7 @@ Result<> WriteNodesAndElementsFiles::operator()()
 
     std::vector<std::string_view> arrayHeadersViews(arrayHeaders.size());
     std::transform(arrayHeaders.begin(), arrayHeaders.end(), arrayHeadersViews.begin(), [](const std::string& s) { return std::string_view(s); });
-    auto result = WriteFile(m_InputValues->NodeFilePath, vertices, m_InputValues->IncludeNodeFileHeader, arrayHeadersViews, m_InputValues->NumberNodes, false);
+    auto result = WriteFile(m_InputValues->NodeFilePath, vertices, m_InputValues->IncludeNodeFileHeader, arrayHeadersViews, m_InputValues->NumberNodes, false, m_MessageHandler, m_ShouldCancel);
     if(result.invalid())
     {
       return result;
@@ -185,7 +190,8 @@ Result<> WriteNodesAndElementsFiles::operator()()
 
     std::vector<std::string_view> arrayHeadersViews(arrayHeaders.size());
     std::transform(arrayHeaders.begin(), arrayHeaders.end(), arrayHeadersViews.begin(), [](const std::string& s) { return std::string_view(s); });
-    auto result = WriteFile(m_InputValues->ElementFilePath, *cellsArray, m_InputValues->IncludeElementFileHeader, arrayHeadersViews, m_InputValues->NumberElements, true);
+    auto result = WriteFile(m_InputValues->ElementFilePath, *cellsArray, m_InputValues->IncludeElementFileHeader, arrayHeadersViews, m_InputValues->NumberElements, true, m_MessageHandler,
+                            m_ShouldCancel);
     if(result.invalid())
     {
       return result;
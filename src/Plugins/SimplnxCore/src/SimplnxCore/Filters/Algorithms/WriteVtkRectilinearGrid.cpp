@@ -7,6 +7,8 @@
 
 #include "SimplnxCore/utils/VtkUtilities.hpp"
 
+#include <fstream>
+
 using namespace nx::core;
 
 // -----------------------------------------------------------------------------
@@ -36,76 +38,78 @@ Result<> WriteVtkRectilinearGrid::operator()()
   FloatVec3 res = imageGeom.getSpacing();
   FloatVec3 origin = imageGeom.getOrigin();
 
-  FILE* outputFile = nullptr;
-  outputFile = fopen(m_InputValues->OutputFile.string().c_str(), "wb");
-  if(nullptr == outputFile)
+  std::ofstream outStrm(m_InputValues->OutputFile, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if(!outStrm.is_open())
   {
     return MakeErrorResult(-2073, fmt::format("Error opening output vtk file '{}'", m_InputValues->OutputFile.string()));
   }
 
   // write the header
-  writeVtkHeader(outputFile);
+  writeVtkHeader(outStrm);
 
   // Write the Coordinate Points
-  Result<> writeCoordsResults = writeCoords<float32>(outputFile, "X_COORDINATES", "float", dims[0] + 1, origin[0] - res[0] * 0.5f, res[0]);
+  Result<> writeCoordsResults = writeCoords<float32>(outStrm, "X_COORDINATES", "float", dims[0] + 1, origin[0] - res[0] * 0.5f, res[0]);
   if(writeCoordsResults.invalid())
   {
     return MergeResults(writeCoordsResults, MakeErrorResult(-2075, fmt::format("Error writing X Coordinates in vtk file {}'\n ", m_InputValues->OutputFile.string())));
   }
-  writeCoordsResults = writeCoords<float32>(outputFile, "Y_COORDINATES", "float", dims[1] + 1, origin[1] - res[1] * 0.5f, res[1]);
+  writeCoordsResults = writeCoords<float32>(outStrm, "Y_COORDINATES", "float", dims[1] + 1, origin[1] - res[1] * 0.5f, res[1]);
   if(writeCoordsResults.invalid())
   {
-    return MergeResults(writeCoordsResults, MakeErrorResult(-2076, fmt::format("Error writing Y Coordinates in vtk file %s'\n ", m_InputValues->OutputFile.string())));
+    return MergeResults(writeCoordsResults, MakeErrorResult(-2076, fmt::format("Error writing Y Coordinates in vtk file {}'\n ", m_InputValues->OutputFile.string())));
   }
-  writeCoordsResults = writeCoords<float32>(outputFile, "Z_COORDINATES", "float", dims[2] + 1, origin[2] - res[2] * 0.5f, res[2]);
+  writeCoordsResults = writeCoords<float32>(outStrm, "Z_COORDINATES", "float", dims[2] + 1, origin[2] - res[2] * 0.5f, res[2]);
   if(writeCoordsResults.invalid())
   {
-    return MergeResults(writeCoordsResults, MakeErrorResult(-2077, fmt::format("Error writing Z Coordinates in vtk file %s'\n ", m_InputValues->OutputFile.string())));
+    return MergeResults(writeCoordsResults, MakeErrorResult(-2077, fmt::format("Error writing Z Coordinates in vtk file {}'\n ", m_InputValues->OutputFile.string())));
   }
 
   // Write the data arrays
   const auto totalCells = imageGeom.getNumXCells() * imageGeom.getNumYCells() * imageGeom.getNumZCells();
-  fprintf(outputFile, "CELL_DATA %d\n", static_cast<int>(totalCells));
+  outStrm << fmt::format("CELL_DATA {}\n", static_cast<int>(totalCells));
 
+  Result<> result;
   for(const DataPath& arrayPath : m_InputValues->SelectedDataArrayPaths)
   {
-    ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outputFile, m_InputValues->WriteBinaryFile, m_DataStructure, arrayPath,
-                        m_MessageHandler);
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
+    result = MergeResults(result, ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outStrm, m_InputValues->WriteBinaryFile,
+                                                      m_DataStructure, arrayPath, m_MessageHandler, m_ShouldCancel));
   }
 
-  fclose(outputFile);
-
-  return {};
+  return result;
 }
 
 // -----------------------------------------------------------------------------
-void WriteVtkRectilinearGrid::writeVtkHeader(FILE* outputFile) const
+void WriteVtkRectilinearGrid::writeVtkHeader(std::ostream& outStrm) const
 {
   const auto& geom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
   const usize xPoints = geom.getNumXCells() + 1;
   const usize yPoints = geom.getNumYCells() + 1;
   const usize zPoints = geom.getNumZCells() + 1;
 
-  fprintf(outputFile, "# vtk DataFile Version 2.0\n");
-  fprintf(outputFile, "Data set from DREAM.3D SimplnxCore version 7.0.0\n");
+  outStrm << "# vtk DataFile Version 2.0\n";
+  outStrm << "Data set from DREAM.3D SimplnxCore version 7.0.0\n";
   if(m_InputValues->WriteBinaryFile)
   {
-    fprintf(outputFile, "BINARY\n");
+    outStrm << "BINARY\n";
   }
   else
   {
-    fprintf(outputFile, "ASCII\n");
+    outStrm << "ASCII\n";
   }
-  fprintf(outputFile, "\n");
-  fprintf(outputFile, "DATASET RECTILINEAR_GRID\n");
-  fprintf(outputFile, "DIMENSIONS %ld %ld %ld\n", static_cast<long int>(xPoints), static_cast<long int>(yPoints), static_cast<long int>(zPoints));
+  outStrm << "\n";
+  outStrm << "DATASET RECTILINEAR_GRID\n";
+  outStrm << fmt::format("DIMENSIONS {} {} {}\n", xPoints, yPoints, zPoints);
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-Result<> WriteVtkRectilinearGrid::writeCoords(FILE* outputFile, const std::string& axis, const std::string& type, int64 nPoints, T min, T step)
+Result<> WriteVtkRectilinearGrid::writeCoords(std::ostream& outStrm, const std::string& axis, const std::string& type, int64 nPoints, T min, T step)
 {
-  fprintf(outputFile, "%s %lld %s\n", axis.c_str(), static_cast<long long unsigned int>(nPoints), type.c_str());
+  outStrm << fmt::format("{} {} {}\n", axis, nPoints, type);
   if(m_InputValues->WriteBinaryFile)
   {
     std::vector<T> data(nPoints);
@@ -119,27 +123,28 @@ Result<> WriteVtkRectilinearGrid::writeCoords(FILE* outputFile, const std::strin
       }
       data[idx] = d;
     }
-    const usize totalWritten = fwrite(static_cast<void*>(data.data()), sizeof(T), static_cast<usize>(nPoints), outputFile);
-    fprintf(outputFile, "\n"); // Write a newline character at the end of the coordinates
-    if(totalWritten != static_cast<usize>(nPoints))
+    outStrm.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(sizeof(T) * data.size()));
+    outStrm << "\n"; // Write a newline character at the end of the coordinates
+    if(outStrm.fail())
     {
-      fclose(outputFile);
       return MakeErrorResult(-2074, fmt::format("Error Writing Binary VTK Data into file"));
     }
   }
   else
   {
+    std::string buffer;
     T d;
     for(int idx = 0; idx < nPoints; ++idx)
     {
       d = idx * step + min;
-      fprintf(outputFile, "%f ", d);
+      fmt::format_to(std::back_inserter(buffer), "{:f} ", d);
       if(idx % 20 == 0 && idx != 0)
       {
-        fprintf(outputFile, "\n");
+        buffer.push_back('\n');
       }
     }
-    fprintf(outputFile, "\n");
+    buffer.push_back('\n');
+    outStrm << buffer;
   }
   return {};
 }
@@ -8,6 +8,8 @@
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
 #include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
 
+#include <ostream>
+
 namespace nx::core
 {
 class ImageGeom;
@@ -41,12 +43,12 @@ public:
 
   const std::atomic_bool& getCancel();
 
-  void writeVtkHeader(FILE* outputFile) const;
+  void writeVtkHeader(std::ostream& outStrm) const;
 
   /**
    * @brief This function writes a set of Axis coordinates to that are needed
    * for a Rectilinear Grid based data set.
-   * @param outputFile The "C" FILE* pointer to the file being written to.
+   * @param outStrm The stream of the file being written to.
    * @param axis The name of the Axis that is being written
    * @param type The type of primitive being written (float, int, ...)
    * @param nPoints The total number of points in the array
@@ -56,7 +58,7 @@ public:
    * @param binary Whether or not to write the vtk file data in binary
    */
   template <typename T>
-  Result<> writeCoords(FILE* outputFile, const std::string& axis, const std::string& type, int64 nPoints, T min, T step);
+  Result<> writeCoords(std::ostream& outStrm, const std::string& axis, const std::string& type, int64 nPoints, T min, T step);
 
 private:
   DataStructure& m_DataStructure;
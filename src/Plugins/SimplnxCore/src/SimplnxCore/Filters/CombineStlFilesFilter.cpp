@@ -1,6 +1,7 @@
 #include "CombineStlFilesFilter.hpp"
 
 #include "SimplnxCore/Filters/Algorithms/CombineStlFiles.hpp"
+#include "SimplnxCore/utils/StlUtilities.hpp"
 
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
@@ -139,6 +140,23 @@ IFilter::PreflightResult CombineStlFilesFilter::preflightImpl(const DataStructur
   {
     return MakePreflightErrorResult(-9370, fmt::format("No STL files were found in the selected directory '{}'", pStlFilesPathValue.string()));
   }
+  for(const auto& stlFile : stlFiles)
+  {
+    StlConstants::StlFileType stlFileType = StlUtilities::DetermineStlFileType(stlFile);
+    if(stlFileType == StlConstants::StlFileType::ASCI)
+    {
+      return MakePreflightErrorResult(StlConstants::k_UnsupportedFileType,
+                                      fmt::format("The STL file '{}' is ASCII which is not currently supported. Please convert it to a binary STL file using another program.", stlFile.string()));
+    }
+    if(stlFileType == StlConstants::StlFileType::FileOpenError)
+    {
+      return MakePreflightErrorResult(StlConstants::k_ErrorOpeningFile, fmt::format("Error opening the STL file '{}'.", stlFile.string()));
+    }
+    if(stlFileType == StlConstants::StlFileType::HeaderParseError)
+    {
+      return MakePreflightErrorResult(StlConstants::k_StlHeaderParseError, fmt::format("Error parsing the header of the STL file '{}'.", stlFile.string()));
+    }
+  }
 
   {
     auto createTriangleGeometryAction = std::make_unique<CreateTriangleGeometryAction>(pTriangleDataContainerNameValue, 1, 1, pVertexAttributeMatrixNameValue, pFaceAttributeMatrixNameValue,
@@ -14,12 +14,270 @@
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+#include <numeric>
 #include <sstream>
 
 namespace nx::core
 {
+namespace
+{
+/**
+ * @brief Packs a (feature, neighbor) pair into a single sortable key. Both ids are
+ * guaranteed to be > 0 by the caller so the ordering matches (feature, neighbor).
+ */
+inline uint64 PackFacePair(int32 feature, int32 neighbor)
+{
+  return (static_cast<uint64>(static_cast<uint32>(feature)) << 32) | static_cast<uint64>(static_cast<uint32>(neighbor));
+}
+
+inline int32 UnpackFeature(uint64 key)
+{
+  return static_cast<int32>(key >> 32);
+}
+
+inline int32 UnpackNeighbor(uint64 key)
+{
+  return static_cast<int32>(key & 0xFFFFFFFFULL);
+}
+
+/**
+ * @brief Holds the reduced output of a single slab. The keys are sorted and unique and
+ * each key has the number of shared cell faces found inside of the slab.
+ */
+struct SlabFaceCounts
+{
+  std::vector<uint64> keys;
+  std::vector<uint32> counts;
+  std::vector<int32> surfaceFeatures;
+};
+
+/**
+ * @brief Sorts the packed keys and collapses runs of identical keys into (key, count) pairs.
+ * Input counts may be empty, in which case each key counts as a single face.
+ */
+void ReduceFaceKeys(std::vector<uint64>& keys, std::vector<uint32>& counts, bool runParallel)
+{
+  if(keys.empty())
+  {
+    counts.clear();
+    return;
+  }
+
+  if(counts.empty())
+  {
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    if(runParallel)
+    {
+      tbb::parallel_sort(keys.begin(), keys.end());
+    }
+    else
+#endif
+    {
+      std::sort(keys.begin(), keys.end());
+    }
+    counts.assign(keys.size(), 1);
+  }
+  else
+  {
+    // Sort the keys and counts together through an index permutation
+    std::vector<usize> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto compare = [&keys](usize lhs, usize rhs) { return keys[lhs] < keys[rhs]; };
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    if(runParallel)
+    {
+      tbb::parallel_sort(order.begin(), order.end(), compare);
+    }
+    else
+#endif
+    {
+      std::sort(order.begin(), order.end(), compare);
+    }
+    std::vector<uint64> sortedKeys(keys.size());
+    std::vector<uint32> sortedCounts(keys.size());
+    for(usize i = 0; i < order.size(); i++)
+    {
+      sortedKeys[i] = keys[order[i]];
+      sortedCounts[i] = counts[order[i]];
+    }
+    keys.swap(sortedKeys);
+    counts.swap(sortedCounts);
+  }
+
+  usize outIndex = 0;
+  for(usize i = 1; i < keys.size(); i++)
+  {
+    if(keys[i] == keys[outIndex])
+    {
+      counts[outIndex] += counts[i];
+    }
+    else
+    {
+      outIndex++;
+      keys[outIndex] = keys[i];
+      counts[outIndex] = counts[i];
+    }
+  }
+  keys.resize(outIndex + 1);
+  counts.resize(outIndex + 1);
+}
+
+/**
+ * @brief Scans a contiguous range of cells, records every face shared with a different
+ * (non-zero) Feature and reduces those faces into per-slab (feature, neighbor, count) triples.
+ * Each slab owns its own output slot and its own range of the boundary cells array so
+ * no synchronization is needed between slabs.
+ */
+class ComputeFeatureNeighborsSlabImpl
+{
+public:
+  ComputeFeatureNeighborsSlabImpl(const Int32AbstractDataStore& featureIds, Int8AbstractDataStore* boundaryCells, bool storeSurfaceFeatures, const SizeVec3& dims, usize totalFeatures,
+                                  usize startIndex, usize endIndex, SlabFaceCounts& output, const std::atomic_bool& shouldCancel)
+  : m_FeatureIds(featureIds)
+  , m_BoundaryCells(boundaryCells)
+  , m_StoreSurfaceFeatures(storeSurfaceFeatures)
+  , m_Dims(dims)
+  , m_TotalFeatures(totalFeatures)
+  , m_StartIndex(startIndex)
+  , m_EndIndex(endIndex)
+  , m_Output(output)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()() const
+  {
+    const auto numX = static_cast<int64>(m_Dims[0]);
+    const auto numY = static_cast<int64>(m_Dims[1]);
+    const auto numZ = static_cast<int64>(m_Dims[2]);
+    const std::array<int64, 6> neighPoints = {-numX * numY, -numX, -1, 1, numX, numX * numY};
+
+    std::vector<uint64>& keys = m_Output.keys;
+    std::vector<int32>& surfaceFeatures = m_Output.surfaceFeatures;
+
+    for(usize j = m_StartIndex; j < m_EndIndex; j++)
+    {
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+
+      int8 onSurf = 0;
+      const int32 feature = m_FeatureIds[j];
+      if(feature > 0 && static_cast<usize>(feature) < m_TotalFeatures)
+      {
+        const auto column = static_cast<int64>(j % m_Dims[0]);
+        const auto row = static_cast<int64>((j / m_Dims[0]) % m_Dims[1]);
+        const auto plane = static_cast<int64>(j / (m_Dims[0] * m_Dims[1]));
+
+        if(m_StoreSurfaceFeatures)
+        {
+          const bool onXYEdge = column == 0 || column == numX - 1 || row == 0 || row == numY - 1;
+          if((numZ != 1 && (onXYEdge || plane == 0 || plane == numZ - 1)) || (numZ == 1 && onXYEdge))
+          {
+            surfaceFeatures.push_back(feature);
+          }
+        }
+
+        const std::array<bool, 6> validNeighbor = {plane != 0, row != 0, column != 0, column != numX - 1, row != numY - 1, plane != numZ - 1};
+        for(usize k = 0; k < 6; k++)
+        {
+          if(!validNeighbor[k])
+          {
+            continue;
+          }
+          const int32 neighborFeature = m_FeatureIds[static_cast<int64>(j) + neighPoints[k]];
+          if(neighborFeature != feature && neighborFeature > 0)
+          {
+            onSurf++;
+            keys.push_back(PackFacePair(feature, neighborFeature));
+          }
+        }
+      }
+      if(m_BoundaryCells != nullptr)
+      {
+        m_BoundaryCells->setValue(j, onSurf);
+      }
+    }
+
+    // Reduce the faces found in this slab before they are merged with the other slabs
+    ReduceFaceKeys(keys, m_Output.counts, false);
+    std::sort(surfaceFeatures.begin(), surfaceFeatures.end());
+    surfaceFeatures.erase(std::unique(surfaceFeatures.begin(), surfaceFeatures.end()), surfaceFeatures.end());
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  Int8AbstractDataStore* m_BoundaryCells = nullptr;
+  bool m_StoreSurfaceFeatures = false;
+  SizeVec3 m_Dims;
+  usize m_TotalFeatures = 0;
+  usize m_StartIndex = 0;
+  usize m_EndIndex = 0;
+  SlabFaceCounts& m_Output;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Builds the NeighborList and SharedSurfaceAreaList vectors for a range of Features
+ * from the globally reduced (feature, neighbor, count) arrays.
+ */
+class ComputeFeatureNeighborListsImpl
+{
+public:
+  ComputeFeatureNeighborListsImpl(const std::vector<uint64>& keys, const std::vector<uint32>& counts, const std::vector<usize>& featureOffsets, float32 faceArea,
+                                  Int32AbstractDataStore& numNeighbors, std::vector<NeighborList<int32>::SharedVectorType>& neighborLists,
+                                  std::vector<NeighborList<float32>::SharedVectorType>& sharedSurfaceAreaLists)
+  : m_Keys(keys)
+  , m_Counts(counts)
+  , m_FeatureOffsets(featureOffsets)
+  , m_FaceArea(faceArea)
+  , m_NumNeighbors(numNeighbors)
+  , m_NeighborLists(neighborLists)
+  , m_SharedSurfaceAreaLists(sharedSurfaceAreaLists)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      const usize begin = m_FeatureOffsets[featureId];
+      const usize end = m_FeatureOffsets[featureId + 1];
+
+      auto neighbors = std::make_shared<std::vector<int32>>(end - begin);
+      auto areas = std::make_shared<std::vector<float32>>(end - begin);
+      for(usize i = begin; i < end; i++)
+      {
+        (*neighbors)[i - begin] = UnpackNeighbor(m_Keys[i]);
+        (*areas)[i - begin] = static_cast<float32>(m_Counts[i]) * m_FaceArea;
+      }
+      m_NumNeighbors.setValue(featureId, static_cast<int32>(end - begin));
+      m_NeighborLists[featureId] = neighbors;
+      m_SharedSurfaceAreaLists[featureId] = areas;
+    }
+  }
+
+private:
+  const std::vector<uint64>& m_Keys;
+  const std::vector<uint32>& m_Counts;
+  const std::vector<usize>& m_FeatureOffsets;
+  float32 m_FaceArea = 0.0f;
+  Int32AbstractDataStore& m_NumNeighbors;
+  std::vector<NeighborList<int32>::SharedVectorType>& m_NeighborLists;
+  std::vector<NeighborList<float32>::SharedVectorType>& m_SharedSurfaceAreaLists;
+};
+} // namespace
+
 //------------------------------------------------------------------------------
 std::string ComputeFeatureNeighborsFilter::name() const
 {
@@ -217,205 +475,110 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   }
 
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  SizeVec3 uDims = imageGeom.getDimensions();
-  const auto imageGeomNumX = imageGeom.getNumXCells();
-  const auto imageGeomNumY = imageGeom.getNumYCells();
-  const auto imageGeomNumZ = imageGeom.getNumZCells();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(uDims[0]),
-      static_cast<int64>(uDims[1]),
-      static_cast<int64>(uDims[2]),
-  };
-
-  std::array<int64, 6> neighPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-
-  int64 column = 0;
-  int64 row = 0;
-  int64 plane = 0;
-  int32 feature = 0;
-  int32 nnum = 0;
-  uint8 onsurf = 0;
-  bool good = false;
-  int64 neighbor = 0;
-
-  std::vector<std::vector<int32>> neighborlist(totalFeatures);
-  std::vector<std::vector<float>> neighborsurfacearealist(totalFeatures);
-
-  int32 nListSize = 100;
-
-  float progInt = 0.0F;
-  auto start = std::chrono::steady_clock::now();
-  // Initialize the neighbor lists
+  const SizeVec3 uDims = imageGeom.getDimensions();
+  const FloatVec3 spacing = imageGeom.getSpacing();
+
   for(usize i = 1; i < totalFeatures; i++)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Initializing Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(shouldCancel)
-    {
-      return {};
-    }
-
     numNeighbors[i] = 0;
-    neighborlist[i].resize(nListSize);
-    neighborsurfacearealist[i].assign(nListSize, -1.0f);
-    if(storeSurfaceFeatures && surfaceFeatures != nullptr)
+    if(surfaceFeatures != nullptr)
     {
       surfaceFeatures->setValue(i, false);
     }
   }
 
-  progInt = 0.0F;
-  start = std::chrono::steady_clock::now();
-  // Loop over all points to generate the neighbor lists
-  for(usize j = 0; j < totalPoints; j++)
+  messageHandler(IFilter::Message::Type::Info, "Determining Neighbor Lists");
+
+  // Split the cells into contiguous slabs. Each slab records the faces it shares with other
+  // Features into its own buffer so the slabs can be scanned without any locking.
+  typename IParallelAlgorithm::AlgorithmArrays algArrays;
+  algArrays.push_back(dataStructure.getDataAs<IDataArray>(featureIdsPath));
+  if(storeBoundaryCells)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(j) / static_cast<float>(totalPoints) * 100.0f;
-      std::string message = fmt::format("Determining Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
+    algArrays.push_back(dataStructure.getDataAs<IDataArray>(boundaryCellsPath));
+  }
 
-    if(shouldCancel)
-    {
-      return {};
-    }
+  ParallelTaskAlgorithm slabTaskRunner;
+  slabTaskRunner.requireArraysInMemory(algArrays);
+  const usize numSlabs = slabTaskRunner.getParallelizationEnabled() ? std::max<usize>(1, std::min<usize>(totalPoints, slabTaskRunner.getMaxThreads() * 4)) : 1;
+  const usize slabSize = (totalPoints + numSlabs - 1) / numSlabs;
 
-    onsurf = 0;
-    feature = featureIds[j];
-    if(feature > 0 && feature < neighborlist.size())
-    {
-      column = static_cast<int64>(j % imageGeomNumX);
-      row = static_cast<int64>((j / imageGeomNumX) % imageGeomNumY);
-      plane = static_cast<int64>(j / (imageGeomNumX * imageGeomNumY));
-      if(storeSurfaceFeatures && surfaceFeatures != nullptr)
-      {
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY)-1) || plane == 0 ||
-            plane == static_cast<int64>((imageGeomNumZ - 1))) &&
-           imageGeomNumZ != 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY - 1))) && imageGeomNumZ == 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-      }
-      for(size_t k = 0; k < 6; k++)
-      {
-        good = true;
-        neighbor = static_cast<int64>(j + neighPoints[k]);
-        if(k == 0 && plane == 0)
-        {
-          good = false;
-        }
-        if(k == 5 && plane == (imageGeomNumZ - 1))
-        {
-          good = false;
-        }
-        if(k == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(k == 4 && row == (imageGeomNumY - 1))
-        {
-          good = false;
-        }
-        if(k == 2 && column == 0)
-        {
-          good = false;
-        }
-        if(k == 3 && column == (imageGeomNumX - 1))
-        {
-          good = false;
-        }
-        if(good && featureIds[neighbor] != feature && featureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = numNeighbors[feature];
-          neighborlist[feature].push_back(featureIds[neighbor]);
-          nnum++;
-          numNeighbors[feature] = nnum;
-        }
-      }
-    }
-    if(storeBoundaryCells && boundaryCells != nullptr)
-    {
-      boundaryCells->setValue(j, static_cast<int32>(onsurf));
-    }
+  std::vector<SlabFaceCounts> slabResults(numSlabs);
+  for(usize slab = 0; slab < numSlabs; slab++)
+  {
+    const usize startIndex = std::min(slab * slabSize, totalPoints);
+    const usize endIndex = std::min(startIndex + slabSize, totalPoints);
+    slabTaskRunner.execute(
+        ComputeFeatureNeighborsSlabImpl(featureIds, boundaryCells, storeSurfaceFeatures, uDims, totalFeatures, startIndex, endIndex, slabResults[slab], shouldCancel));
   }
+  slabTaskRunner.wait();
 
-  FloatVec3 spacing = imageGeom.getSpacing();
+  if(shouldCancel)
+  {
+    return {};
+  }
 
-  progInt = 0;
-  start = std::chrono::steady_clock::now();
-  // We do this to create new set of NeighborList objects
-  for(usize i = 1; i < totalFeatures; i++)
+  messageHandler(IFilter::Message::Type::Info, "Merging Neighbor Lists");
+
+  // Concatenate the per-slab triples and reduce them into one sorted (feature, neighbor, count) set
+  usize totalTriples = 0;
+  for(const auto& slabResult : slabResults)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    totalTriples += slabResult.keys.size();
+    if(surfaceFeatures != nullptr)
     {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Calculating Surface Areas || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-    if(shouldCancel)
-    {
-      return {};
+      for(const int32 surfaceFeature : slabResult.surfaceFeatures)
+      {
+        surfaceFeatures->setValue(surfaceFeature, true);
+      }
     }
+  }
 
-    std::map<int32, int32> neighToCount;
-    auto numneighs = static_cast<int32>(neighborlist[i].size());
+  std::vector<uint64> keys;
+  std::vector<uint32> counts;
+  keys.reserve(totalTriples);
+  counts.reserve(totalTriples);
+  for(auto& slabResult : slabResults)
+  {
+    keys.insert(keys.end(), slabResult.keys.begin(), slabResult.keys.end());
+    counts.insert(counts.end(), slabResult.counts.begin(), slabResult.counts.end());
+    slabResult = SlabFaceCounts{};
+  }
+  if(numSlabs > 1)
+  {
+    ReduceFaceKeys(keys, counts, slabTaskRunner.getParallelizationEnabled());
+  }
 
-    // this increments the voxel counts for each feature
-    for(int32 j = 0; j < numneighs; j++)
-    {
-      neighToCount[neighborlist[i][j]]++;
-    }
+  if(shouldCancel)
+  {
+    return {};
+  }
 
-    auto neighborIter = neighToCount.find(0);
-    neighToCount.erase(neighborIter);
-    neighborIter = neighToCount.find(-1);
-    if(neighborIter != neighToCount.end())
-    {
-      neighToCount.erase(neighborIter);
-    }
-    // Resize the features neighbor list to zero
-    neighborlist[i].resize(0);
-    neighborsurfacearealist[i].resize(0);
+  messageHandler(IFilter::Message::Type::Info, "Calculating Surface Areas");
 
-    for(const auto [neigh, number] : neighToCount)
-    {
-      float area = static_cast<float>(number) * spacing[0] * spacing[1];
+  // The reduced keys are sorted by Feature, so each Feature owns one contiguous run of the arrays
+  std::vector<usize> featureOffsets(totalFeatures + 1, 0);
+  for(const uint64 key : keys)
+  {
+    featureOffsets[UnpackFeature(key) + 1]++;
+  }
+  for(usize i = 1; i < featureOffsets.size(); i++)
+  {
+    featureOffsets[i] += featureOffsets[i - 1];
+  }
 
-      // Push the neighbor feature identifier back onto the list, so we stay synced up
-      neighborlist[i].push_back(neigh);
-      neighborsurfacearealist[i].push_back(area);
-    }
-    numNeighbors[i] = static_cast<int32>(neighborlist[i].size());
+  std::vector<NeighborList<int32>::SharedVectorType> neighborLists(totalFeatures);
+  std::vector<NeighborList<float32>::SharedVectorType> sharedSurfaceAreaLists(totalFeatures);
 
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    neighborList.setList(static_cast<int32>(i), sharedNeiLst);
+  ParallelDataAlgorithm listDataAlg;
+  listDataAlg.setRange(std::min<usize>(1, totalFeatures), totalFeatures);
+  listDataAlg.requireArraysInMemory({dataStructure.getDataAs<IDataArray>(numNeighborsPath)});
+  listDataAlg.execute(ComputeFeatureNeighborListsImpl(keys, counts, featureOffsets, spacing[0] * spacing[1], numNeighbors, neighborLists, sharedSurfaceAreaLists));
 
-    NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
-    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSAL);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    neighborList.setList(static_cast<int32>(i), neighborLists[i]);
+    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSurfaceAreaLists[i]);
   }
 
   return {};
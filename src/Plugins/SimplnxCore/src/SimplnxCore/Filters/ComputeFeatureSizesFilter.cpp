@@ -11,6 +11,7 @@
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 
+#include "simplnx/Utilities/FeatureReduction.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <cmath>
@@ -146,9 +147,8 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
 {
   auto saveElementSizes = args.value<bool>(k_SaveElementSizes_Key);
 
-  const auto& featureIds = dataStructure.getDataRefAs<Int32Array>(args.value<DataPath>(k_CellFeatureIdsArrayPath_Key)).getDataStoreRef();
-
-  usize totalPoints = featureIds.getNumberOfTuples();
+  const auto& featureIdsArray = dataStructure.getDataRefAs<Int32Array>(args.value<DataPath>(k_CellFeatureIdsArrayPath_Key));
+  const auto& featureIds = featureIdsArray.getDataStoreRef();
 
   auto geomPath = args.value<DataPath>(k_GeometryPath_Key);
   auto* geom = dataStructure.getDataAs<IGeometry>(geomPath);
@@ -167,14 +167,17 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
     usize maxValue = featureIds[featureIdsMaxIdx];
     usize numFeatures = maxValue + 1;
 
-    std::vector<uint64> featureCounts(numFeatures, 0);
-
-    for(size_t j = 0; j < totalPoints; j++)
+    FeatureReduction<uint64> featureReduction(featureIds, numFeatures, 0);
+    auto countsResult = featureReduction.execute([](uint64& count, usize, usize) { count++; }, [](uint64& count, uint64 otherCount) { count += otherCount; }, shouldCancel);
+    if(countsResult.invalid())
+    {
+      return ConvertResult(std::move(countsResult));
+    }
+    if(shouldCancel)
     {
-      int32_t gnum = featureIds[j];
-      auto temp = featureCounts[gnum] + 1;
-      featureCounts[gnum] = temp;
+      return {};
     }
+    const std::vector<uint64>& featureCounts = countsResult.value();
 
     FloatVec3 spacing = imageGeom->getSpacing();
 
@@ -257,20 +260,38 @@ Result<> ComputeFeatureSizesFilter::executeImpl(DataStructure& dataStructure, co
 
     const Float32Array* elemSizes = geom->getElementSizes();
 
-    std::vector<float> featureCounts(numFeatures, 1);
-
-    for(size_t j = 0; j < totalPoints; j++)
+    struct FeatureSize
+    {
+      float32 count = 1.0f;
+      float32 volume = 0.0f;
+    };
+
+    FeatureReduction<FeatureSize> featureReduction(featureIds, numFeatures, FeatureSize{1.0f, 0.0f});
+    featureReduction.requireArraysInMemory({&featureIdsArray, elemSizes});
+    auto sizesResult = featureReduction.executeInElementOrder(
+        [elemSizes](FeatureSize& featureSize, usize, usize elementIndex) {
+          featureSize.count += 1.0f;
+          featureSize.volume += (*elemSizes)[elementIndex];
+        },
+        shouldCancel);
+    if(sizesResult.invalid())
     {
-      int32 gnum = featureIds[j];
-      auto temp = featureCounts[gnum] + 1;
-      featureCounts[gnum] = temp;
-      auto temp2 = volumes[gnum];
-      volumes[gnum] = temp2 + (*elemSizes)[j];
+      return ConvertResult(std::move(sizesResult));
     }
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const std::vector<FeatureSize>& featureSizes = sizesResult.value();
+    for(usize i = 0; i < numFeatures; i++)
+    {
+      volumes[i] += featureSizes[i].volume;
+    }
+
     float vol_term = (4.0f / 3.0f) * k_PI;
     for(size_t i = 1; i < numFeatures; i++)
     {
-      numElements[i] = static_cast<int32>(featureCounts[i]);
+      numElements[i] = static_cast<int32>(featureSizes[i].count);
       float rad = volumes[i] / vol_term;
       float diameter = 2.0f * powf(rad, 0.3333333333f);
       equivalentDiameters[i] = diameter;
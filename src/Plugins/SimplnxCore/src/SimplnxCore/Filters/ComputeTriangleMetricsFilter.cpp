@@ -0,0 +1,169 @@
+#include "ComputeTriangleMetricsFilter.hpp"
+
+#include "SimplnxCore/Filters/Algorithms/ComputeTriangleMetrics.hpp"
+
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
+#include "simplnx/Parameters/BoolParameter.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_MissingFaceAttributeMatrix = -76990;
+constexpr int32 k_NoMetricSelected = -76991;
+} // namespace
+
+namespace nx::core
+{
+//------------------------------------------------------------------------------
+std::string ComputeTriangleMetricsFilter::name() const
+{
+  return FilterTraits<ComputeTriangleMetricsFilter>::name.str();
+}
+
+//------------------------------------------------------------------------------
+std::string ComputeTriangleMetricsFilter::className() const
+{
+  return FilterTraits<ComputeTriangleMetricsFilter>::className;
+}
+
+//------------------------------------------------------------------------------
+Uuid ComputeTriangleMetricsFilter::uuid() const
+{
+  return FilterTraits<ComputeTriangleMetricsFilter>::uuid;
+}
+
+//------------------------------------------------------------------------------
+std::string ComputeTriangleMetricsFilter::humanName() const
+{
+  return "Compute Triangle Metrics";
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> ComputeTriangleMetricsFilter::defaultTags() const
+{
+  return {className(), "Surface Meshing", "Misc", "Statistics", "Triangle Geometry", "Area", "Normal", "Centroid", "Dihedral Angle"};
+}
+
+//------------------------------------------------------------------------------
+Parameters ComputeTriangleMetricsFilter::parameters() const
+{
+  Parameters params;
+
+  // Create the parameter descriptors that are needed for this filter
+  params.insertSeparator(Parameters::Separator{"Input Data Objects"});
+  params.insert(std::make_unique<GeometrySelectionParameter>(k_TriGeometryDataPath_Key, "Triangle Geometry", "The complete path to the Geometry for which to calculate the metrics", DataPath{},
+                                                             GeometrySelectionParameter::AllowedTypes{IGeometry::Type::Triangle}));
+
+  params.insertSeparator(Parameters::Separator{"Output Face Data"});
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ComputeAreas_Key, "Compute Face Areas", "Whether to compute the area of each face", true));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_AreasArrayName_Key, "Created Face Areas", "The name of the array storing the calculated face areas", "Face Areas"));
+  params.linkParameters(k_ComputeAreas_Key, k_AreasArrayName_Key, true);
+
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ComputeNormals_Key, "Compute Face Normals", "Whether to compute the normal of each face", true));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_NormalsArrayName_Key, "Created Face Normals", "The name of the array storing the calculated face normals", "Face Normals"));
+  params.linkParameters(k_ComputeNormals_Key, k_NormalsArrayName_Key, true);
+
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ComputeCentroids_Key, "Compute Face Centroids", "Whether to compute the centroid of each face", true));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_CentroidsArrayName_Key, "Created Face Centroids", "The name of the array storing the calculated face centroids", "Centroids"));
+  params.linkParameters(k_ComputeCentroids_Key, k_CentroidsArrayName_Key, true);
+
+  params.insertLinkableParameter(
+      std::make_unique<BoolParameter>(k_ComputeMinDihedralAngles_Key, "Compute Minimum Dihedral Angles", "Whether to compute the minimum dihedral angle of each face", true));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_MinDihedralAnglesArrayName_Key, "Created Dihedral Angles", "The name of the array storing the calculated minimum dihedral angles",
+                                                          "Dihedral Angles"));
+  params.linkParameters(k_ComputeMinDihedralAngles_Key, k_MinDihedralAnglesArrayName_Key, true);
+
+  return params;
+}
+
+//------------------------------------------------------------------------------
+IFilter::VersionType ComputeTriangleMetricsFilter::parametersVersion() const
+{
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+IFilter::UniquePointer ComputeTriangleMetricsFilter::clone() const
+{
+  return std::make_unique<ComputeTriangleMetricsFilter>();
+}
+
+//------------------------------------------------------------------------------
+IFilter::PreflightResult ComputeTriangleMetricsFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
+                                                                     const std::atomic_bool& shouldCancel) const
+{
+  auto pTriangleGeometryDataPath = filterArgs.value<DataPath>(k_TriGeometryDataPath_Key);
+
+  // Each selected metric as {component count, array name}
+  std::vector<std::pair<usize, std::string>> outputArrays;
+  if(filterArgs.value<BoolParameter::ValueType>(k_ComputeAreas_Key))
+  {
+    outputArrays.emplace_back(1, filterArgs.value<std::string>(k_AreasArrayName_Key));
+  }
+  if(filterArgs.value<BoolParameter::ValueType>(k_ComputeNormals_Key))
+  {
+    outputArrays.emplace_back(3, filterArgs.value<std::string>(k_NormalsArrayName_Key));
+  }
+  if(filterArgs.value<BoolParameter::ValueType>(k_ComputeCentroids_Key))
+  {
+    outputArrays.emplace_back(3, filterArgs.value<std::string>(k_CentroidsArrayName_Key));
+  }
+  if(filterArgs.value<BoolParameter::ValueType>(k_ComputeMinDihedralAngles_Key))
+  {
+    outputArrays.emplace_back(1, filterArgs.value<std::string>(k_MinDihedralAnglesArrayName_Key));
+  }
+  if(outputArrays.empty())
+  {
+    return MakePreflightErrorResult(k_NoMetricSelected, "At least one triangle metric must be selected");
+  }
+
+  nx::core::Result<OutputActions> resultOutputActions;
+
+  const auto* triangleGeom = dataStructure.getDataAs<TriangleGeom>(pTriangleGeometryDataPath);
+  // Get the Face AttributeMatrix from the Geometry (It should have been set at construction of the Triangle Geometry)
+  const AttributeMatrix* faceAttributeMatrix = triangleGeom->getFaceAttributeMatrix();
+  if(faceAttributeMatrix == nullptr)
+  {
+    return MakePreflightErrorResult(k_MissingFaceAttributeMatrix,
+                                    fmt::format("Could not find Triangle Face Attribute Matrix within the Triangle Geometry '{}'", pTriangleGeometryDataPath.toString()));
+  }
+
+  const DataPath faceAttributeMatrixPath = pTriangleGeometryDataPath.createChildPath(faceAttributeMatrix->getName());
+  for(const auto& [numComponents, arrayName] : outputArrays)
+  {
+    auto createArrayAction = std::make_unique<CreateArrayAction>(nx::core::DataType::float64, std::vector<usize>{triangleGeom->getNumberOfFaces()}, std::vector<usize>{numComponents},
+                                                                 faceAttributeMatrixPath.createChildPath(arrayName));
+    resultOutputActions.value().appendAction(std::move(createArrayAction));
+  }
+
+  // Return the resultOutputActions via std::move()
+  return {std::move(resultOutputActions)};
+}
+
+//------------------------------------------------------------------------------
+Result<> ComputeTriangleMetricsFilter::executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                                                   const std::atomic_bool& shouldCancel) const
+{
+  ComputeTriangleMetricsInputValues inputValues;
+
+  inputValues.TriangleGeometryPath = filterArgs.value<DataPath>(k_TriGeometryDataPath_Key);
+  const auto& triangleGeom = dataStructure.getDataRefAs<TriangleGeom>(inputValues.TriangleGeometryPath);
+  const DataPath faceAttributeMatrixPath = inputValues.TriangleGeometryPath.createChildPath(triangleGeom.getFaceAttributeMatrixRef().getName());
+
+  inputValues.ComputeAreas = filterArgs.value<BoolParameter::ValueType>(k_ComputeAreas_Key);
+  inputValues.AreasArrayPath = faceAttributeMatrixPath.createChildPath(filterArgs.value<std::string>(k_AreasArrayName_Key));
+  inputValues.ComputeNormals = filterArgs.value<BoolParameter::ValueType>(k_ComputeNormals_Key);
+  inputValues.NormalsArrayPath = faceAttributeMatrixPath.createChildPath(filterArgs.value<std::string>(k_NormalsArrayName_Key));
+  inputValues.ComputeCentroids = filterArgs.value<BoolParameter::ValueType>(k_ComputeCentroids_Key);
+  inputValues.CentroidsArrayPath = faceAttributeMatrixPath.createChildPath(filterArgs.value<std::string>(k_CentroidsArrayName_Key));
+  inputValues.ComputeMinDihedralAngles = filterArgs.value<BoolParameter::ValueType>(k_ComputeMinDihedralAngles_Key);
+  inputValues.MinDihedralAnglesArrayPath = faceAttributeMatrixPath.createChildPath(filterArgs.value<std::string>(k_MinDihedralAnglesArrayName_Key));
+
+  return ComputeTriangleMetrics(dataStructure, messageHandler, shouldCancel, &inputValues)();
+}
+} // namespace nx::core
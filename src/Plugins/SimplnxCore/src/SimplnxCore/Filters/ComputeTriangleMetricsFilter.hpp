@@ -0,0 +1,113 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/Filter/FilterTraits.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+
+namespace nx::core
+{
+/**
+ * @class ComputeTriangleMetricsFilter
+ * @brief This filter computes any selected subset of the area, normal, centroid and minimum dihedral angle of each
+ * face of a **TriangleGeom** object in one pass over its faces
+ */
+class SIMPLNXCORE_EXPORT ComputeTriangleMetricsFilter : public IFilter
+{
+public:
+  ComputeTriangleMetricsFilter() = default;
+  ~ComputeTriangleMetricsFilter() noexcept override = default;
+
+  ComputeTriangleMetricsFilter(const ComputeTriangleMetricsFilter&) = delete;
+  ComputeTriangleMetricsFilter(ComputeTriangleMetricsFilter&&) noexcept = delete;
+
+  ComputeTriangleMetricsFilter& operator=(const ComputeTriangleMetricsFilter&) = delete;
+  ComputeTriangleMetricsFilter& operator=(ComputeTriangleMetricsFilter&&) noexcept = delete;
+
+  // Parameter Keys
+  static inline constexpr StringLiteral k_TriGeometryDataPath_Key = "input_triangle_geometry_path";
+  static inline constexpr StringLiteral k_ComputeAreas_Key = "compute_areas";
+  static inline constexpr StringLiteral k_AreasArrayName_Key = "output_areas_array_name";
+  static inline constexpr StringLiteral k_ComputeNormals_Key = "compute_normals";
+  static inline constexpr StringLiteral k_NormalsArrayName_Key = "output_normals_array_name";
+  static inline constexpr StringLiteral k_ComputeCentroids_Key = "compute_centroids";
+  static inline constexpr StringLiteral k_CentroidsArrayName_Key = "output_centroids_array_name";
+  static inline constexpr StringLiteral k_ComputeMinDihedralAngles_Key = "compute_min_dihedral_angles";
+  static inline constexpr StringLiteral k_MinDihedralAnglesArrayName_Key = "output_min_dihedral_angles_array_name";
+
+  /**
+   * @brief Returns the name of the filter.
+   * @return
+   */
+  std::string name() const override;
+
+  /**
+   * @brief Returns the C++ classname of this filter.
+   * @return
+   */
+  std::string className() const override;
+
+  /**
+   * @brief Returns the uuid of the filter.
+   * @return
+   */
+  Uuid uuid() const override;
+
+  /**
+   * @brief Returns the human readable name of the filter.
+   * @return
+   */
+  std::string humanName() const override;
+
+  /**
+   * @brief Returns the default tags for this filter.
+   * @return
+   */
+  std::vector<std::string> defaultTags() const override;
+
+  /**
+   * @brief Returns the parameters of the filter (i.e. its inputs)
+   * @return
+   */
+  Parameters parameters() const override;
+
+  /**
+   * @brief Returns parameters version integer.
+   * Initial version should always be 1.
+   * Should be incremented everytime the parameters change.
+   * @return VersionType
+   */
+  VersionType parametersVersion() const override;
+
+  /**
+   * @brief Returns a copy of the filter.
+   * @return
+   */
+  UniquePointer clone() const override;
+
+protected:
+  /**
+   * @brief Takes in a DataStructure and checks that the filter can be run on it with the given arguments.
+   * Returns any warnings/errors. Also returns the changes that would be applied to the DataStructure.
+   * Some parts of the actions may not be completely filled out if all the required information is not available at preflight time.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override;
+
+  /**
+   * @brief Applies the filter's algorithm to the DataStructure with the given arguments. Returns any warnings/errors.
+   * On failure, there is no guarantee that the DataStructure is in a correct state.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override;
+};
+} // namespace nx::core
+
+SIMPLNX_DEF_FILTER_TRAITS(nx::core, ComputeTriangleMetricsFilter, "c4b2f6d1-7e3a-4b58-9d0f-2a61e8b35c97");
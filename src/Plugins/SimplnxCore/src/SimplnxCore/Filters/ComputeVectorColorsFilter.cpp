@@ -14,11 +14,6 @@
 
 using namespace nx::core;
 
-namespace
-{
-const DataPath k_MaskArrayPath = DataPath({"mask array"});
-}
-
 namespace nx::core
 {
 //------------------------------------------------------------------------------
@@ -92,7 +87,6 @@ IFilter::UniquePointer ComputeVectorColorsFilter::clone() const
 IFilter::PreflightResult ComputeVectorColorsFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
                                                                   const std::atomic_bool& shouldCancel) const
 {
-  auto pUseGoodVoxelsValue = filterArgs.value<bool>(k_UseMask_Key);
   auto pVectorsArrayPathValue = filterArgs.value<DataPath>(k_VectorsArrayPath_Key);
   auto pGoodVoxelsArrayPathValue = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   auto pCellVectorColorsArrayNameValue = filterArgs.value<std::string>(k_CellVectorColorsArrayName_Key);
@@ -107,12 +101,6 @@ IFilter::PreflightResult ComputeVectorColorsFilter::preflightImpl(const DataStru
     resultOutputActions.value().appendAction(std::move(action));
   }
 
-  if(!pUseGoodVoxelsValue)
-  {
-    auto action = std::make_unique<CreateArrayAction>(DataType::boolean, vectorsTupShape, std::vector<usize>{1}, k_MaskArrayPath);
-    resultOutputActions.value().appendAction(std::move(action));
-  }
-
   // Return both the resultOutputActions and the preflightUpdatedValues via std::move()
   return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
 }
@@ -125,15 +113,8 @@ Result<> ComputeVectorColorsFilter::executeImpl(DataStructure& dataStructure, co
 
   inputValues.UseMask = filterArgs.value<bool>(k_UseMask_Key);
   inputValues.VectorsArrayPath = filterArgs.value<DataPath>(k_VectorsArrayPath_Key);
-  if(!inputValues.UseMask)
-  {
-    inputValues.MaskArrayPath = k_MaskArrayPath;
-    dataStructure.getDataAs<BoolArray>(k_MaskArrayPath)->fill(true);
-  }
-  else
-  {
-    inputValues.MaskArrayPath = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
-  }
+  // Without a mask the algorithm passes a null mask array to ExecuteWithMaskView(), which colors every element
+  inputValues.MaskArrayPath = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   inputValues.CellVectorColorsArrayPath = inputValues.VectorsArrayPath.replaceName(filterArgs.value<std::string>(k_CellVectorColorsArrayName_Key));
 
   return ComputeVectorColors(dataStructure, messageHandler, shouldCancel, &inputValues)();
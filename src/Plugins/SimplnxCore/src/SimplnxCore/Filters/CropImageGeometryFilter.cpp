@@ -20,13 +20,12 @@
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/GeometryHelpers.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
-#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 #include "simplnx/Utilities/SamplingUtils.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <numeric>
+
 using namespace nx::core;
 
 namespace
@@ -62,74 +61,6 @@ FloatVec3 GetCurrentVolumeDataContainerResolutions(const DataStructure& dataStru
   }
   return data;
 }
-
-/**
- * @brief
- * @tparam T
- */
-template <typename T>
-class CropImageGeomDataArray
-{
-public:
-  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, const std::atomic_bool& shouldCancel)
-  : m_OldCellStore(oldCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
-  , m_NewCellStore(newCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
-  , m_SrcImageGeom(srcImageGeom)
-  , m_Bounds(bounds)
-  , m_ShouldCancel(shouldCancel)
-  {
-  }
-
-  ~CropImageGeomDataArray() = default;
-
-  CropImageGeomDataArray(const CropImageGeomDataArray&) = default;
-  CropImageGeomDataArray(CropImageGeomDataArray&&) noexcept = default;
-  CropImageGeomDataArray& operator=(const CropImageGeomDataArray&) = delete;
-  CropImageGeomDataArray& operator=(CropImageGeomDataArray&&) noexcept = delete;
-
-  void operator()() const
-  {
-    convert();
-  }
-
-protected:
-  void convert() const
-  {
-    size_t numComps = m_OldCellStore.getNumberOfComponents();
-
-    m_NewCellStore.fill(static_cast<T>(-1));
-
-    auto srcDims = m_SrcImageGeom.getDimensions();
-
-    uint64 destTupleIndex = 0;
-    for(uint64 zIndex = m_Bounds[4]; zIndex < m_Bounds[5]; zIndex++)
-    {
-      if(m_ShouldCancel)
-      {
-        return;
-      }
-      for(uint64 yIndex = m_Bounds[2]; yIndex < m_Bounds[3]; yIndex++)
-      {
-        for(uint64 xIndex = m_Bounds[0]; xIndex < m_Bounds[1]; xIndex++)
-        {
-          uint64 srcIndex = (srcDims[0] * srcDims[1] * zIndex) + (srcDims[0] * yIndex) + xIndex;
-          for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-          {
-            m_NewCellStore.setValue(destTupleIndex * numComps + compIndex, m_OldCellStore.getValue(srcIndex * numComps + compIndex));
-          }
-          destTupleIndex++;
-        }
-      }
-    }
-  }
-
-private:
-  const AbstractDataStore<T>& m_OldCellStore;
-  AbstractDataStore<T>& m_NewCellStore;
-  const ImageGeom& m_SrcImageGeom;
-  std::array<uint64, 6> m_Bounds;
-  const std::atomic_bool& m_ShouldCancel;
-};
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -632,11 +563,16 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
     return MakeErrorResult(-952, errMsg);
   }
 
-  std::array<uint64, 6> bounds = {xMin, xMax + 1, yMin, yMax + 1, zMin, zMax + 1};
+  // A crop is a separable index map where each axis reads a contiguous range of the source
+  const std::array<uint64, 6> bounds = {xMin, xMax + 1, yMin, yMax + 1, zMin, zMax + 1};
+  Sampling::SeparableIndexMap indexMap;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    indexMap[axis].resize(bounds[axis * 2 + 1] - bounds[axis * 2]);
+    std::iota(indexMap[axis].begin(), indexMap[axis].end(), bounds[axis * 2]);
+  }
+  const SizeVec3 srcDims = srcImageGeom.getDimensions();
 
-  // The actual cropping of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
   auto& destCellDataAM = destImageGeom.getCellDataRef();
   for(const auto& [dataId, oldDataObject] : srcCellDataAM)
@@ -652,9 +588,13 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
     auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(srcName));
 
     messageHandler(fmt::format("Cropping Volume || Copying Data Array {}", srcName));
-    ExecuteParallelFunction<CropImageGeomDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel);
+    // The rows of each array are copied in parallel
+    Result<> copyResult = Sampling::CopyTuplesUsingSeparableIndexMap(oldDataArray, newDataArray, srcDims, indexMap, shouldCancel);
+    if(copyResult.invalid())
+    {
+      return copyResult;
+    }
   }
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
   if(shouldCancel)
   {
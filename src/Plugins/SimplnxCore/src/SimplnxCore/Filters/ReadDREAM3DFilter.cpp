@@ -1,9 +1,13 @@
 #include "ReadDREAM3DFilter.hpp"
 
 #include "simplnx/Common/StringLiteral.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Filter/Actions/ImportH5ObjectPathsAction.hpp"
+#include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
 #include "simplnx/Parameters/StringParameter.hpp"
+#include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
@@ -14,6 +18,28 @@ namespace
 {
 constexpr nx::core::int32 k_NoImportPathError = -1;
 constexpr nx::core::int32 k_FailedOpenFileReaderError = -25;
+constexpr nx::core::int32 k_InvalidSubvolumeError = -26;
+constexpr nx::core::int32 k_InvalidSubvolumeGeometryPathError = -27;
+constexpr nx::core::int32 k_MissingSubvolumeGeometryError = -28;
+
+/**
+ * @brief Returns true if the group below parentGroup at pathVector[index...] is an Image Geometry. Only the HDF5
+ * groups along the path and the ObjectType attribute of the last one are read.
+ */
+bool ContainsImageGeometry(const nx::core::HDF5::GroupReader& parentGroup, const std::vector<std::string>& pathVector, nx::core::usize index)
+{
+  if(!parentGroup.isGroup(pathVector[index]))
+  {
+    return false;
+  }
+  const nx::core::HDF5::GroupReader groupReader = parentGroup.openGroup(pathVector[index]);
+  if(index + 1 < pathVector.size())
+  {
+    return ContainsImageGeometry(groupReader, pathVector, index + 1);
+  }
+  auto typeAttribute = groupReader.getAttribute(nx::core::Constants::k_ObjectTypeTag);
+  return typeAttribute.isValid() && typeAttribute.readAsString() == nx::core::ImageGeom::k_TypeName.view();
+}
 } // namespace
 
 namespace nx::core
@@ -54,13 +80,38 @@ Parameters ReadDREAM3DFilter::parameters() const
   Parameters params;
   params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
   params.insert(std::make_unique<Dream3dImportParameter>(k_ImportFileData, "Import File Path", "The HDF5 file path the DataStructure should be imported from.", Dream3dImportParameter::ImportData()));
+
+  params.insertSeparator(Parameters::Separator{"Optional Image Subvolume"});
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ReadImageSubvolume_Key, "Read Image Subvolume",
+                                                                 "If true only the selected voxels of the Image Geometry cell data are read from the file", false));
+  params.insert(std::make_unique<StringParameter>(k_SubvolumeGeometryPath_Key, "Subvolume Image Geometry Path",
+                                                  "Path of the Image Geometry in the file to read a subvolume of. Leave empty to apply the subvolume to every Image Geometry", ""));
+  params.insert(std::make_unique<VectorUInt64Parameter>(k_SubvolumeMinVoxel_Key, "Min Voxel", "Lower bound of the voxels to read", std::vector<uint64>{0, 0, 0},
+                                                        std::vector<std::string>{"X (Column)", "Y (Row)", "Z (Plane)"}));
+  params.insert(std::make_unique<VectorUInt64Parameter>(k_SubvolumeMaxVoxel_Key, "Max Voxel [Inclusive]", "Upper bound of the voxels to read. Values past the end of the geometry are clamped",
+                                                        std::vector<uint64>{0, 0, 0}, std::vector<std::string>{"X (Column)", "Y (Row)", "Z (Plane)"}));
+  params.insert(std::make_unique<VectorUInt64Parameter>(k_SubvolumeStride_Key, "Stride", "Read every Nth voxel along each axis to create a decimated preview", std::vector<uint64>{1, 1, 1},
+                                                        std::vector<std::string>{"X (Column)", "Y (Row)", "Z (Plane)"}));
+  params.linkParameters(k_ReadImageSubvolume_Key, k_SubvolumeGeometryPath_Key, true);
+  params.linkParameters(k_ReadImageSubvolume_Key, k_SubvolumeMinVoxel_Key, true);
+  params.linkParameters(k_ReadImageSubvolume_Key, k_SubvolumeMaxVoxel_Key, true);
+  params.linkParameters(k_ReadImageSubvolume_Key, k_SubvolumeStride_Key, true);
   return params;
 }
 
 //------------------------------------------------------------------------------
 IFilter::VersionType ReadDREAM3DFilter::parametersVersion() const
 {
-  return 1;
+  return 2;
+
+  // Version 1 -> 2
+  // Change 1:
+  // Added - k_ReadImageSubvolume_Key = "read_image_subvolume";
+  // Added - k_SubvolumeGeometryPath_Key = "subvolume_geometry_path";
+  // Added - k_SubvolumeMinVoxel_Key = "subvolume_min_voxel";
+  // Added - k_SubvolumeMaxVoxel_Key = "subvolume_max_voxel";
+  // Added - k_SubvolumeStride_Key = "subvolume_stride";
+  // Solution - Pipelines written with version 1 always read the whole file, so `k_ReadImageSubvolume_Key Value` = false;
 }
 
 //------------------------------------------------------------------------------
@@ -82,8 +133,46 @@ IFilter::PreflightResult ReadDREAM3DFilter::preflightImpl(const DataStructure& d
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_FailedOpenFileReaderError, "Failed to open the HDF5 file at the specified path."}})};
   }
 
+  std::optional<HDF5::ImageSubvolume> imageSubvolume;
+  if(args.value<bool>(k_ReadImageSubvolume_Key))
+  {
+    auto minVoxel = args.value<std::vector<uint64>>(k_SubvolumeMinVoxel_Key);
+    auto maxVoxel = args.value<std::vector<uint64>>(k_SubvolumeMaxVoxel_Key);
+    auto stride = args.value<std::vector<uint64>>(k_SubvolumeStride_Key);
+    auto geometryPath = args.value<std::string>(k_SubvolumeGeometryPath_Key);
+
+    imageSubvolume = HDF5::ImageSubvolume{};
+    if(!geometryPath.empty())
+    {
+      imageSubvolume->GeometryPath = DataPath::FromString(geometryPath);
+      if(!imageSubvolume->GeometryPath.has_value())
+      {
+        return {MakeErrorResult<OutputActions>(k_InvalidSubvolumeGeometryPathError, fmt::format("'{}' is not a valid Image Geometry path.", geometryPath))};
+      }
+
+      // A path that matches no Image Geometry in the file would otherwise silently read every geometry in full.
+      // Legacy files report their own error since they do not support subvolumes.
+      if(DREAM3D::GetFileVersion(fileReader) == DREAM3D::k_CurrentFileVersion &&
+         (imageSubvolume->GeometryPath->empty() || !ContainsImageGeometry(fileReader.openGroup(Constants::k_DataStructureTag), imageSubvolume->GeometryPath->getPathVector(), 0)))
+      {
+        return {MakeErrorResult<OutputActions>(k_MissingSubvolumeGeometryError, fmt::format("The file does not contain an Image Geometry at the Subvolume Image Geometry Path '{}'.", geometryPath))};
+      }
+    }
+    for(usize i = 0; i < 3; i++)
+    {
+      if(minVoxel[i] > maxVoxel[i] || stride[i] == 0)
+      {
+        return {MakeErrorResult<OutputActions>(k_InvalidSubvolumeError, fmt::format("Invalid subvolume along axis {}: Min Voxel ({}) must not be greater than Max Voxel ({}) and Stride ({}) must be at least 1",
+                                                                                    i, minVoxel[i], maxVoxel[i], stride[i]))};
+      }
+      imageSubvolume->MinIndex[i] = minVoxel[i];
+      imageSubvolume->MaxIndex[i] = maxVoxel[i];
+      imageSubvolume->Stride[i] = stride[i];
+    }
+  }
+
   OutputActions actions;
-  auto action = std::make_unique<ImportH5ObjectPathsAction>(importData.FilePath, importData.DataPaths);
+  auto action = std::make_unique<ImportH5ObjectPathsAction>(importData.FilePath, importData.DataPaths, imageSubvolume);
   actions.appendAction(std::move(action));
   return {std::move(actions)};
 }
@@ -28,6 +28,11 @@ public:
 
   // Parameter Keys
   static inline constexpr StringLiteral k_ImportFileData = "import_data_object";
+  static inline constexpr StringLiteral k_ReadImageSubvolume_Key = "read_image_subvolume";
+  static inline constexpr StringLiteral k_SubvolumeGeometryPath_Key = "subvolume_geometry_path";
+  static inline constexpr StringLiteral k_SubvolumeMinVoxel_Key = "subvolume_min_voxel";
+  static inline constexpr StringLiteral k_SubvolumeMaxVoxel_Key = "subvolume_max_voxel";
+  static inline constexpr StringLiteral k_SubvolumeStride_Key = "subvolume_stride";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
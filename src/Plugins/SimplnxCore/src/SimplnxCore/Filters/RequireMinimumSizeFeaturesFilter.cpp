@@ -11,6 +11,7 @@
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
+#include "simplnx/Utilities/TupleRemap.hpp"
 
 #include <algorithm>
 #include <vector>
@@ -28,7 +29,8 @@ constexpr int32 k_BadMinAllowedFeatureSize = -5555;
 constexpr int32 k_BadNumCellsPath = -5556;
 constexpr int32 k_ParentlessPathError = -5557;
 
-void assign_badpoints(DataStructure& dataStructure, const DataPath& featureIdsPath, SizeVec3 dimensions, const NumCellsArrayType::store_type& numCellsStoreRef)
+Result<> assign_badpoints(DataStructure& dataStructure, const DataPath& featureIdsPath, SizeVec3 dimensions, const NumCellsArrayType::store_type& numCellsStoreRef,
+                          const std::atomic_bool& shouldCancel)
 {
   FeatureIdsArrayType::store_type* featureIds = dataStructure.getDataAs<FeatureIdsArrayType>(featureIdsPath)->getDataStore();
   usize totalPoints = featureIds->getNumberOfTuples();
@@ -158,36 +160,30 @@ void assign_badpoints(DataStructure& dataStructure, const DataPath& featureIdsPa
         }
       }
     }
-    DataPath attrMatPath = featureIdsPath.getParent();
-    auto* parentGroup = dataStructure.getDataAs<BaseGroup>(attrMatPath);
-    std::vector<std::string> voxelArrayNames;
-    for(const auto& [identifier, sharedChild] : *parentGroup)
-    {
-      if(std::dynamic_pointer_cast<IDataArray>(sharedChild))
-      {
-        voxelArrayNames.push_back(sharedChild->getName());
-      }
-    }
-
-    // TODO: This loop could be parallelized. Look at NeighborOrientationCorrelation filter
+    // Gather the copies in a source index map. A neighbor that was filled earlier in this
+    // pass counts as good, exactly as if the tuples were copied one at a time in place.
+    std::vector<int32> sourceIndices(totalPoints, -1);
     for(size_t j = 0; j < totalPoints; j++)
     {
       featurename = featureIds->getValue(j);
       neighbor = neighbors[j];
-      if(neighbor >= 0)
+      if(neighbor >= 0 && featurename < 0)
       {
-        if(featurename < 0 && featureIds->getValue(neighbor) >= 0)
+        const int32 currentNeighbor = (static_cast<size_t>(neighbor) < j && sourceIndices[neighbor] >= 0) ? sourceIndices[neighbor] : neighbor;
+        if(featureIds->getValue(currentNeighbor) >= 0)
         {
-          for(auto& voxelArrayName : voxelArrayNames)
-          {
-            auto arrayPath = attrMatPath.createChildPath(voxelArrayName);
-            auto* arr = dataStructure.getDataAs<IDataArray>(arrayPath);
-            arr->copyTuple(neighbor, j);
-          }
+          sourceIndices[j] = currentNeighbor;
         }
       }
     }
+
+    Result<> remapResult = TupleRemap::Create(sourceIndices).apply(dataStructure, featureIdsPath.getParent(), {}, shouldCancel);
+    if(remapResult.invalid() || shouldCancel)
+    {
+      return remapResult;
+    }
   }
+  return {};
 }
 
 // -----------------------------------------------------------------------------
@@ -425,7 +421,11 @@ Result<> RequireMinimumSizeFeaturesFilter::executeImpl(DataStructure& dataStruct
   }
 
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  assign_badpoints(dataStructure, featureIdsPath, imageGeom.getDimensions(), numCellsStoreRef);
+  Result<> assignResult = assign_badpoints(dataStructure, featureIdsPath, imageGeom.getDimensions(), numCellsStoreRef, shouldCancel);
+  if(assignResult.invalid())
+  {
+    return assignResult;
+  }
 
   DataPath cellFeatureGroupPath = numCellsPath.getParent();
   size_t currentFeatureCount = numCellsStoreRef.getNumberOfTuples();
@@ -200,7 +200,11 @@ Result<> WriteASCIIDataFilter::executeImpl(DataStructure& dataStructure, const A
         return MakeErrorResult(-11021, fmt::format("Unable to create output file {}", outputPath.string()));
       }
 
-      OStreamUtilities::PrintDataSetsToSingleFile(outStrm, selectedDataArrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+      Result<> printResult = OStreamUtilities::PrintDataSetsToSingleFile(outStrm, selectedDataArrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+      if(printResult.invalid())
+      {
+        return printResult;
+      }
     }
 
     Result<> commitResult = atomicFile.commit();
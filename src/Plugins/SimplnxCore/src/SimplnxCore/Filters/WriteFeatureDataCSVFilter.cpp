@@ -151,7 +151,12 @@ Result<> WriteFeatureDataCSVFilter::executeImpl(DataStructure& dataStructure, co
     }
 
     // call ostream function
-    OStreamUtilities::PrintDataSetsToSingleFile(fout, arrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, true, true, false, "Feature_ID", neighborPaths, pWriteNumFeaturesLineValue);
+    Result<> printResult = OStreamUtilities::PrintDataSetsToSingleFile(fout, arrayPaths, dataStructure, messageHandler, shouldCancel, delimiter, true, true, false, "Feature_ID", neighborPaths,
+                                                                       pWriteNumFeaturesLineValue);
+    if(printResult.invalid())
+    {
+      return printResult;
+    }
   }
 
   Result<> commitResult = atomicFile.commit();
@@ -1,14 +1,93 @@
 #include "StlUtilities.hpp"
 
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
 
 using namespace nx::core;
 
+namespace
+{
+constexpr usize k_HeaderAndCountSize = StlConstants::k_STL_HEADER_LENGTH + sizeof(int32);
+constexpr usize k_TriangleValuesSize = 12 * sizeof(float32);
+constexpr usize k_TriangleRecordSize = k_TriangleValuesSize + sizeof(uint16);
+
+bool IsMagicsFile(const std::string& stlHeaderStr)
+{
+  // Look for the tell-tale signs that the file was written from Magics Materialise
+  // If the file was written by Magics as a "Color STL" file then the 2byte int
+  // values between each triangle will be NON-Zero which will screw up the reading.
+  // These NON-Zero value do NOT indicate a length but is some sort of color
+  // value encoded into the file. Instead of being normal like everyone else and
+  // using the STL spec they went off and did their own thing.
+
+  static const std::string k_ColorHeader("COLOR=");
+  static const std::string k_MaterialHeader("MATERIAL=");
+  if(stlHeaderStr.find(k_ColorHeader) != std::string::npos && stlHeaderStr.find(k_MaterialHeader) != std::string::npos)
+  {
+    return true;
+  }
+  return false;
+}
+
+bool IsVxElementsFile(const std::string& stlHeader)
+{
+  // Look for the tell-tale signs that the file was written from VxElements Creaform
+  // STL files do not honor the last 2 bytes of the 50 byte Triangle struct
+  // as specified in the STL Binary File specification. If we detect this, then we
+  // ignore the 2 bytes are anything meaningful.
+  return nx::core::StringUtilities::contains(stlHeader, "VXelements");
+}
+
+/**
+ * @brief A triangle corner keyed by the bit patterns of its coordinates. Sorting the keys brings the corners that share a
+ * vertex together, with the first corner that uses the vertex in front.
+ */
+struct CornerKey
+{
+  std::array<uint32, 3> Coords = {};
+  usize Corner = 0;
+
+  bool operator<(const CornerKey& other) const
+  {
+    return Coords != other.Coords ? Coords < other.Coords : Corner < other.Corner;
+  }
+};
+
+uint32 CoordinateKey(float32 value)
+{
+  // Adding 0 turns -0 into +0 so that both are merged just like they compare equal as floats
+  return std::bit_cast<uint32>(value + 0.0F);
+}
+
+void SortCornerKeys(std::vector<CornerKey>& cornerKeys)
+{
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  tbb::parallel_sort(cornerKeys.begin(), cornerKeys.end());
+#else
+  std::sort(cornerKeys.begin(), cornerKeys.end());
+#endif
+}
+} // namespace
+
 StlConstants::StlFileType StlUtilities::DetermineStlFileType(const fs::path& path)
 {
   // Open File
@@ -155,3 +234,208 @@ void StlUtilities::ConvertAsciiToBinaryStl(const std::filesystem::path& inputPat
 
 // Example usage:
 // convertAsciiToBinarySTL("input_ascii.stl", "output_binary.stl");
+
+// -----------------------------------------------------------------------------
+Result<StlUtilities::BinaryStlFile> StlUtilities::BinaryStlFile::Open(const fs::path& filePath)
+{
+  Result<MemoryMappedFile> mappedFileResult = MemoryMappedFile::Open(filePath);
+  if(mappedFileResult.invalid())
+  {
+    return MakeErrorResult<BinaryStlFile>(StlConstants::k_ErrorOpeningFile, fmt::format("Error opening STL file '{}'", filePath.string()));
+  }
+
+  BinaryStlFile stlFile;
+  stlFile.m_File = std::move(mappedFileResult.value());
+  const uint8* fileData = stlFile.m_File.data();
+  const usize fileSize = stlFile.m_File.size();
+
+  if(fileSize < StlConstants::k_STL_HEADER_LENGTH)
+  {
+    return MakeErrorResult<BinaryStlFile>(StlConstants::k_StlHeaderParseError, "Error reading first 8 bytes of STL header. This can't be good.");
+  }
+  if(fileSize < k_HeaderAndCountSize)
+  {
+    return MakeErrorResult<BinaryStlFile>(StlConstants::k_TriangleCountParseError, "Error reading number of triangles from file. This is bad.");
+  }
+  const std::string stlHeaderStr(reinterpret_cast<const char*>(fileData), StlConstants::k_STL_HEADER_LENGTH);
+  int32 triCount = 0;
+  std::memcpy(&triCount, fileData + StlConstants::k_STL_HEADER_LENGTH, sizeof(int32));
+  if(triCount < 0)
+  {
+    return MakeErrorResult<BinaryStlFile>(StlConstants::k_TriangleCountParseError, fmt::format("The STL file header states a negative number of triangles ({}).", triCount));
+  }
+  stlFile.m_NumTriangles = static_cast<usize>(triCount);
+
+  // Per the STL spec the uint16 after each triangle is the number of vendor specific bytes that follow it. Magics and
+  // VXelements write other values there, so for their files the records are always packed.
+  const bool ignoreMetaSizeValue = IsMagicsFile(stlHeaderStr) || IsVxElementsFile(stlHeaderStr);
+
+  // Walk the records once to validate the file length. Offsets are only stored once a record is followed by extra bytes.
+  usize offset = k_HeaderAndCountSize;
+  for(usize triangle = 0; triangle < stlFile.m_NumTriangles; triangle++)
+  {
+    if(offset >= fileSize)
+    {
+      std::string msg = fmt::format(
+          "Trying to read at file position {} >= file size {}.\n  File Header: '{}'\n  Header Triangle Count: {}  Current Triangle: {}\n  The STL File does not conform to the STL file specification.",
+          offset, fileSize, stlHeaderStr, triCount, triangle);
+      return MakeErrorResult<BinaryStlFile>(StlConstants::k_StlFileLengthError, msg);
+    }
+    if(offset + k_TriangleValuesSize > fileSize)
+    {
+      return MakeErrorResult<BinaryStlFile>(StlConstants::k_TriangleParseError, fmt::format("Error reading Triangle '{}'. The file ends inside of the triangle.", triangle));
+    }
+    if(offset + k_TriangleRecordSize > fileSize)
+    {
+      return MakeErrorResult<BinaryStlFile>(StlConstants::k_AttributeParseError, fmt::format("Error reading Number of attributes for triangle '{}'. The file ends inside of the value.", triangle));
+    }
+
+    uint16 attributeByteCount = 0;
+    if(!ignoreMetaSizeValue)
+    {
+      std::memcpy(&attributeByteCount, fileData + offset + k_TriangleValuesSize, sizeof(uint16));
+    }
+    if(attributeByteCount != 0 && stlFile.m_TriangleOffsets.empty())
+    {
+      stlFile.m_TriangleOffsets.resize(stlFile.m_NumTriangles);
+      for(usize packedTriangle = 0; packedTriangle < triangle; packedTriangle++)
+      {
+        stlFile.m_TriangleOffsets[packedTriangle] = k_HeaderAndCountSize + packedTriangle * k_TriangleRecordSize;
+      }
+    }
+    if(!stlFile.m_TriangleOffsets.empty())
+    {
+      stlFile.m_TriangleOffsets[triangle] = offset;
+    }
+    offset += k_TriangleRecordSize + attributeByteCount;
+  }
+
+  return {std::move(stlFile)};
+}
+
+// -----------------------------------------------------------------------------
+usize StlUtilities::BinaryStlFile::getNumberOfTriangles() const
+{
+  return m_NumTriangles;
+}
+
+// -----------------------------------------------------------------------------
+const uint8* StlUtilities::BinaryStlFile::getTriangleRecord(usize triangle) const
+{
+  const usize offset = m_TriangleOffsets.empty() ? k_HeaderAndCountSize + triangle * k_TriangleRecordSize : m_TriangleOffsets[triangle];
+  return m_File.data() + offset;
+}
+
+// -----------------------------------------------------------------------------
+Result<std::vector<float32>> StlUtilities::BinaryStlFile::readTriangles(AbstractDataStore<IGeometry::MeshIndexType>& faces, AbstractDataStore<float64>& faceNormals, usize faceOffset,
+                                                                         const std::atomic_bool& shouldCancel) const
+{
+  const usize numCorners = 3 * m_NumTriangles;
+
+  // Parse the triangle records in parallel. The normals go straight into the geometry, the corners become sort keys.
+  std::vector<CornerKey> cornerKeys(numCorners);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, m_NumTriangles);
+    dataAlg.requireStoresInMemory({&faceNormals});
+    dataAlg.execute([&](const Range& range) {
+      std::array<float32, 12> values = {};
+      for(usize triangle = range.min(); triangle < range.max(); triangle++)
+      {
+        if(shouldCancel)
+        {
+          return;
+        }
+        std::memcpy(values.data(), getTriangleRecord(triangle), k_TriangleValuesSize);
+        const usize faceIndex = faceOffset + triangle;
+        faceNormals[3 * faceIndex + 0] = static_cast<float64>(values[0]);
+        faceNormals[3 * faceIndex + 1] = static_cast<float64>(values[1]);
+        faceNormals[3 * faceIndex + 2] = static_cast<float64>(values[2]);
+        for(usize vertex = 0; vertex < 3; vertex++)
+        {
+          CornerKey& cornerKey = cornerKeys[3 * triangle + vertex];
+          cornerKey.Coords = {CoordinateKey(values[3 + 3 * vertex]), CoordinateKey(values[4 + 3 * vertex]), CoordinateKey(values[5 + 3 * vertex])};
+          cornerKey.Corner = 3 * triangle + vertex;
+        }
+      }
+    });
+  }
+  if(shouldCancel)
+  {
+    return {};
+  }
+
+  // Each run of sorted keys with identical coordinates is one unique vertex
+  SortCornerKeys(cornerKeys);
+  std::vector<usize> runStarts;
+  for(usize i = 0; i < numCorners; i++)
+  {
+    if(i == 0 || cornerKeys[i].Coords != cornerKeys[i - 1].Coords)
+    {
+      runStarts.push_back(i);
+    }
+  }
+  const usize numRuns = runStarts.size();
+  runStarts.push_back(numCorners);
+
+  std::vector<usize> cornerRuns(numCorners);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRuns);
+    dataAlg.execute([&](const Range& range) {
+      for(usize run = range.min(); run < range.max(); run++)
+      {
+        for(usize i = runStarts[run]; i < runStarts[run + 1]; i++)
+        {
+          cornerRuns[cornerKeys[i].Corner] = run;
+        }
+      }
+    });
+  }
+  cornerKeys = std::vector<CornerKey>();
+  runStarts = std::vector<usize>();
+
+  // Number the unique vertices in the order in which the triangles first use them
+  constexpr usize k_Unassigned = std::numeric_limits<usize>::max();
+  std::vector<usize> runVertexIds(numRuns, k_Unassigned);
+  std::vector<usize> firstCorners;
+  firstCorners.reserve(numRuns);
+  for(usize corner = 0; corner < numCorners; corner++)
+  {
+    usize& vertexId = runVertexIds[cornerRuns[corner]];
+    if(vertexId == k_Unassigned)
+    {
+      vertexId = firstCorners.size();
+      firstCorners.push_back(corner);
+    }
+  }
+
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numCorners);
+    dataAlg.requireStoresInMemory({&faces});
+    dataAlg.execute([&](const Range& range) {
+      for(usize corner = range.min(); corner < range.max(); corner++)
+      {
+        faces[3 * faceOffset + corner] = static_cast<IGeometry::MeshIndexType>(runVertexIds[cornerRuns[corner]]);
+      }
+    });
+  }
+
+  // The coordinates are copied from the first corner of each vertex so they are exactly the values in the file
+  std::vector<float32> vertices(3 * firstCorners.size());
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, firstCorners.size());
+    dataAlg.execute([&](const Range& range) {
+      for(usize vertexId = range.min(); vertexId < range.max(); vertexId++)
+      {
+        const usize corner = firstCorners[vertexId];
+        const uint8* coords = getTriangleRecord(corner / 3) + 3 * sizeof(float32) * (1 + corner % 3);
+        std::memcpy(vertices.data() + 3 * vertexId, coords, 3 * sizeof(float32));
+      }
+    });
+  }
+
+  return {std::move(vertices)};
+}
@@ -1,7 +1,16 @@
 #pragma once
 
+#include "SimplnxCore/SimplnxCore_export.hpp"
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/Geometry/IGeometry.hpp"
+#include "simplnx/Utilities/MemoryMappedFile.hpp"
+
+#include <atomic>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -58,5 +67,54 @@ int32_t NumFacesFromHeader(const fs::path& path);
  */
 void ConvertAsciiToBinaryStl(const std::filesystem::path& inputPath, const std::filesystem::path& outputPath);
 
+/**
+ * @class BinaryStlFile
+ * @brief Reads the triangles of a binary STL file through a memory map. The triangles are parsed in parallel and
+ * identical vertices are merged while loading by sorting the triangle corners on their coordinates, so the result
+ * needs no separate duplicate node elimination.
+ */
+class SIMPLNXCORE_EXPORT BinaryStlFile
+{
+public:
+  /**
+   * @brief Maps the file and validates that all triangles stated in its header are present.
+   * @param filePath
+   * @return Result<BinaryStlFile>
+   */
+  static Result<BinaryStlFile> Open(const fs::path& filePath);
+
+  /**
+   * @brief Returns the number of triangles stated in the header.
+   * @return usize
+   */
+  usize getNumberOfTriangles() const;
+
+  /**
+   * @brief Parses all triangles. Their normals are written to faceNormals and the ids of their vertices to faces, both
+   * starting at triangle faceOffset. The vertex ids start at 0 and number the unique vertices in the order in which the
+   * triangles first use them. Returns the coordinates of the unique vertices.
+   * @param faces
+   * @param faceNormals
+   * @param faceOffset
+   * @param shouldCancel
+   * @return Result<std::vector<float32>>
+   */
+  Result<std::vector<float32>> readTriangles(AbstractDataStore<IGeometry::MeshIndexType>& faces, AbstractDataStore<float64>& faceNormals, usize faceOffset,
+                                             const std::atomic_bool& shouldCancel) const;
+
+private:
+  BinaryStlFile() = default;
+
+  /**
+   * @brief Returns the 50 byte record of the triangle: the normal and 3 vertices as 12 float32 followed by the attribute byte count.
+   */
+  const uint8* getTriangleRecord(usize triangle) const;
+
+  MemoryMappedFile m_File;
+  usize m_NumTriangles = 0;
+  // Only filled if the file uses non-zero attribute byte counts, otherwise the records are packed
+  std::vector<usize> m_TriangleOffsets;
+};
+
 } // namespace StlUtilities
 } // namespace nx::core
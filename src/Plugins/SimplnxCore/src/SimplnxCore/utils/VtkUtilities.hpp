@@ -5,8 +5,6 @@
 namespace nx::core
 {
 
-static constexpr usize k_BufferDumpVal = 1000000;
-
 // -----------------------------------------------------------------------------
 template <typename T>
 std::string TypeForPrimitive(const IFilter::MessageHandler& messageHandler)
@@ -138,74 +136,52 @@ std::string TypeForPrimitive(const IFilter::MessageHandler& messageHandler)
 struct WriteVtkDataArrayFunctor
 {
   template <typename T>
-  void operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler)
+  Result<> operator()(std::ostream& outStrm, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler,
+                      const std::atomic_bool& shouldCancel)
   {
-    auto* dataArray = dataStructure.getDataAs<DataArray<T>>(arrayPath);
-    auto& dataStore = dataArray->template getIDataStoreRefAs<DataStore<T>>();
+    const auto& dataStore = dataStructure.getDataAs<DataArray<T>>(arrayPath)->getDataStoreRef();
 
     messageHandler(IFilter::Message::Type::Info, fmt::format("Writing Cell Data {}", arrayPath.getTargetName()));
 
-    const usize totalElements = dataStore.getSize();
     const int numComps = static_cast<int>(dataStore.getNumberOfComponents());
     std::string dName = arrayPath.getTargetName();
     dName = StringUtilities::replace(dName, " ", "_");
 
     const std::string vtkTypeString = TypeForPrimitive<T>(messageHandler);
-    bool useIntCast = false;
-    if(vtkTypeString == "unsigned_char" || vtkTypeString == "char")
-    {
-      useIntCast = true;
-    }
 
-    fprintf(outputFile, "SCALARS %s %s %d\n", dName.c_str(), vtkTypeString.c_str(), numComps);
-    fprintf(outputFile, "LOOKUP_TABLE default\n");
+    outStrm << fmt::format("SCALARS {} {} {}\n", dName, vtkTypeString, numComps);
+    outStrm << "LOOKUP_TABLE default\n";
+    Result<> result;
     if(binary)
     {
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
-      fwrite(dataStore.data(), sizeof(T), totalElements, outputFile);
-      fprintf(outputFile, "\n");
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
+      result = OStreamUtilities::WriteBigEndianValues(outStrm, dataStore, messageHandler, fmt::format("Writing {}", dName), shouldCancel);
     }
     else
     {
-      std::string buffer;
-      buffer.reserve(k_BufferDumpVal);
-      for(size_t i = 0; i < totalElements; i++)
-      {
-        if(i % 20 == 0 && i > 0)
-        {
-          buffer.append("\n");
-        }
-        if(useIntCast)
-        {
-          buffer.append(fmt::format(" {:d}", static_cast<int>(dataStore[i])));
-        }
-        else if constexpr(std::is_floating_point_v<T>)
-        {
-          buffer.append(fmt::format(" {:f}", dataStore[i]));
-        }
-        else
-        {
-          buffer.append(fmt::format(" {}", dataStore[i]));
-        }
-        // If the buffer is within 32 bytes of the reserved size, then dump
-        // the contents to the file.
-        if(buffer.size() > (k_BufferDumpVal - 32))
-        {
-          fprintf(outputFile, "%s", buffer.c_str());
-          buffer.clear();
-          buffer.reserve(k_BufferDumpVal);
-        }
-      }
-      buffer.append("\n");
-      fprintf(outputFile, "%s", buffer.c_str());
+      auto formatBlock = [&dataStore](std::string& buffer, usize begin, usize end) -> Result<> {
+        return DataStoreUtilities::ReadBlocks(dataStore, begin, end, [&buffer](usize blockStart, nonstd::span<const T> values) {
+          for(usize i = 0; i < values.size(); i++)
+          {
+            if((blockStart + i) % 20 == 0 && blockStart + i > 0)
+            {
+              buffer.push_back('\n');
+            }
+            buffer.push_back(' ');
+            if constexpr(std::is_floating_point_v<T>)
+            {
+              fmt::format_to(std::back_inserter(buffer), "{:f}", values[i]);
+            }
+            else
+            {
+              OStreamUtilities::AppendInteger(buffer, values[i]);
+            }
+          }
+        });
+      };
+      result = OStreamUtilities::WriteBlocks(outStrm, dataStore.getSize(), formatBlock, messageHandler, fmt::format("Writing {}", dName), shouldCancel, {&dataStore});
     }
+    outStrm << "\n";
+    return result;
   }
 };
 
@@ -264,7 +240,6 @@ struct WriteVtkDataFunctor
   Result<> operator()(std::ofstream& outStrm, IDataArray& iDataArray, bool binary, const nx::core::IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
   {
     using DataArrayType = DataArray<T>;
-    using DataStoreType = typename DataArrayType::store_type;
 
     auto& dataArrayRef = dynamic_cast<DataArrayType&>(iDataArray);
     const auto& dataStoreRef = dataArrayRef.getDataStoreRef();
@@ -274,72 +249,28 @@ struct WriteVtkDataFunctor
     outStrm << "SCALARS " << name << " " << ConvertDataTypeToVtkDataType<T>() << " " << dataArrayRef.getNumberOfComponents() << "\n";
     outStrm << "LOOKUP_TABLE default\n";
 
+    Result<> result;
     if(binary)
     {
-      // Swap to big Endian... because
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
-
-      auto result = dataStoreRef.writeBinaryFile(outStrm);
-      if(result.first != 0)
-      {
-      }
-
-      // Swap back to little endian
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
+      // VTK binary data is big endian
+      result = OStreamUtilities::WriteBigEndianValues(outStrm, dataStoreRef, messageHandler, fmt::format("Processing {}", dataArrayRef.getName()), shouldCancel);
     }
     else
     {
-      const size_t k_DefaultElementsPerLine = 10;
-      auto start = std::chrono::steady_clock::now();
-      auto numTuples = dataStoreRef.getSize();
-      size_t currentItemCount = 0;
-
-      for(size_t idx = 0; idx < numTuples; idx++)
-      {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          auto string = fmt::format("Processing {}: {}% completed", dataArrayRef.getName(), static_cast<int32>(100 * static_cast<float>(idx) / static_cast<float>(numTuples)));
-          messageHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
+      constexpr usize k_DefaultElementsPerLine = 10;
+      auto formatBlock = [&dataStoreRef](std::string& buffer, usize begin, usize end) -> Result<> {
+        return DataStoreUtilities::ReadBlocks(dataStoreRef, begin, end, [&buffer](usize blockStart, nonstd::span<const T> values) {
+          for(usize i = 0; i < values.size(); i++)
           {
-            return {};
+            OStreamUtilities::AppendValue(buffer, values[i]);
+            buffer.push_back((blockStart + i) % k_DefaultElementsPerLine < k_DefaultElementsPerLine - 1 ? ' ' : '\n');
           }
-        }
-
-        if constexpr(std::is_same_v<T, int8> || std::is_same_v<T, uint8>)
-        {
-          outStrm << static_cast<int32>(dataArrayRef[idx]);
-        }
-        else if constexpr(std::is_same_v<T, float32> || std::is_same_v<T, float64>)
-        {
-          outStrm << fmt::format("{}", dataArrayRef[idx]);
-        }
-        else
-        {
-          outStrm << dataArrayRef[idx];
-        }
-        if(currentItemCount < k_DefaultElementsPerLine - 1)
-        {
-          outStrm << ' ';
-          currentItemCount++;
-        }
-        else
-        {
-          outStrm << "\n";
-          currentItemCount = 0;
-        }
-      }
+        });
+      };
+      result = OStreamUtilities::WriteBlocks(outStrm, dataStoreRef.getSize(), formatBlock, messageHandler, fmt::format("Processing {}", dataArrayRef.getName()), shouldCancel, {&dataStoreRef});
     }
     outStrm << "\n"; // Always end with a new line for binary data
-    return {};
+    return result;
   }
 };
 } // namespace nx::core
@@ -1,6 +1,7 @@
 #include "SimplnxCore/Filters/ApplyTransformationToGeometryFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
@@ -20,11 +21,6 @@ using namespace nx::core;
 using namespace nx::core::Constants;
 using namespace nx::core::UnitTest;
 
-namespace
-{
-
-} // namespace
-
 namespace apply_transformation_to_geometry
 {
 const nx::core::ChoicesParameter::ValueType k_PrecomputedTransformationMatrixIdx = 1ULL;
@@ -56,6 +52,29 @@ const int32 k_CellAttrMatrixUnusedWarning = -5555;
 
 } // namespace apply_transformation_to_geometry
 
+namespace
+{
+/**
+ * @brief Integer arrays are never interpolated, so the "Data" array of a linear transformation has to match the one
+ * of a nearest neighbor transformation of the same input.
+ */
+void RequireNearestNeighborResult(const fs::path& baseDataFilePath, Arguments args, const DataStructure& linearDataStructure)
+{
+  DataStructure dataStructure = UnitTest::LoadDataStructure(baseDataFilePath);
+  args.insertOrAssign(ApplyTransformationToGeometryFilter::k_InterpolationType_Key,
+                      std::make_any<nx::core::ChoicesParameter::ValueType>(apply_transformation_to_geometry::k_NearestNeighborInterpolationIdx));
+
+  const ApplyTransformationToGeometryFilter filter;
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const DataPath calculatedPath({apply_transformation_to_geometry::k_InputGeometryName, k_CellData, "Data"});
+  const auto& nearestNeighborData = dataStructure.getDataRefAs<IDataArray>(calculatedPath);
+  const auto& linearData = linearDataStructure.getDataRefAs<IDataArray>(calculatedPath);
+  UnitTest::CompareDataArrays<int32>(nearestNeighborData, linearData);
+}
+} // namespace
+
 TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Translation_Node", "[SimplnxCore][ApplyTransformationToGeometryFilter]")
 {
   const nx::core::UnitTest::TestFileSentinel testDataSentinel1(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "6_6_apply_transformation_to_geometry.tar.gz",
@@ -340,9 +359,9 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Rotation_Image_Linea
   DataStructure dataStructure = UnitTest::LoadDataStructure(baseDataFilePath);
   const DataPath inputGeometryPath({"InputData"});
   const DataPath inputCellAMPath = inputGeometryPath.createChildPath(k_CellData);
+  Arguments args;
   {
     const ApplyTransformationToGeometryFilter filter;
-    Arguments args;
 
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(inputGeometryPath));
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformationType_Key, std::make_any<nx::core::ChoicesParameter::ValueType>(apply_transformation_to_geometry::k_RotationIdx));
@@ -361,13 +380,7 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Rotation_Image_Linea
 #ifdef SIMPLNX_WRITE_TEST_OUTPUT
   WriteTestDataStructure(dataStructure, fmt::format("{}/apply_transformation_to_geometry_rotation.dream3d", unit_test::k_BinaryTestOutputDir));
 #endif
-  {
-    const DataPath exemplarPath({apply_transformation_to_geometry::k_RotationGeometryName66, k_CellData, "Data"});
-    const DataPath calculatedPath({apply_transformation_to_geometry::k_InputGeometryName, k_CellData, "Data"});
-    const auto& exemplarData = dataStructure.getDataRefAs<IDataArray>(exemplarPath);
-    const auto& calculatedData = dataStructure.getDataRefAs<IDataArray>(calculatedPath);
-    UnitTest::CompareDataArrays<int32>(exemplarData, calculatedData);
-  }
+  RequireNearestNeighborResult(baseDataFilePath, args, dataStructure);
 }
 
 TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Scale_Image_Linear", "[SimplnxCore][ApplyTransformationToGeometryFilter]")
@@ -420,9 +433,9 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Manual_Image_Linear"
   DataStructure dataStructure = UnitTest::LoadDataStructure(baseDataFilePath);
   const DataPath inputGeometryPath({"InputData"});
   const DataPath inputCellAMPath = inputGeometryPath.createChildPath(k_CellData);
+  Arguments args;
   {
     const ApplyTransformationToGeometryFilter filter;
-    Arguments args;
 
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(inputGeometryPath));
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformationType_Key,
@@ -445,13 +458,7 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Manual_Image_Linear"
   WriteTestDataStructure(dataStructure, fmt::format("{}/apply_transformation_to_geometry_manual.dream3d", unit_test::k_BinaryTestOutputDir));
 #endif
 
-  {
-    const DataPath exemplarPath({apply_transformation_to_geometry::k_ManualGeometryName66, k_CellData, "Data"});
-    const DataPath calculatedPath({apply_transformation_to_geometry::k_InputGeometryName, k_CellData, "Data"});
-    const auto& exemplarData = dataStructure.getDataRefAs<IDataArray>(exemplarPath);
-    const auto& calculatedData = dataStructure.getDataRefAs<IDataArray>(calculatedPath);
-    UnitTest::CompareDataArrays<int32>(exemplarData, calculatedData);
-  }
+  RequireNearestNeighborResult(baseDataFilePath, args, dataStructure);
 }
 
 TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Precomputed_Image_Linear", "[SimplnxCore][ApplyTransformationToGeometryFilter]")
@@ -463,9 +470,9 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Precomputed_Image_Li
   DataStructure dataStructure = UnitTest::LoadDataStructure(baseDataFilePath);
   const DataPath inputGeometryPath({"InputData"});
   const DataPath inputCellAMPath = inputGeometryPath.createChildPath(k_CellData);
+  Arguments args;
   {
     const ApplyTransformationToGeometryFilter filter;
-    Arguments args;
 
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(inputGeometryPath));
     args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformationType_Key,
@@ -488,13 +495,89 @@ TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Precomputed_Image_Li
   WriteTestDataStructure(dataStructure, fmt::format("{}/apply_transformation_to_geometry_manual.dream3d", unit_test::k_BinaryTestOutputDir));
 #endif
 
+  RequireNearestNeighborResult(baseDataFilePath, args, dataStructure);
+}
+
+TEST_CASE("SimplnxCore::ApplyTransformationToGeometryFilter:Rotation_Image_Linear_Float", "[SimplnxCore][ApplyTransformationToGeometryFilter]")
+{
+  // A linear field has to be reproduced exactly by trilinear interpolation, while integer labels keep their original values
+  const SizeVec3 dims = {10, 10, 2};
+  const std::vector<usize> tupleShape = {dims[2], dims[1], dims[0]};
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, apply_transformation_to_geometry::k_InputGeometryName);
+  imageGeom->setDimensions(dims);
+  imageGeom->setSpacing({1.0F, 1.0F, 1.0F});
+  imageGeom->setOrigin({0.0F, 0.0F, 0.0F});
+  auto* cellAM = AttributeMatrix::Create(dataStructure, k_CellData, tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellAM);
+  auto* fieldArray = UnitTest::CreateTestDataArray<float32>(dataStructure, "Field", tupleShape, {1}, cellAM->getId());
+  auto* labelArray = UnitTest::CreateTestDataArray<int32>(dataStructure, "Labels", tupleShape, {1}, cellAM->getId());
+  for(usize z = 0; z < dims[2]; z++)
   {
-    const DataPath exemplarPath({apply_transformation_to_geometry::k_PrecomputedGeometryName66, k_CellData, "Data"});
-    const DataPath calculatedPath({apply_transformation_to_geometry::k_InputGeometryName, k_CellData, "Data"});
-    const auto& exemplarData = dataStructure.getDataRefAs<IDataArray>(exemplarPath);
-    const auto& calculatedData = dataStructure.getDataRefAs<IDataArray>(calculatedPath);
-    UnitTest::CompareDataArrays<int32>(exemplarData, calculatedData);
+    for(usize y = 0; y < dims[1]; y++)
+    {
+      for(usize x = 0; x < dims[0]; x++)
+      {
+        const usize index = (z * dims[1] + y) * dims[0] + x;
+        const Point3Df center = imageGeom->getCoordsf(x, y, z);
+        (*fieldArray)[index] = center[0] + 2.0F * center[1];
+        (*labelArray)[index] = x < 5 ? 7 : 11;
+      }
+    }
+  }
+
+  const DataPath inputGeometryPath({apply_transformation_to_geometry::k_InputGeometryName});
+  {
+    const ApplyTransformationToGeometryFilter filter;
+    Arguments args;
+
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(inputGeometryPath));
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TransformationType_Key, std::make_any<nx::core::ChoicesParameter::ValueType>(apply_transformation_to_geometry::k_RotationIdx));
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_InterpolationType_Key, std::make_any<nx::core::ChoicesParameter::ValueType>(apply_transformation_to_geometry::k_LinearInterpolationIdx));
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_CellAttributeMatrixPath_Key, std::make_any<DataPath>(inputGeometryPath.createChildPath(k_CellData)));
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_Rotation_Key, std::make_any<nx::core::VectorFloat32Parameter::ValueType>({0.0F, 0.0F, 1.0F, 30.0F}));
+    args.insertOrAssign(ApplyTransformationToGeometryFilter::k_TranslateGeometryToGlobalOrigin_Key, std::make_any<nx::core::BoolParameter::ValueType>(false));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  const auto& rotatedGeom = dataStructure.getDataRefAs<ImageGeom>(inputGeometryPath);
+  const auto& rotatedField = dataStructure.getDataRefAs<Float32Array>(inputGeometryPath.createChildPath(k_CellData).createChildPath("Field"));
+  const auto& rotatedLabels = dataStructure.getDataRefAs<Int32Array>(inputGeometryPath.createChildPath(k_CellData).createChildPath("Labels"));
+  const SizeVec3 rotatedDims = rotatedGeom.getDimensions();
+  REQUIRE(rotatedField.getNumberOfTuples() == rotatedDims[0] * rotatedDims[1] * rotatedDims[2]);
+
+  const float32 cosAngle = std::cos(30.0F * k_PiOver180F);
+  const float32 sinAngle = std::sin(30.0F * k_PiOver180F);
+  usize numInterior = 0;
+  for(usize z = 0; z < rotatedDims[2]; z++)
+  {
+    for(usize y = 0; y < rotatedDims[1]; y++)
+    {
+      for(usize x = 0; x < rotatedDims[0]; x++)
+      {
+        const usize index = (z * rotatedDims[1] + y) * rotatedDims[0] + x;
+        const int32 label = rotatedLabels[index];
+        REQUIRE((label == 0 || label == 7 || label == 11));
+
+        // Rotate the cell center back into the original geometry and only check cells between the original cell centers
+        const Point3Df center = rotatedGeom.getCoordsf(x, y, z);
+        const float32 sourceX = cosAngle * center[0] + sinAngle * center[1];
+        const float32 sourceY = -sinAngle * center[0] + cosAngle * center[1];
+        if(sourceX < 0.51F || sourceX > 9.49F || sourceY < 0.51F || sourceY > 9.49F)
+        {
+          continue;
+        }
+        numInterior++;
+        REQUIRE(rotatedField[index] == Approx(sourceX + 2.0F * sourceY).margin(1.0E-3));
+      }
+    }
   }
+  REQUIRE(numInterior > 0);
 }
 
 /*******************************************************************************
@@ -6,8 +6,10 @@
 
 #include "SimplnxCore/Filters/CombineStlFilesFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
+#include "SimplnxCore/utils/StlUtilities.hpp"
 
 #include <filesystem>
+#include <fstream>
 namespace fs = std::filesystem;
 
 using namespace nx::core;
@@ -87,3 +89,36 @@ TEST_CASE("SimplnxCore::CombineStlFilesFilter: InValid Filter Execution")
   auto executeResult = filter.execute(dataStructure, args);
   SIMPLNX_RESULT_REQUIRE_INVALID(executeResult.result)
 }
+
+TEST_CASE("SimplnxCore::CombineStlFilesFilter: ASCII STL File", "[SimplnxCore][CombineStlFilesFilter]")
+{
+  // ASCII STL files cannot be read, so a directory holding one is rejected in preflight
+  const fs::path inputStlDir = fs::path(fmt::format("{}/combine_stl_files_ascii", unit_test::k_BinaryTestOutputDir));
+  fs::remove_all(inputStlDir);
+  fs::create_directories(inputStlDir);
+  {
+    std::ofstream asciiFile(inputStlDir / "ascii_triangle.stl");
+    asciiFile << "solid ascii_triangle\n"
+                 "  facet normal 0 0 1\n"
+                 "    outer loop\n"
+                 "      vertex 0 0 0\n"
+                 "      vertex 1 0 0\n"
+                 "      vertex 0 1 0\n"
+                 "    endloop\n"
+                 "  endfacet\n"
+                 "endsolid ascii_triangle\n";
+  }
+
+  CombineStlFilesFilter filter;
+  DataStructure dataStructure;
+  Arguments args;
+  args.insertOrAssign(CombineStlFilesFilter::k_StlFilesPath_Key, std::make_any<FileSystemPathParameter::ValueType>(inputStlDir));
+  args.insertOrAssign(CombineStlFilesFilter::k_TriangleGeometryPath_Key, std::make_any<DataPath>(k_ComputedTriangleDataContainerName));
+  args.insertOrAssign(CombineStlFilesFilter::k_FaceAttributeMatrixName_Key, std::make_any<std::string>(k_FaceData));
+  args.insertOrAssign(CombineStlFilesFilter::k_FaceNormalsArrayName_Key, std::make_any<std::string>(k_FaceNormals));
+  args.insertOrAssign(CombineStlFilesFilter::k_VertexAttributeMatrixName_Key, std::make_any<std::string>(k_VertexData));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions)
+  REQUIRE(preflightResult.outputActions.errors().front().code == StlConstants::k_UnsupportedFileType);
+}
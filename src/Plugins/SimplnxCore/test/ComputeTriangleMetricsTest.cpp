@@ -0,0 +1,147 @@
+#include "SimplnxCore/Filters/ComputeTriangleAreasFilter.hpp"
+#include "SimplnxCore/Filters/ComputeTriangleMetricsFilter.hpp"
+#include "SimplnxCore/Filters/ReadStlFileFilter.hpp"
+#include "SimplnxCore/Filters/TriangleCentroidFilter.hpp"
+#include "SimplnxCore/Filters/TriangleDihedralAngleFilter.hpp"
+#include "SimplnxCore/Filters/TriangleNormalFilter.hpp"
+#include "SimplnxCore/SimplnxCore_test_dirs.hpp"
+
+#include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+
+namespace
+{
+constexpr float64 k_max_difference = 0.000001;
+
+const std::string k_TriangleGeometryName = "[Triangle Geometry]";
+const DataPath k_TriangleGeometryPath({k_TriangleGeometryName});
+const DataPath k_FaceDataPath = k_TriangleGeometryPath.createChildPath(INodeGeometry2D::k_FaceDataName);
+
+void ReadSpecimen(DataStructure& dataStructure)
+{
+  std::string inputFile = fmt::format("{}/ASTMD638_specimen.stl", unit_test::k_ComplexTestDataSourceDir.view());
+
+  ReadStlFileFilter filter;
+  Arguments args;
+  args.insertOrAssign(ReadStlFileFilter::k_StlFilePath_Key, std::make_any<FileSystemPathParameter::ValueType>(fs::path(inputFile)));
+  args.insertOrAssign(ReadStlFileFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  REQUIRE(dataStructure.getDataRefAs<TriangleGeom>(k_TriangleGeometryPath).getNumberOfFaces() == 92);
+}
+
+Arguments CreateMetricsArguments(bool areas, bool normals, bool centroids, bool dihedralAngles)
+{
+  Arguments args;
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_TriGeometryDataPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_ComputeAreas_Key, std::make_any<bool>(areas));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_AreasArrayName_Key, std::make_any<std::string>("Fused Areas"));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_ComputeNormals_Key, std::make_any<bool>(normals));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_NormalsArrayName_Key, std::make_any<std::string>("Fused Normals"));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_ComputeCentroids_Key, std::make_any<bool>(centroids));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_CentroidsArrayName_Key, std::make_any<std::string>("Fused Centroids"));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_ComputeMinDihedralAngles_Key, std::make_any<bool>(dihedralAngles));
+  args.insertOrAssign(ComputeTriangleMetricsFilter::k_MinDihedralAnglesArrayName_Key, std::make_any<std::string>("Fused Dihedral Angles"));
+  return args;
+}
+
+void CompareArrays(const DataStructure& dataStructure, const std::string& exemplarName, const std::string& computedName)
+{
+  const auto& exemplar = dataStructure.getDataRefAs<Float64Array>(k_FaceDataPath.createChildPath(exemplarName));
+  const auto& computed = dataStructure.getDataRefAs<Float64Array>(k_FaceDataPath.createChildPath(computedName));
+  REQUIRE(exemplar.getSize() == computed.getSize());
+  for(usize i = 0; i < exemplar.getSize(); i++)
+  {
+    if(std::isnan(exemplar[i]))
+    {
+      REQUIRE(std::isnan(computed[i]));
+      continue;
+    }
+    REQUIRE(std::fabs(exemplar[i] - computed[i]) < k_max_difference);
+  }
+}
+} // namespace
+
+TEST_CASE("SimplnxCore::ComputeTriangleMetricsFilter: Matches Single Metric Filters", "[SimplnxCore][ComputeTriangleMetricsFilter]")
+{
+  DataStructure dataStructure;
+  ReadSpecimen(dataStructure);
+
+  {
+    ComputeTriangleAreasFilter filter;
+    Arguments args;
+    args.insertOrAssign(ComputeTriangleAreasFilter::k_TriangleGeometryDataPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+    args.insertOrAssign(ComputeTriangleAreasFilter::k_CalculatedAreasDataName_Key, std::make_any<std::string>("Areas"));
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(dataStructure, args).result);
+  }
+  {
+    TriangleNormalFilter filter;
+    Arguments args;
+    args.insertOrAssign(TriangleNormalFilter::k_TriGeometryDataPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+    args.insertOrAssign(TriangleNormalFilter::k_SurfaceMeshTriangleNormalsArrayName_Key, std::make_any<std::string>("Normals"));
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(dataStructure, args).result);
+  }
+  {
+    TriangleCentroidFilter filter;
+    Arguments args;
+    args.insertOrAssign(TriangleCentroidFilter::k_TriGeometryDataPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+    args.insertOrAssign(TriangleCentroidFilter::k_CentroidsArrayName_Key, std::make_any<std::string>("Centroids"));
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(dataStructure, args).result);
+  }
+  {
+    TriangleDihedralAngleFilter filter;
+    Arguments args;
+    args.insertOrAssign(TriangleDihedralAngleFilter::k_TGeometryDataPath_Key, std::make_any<DataPath>(k_TriangleGeometryPath));
+    args.insertOrAssign(TriangleDihedralAngleFilter::k_SurfaceMeshTriangleDihedralAnglesArrayName_Key, std::make_any<std::string>("Dihedral Angles"));
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(dataStructure, args).result);
+  }
+
+  {
+    ComputeTriangleMetricsFilter filter;
+    Arguments args = CreateMetricsArguments(true, true, true, true);
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  }
+
+  CompareArrays(dataStructure, "Areas", "Fused Areas");
+  CompareArrays(dataStructure, "Normals", "Fused Normals");
+  CompareArrays(dataStructure, "Centroids", "Fused Centroids");
+  CompareArrays(dataStructure, "Dihedral Angles", "Fused Dihedral Angles");
+}
+
+TEST_CASE("SimplnxCore::ComputeTriangleMetricsFilter: Selected Metrics Only", "[SimplnxCore][ComputeTriangleMetricsFilter]")
+{
+  DataStructure dataStructure;
+  ReadSpecimen(dataStructure);
+
+  ComputeTriangleMetricsFilter filter;
+  {
+    Arguments args = CreateMetricsArguments(false, false, false, false);
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+  }
+
+  Arguments args = CreateMetricsArguments(false, true, false, true);
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  REQUIRE(dataStructure.getDataAs<Float64Array>(k_FaceDataPath.createChildPath("Fused Areas")) == nullptr);
+  REQUIRE(dataStructure.getDataAs<Float64Array>(k_FaceDataPath.createChildPath("Fused Centroids")) == nullptr);
+  REQUIRE(dataStructure.getDataRefAs<Float64Array>(k_FaceDataPath.createChildPath("Fused Normals")).getNumberOfComponents() == 3);
+  REQUIRE(dataStructure.getDataRefAs<Float64Array>(k_FaceDataPath.createChildPath("Fused Dihedral Angles")).getNumberOfTuples() == 92);
+}
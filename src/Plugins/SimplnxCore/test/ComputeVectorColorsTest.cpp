@@ -35,6 +35,9 @@ TEST_CASE("SimplnxCore::ComputeVectorColorsFilter: Valid Filter Execution", "[Si
     // Execute the filter and check the result
     auto executeResult = filter.execute(dataStructure, args);
     REQUIRE(executeResult.result.valid());
+
+    // No temporary all-true mask array is created when no mask is used
+    REQUIRE(dataStructure.getDataAs<BoolArray>(DataPath({"mask array"})) == nullptr);
   }
 
   UnitTest::CompareArrays<uint8>(dataStructure, ebsdPath.createChildPath("VectorColor"), ebsdPath.createChildPath(k_VecColorsNX));
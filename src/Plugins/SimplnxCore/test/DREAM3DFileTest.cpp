@@ -4,10 +4,12 @@
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Filter/Arguments.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
@@ -415,3 +417,71 @@ TEST_CASE("DREAM3DFileTest: Existing Data Objects Test")
     REQUIRE(executeResult.result.valid());
   }
 }
+
+TEST_CASE("DREAM3DFileTest: Image Subvolume Import")
+{
+  auto app = Application::GetOrCreateInstance();
+
+  const fs::path filePath = GetDataDir(*app) / "ImageSubvolumeTest.dream3d";
+  const DataPath geomPath({"Image"});
+  const DataPath arrayPath = geomPath.createChildPath("Cell Data").createChildPath("Values");
+
+  {
+    DataStructure dataStructure;
+    auto* imageGeom = ImageGeom::Create(dataStructure, "Image");
+    imageGeom->setDimensions({4, 3, 2});
+    imageGeom->setOrigin({1.0f, 2.0f, 3.0f});
+    imageGeom->setSpacing({0.5f, 0.25f, 2.0f});
+    auto* cellData = AttributeMatrix::Create(dataStructure, "Cell Data", {2, 3, 4}, imageGeom->getId());
+    imageGeom->setCellData(*cellData);
+    auto* values = UnitTest::CreateTestDataArray<int32>(dataStructure, "Values", {2, 3, 4}, {1}, cellData->getId());
+    for(usize i = 0; i < values->getSize(); i++)
+    {
+      (*values)[i] = static_cast<int32>(i);
+    }
+    auto writeResult = DREAM3D::WriteFile(filePath, dataStructure);
+    SIMPLNX_RESULT_REQUIRE_VALID(writeResult);
+  }
+
+  ReadDREAM3DFilter filter;
+  Arguments args;
+  Dream3dImportParameter::ImportData importData;
+  importData.FilePath = filePath;
+  args.insert(ReadDREAM3DFilter::k_ImportFileData, std::make_any<Dream3dImportParameter::ImportData>(importData));
+  args.insert(ReadDREAM3DFilter::k_ReadImageSubvolume_Key, std::make_any<bool>(true));
+  args.insert(ReadDREAM3DFilter::k_SubvolumeGeometryPath_Key, std::make_any<std::string>(geomPath.toString()));
+  args.insert(ReadDREAM3DFilter::k_SubvolumeMinVoxel_Key, std::make_any<std::vector<uint64>>(std::vector<uint64>{1, 0, 1}));
+  args.insert(ReadDREAM3DFilter::k_SubvolumeMaxVoxel_Key, std::make_any<std::vector<uint64>>(std::vector<uint64>{3, 2, 1}));
+  args.insert(ReadDREAM3DFilter::k_SubvolumeStride_Key, std::make_any<std::vector<uint64>>(std::vector<uint64>{2, 2, 1}));
+
+  // A geometry path that is not an Image Geometry in the file is rejected instead of being ignored
+  {
+    Arguments missingArgs = args;
+    missingArgs.insertOrAssign(ReadDREAM3DFilter::k_SubvolumeGeometryPath_Key, std::make_any<std::string>("Missing Image"));
+    DataStructure dataStructure;
+    auto preflightResult = filter.preflight(dataStructure, missingArgs);
+    SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions);
+  }
+
+  DataStructure dataStructure;
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  const auto* imageGeom = dataStructure.getDataAs<ImageGeom>(geomPath);
+  REQUIRE(imageGeom != nullptr);
+  REQUIRE(imageGeom->getDimensions() == SizeVec3{2, 2, 1});
+  REQUIRE(imageGeom->getOrigin() == FloatVec3{1.5f, 2.0f, 5.0f});
+  REQUIRE(imageGeom->getSpacing() == FloatVec3{1.0f, 0.5f, 2.0f});
+
+  const auto& values = dataStructure.getDataRefAs<Int32Array>(arrayPath);
+  REQUIRE(values.getNumberOfTuples() == 4);
+  const std::vector<int32> expected = {13, 15, 21, 23};
+  for(usize i = 0; i < expected.size(); i++)
+  {
+    REQUIRE(values[i] == expected[i]);
+  }
+
+  fs::remove(filePath);
+}
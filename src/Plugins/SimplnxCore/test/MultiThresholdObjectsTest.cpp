@@ -3,6 +3,7 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/ArrayThresholdEvaluator.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -676,3 +677,62 @@ TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution, DataType", "[Sim
     checkMaskValues<float64>(dataStructure, k_ThresholdArrayPath);
   }
 }
+
+TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution, Nested Sets", "[SimplnxCore][MultiThresholdObjects]")
+{
+  DataStructure dataStructure = CreateTestDataStructure();
+
+  // { Int > 2 AND Int < 5 } OR Int == 1
+  auto greaterThan = std::make_shared<ArrayThreshold>();
+  greaterThan->setArrayPath(k_TestArrayIntPath);
+  greaterThan->setComparisonType(ArrayThreshold::ComparisonType::GreaterThan);
+  greaterThan->setComparisonValue(2);
+  auto lessThan = std::make_shared<ArrayThreshold>();
+  lessThan->setArrayPath(k_TestArrayIntPath);
+  lessThan->setComparisonType(ArrayThreshold::ComparisonType::LessThan);
+  lessThan->setComparisonValue(5);
+  lessThan->setUnionOperator(IArrayThreshold::UnionOperator::And);
+  auto nestedSet = std::make_shared<ArrayThresholdSet>();
+  nestedSet->setArrayThresholds({greaterThan, lessThan});
+  auto equalTo = std::make_shared<ArrayThreshold>();
+  equalTo->setArrayPath(k_TestArrayIntPath);
+  equalTo->setComparisonType(ArrayThreshold::ComparisonType::Operator_Equal);
+  equalTo->setComparisonValue(1);
+  equalTo->setUnionOperator(IArrayThreshold::UnionOperator::Or);
+
+  ArrayThresholdSet thresholdSet;
+  thresholdSet.setArrayThresholds({nestedSet, equalTo});
+
+  bool inverted = GENERATE(false, true);
+  thresholdSet.setInverted(inverted);
+
+  MultiThresholdObjectsFilter filter;
+  Arguments args;
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_ArrayThresholdsObject_Key, std::make_any<ArrayThresholdSet>(thresholdSet));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedDataName_Key, std::make_any<std::string>(k_ThresholdArrayName));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedMaskType_Key, std::make_any<DataType>(DataType::boolean));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  auto* thresholdArray = dataStructure.getDataAs<BoolArray>(k_ThresholdArrayPath);
+  REQUIRE(thresholdArray != nullptr);
+
+  auto evaluatorResult = ArrayThresholdEvaluator::Create(dataStructure, thresholdSet);
+  SIMPLNX_RESULT_REQUIRE_VALID(evaluatorResult)
+  std::atomic_bool shouldCancel = false;
+  auto packedMaskResult = evaluatorResult.value().evaluatePacked(shouldCancel);
+  SIMPLNX_RESULT_REQUIRE_VALID(packedMaskResult)
+  const std::vector<uint64>& packedMask = packedMaskResult.value();
+  REQUIRE(packedMask.size() == 1);
+
+  for(usize i = 0; i < 20; i++)
+  {
+    const bool expected = (i == 1 || i == 3 || i == 4) != inverted;
+    REQUIRE((*thresholdArray)[i] == expected);
+    REQUIRE((((packedMask[0] >> i) & 1ULL) != 0) == expected);
+  }
+}
@@ -9,8 +9,11 @@
 
 #include <catch2/catch.hpp>
 
+#include <array>
 #include <filesystem>
+#include <fstream>
 #include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
@@ -134,3 +137,65 @@ TEST_CASE("SimplnxCore::ReadStlFileFilter:AttributeParseError", "[SimplnxCore][R
 
   REQUIRE(executeResult.result.errors().front().code == -1107);
 }
+
+TEST_CASE("SimplnxCore::ReadStlFileFilter:Shared_Vertices", "[SimplnxCore][ReadStlFileFilter]")
+{
+  // Two triangles of a unit square sharing an edge. The first one is followed by 3 bytes of attribute data.
+  const fs::path inputFile = fmt::format("{}/ReadStlFileTest_SharedVertices.stl", unit_test::k_BinaryTestOutputDir);
+  {
+    const std::vector<std::array<float32, 12>> triangles = {{0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 1.0F, 1.0F, 0.0F},
+                                                            {0.0F, 0.0F, 1.0F, -0.0F, 0.0F, 0.0F, 1.0F, 1.0F, 0.0F, 0.0F, 1.0F, 0.0F}};
+    const std::vector<uint16> attributeByteCounts = {3, 0};
+    std::ofstream stlFile(inputFile, std::ios_base::binary);
+    const std::array<char, 80> header = {'s', 'h', 'a', 'r', 'e', 'd'};
+    stlFile.write(header.data(), header.size());
+    const auto triangleCount = static_cast<int32>(triangles.size());
+    stlFile.write(reinterpret_cast<const char*>(&triangleCount), sizeof(triangleCount));
+    for(usize i = 0; i < triangles.size(); i++)
+    {
+      stlFile.write(reinterpret_cast<const char*>(triangles[i].data()), sizeof(triangles[i]));
+      stlFile.write(reinterpret_cast<const char*>(&attributeByteCounts[i]), sizeof(uint16));
+      stlFile.write("abc", attributeByteCounts[i]);
+    }
+  }
+
+  DataStructure dataStructure;
+  Arguments args;
+  ReadStlFileFilter filter;
+
+  DataPath triangleGeomDataPath({"[Triangle Geometry]"});
+
+  args.insertOrAssign(ReadStlFileFilter::k_StlFilePath_Key, std::make_any<FileSystemPathParameter::ValueType>(inputFile));
+  args.insertOrAssign(ReadStlFileFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(triangleGeomDataPath));
+  args.insertOrAssign(ReadStlFileFilter::k_ScaleOutput, std::make_any<bool>(true));
+  args.insertOrAssign(ReadStlFileFilter::k_ScaleFactor, std::make_any<float32>(2.0F));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  TriangleGeom& triangleGeom = dataStructure.getDataRefAs<TriangleGeom>(triangleGeomDataPath);
+  REQUIRE(triangleGeom.getNumberOfFaces() == 2);
+  REQUIRE(triangleGeom.getNumberOfVertices() == 4);
+  REQUIRE(triangleGeom.getVertexAttributeMatrix()->getNumTuples() == 4);
+
+  // Vertices are numbered in the order in which the triangles first use them
+  const std::vector<IGeometry::MeshIndexType> expectedFaces = {0, 1, 2, 0, 2, 3};
+  const auto& faces = triangleGeom.getFacesRef();
+  for(usize i = 0; i < expectedFaces.size(); i++)
+  {
+    REQUIRE(faces[i] == expectedFaces[i]);
+  }
+  const std::vector<float32> expectedVertices = {0.0F, 0.0F, 0.0F, 2.0F, 0.0F, 0.0F, 2.0F, 2.0F, 0.0F, 0.0F, 2.0F, 0.0F};
+  const auto& vertices = triangleGeom.getVerticesRef();
+  for(usize i = 0; i < expectedVertices.size(); i++)
+  {
+    REQUIRE(vertices[i] == expectedVertices[i]);
+  }
+
+  const auto& faceNormals = dataStructure.getDataRefAs<Float64Array>(triangleGeom.getFaceAttributeMatrixDataPath().createChildPath("Face Normals"));
+  REQUIRE(faceNormals[2] == 1.0);
+  REQUIRE(faceNormals[5] == 1.0);
+}
@@ -25,6 +25,7 @@
 #include <simplnx/DataStructure/Geometry/TetrahedralGeom.hpp>
 #include <simplnx/DataStructure/Geometry/TriangleGeom.hpp>
 #include <simplnx/DataStructure/Geometry/VertexGeom.hpp>
+#include <simplnx/DataStructure/NeighborList.hpp>
 #include <simplnx/DataStructure/StringArray.hpp>
 #include <simplnx/Filter/Actions/CopyArrayInstanceAction.hpp>
 #include <simplnx/Filter/Actions/CopyDataObjectAction.hpp>
@@ -82,6 +83,7 @@
 #include <simplnx/Pipeline/Pipeline.hpp>
 #include <simplnx/Pipeline/PipelineFilter.hpp>
 #include <simplnx/Utilities/DataGroupUtilities.hpp>
+#include <simplnx/Utilities/DataStoreUtilities.hpp>
 #include <simplnx/Utilities/Parsing/HDF5/Readers/AttributeReader.hpp>
 #include <simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp>
 
@@ -160,6 +162,194 @@ auto BindVectorParameter(py::handle scope, const char* name)
 #define SIMPLNX_PY_BIND_NUMBER_PARAMETER(scope, className) BindNumberParameter<className>(scope, #className)
 #define SIMPLNX_PY_BIND_VECTOR_PARAMETER(scope, className) BindVectorParameter<className>(scope, #className)
 
+/**
+ * @brief Returns the tuple shape of a DataStore with the given component shape that holds the values of a NumPy array.
+ * The trailing dimensions of the array must equal the component shape, except that a component shape of [1] may
+ * also be left out of the array's shape.
+ * @param array
+ * @param componentShape
+ * @return IDataStore::ShapeType
+ */
+IDataStore::ShapeType GetNumPyTupleShape(const py::array& array, const IDataStore::ShapeType& componentShape)
+{
+  IDataStore::ShapeType tupleShape(array.shape(), array.shape() + array.ndim());
+  const usize numComponents = std::accumulate(componentShape.cbegin(), componentShape.cend(), static_cast<usize>(1), std::multiplies<>());
+  if(tupleShape.size() >= componentShape.size() && std::equal(componentShape.cbegin(), componentShape.cend(), tupleShape.cend() - static_cast<std::ptrdiff_t>(componentShape.size())))
+  {
+    tupleShape.resize(tupleShape.size() - componentShape.size());
+  }
+  else if(numComponents != 1)
+  {
+    throw std::invalid_argument(fmt::format("The shape {} of the NumPy array does not end with the component shape {}.", tupleShape, componentShape));
+  }
+  if(tupleShape.empty())
+  {
+    tupleShape.push_back(1);
+  }
+  return tupleShape;
+}
+
+/**
+ * @brief Creates a DataStore that adopts the buffer of a writeable NumPy array without copying it. The DataStore
+ * holds a reference to the array for as long as it uses the buffer. The array must be C contiguous and of type T
+ * since a converted copy would not share its memory with the caller's array.
+ * @param array
+ * @param componentShape
+ * @return std::shared_ptr<DataStore<T>>
+ */
+template <class T>
+std::shared_ptr<DataStore<T>> CreateDataStoreFromNumPy(const py::array& array, const IDataStore::ShapeType& componentShape)
+{
+  using NumPyArrayType = py::array_t<T, py::array::c_style>;
+
+  if(!py::isinstance<py::array_t<T>>(array))
+  {
+    throw py::type_error(fmt::format("Unable to adopt a NumPy array of dtype '{}'. The array must have dtype '{}', use array.astype() to convert it first.", py::str(array.dtype()).cast<std::string>(),
+                                     py::str(py::dtype::of<T>()).cast<std::string>()));
+  }
+  if(!py::isinstance<NumPyArrayType>(array))
+  {
+    throw py::type_error("Unable to adopt a NumPy array that is not C contiguous. Use numpy.ascontiguousarray() to create a C contiguous copy first.");
+  }
+  if(!array.writeable())
+  {
+    throw std::invalid_argument("Unable to adopt a read only NumPy array. Pass a writeable array or a copy of the array.");
+  }
+  auto typedArray = py::reinterpret_borrow<NumPyArrayType>(array);
+  IDataStore::ShapeType tupleShape = GetNumPyTupleShape(typedArray, componentShape);
+  T* buffer = typedArray.mutable_data();
+  std::shared_ptr<void> bufferOwner(new NumPyArrayType(std::move(typedArray)), [](void* arrayHandle) {
+    // The store may be released after the interpreter has shut down, in which case the array can no longer be released.
+    if(Py_IsInitialized() == 0)
+    {
+      return;
+    }
+    // The store may also be released from a thread that does not hold the GIL, such as while a pipeline executes.
+    py::gil_scoped_acquire acquireGIL{};
+    delete static_cast<NumPyArrayType*>(arrayHandle);
+  });
+  return std::make_shared<DataStore<T>>(buffer, std::move(bufferOwner), std::move(tupleShape), componentShape);
+}
+
+/**
+ * @brief Returns the values of numTuples tuples starting at startTuple as a NumPy array whose trailing dimensions
+ * are the component shape of the store. The array is a view of stores held in memory and a copy of any other store,
+ * such as an out-of-core store.
+ * @param store
+ * @param startTuple
+ * @param numTuples
+ * @return py::array
+ */
+template <class T>
+py::array ReadDataStoreChunk(AbstractDataStore<T>& store, usize startTuple, usize numTuples)
+{
+  if(startTuple > store.getNumberOfTuples() || numTuples > store.getNumberOfTuples() - startTuple)
+  {
+    throw py::index_error(fmt::format("Unable to read {} tuples starting at tuple {} from a data store with {} tuples.", numTuples, startTuple, store.getNumberOfTuples()));
+  }
+  IDataStore::ShapeType shape = {numTuples};
+  IDataStore::ShapeType componentShape = store.getComponentShape();
+  shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+  const usize startIndex = startTuple * store.getNumberOfComponents();
+
+  auto* dataStore = dynamic_cast<DataStore<T>*>(&store);
+  if(dataStore != nullptr)
+  {
+    return py::array_t<T, py::array::c_style>(shape, dataStore->data() + startIndex, py::cast(*dataStore));
+  }
+  py::array_t<T, py::array::c_style> chunk(shape);
+  Result<> result = store.copyIntoBuffer(startIndex, nonstd::span<T>(chunk.mutable_data(), static_cast<usize>(chunk.size())));
+  if(result.invalid())
+  {
+    throw std::runtime_error(fmt::format("Errors={}", result.errors()));
+  }
+  return chunk;
+}
+
+/**
+ * @brief Writes the values of a NumPy array into the store starting at startTuple. Writing a view returned by
+ * ReadDataStoreChunk() back to the same tuples does nothing, since the values are already in the store.
+ * @param store
+ * @param startTuple
+ * @param values
+ */
+template <class T>
+void WriteDataStoreChunk(AbstractDataStore<T>& store, usize startTuple, const py::array_t<T, py::array::c_style | py::array::forcecast>& values)
+{
+  const usize numComponents = store.getNumberOfComponents();
+  const auto numValues = static_cast<usize>(values.size());
+  if(numValues % numComponents != 0 || startTuple > store.getNumberOfTuples() || numValues / numComponents > store.getNumberOfTuples() - startTuple)
+  {
+    throw py::index_error(
+        fmt::format("Unable to write {} values starting at tuple {} into a data store with {} tuples of {} components.", numValues, startTuple, store.getNumberOfTuples(), numComponents));
+  }
+  const usize startIndex = startTuple * numComponents;
+  auto* dataStore = dynamic_cast<DataStore<T>*>(&store);
+  if(dataStore != nullptr && dataStore->data() + startIndex == values.data())
+  {
+    return;
+  }
+  Result<> result = store.copyFromBuffer(startIndex, nonstd::span<const T>(values.data(), numValues));
+  if(result.invalid())
+  {
+    throw std::runtime_error(fmt::format("Errors={}", result.errors()));
+  }
+}
+
+/**
+ * @brief Python iterator over a data store in chunks of tuples. Each step returns (start_tuple, array) where the
+ * array holds the values of the next chunk as returned by ReadDataStoreChunk().
+ */
+class DataStoreChunkIterator
+{
+public:
+  using ReadChunkFunc = std::function<py::array(usize, usize)>;
+
+  DataStoreChunkIterator(ReadChunkFunc readChunk, usize numTuples, usize chunkTuples)
+  : m_ReadChunk(std::move(readChunk))
+  , m_NumTuples(numTuples)
+  , m_ChunkTuples(std::max(chunkTuples, static_cast<usize>(1)))
+  {
+  }
+
+  py::tuple next()
+  {
+    if(m_NextTuple >= m_NumTuples)
+    {
+      throw py::stop_iteration();
+    }
+    const usize startTuple = m_NextTuple;
+    const usize numTuples = std::min(m_ChunkTuples, m_NumTuples - startTuple);
+    py::array chunk = m_ReadChunk(startTuple, numTuples);
+    m_NextTuple += numTuples;
+    return py::make_tuple(startTuple, std::move(chunk));
+  }
+
+private:
+  ReadChunkFunc m_ReadChunk;
+  usize m_NumTuples = 0;
+  usize m_ChunkTuples = 1;
+  usize m_NextTuple = 0;
+};
+
+template <class T>
+auto BindAbstractDataStore(py::handle scope, const char* name)
+{
+  py::class_<AbstractDataStore<T>, IDataStore, std::shared_ptr<AbstractDataStore<T>>> abstractDataStore(scope, name);
+  abstractDataStore.def("read_chunk", &ReadDataStoreChunk<T>, "start_tuple"_a, "num_tuples"_a,
+                        "Returns the values of 'num_tuples' tuples starting at 'start_tuple' as a NumPy array. The array is a view of stores held in memory and a copy otherwise.");
+  abstractDataStore.def("write_chunk", &WriteDataStoreChunk<T>, "start_tuple"_a, "values"_a, "Writes the values of a NumPy array into the store starting at 'start_tuple'.");
+  abstractDataStore.def(
+      "iter_chunks",
+      [](AbstractDataStore<T>& store, usize chunkTuples) {
+        return DataStoreChunkIterator([&store](usize startTuple, usize numTuples) { return ReadDataStoreChunk<T>(store, startTuple, numTuples); }, store.getNumberOfTuples(), chunkTuples);
+      },
+      "chunk_tuples"_a = DataStoreUtilities::k_DefaultBlockSize, py::keep_alive<0, 1>(),
+      "Iterates over the store in chunks of 'chunk_tuples' tuples, returning (start_tuple, array) for each chunk. Works for every store, including out-of-core stores. "
+      "Modified chunks of stores that are not held in memory must be written back with write_chunk().");
+  return abstractDataStore;
+}
+
 template <class T>
 auto BindDataStore(py::handle scope, const char* name)
 {
@@ -175,6 +365,12 @@ auto BindDataStore(py::handle scope, const char* name)
         return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
       },
       py::return_value_policy::reference_internal);
+  dataStore.def_static(
+      "from_numpy", [](const py::array& array, const IDataStore::ShapeType& componentShape) { return CreateDataStoreFromNumPy<T>(array, componentShape); }, "array"_a.noconvert(),
+      "component_shape"_a = IDataStore::ShapeType{1},
+      "Creates a DataStore that uses the buffer of a writeable, C contiguous NumPy array of the store's dtype without copying it. The trailing dimensions of the array must equal the component "
+      "shape.");
+  dataStore.def_property_readonly("uses_external_buffer", &DataStore<T>::usesExternalBuffer);
   dataStore.def("__getitem__", &DataStore<T>::at);
   dataStore.def("__len__", &DataStore<T>::getSize);
   dataStore.def("resize_tuples", &DataStore<T>::resizeTuples, "Resize the tuples with the given shape");
@@ -192,19 +388,100 @@ auto BindDataArray(py::handle scope, const char* name)
         using DataArrayType = DataArray<T>;
         using DataStoreType = DataStore<T>;
         const typename DataArrayType::store_type& abstractDataStore = dataArray.getDataStoreRef();
-        const DataStoreType& dataStore = dynamic_cast<const DataStoreType&>(abstractDataStore);
+        const auto* dataStorePtr = dynamic_cast<const DataStoreType*>(&abstractDataStore);
+        if(dataStorePtr == nullptr)
+        {
+          throw std::runtime_error(fmt::format("Unable to create a NumPy view of '{}' because its data is not held in memory. Use store.iter_chunks() to access the data.", dataArray.getName()));
+        }
+        const DataStoreType& dataStore = *dataStorePtr;
         IDataStore::ShapeType shape = dataStore.getTupleShape();
         IDataStore::ShapeType componentShape = dataStore.getComponentShape();
         shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
         return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
       },
       py::return_value_policy::reference_internal);
+  dataArray.def(
+      "adopt_numpy",
+      [](DataArray<T>& dataArray, const py::array& array) {
+        std::shared_ptr<DataStore<T>> dataStore = CreateDataStoreFromNumPy<T>(array, dataArray.getComponentShape());
+        if(dataStore->getTupleShape() != dataArray.getTupleShape())
+        {
+          throw std::invalid_argument(
+              fmt::format("The tuple shape {} of the NumPy array does not match the tuple shape {} of '{}'.", dataStore->getTupleShape(), dataArray.getTupleShape(), dataArray.getName()));
+        }
+        dataArray.setDataStore(std::move(dataStore));
+      },
+      "array"_a.noconvert(), "Replaces the data store of the array with one that uses the buffer of a writeable, C contiguous NumPy array of the same shape and dtype without copying it.");
   return dataArray;
 }
 
+template <class T>
+auto BindNeighborList(py::handle scope, const char* name)
+{
+  py::class_<NeighborList<T>, INeighborList, std::shared_ptr<NeighborList<T>>> neighborList(scope, name);
+  neighborList.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
+  neighborList.def("__len__", [](const NeighborList<T>& self) { return static_cast<usize>(self.getNumberOfLists()); });
+  neighborList.def(
+      "csr",
+      [](const NeighborList<T>& self) {
+        // The lists are held as separate vectors, so they are copied once into arrays allocated by NumPy.
+        const auto& lists = self.getValues();
+        py::array_t<uint64> offsets(static_cast<py::ssize_t>(lists.size() + 1));
+        auto offsetValues = offsets.mutable_unchecked<1>();
+        uint64 numValues = 0;
+        for(usize listIndex = 0; listIndex < lists.size(); listIndex++)
+        {
+          offsetValues(listIndex) = numValues;
+          numValues += lists[listIndex] == nullptr ? 0 : lists[listIndex]->size();
+        }
+        offsetValues(lists.size()) = numValues;
+        py::array_t<T> values(static_cast<py::ssize_t>(numValues));
+        T* valuePtr = values.mutable_data();
+        for(const auto& list : lists)
+        {
+          if(list != nullptr)
+          {
+            valuePtr = std::copy(list->cbegin(), list->cend(), valuePtr);
+          }
+        }
+        return py::make_tuple(std::move(offsets), std::move(values));
+      },
+      "Returns the lists as the NumPy arrays (offsets, values) of a compressed sparse row layout, so that list i is values[offsets[i]:offsets[i + 1]].");
+  neighborList.def(
+      "set_csr",
+      [](NeighborList<T>& self, const py::array_t<uint64, py::array::c_style | py::array::forcecast>& offsets, const py::array_t<T, py::array::c_style | py::array::forcecast>& values) {
+        if(offsets.ndim() != 1 || offsets.size() < 1 || values.ndim() != 1)
+        {
+          throw std::invalid_argument("The offsets and values must be one dimensional and the offsets must hold at least one value.");
+        }
+        const uint64* offsetPtr = offsets.data();
+        const auto numLists = static_cast<usize>(offsets.size() - 1);
+        for(usize listIndex = 0; listIndex < numLists; listIndex++)
+        {
+          if(offsetPtr[listIndex] > offsetPtr[listIndex + 1])
+          {
+            throw std::invalid_argument(fmt::format("The offsets must not decrease, but offset {} is larger than offset {}.", listIndex, listIndex + 1));
+          }
+        }
+        if(offsetPtr[0] != 0 || offsetPtr[numLists] != static_cast<uint64>(values.size()))
+        {
+          throw std::invalid_argument(fmt::format("The offsets must run from 0 to the number of values ({}).", values.size()));
+        }
+        const T* valuePtr = values.data();
+        self.resizeTotalElements(numLists);
+        for(usize listIndex = 0; listIndex < numLists; listIndex++)
+        {
+          self.setList(static_cast<int32>(listIndex), std::make_shared<typename NeighborList<T>::VectorType>(valuePtr + offsetPtr[listIndex], valuePtr + offsetPtr[listIndex + 1]));
+        }
+      },
+      "offsets"_a, "values"_a, "Replaces the lists with those of a compressed sparse row layout, so that list i becomes values[offsets[i]:offsets[i + 1]].");
+  return neighborList;
+}
+
 #define SIMPLNX_PY_BIND_DATA_ARRAY(scope, className) BindDataArray<className::value_type>(scope, #className)
 #define SIMPLNX_PY_BIND_DATA_STORE(scope, className) BindDataStore<className::value_type>(scope, #className)
-#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) SIMPLNX_PY_BIND_CLASS_VARIADIC(scope, className, IDataStore, std::shared_ptr<className>)
+#define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) BindAbstractDataStore<className::value_type>(scope, #className)
+#define SIMPLNX_PY_BIND_NEIGHBOR_LIST(scope, className) BindNeighborList<className::value_type>(scope, #className)
 
 template <class GeomT>
 auto BindCreateGeometry2DAction(py::handle scope, const char* name)
@@ -727,6 +1004,10 @@ PYBIND11_MODULE(simplnx, mod)
   auto dataStoreFloat64 = SIMPLNX_PY_BIND_DATA_STORE(mod, Float64DataStore);
   auto dataStoreBool = SIMPLNX_PY_BIND_DATA_STORE(mod, BoolDataStore);
 
+  py::class_<DataStoreChunkIterator> dataStoreChunkIterator(mod, "DataStoreChunkIterator");
+  dataStoreChunkIterator.def("__iter__", [](DataStoreChunkIterator& self) -> DataStoreChunkIterator& { return self; }, py::return_value_policy::reference_internal);
+  dataStoreChunkIterator.def("__next__", &DataStoreChunkIterator::next);
+
   py::class_<DataStructure> dataStructure(mod, "DataStructure");
   py::class_<DataObject, std::shared_ptr<DataObject>> dataObject(mod, "DataObject");
 
@@ -1034,6 +1315,20 @@ PYBIND11_MODULE(simplnx, mod)
   auto dataArrayFloat64 = SIMPLNX_PY_BIND_DATA_ARRAY(mod, Float64Array);
   auto dataArrayBool = SIMPLNX_PY_BIND_DATA_ARRAY(mod, BoolArray);
 
+  py::class_<INeighborList, IArray, std::shared_ptr<INeighborList>> iNeighborList(mod, "INeighborList");
+  iNeighborList.def_property_readonly("data_type", &INeighborList::getDataType);
+
+  auto neighborListInt8 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int8NeighborList);
+  auto neighborListUInt8 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt8NeighborList);
+  auto neighborListInt16 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int16NeighborList);
+  auto neighborListUInt16 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt16NeighborList);
+  auto neighborListInt32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int32NeighborList);
+  auto neighborListUInt32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt32NeighborList);
+  auto neighborListInt64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int64NeighborList);
+  auto neighborListUInt64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt64NeighborList);
+  auto neighborListFloat32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Float32NeighborList);
+  auto neighborListFloat64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Float64NeighborList);
+
   rectGridGeom.def_property_readonly("x_bounds", py::overload_cast<>(&RectGridGeom::getXBoundsRef), py::return_value_policy::reference_internal);
   rectGridGeom.def_property_readonly("y_bounds", py::overload_cast<>(&RectGridGeom::getYBoundsRef), py::return_value_policy::reference_internal);
   rectGridGeom.def_property_readonly("z_bounds", py::overload_cast<>(&RectGridGeom::getZBoundsRef), py::return_value_policy::reference_internal);
@@ -0,0 +1,415 @@
+#include "BatchRunner.hpp"
+
+#include "CliObserver.hpp"
+
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineFilter.hpp"
+#include "simplnx/Utilities/TimeUtilities.hpp"
+
+#include <fmt/format.h>
+
+#include <hdf5.h>
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+using namespace nx::core::CLI;
+
+namespace
+{
+constexpr int32 k_BatchFileOpenError = -130;
+constexpr int32 k_BatchFileParseError = -131;
+constexpr int32 k_BatchJobParseError = -132;
+constexpr int32 k_PipelineOpenError = -133;
+constexpr int32 k_PipelineParseError = -134;
+constexpr int32 k_OverrideError = -135;
+constexpr int32 k_PreflightError = -136;
+constexpr int32 k_ExecuteError = -137;
+constexpr int32 k_ExceptionError = -138;
+constexpr int32 k_ReportWriteError = -139;
+constexpr int32 k_JobsFailedError = -140;
+
+constexpr StringLiteral k_JobsKey = "jobs";
+constexpr StringLiteral k_PipelineKey = "pipeline";
+constexpr StringLiteral k_NameKey = "name";
+constexpr StringLiteral k_OverridesKey = "overrides";
+constexpr StringLiteral k_FilterIndexKey = "filter_index";
+constexpr StringLiteral k_ArgKey = "arg";
+constexpr StringLiteral k_ValueKey = "value";
+constexpr StringLiteral k_MaxConcurrentPipelinesKey = "max_concurrent_pipelines";
+constexpr StringLiteral k_MaxThreadsKey = "max_threads";
+constexpr StringLiteral k_MemoryBudgetKey = "memory_budget";
+constexpr StringLiteral k_LogDirectoryKey = "log_directory";
+constexpr StringLiteral k_ReportKey = "report";
+
+constexpr StringLiteral k_PipelineItemsKey = "pipeline";
+constexpr StringLiteral k_ArgsKey = "args";
+
+constexpr StringLiteral k_DefaultReportName = "batch_report.json";
+
+fs::path ResolvePath(const fs::path& path, const fs::path& baseDir)
+{
+  return path.is_absolute() ? path : baseDir / path;
+}
+
+Result<> ApplyOverride(nlohmann::json& pipelineJson, const BatchRunner::Override& override)
+{
+  if(!pipelineJson.contains(k_PipelineItemsKey) || !pipelineJson[k_PipelineItemsKey].is_array() || override.filterIndex >= pipelineJson[k_PipelineItemsKey].size())
+  {
+    return MakeErrorResult(k_OverrideError, fmt::format("Cannot override argument '{}': the pipeline has no filter at index {}", override.argumentKey, override.filterIndex));
+  }
+  nlohmann::json& filterJson = pipelineJson[k_PipelineItemsKey][override.filterIndex];
+  if(!filterJson.contains(k_ArgsKey) || !filterJson[k_ArgsKey].contains(override.argumentKey))
+  {
+    return MakeErrorResult(k_OverrideError, fmt::format("Cannot override argument '{}': filter {} has no such argument", override.argumentKey, override.filterIndex));
+  }
+  nlohmann::json& argJson = filterJson[k_ArgsKey][override.argumentKey];
+  // Versioned arguments keep their version
+  if(argJson.is_object() && argJson.contains(k_ValueKey))
+  {
+    argJson[k_ValueKey] = override.value;
+  }
+  else
+  {
+    argJson = override.value;
+  }
+  return {};
+}
+
+Result<Pipeline> LoadJobPipeline(const BatchRunner::Job& job)
+{
+  if(job.pipelinePath.extension() == Pipeline::k_SIMPLExtension.view())
+  {
+    return MakeErrorResult<Pipeline>(k_PipelineParseError, fmt::format("'{}' is a legacy DREAM.3D version 6.x pipeline. Convert it with --convert-output first.", job.pipelinePath.string()));
+  }
+  std::ifstream file(job.pipelinePath);
+  if(!file.is_open())
+  {
+    return MakeErrorResult<Pipeline>(k_PipelineOpenError, fmt::format("Failed to open pipeline '{}'", job.pipelinePath.string()));
+  }
+  nlohmann::json pipelineJson = nlohmann::json::parse(file, nullptr, false);
+  if(pipelineJson.is_discarded())
+  {
+    return MakeErrorResult<Pipeline>(k_PipelineParseError, fmt::format("Failed to parse pipeline '{}'", job.pipelinePath.string()));
+  }
+  for(const auto& override : job.overrides)
+  {
+    Result<> overrideResult = ApplyOverride(pipelineJson, override);
+    if(overrideResult.invalid())
+    {
+      return ConvertResultTo<Pipeline>(std::move(overrideResult), {});
+    }
+  }
+  return Pipeline::FromJson(pipelineJson);
+}
+
+std::vector<Error> CollectErrors(const Pipeline& pipeline)
+{
+  std::vector<Error> errors;
+  for(const auto& node : pipeline)
+  {
+    const auto* filterNode = dynamic_cast<const PipelineFilter*>(node.get());
+    if(filterNode == nullptr || !filterNode->hasErrors())
+    {
+      continue;
+    }
+    for(const auto& error : filterNode->getErrors())
+    {
+      errors.push_back(Error{error.code, fmt::format("{}: {}", filterNode->getName(), error.message)});
+    }
+  }
+  return errors;
+}
+
+void WriteErrors(std::ostream& stream, const std::vector<Error>& errors)
+{
+  for(const auto& error : errors)
+  {
+    stream << fmt::format("Error {}: {}", error.code, error.message) << std::endl;
+  }
+}
+} // namespace
+
+Result<BatchRunner> BatchRunner::FromFile(const fs::path& batchFilePath)
+{
+  std::ifstream file(batchFilePath);
+  if(!file.is_open())
+  {
+    return MakeErrorResult<BatchRunner>(k_BatchFileOpenError, fmt::format("Failed to open batch file '{}'", batchFilePath.string()));
+  }
+  nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+  if(json.is_discarded())
+  {
+    return MakeErrorResult<BatchRunner>(k_BatchFileParseError, fmt::format("Failed to parse batch file '{}'", batchFilePath.string()));
+  }
+  return FromJson(json, fs::absolute(batchFilePath).parent_path());
+}
+
+Result<BatchRunner> BatchRunner::FromJson(const nlohmann::json& json, const fs::path& baseDir)
+{
+  if(!json.is_object() || !json.contains(k_JobsKey) || !json[k_JobsKey].is_array())
+  {
+    return MakeErrorResult<BatchRunner>(k_BatchFileParseError, fmt::format("Batch file does not contain a '{}' array", k_JobsKey));
+  }
+
+  BatchRunner batchRunner;
+  try
+  {
+    const usize hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    batchRunner.m_MaxThreads = std::max(json.value(k_MaxThreadsKey.str(), hardwareThreads), static_cast<usize>(1));
+    batchRunner.m_MaxConcurrentPipelines = std::max(json.value(k_MaxConcurrentPipelinesKey.str(), batchRunner.m_MaxThreads), static_cast<usize>(1));
+    batchRunner.m_MemoryBudget = json.value(k_MemoryBudgetKey.str(), Application::GetOrCreateInstance()->getPreferences()->largeDataStructureSize());
+    batchRunner.m_LogDirectory = ResolvePath(json.value(k_LogDirectoryKey.str(), std::string()), baseDir);
+    batchRunner.m_ReportPath = ResolvePath(json.value(k_ReportKey.str(), (batchRunner.m_LogDirectory / k_DefaultReportName.str()).string()), baseDir);
+
+    for(const auto& jobJson : json[k_JobsKey])
+    {
+      const usize jobIndex = batchRunner.m_Jobs.size();
+      if(!jobJson.contains(k_PipelineKey) || !jobJson[k_PipelineKey].is_string())
+      {
+        return MakeErrorResult<BatchRunner>(k_BatchJobParseError, fmt::format("Batch job {} does not contain a '{}' path", jobIndex, k_PipelineKey));
+      }
+      Job job;
+      job.pipelinePath = ResolvePath(jobJson[k_PipelineKey].get<std::string>(), baseDir);
+      job.name = jobJson.value(k_NameKey.str(), fmt::format("{}_{}", job.pipelinePath.stem().string(), jobIndex));
+      if(jobJson.contains(k_OverridesKey))
+      {
+        for(const auto& overrideJson : jobJson[k_OverridesKey])
+        {
+          Override override;
+          override.filterIndex = overrideJson.at(k_FilterIndexKey).get<usize>();
+          override.argumentKey = overrideJson.at(k_ArgKey).get<std::string>();
+          override.value = overrideJson.at(k_ValueKey);
+          job.overrides.push_back(std::move(override));
+        }
+      }
+      batchRunner.m_Jobs.push_back(std::move(job));
+    }
+  } catch(const nlohmann::json::exception& exception)
+  {
+    return MakeErrorResult<BatchRunner>(k_BatchJobParseError, fmt::format("Invalid batch file: {}", exception.what()));
+  }
+
+  return {std::move(batchRunner)};
+}
+
+Result<> BatchRunner::execute(const MessageCallback& messageCallback)
+{
+  const auto batchStart = std::chrono::steady_clock::now();
+  m_Reports.assign(m_Jobs.size(), JobReport{});
+
+  std::mutex mutex;
+  std::condition_variable jobFinished;
+  usize jobsRunning = 0;
+  uint64 memoryInUse = 0;
+
+  // Messages are passed on one at a time since jobs finish on worker threads
+  auto message = [&mutex, &messageCallback](const std::string& text) {
+    std::lock_guard<std::mutex> lock(mutex);
+    messageCallback(text);
+  };
+
+  // Pipelines read and write HDF5 files during preflight and execution, which only a thread-safe HDF5 library allows concurrently
+  // A job only runs once a thread of the shared budget picks it up, so more concurrent pipelines than threads would only hold memory
+  usize maxConcurrentPipelines = std::min(m_MaxConcurrentPipelines, m_MaxThreads);
+  hbool_t hdf5ThreadSafe = false;
+  H5is_library_threadsafe(&hdf5ThreadSafe);
+  const bool runOneAtATime = !hdf5ThreadSafe || maxConcurrentPipelines == 1;
+  if(!hdf5ThreadSafe && maxConcurrentPipelines > 1)
+  {
+    message("Warning: The HDF5 library is not thread-safe so the pipelines are run one at a time.");
+    maxConcurrentPipelines = 1;
+  }
+
+  std::error_code errorCode;
+  fs::create_directories(m_LogDirectory, errorCode);
+
+  message(fmt::format("{} Running {} jobs with up to {} concurrent pipelines, {} threads and a memory budget of {} bytes", timestamp(), m_Jobs.size(), maxConcurrentPipelines, m_MaxThreads,
+                      m_MemoryBudget));
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  // Every pipeline runs inside one arena so that all jobs share the same thread budget
+  tbb::task_arena arena(static_cast<int>(m_MaxThreads), 0);
+  tbb::task_group taskGroup;
+#endif
+
+  for(usize jobIndex = 0; jobIndex < m_Jobs.size(); jobIndex++)
+  {
+    const Job& job = m_Jobs[jobIndex];
+    JobReport& report = m_Reports[jobIndex];
+    report.name = job.name;
+    report.pipelinePath = job.pipelinePath;
+    report.logPath = m_LogDirectory / (job.name + ".log");
+
+    // The pipelines are loaded and preflighted here, one at a time, so that the memory they need is known before they start
+    if(runOneAtATime)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      jobFinished.wait(lock, [&jobsRunning]() { return jobsRunning == 0; });
+    }
+    auto logStream = std::make_shared<std::ofstream>(report.logPath, std::ios_base::out | std::ios_base::trunc);
+    *logStream << timestamp() << " Job '" << job.name << "': " << job.pipelinePath.string() << std::endl;
+
+    Result<Pipeline> pipelineResult = LoadJobPipeline(job);
+    if(pipelineResult.invalid())
+    {
+      report.errors = pipelineResult.errors();
+      WriteErrors(*logStream, report.errors);
+      message(fmt::format("{} Job '{}' failed to load", timestamp(), job.name));
+      continue;
+    }
+    auto pipeline = std::make_shared<Pipeline>(std::move(pipelineResult.value()));
+    bool preflighted = false;
+    {
+      const PipelineObserver observer(pipeline.get(), *logStream);
+      preflighted = pipeline->preflight();
+    }
+    if(!preflighted)
+    {
+      report.errors = CollectErrors(*pipeline);
+      report.errors.push_back(Error{k_PreflightError, "Error preflighting pipeline"});
+      WriteErrors(*logStream, report.errors);
+      message(fmt::format("{} Job '{}' failed to preflight", timestamp(), job.name));
+      continue;
+    }
+    report.estimatedMemory = pipeline->getMemoryRequired();
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if(report.estimatedMemory > m_MemoryBudget)
+      {
+        messageCallback(fmt::format("Warning: Job '{}' needs an estimated {} bytes which exceeds the memory budget. It will run by itself.", job.name, report.estimatedMemory));
+      }
+      // A job that does not fit next to the running jobs waits until enough of them have finished
+      jobFinished.wait(lock, [&]() { return jobsRunning == 0 || (jobsRunning < maxConcurrentPipelines && memoryInUse + report.estimatedMemory <= m_MemoryBudget); });
+      jobsRunning++;
+      memoryInUse += report.estimatedMemory;
+      messageCallback(fmt::format("{} Starting job '{}' ({} of {})", timestamp(), job.name, jobIndex + 1, m_Jobs.size()));
+    }
+
+    auto runJob = [&, pipeline, logStream, jobIndex]() {
+      JobReport& jobReport = m_Reports[jobIndex];
+      const auto jobStart = std::chrono::steady_clock::now();
+      bool succeeded = false;
+      std::vector<Error> errors;
+      try
+      {
+        const PipelineObserver observer(pipeline.get(), *logStream);
+        succeeded = pipeline->execute();
+      } catch(const std::exception& exception)
+      {
+        errors.push_back(Error{k_ExceptionError, fmt::format("Exception: {}", exception.what())});
+      }
+      if(!succeeded)
+      {
+        std::vector<Error> filterErrors = CollectErrors(*pipeline);
+        errors.insert(errors.begin(), filterErrors.begin(), filterErrors.end());
+        errors.push_back(Error{k_ExecuteError, "Error executing pipeline"});
+        WriteErrors(*logStream, errors);
+      }
+      const float64 durationSeconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - jobStart).count();
+      *logStream << timestamp() << (succeeded ? " Finished executing pipeline" : " Pipeline failed") << std::endl;
+      logStream->close();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobReport.succeeded = succeeded;
+        jobReport.durationSeconds = durationSeconds;
+        jobReport.errors = std::move(errors);
+        jobsRunning--;
+        memoryInUse -= jobReport.estimatedMemory;
+        messageCallback(fmt::format("{} Job '{}' {} after {:.1f} seconds", timestamp(), jobReport.name, succeeded ? "succeeded" : "failed", durationSeconds));
+      }
+      jobFinished.notify_all();
+    };
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    arena.execute([&taskGroup, &runJob]() { taskGroup.run(runJob); });
+#else
+    runJob();
+#endif
+  }
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  arena.execute([&taskGroup]() { taskGroup.wait(); });
+#endif
+
+  m_DurationSeconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - batchStart).count();
+
+  const usize numFailed = std::count_if(m_Reports.cbegin(), m_Reports.cend(), [](const JobReport& report) { return !report.succeeded; });
+  messageCallback(fmt::format("{} Finished {} jobs in {:.1f} seconds: {} succeeded, {} failed", timestamp(), m_Reports.size(), m_DurationSeconds, m_Reports.size() - numFailed, numFailed));
+  for(const auto& report : m_Reports)
+  {
+    if(!report.succeeded)
+    {
+      messageCallback(fmt::format("  Failed: '{}' (log: {})", report.name, report.logPath.string()));
+    }
+  }
+
+  Result<> result;
+  std::ofstream reportStream(m_ReportPath, std::ios_base::out | std::ios_base::trunc);
+  if(reportStream.is_open())
+  {
+    reportStream << reportToJson().dump(2);
+    messageCallback(fmt::format("Batch report: {}", m_ReportPath.string()));
+  }
+  else
+  {
+    result.warnings().push_back(Warning{k_ReportWriteError, fmt::format("Failed to write batch report '{}'", m_ReportPath.string())});
+  }
+
+  if(numFailed > 0)
+  {
+    return MakeErrorResult(k_JobsFailedError, fmt::format("{} of {} batch jobs failed", numFailed, m_Reports.size()));
+  }
+  return result;
+}
+
+const std::vector<BatchRunner::JobReport>& BatchRunner::getReports() const
+{
+  return m_Reports;
+}
+
+nlohmann::json BatchRunner::reportToJson() const
+{
+  nlohmann::json jobsJson = nlohmann::json::array();
+  usize numSucceeded = 0;
+  for(const auto& report : m_Reports)
+  {
+    nlohmann::json errorsJson = nlohmann::json::array();
+    for(const auto& error : report.errors)
+    {
+      errorsJson.push_back({{"code", error.code}, {"message", error.message}});
+    }
+    nlohmann::json jobJson;
+    jobJson["name"] = report.name;
+    jobJson["pipeline"] = report.pipelinePath.string();
+    jobJson["log"] = report.logPath.string();
+    jobJson["succeeded"] = report.succeeded;
+    jobJson["estimated_memory"] = report.estimatedMemory;
+    jobJson["duration_seconds"] = report.durationSeconds;
+    jobJson["errors"] = std::move(errorsJson);
+    jobsJson.push_back(std::move(jobJson));
+    numSucceeded += report.succeeded ? 1 : 0;
+  }
+
+  nlohmann::json json;
+  json["jobs"] = std::move(jobsJson);
+  json["succeeded"] = numSucceeded;
+  json["failed"] = m_Reports.size() - numSucceeded;
+  json["duration_seconds"] = m_DurationSeconds;
+  return json;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+namespace CLI
+{
+/**
+ * @class BatchRunner
+ * @brief The BatchRunner class runs the jobs listed in a batch file, each a pipeline with optional
+ * parameter overrides, concurrently in one process. All jobs share one thread budget and a job is only
+ * started once the memory estimated from its preflight fits in the memory budget next to the jobs that
+ * are already running. Each job writes its own log and a summary report is written once all jobs finished.
+ *
+ * A batch file is a JSON object:
+ * {
+ *   "jobs": [{"pipeline": "a.d3dpipeline", "name": "sample_1", "overrides": [{"filter_index": 0, "arg": "input_file", "value": "1.h5"}]}],
+ *   "max_concurrent_pipelines": 4,
+ *   "max_threads": 16,
+ *   "memory_budget": 34359738368,
+ *   "log_directory": "logs",
+ *   "report": "batch_report.json"
+ * }
+ * Only "jobs" and each job's "pipeline" are required. Relative paths are relative to the batch file.
+ */
+class BatchRunner
+{
+public:
+  using MessageCallback = std::function<void(const std::string&)>;
+
+  /**
+   * @brief Replaces the value of an argument of one filter in a job's pipeline.
+   */
+  struct Override
+  {
+    usize filterIndex = 0;
+    std::string argumentKey;
+    nlohmann::json value;
+  };
+
+  struct Job
+  {
+    std::string name;
+    std::filesystem::path pipelinePath;
+    std::vector<Override> overrides;
+  };
+
+  struct JobReport
+  {
+    std::string name;
+    std::filesystem::path pipelinePath;
+    std::filesystem::path logPath;
+    bool succeeded = false;
+    uint64 estimatedMemory = 0;
+    float64 durationSeconds = 0.0;
+    std::vector<Error> errors;
+  };
+
+  /**
+   * @brief Reads a batch file.
+   * @param batchFilePath
+   * @return Result<BatchRunner>
+   */
+  static Result<BatchRunner> FromFile(const std::filesystem::path& batchFilePath);
+
+  /**
+   * @brief Creates a BatchRunner from the JSON of a batch file. Relative paths are resolved against baseDir.
+   * @param json
+   * @param baseDir
+   * @return Result<BatchRunner>
+   */
+  static Result<BatchRunner> FromJson(const nlohmann::json& json, const std::filesystem::path& baseDir);
+
+  /**
+   * @brief Runs every job and writes the summary report. Progress messages are passed to the callback,
+   * one at a time. Returns an error if any job failed.
+   * @param messageCallback
+   * @return Result<>
+   */
+  Result<> execute(const MessageCallback& messageCallback);
+
+  /**
+   * @brief Returns the reports of the jobs in the order of the batch file once execute() returned.
+   * @return const std::vector<JobReport>&
+   */
+  const std::vector<JobReport>& getReports() const;
+
+  /**
+   * @brief Returns the summary report as JSON.
+   * @return nlohmann::json
+   */
+  nlohmann::json reportToJson() const;
+
+private:
+  BatchRunner() = default;
+
+  std::vector<Job> m_Jobs;
+  usize m_MaxConcurrentPipelines = 0;
+  usize m_MaxThreads = 0;
+  uint64 m_MemoryBudget = 0;
+  std::filesystem::path m_LogDirectory;
+  std::filesystem::path m_ReportPath;
+  std::vector<JobReport> m_Reports;
+  float64 m_DurationSeconds = 0.0;
+};
+} // namespace CLI
+} // namespace nx::core
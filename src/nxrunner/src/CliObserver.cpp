@@ -3,6 +3,8 @@
 #include "simplnx/Pipeline/Messaging/AbstractPipelineMessage.hpp"
 #include "simplnx/Utilities/TimeUtilities.hpp"
 
+#include <fmt/format.h>
+
 #include <chrono>
 #include <iostream>
 #include <string>
@@ -10,7 +12,8 @@
 using namespace nx::core;
 using namespace nx::core::CLI;
 
-PipelineObserver::PipelineObserver(Pipeline* pipeline)
+PipelineObserver::PipelineObserver(Pipeline* pipeline, std::ostream& stream)
+: m_Stream(stream)
 {
   if(pipeline != nullptr)
   {
@@ -28,42 +31,49 @@ PipelineObserver::PipelineObserver(Pipeline* pipeline)
   int32_t currentFilterIndex = 0;
   for(const auto cxFilter : *pipeline)
   {
-    m_SignalConnections.push_back(cxFilter->getFilterUpdateSignal().connect([currentFilterIndex](nx::core::AbstractPipelineNode* node, int32_t, const std::string& message) {
-      std::cout << timestamp() << "  [" << currentFilterIndex << "] " << node->getName() << ": " << message << std::endl;
+    m_SignalConnections.push_back(cxFilter->getFilterUpdateSignal().connect([this, currentFilterIndex](nx::core::AbstractPipelineNode* node, int32_t, const std::string& message) {
+      writeLine(fmt::format("{}  [{}] {}: {}", timestamp(), currentFilterIndex, node->getName(), message));
     }));
 
-    m_SignalConnections.push_back(cxFilter->getFilterProgressSignal().connect([currentFilterIndex](nx::core::AbstractPipelineNode* node, int32_t, int32_t progress, const std::string& message) {
-      std::cout << timestamp() << "  [" << currentFilterIndex << "] " << node->getName() << ": " << progress << "% " << message << std::endl;
+    m_SignalConnections.push_back(cxFilter->getFilterProgressSignal().connect([this, currentFilterIndex](nx::core::AbstractPipelineNode* node, int32_t, int32_t progress, const std::string& message) {
+      writeLine(fmt::format("{}  [{}] {}: {}% {}", timestamp(), currentFilterIndex, node->getName(), progress, message));
     }));
 
-    m_SignalConnections.push_back(cxFilter->getFilterFaultSignal().connect([currentFilterIndex](nx::core::AbstractPipelineNode*, int32_t filterIndex, nx::core::FaultState state) {
+    m_SignalConnections.push_back(cxFilter->getFilterFaultSignal().connect([this, currentFilterIndex](nx::core::AbstractPipelineNode*, int32_t filterIndex, nx::core::FaultState state) {
       if(state == nx::core::FaultState::Errors)
       {
-        std::cout << timestamp() << "  [" << currentFilterIndex << "] Error(s) Encountered during filter execution. Fault state= " << static_cast<int32_t>(state) << std::endl;
+        writeLine(fmt::format("{}  [{}] Error(s) Encountered during filter execution. Fault state= {}", timestamp(), currentFilterIndex, static_cast<int32_t>(state)));
       }
       if(state == nx::core::FaultState::Warnings)
       {
-        std::cout << timestamp() << "  [" << currentFilterIndex << "] Warning(s) Encountered during filter execution. Fault state= " << static_cast<int32_t>(state) << std::endl;
+        writeLine(fmt::format("{}  [{}] Warning(s) Encountered during filter execution. Fault state= {}", timestamp(), currentFilterIndex, static_cast<int32_t>(state)));
       }
     }));
 
     m_SignalConnections.push_back(cxFilter->getFilterFaultDetailSignal().connect(
-        [currentFilterIndex](nx::core::AbstractPipelineNode*, int32_t filterIndex, const nx::core::WarningCollection& warnings, const nx::core::ErrorCollection& errors) {
+        [this, currentFilterIndex](nx::core::AbstractPipelineNode*, int32_t filterIndex, const nx::core::WarningCollection& warnings, const nx::core::ErrorCollection& errors) {
+          // The lines of one report are written together so they cannot interleave with other messages
+          std::string lines;
           if(!warnings.empty())
           {
-            std::cout << "[" << currentFilterIndex << "] Warnings During Execution" << std::endl;
+            lines += fmt::format("[{}] Warnings During Execution\n", currentFilterIndex);
           }
           for(const auto& warn : warnings)
           {
-            std::cout << "    Code: " << warn.code << "    Message: " << warn.message << std::endl;
+            lines += fmt::format("    Code: {}    Message: {}\n", warn.code, warn.message);
           }
           if(!errors.empty())
           {
-            std::cout << "[" << currentFilterIndex << "] Errors During Execution" << std::endl;
+            lines += fmt::format("[{}] Errors During Execution\n", currentFilterIndex);
           }
           for(const auto& error : errors)
           {
-            std::cout << "    Code: " << error.code << "    Message: " << error.message << std::endl;
+            lines += fmt::format("    Code: {}    Message: {}\n", error.code, error.message);
+          }
+          if(!lines.empty())
+          {
+            lines.pop_back();
+            writeLine(lines);
           }
         }));
 
@@ -73,19 +83,25 @@ PipelineObserver::PipelineObserver(Pipeline* pipeline)
 
 PipelineObserver::~PipelineObserver() = default;
 
+void PipelineObserver::writeLine(const std::string& line) const
+{
+  std::lock_guard<std::mutex> lock(m_StreamMutex);
+  m_Stream << line << std::endl;
+}
+
 void PipelineObserver::onNotify(AbstractPipelineNode* node, const std::shared_ptr<AbstractPipelineMessage>& msg)
 {
-  std::cout << msg->toString() << std::endl;
+  writeLine(msg->toString());
 }
 
 void PipelineObserver::onCancelled() const
 {
-  std::cout << timestamp() << "  Pipeline has been cancelled" << std::endl;
+  writeLine(fmt::format("{}  Pipeline has been cancelled", timestamp()));
 }
 
 void PipelineObserver::onFilterProgress(AbstractPipelineNode* node, int32 progress, int32 maxProgress, const std::string& msg) const
 {
-  std::cout << fmt::format("{} ({} / {}): {}", node->getName(), progress, maxProgress, msg) << std::endl;
+  writeLine(fmt::format("{} ({} / {}): {}", node->getName(), progress, maxProgress, msg));
 }
 
 void PipelineObserver::onRunStateChanged(AbstractPipelineNode* node, RunState state) const
@@ -93,13 +109,13 @@ void PipelineObserver::onRunStateChanged(AbstractPipelineNode* node, RunState st
   switch(state)
   {
   case RunState::Executing:
-    std::cout << timestamp() << fmt::format(" {} has begun executing", node->getName()) << std::endl;
+    writeLine(fmt::format("{} {} has begun executing", timestamp(), node->getName()));
     break;
   case RunState::Preflighting:
-    std::cout << timestamp() << fmt::format(" {} has begun preflighting", node->getName()) << std::endl;
+    writeLine(fmt::format("{} {} has begun preflighting", timestamp(), node->getName()));
     break;
   case RunState::Idle:
-    std::cout << timestamp() << fmt::format(" {} has completed", node->getName()) << std::endl;
+    writeLine(fmt::format("{} {} has completed", timestamp(), node->getName()));
     break;
   case RunState::Queued:
     break;
@@ -108,7 +124,7 @@ void PipelineObserver::onRunStateChanged(AbstractPipelineNode* node, RunState st
 
 void PipelineObserver::onFilterUpdate(AbstractPipelineNode* node, const std::string& msg) const
 {
-  std::cout << fmt::format("{}: {}", node->getName(), msg) << std::endl;
+  writeLine(fmt::format("{}: {}", node->getName(), msg));
 }
 
 void PipelineObserver::onFaultStateChanged(AbstractPipelineNode* node, FaultState state) const
@@ -116,10 +132,10 @@ void PipelineObserver::onFaultStateChanged(AbstractPipelineNode* node, FaultStat
   switch(state)
   {
   case FaultState::Errors:
-    std::cout << timestamp() << fmt::format(" '{}' has completed with errors", node->getName()) << std::endl;
+    writeLine(fmt::format("{} '{}' has completed with errors", timestamp(), node->getName()));
     break;
   case FaultState::Warnings:
-    std::cout << timestamp() << fmt::format(" '{}' has completed with warnings", node->getName()) << std::endl;
+    writeLine(fmt::format("{} '{}' has completed with warnings", timestamp(), node->getName()));
     break;
   case FaultState::None:
     break;
@@ -3,18 +3,24 @@
 #include "simplnx/Pipeline/Messaging/PipelineNodeObserver.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
 
+#include <iostream>
+#include <mutex>
+#include <string>
+
 namespace nx::core
 {
 namespace CLI
 {
 /**
  * @class PipelineObserver
- * @brief The PipelineObserver class writes pipeline messages to the standard output.
+ * @brief The PipelineObserver class writes pipeline messages to the standard output
+ * or to the given stream, such as the log of a batch job. Filters may emit messages from
+ * several worker threads, so every message is written to the stream under a lock.
  */
 class PipelineObserver : public PipelineNodeObserver
 {
 public:
-  PipelineObserver(Pipeline* pipeline = nullptr);
+  PipelineObserver(Pipeline* pipeline = nullptr, std::ostream& stream = std::cout);
   virtual ~PipelineObserver();
 
 protected:
@@ -36,6 +42,14 @@ protected:
   void onFaultStateChanged(AbstractPipelineNode* node, FaultState state) const;
 
 private:
+  /**
+   * @brief Writes the line followed by a newline while holding the stream lock.
+   * @param line
+   */
+  void writeLine(const std::string& line) const;
+
+  std::ostream& m_Stream;
+  mutable std::mutex m_StreamMutex;
   std::vector<nod::scoped_connection> m_SignalConnections;
 };
 } // namespace CLI
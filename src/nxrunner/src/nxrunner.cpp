@@ -1,3 +1,4 @@
+#include "BatchRunner.hpp"
 #include "CliObserver.hpp"
 
 #include "simplnx/Common/Result.hpp"
@@ -48,6 +49,7 @@ constexpr StringLiteral k_PreflightParamLong = "--preflight";
 constexpr StringLiteral k_LogFileParamLong = "--logfile";
 constexpr StringLiteral k_ConvertParamLong = "--convert";
 constexpr StringLiteral k_ConvertOutputParamLong = "--convert-output";
+constexpr StringLiteral k_BatchParamLong = "--batch";
 
 constexpr StringLiteral k_HelpParamShort = "-h";
 constexpr StringLiteral k_ExecuteParamShort = "-e";
@@ -55,14 +57,16 @@ constexpr StringLiteral k_PreflightParamShort = "-p";
 constexpr StringLiteral k_LogFileParamShort = "-l";
 constexpr StringLiteral k_ConvertParamShort = "-c";
 constexpr StringLiteral k_ConvertOutputParamShort = "-co";
+constexpr StringLiteral k_BatchParamShort = "-b";
 
 void LoadApp()
 {
   auto app = Application::GetOrCreateInstance();
   // Try loading plugins from the directory that the executable is in.
   // This is the default for developer build trees and CI build trees
+  // Plugins recorded in the plugin manifest are only loaded once a pipeline uses one of their filters
   fs::path appPath = app->getCurrentDir();
-  app->loadPlugins(appPath, true);
+  app->loadPluginsFromManifest(appPath, true);
 
   // For non-windows platforms we need to look in the actual 'Plugins'
   // directory which is up one directory from the executable.
@@ -73,7 +77,7 @@ void LoadApp()
     if(fs::exists(appPath / "Plugins"))
     {
       appPath = appPath / "Plugins";
-      app->loadPlugins(appPath, true);
+      app->loadPluginsFromManifest(appPath, true);
     }
   }
 #endif
@@ -138,7 +142,8 @@ enum class ArgumentType
   Help,
   Logfile,
   Convert,
-  ConvertOutput
+  ConvertOutput,
+  Batch
 };
 
 struct Argument
@@ -237,6 +242,11 @@ Result<CliArguments> ParseParameters(int argc, char* argv[])
       std::string argStr = ParseArgument(argc, argv, index);
       args.emplace_back(ArgumentType::ConvertOutput, argStr);
     }
+    else if(arg == k_BatchParamLong || arg == k_BatchParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Batch, argStr);
+    }
     else
     {
       args.emplace_back(ArgumentType::Invalid, arg);
@@ -378,6 +388,26 @@ Result<> PreflightPipeline(const Argument& arg)
   return PreflightPipeline(pipeline);
 }
 
+Result<> ExecuteBatch(const Argument& arg)
+{
+  std::string batchPath = arg.value;
+  cliOut << "Executing Batch: " << batchPath << "\n";
+
+  auto loadBatchResult = CLI::BatchRunner::FromFile(batchPath);
+  if(loadBatchResult.invalid())
+  {
+    cliOut << fmt::format("Error: Could not load batch file at path: '{}'", batchPath);
+    cliOut.endline();
+    return nx::core::ConvertResult(std::move(loadBatchResult));
+  }
+
+  CLI::BatchRunner batchRunner = std::move(loadBatchResult.value());
+  return batchRunner.execute([](const std::string& message) {
+    cliOut << message;
+    cliOut.endline();
+  });
+}
+
 Result<> ConvertPipeline(const Argument& arg, bool printConvertedPipeline, bool saveConverted)
 {
   std::string pipelinePath = arg.value;
@@ -445,6 +475,8 @@ void DisplayDefaultHelp()
          << "\t Preflight the pipeline at the target filepath. Optionally, create a log file at the specified path.\n";
   cliOut << fmt::format("\t {}|{} <pipeline filepath>  [{}|{} <log filepath>]\t", k_ConvertParamLong, k_ConvertParamShort, k_LogFileParamLong, k_LogFileParamShort)
          << "\t Convert the SIMPL pipeline at the target filepath. Optionally, create a log file at the specified path.";
+  cliOut << fmt::format("\t {}|{} <batch filepath>  [{}|{} <log filepath>]\t", k_BatchParamLong, k_BatchParamShort, k_LogFileParamLong, k_LogFileParamShort)
+         << "\t Execute the pipeline jobs listed in the batch file concurrently. Optionally, create a log file at the specified path.\n";
   cliOut << fmt::format("\t <operand [argument]>  [{}|{} <log filepath>]\t", k_LogFileParamLong, k_LogFileParamShort) << "\t Creates a log file at the specified path.";
   cliOut.endline();
 }
@@ -481,6 +513,14 @@ void DisplayConvertOutputHelp()
   cliOut.endline();
 }
 
+void DisplayBatchHelp()
+{
+  cliOut << "To execute the pipeline jobs listed in a batch file:\n\t";
+  cliOut << fmt::format("\t {}|{} <batch filepath>  [{}|{} <log filepath>]\t", k_BatchParamLong, k_BatchParamShort, k_LogFileParamLong, k_LogFileParamShort)
+         << "\t Execute the pipeline jobs listed in the batch file concurrently, writing a log per job and a summary report. Optionally, create a log file at the specified path.";
+  cliOut.endline();
+}
+
 void DisplayLogfileHelp()
 {
   cliOut << "To export output a log file:\n\t";
@@ -513,6 +553,10 @@ Result<> DisplayHelpMenu(const std::vector<Argument>& arguments)
     DisplayConvertOutputHelp();
     return {};
   }
+  case ArgumentType::Batch: {
+    DisplayBatchHelp();
+    return {};
+  }
   case ArgumentType::Logfile: {
     DisplayLogfileHelp();
     return {};
@@ -581,6 +625,9 @@ int main(int argc, char* argv[])
     case ArgumentType::ConvertOutput: {
       [[fallthrough]];
     }
+    case ArgumentType::Batch: {
+      [[fallthrough]];
+    }
     case ArgumentType::Execute: {
       [[fallthrough]];
     }
@@ -674,6 +721,27 @@ int main(int argc, char* argv[])
       fmt::print("Python exception: {}\n", exception.what());
       return 1;
     }
+#endif
+    catch(const std::exception& exception)
+    {
+      fmt::print("Exception: {}\n", exception.what());
+      return 1;
+    }
+    break;
+  }
+  case ArgumentType::Batch: {
+    try
+    {
+      cliOut << "###### BATCH MODE ########\n";
+      auto result = ExecuteBatch(arguments[0]);
+      results.push_back(result);
+    }
+#if SIMPLNX_EMBED_PYTHON
+    catch(const py::error_already_set& exception)
+    {
+      fmt::print("Python exception: {}\n", exception.what());
+      return 1;
+    }
 #endif
     catch(const std::exception& exception)
     {
@@ -3,6 +3,7 @@
 #include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Plugin/AbstractPlugin.hpp"
 #include "simplnx/Plugin/PluginLoader.hpp"
+#include "simplnx/Plugin/PluginManifest.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <fmt/core.h>
@@ -79,6 +80,24 @@ std::string getApplicationName(Application* app)
 {
   return "DREAM3DNX";
 }
+
+std::vector<std::filesystem::path> findPluginFiles(const std::filesystem::path& pluginDir)
+{
+  std::vector<std::filesystem::path> pluginFiles;
+  for(const auto& entry : std::filesystem::directory_iterator(pluginDir))
+  {
+    std::filesystem::path path = entry.path();
+#ifdef NDEBUG // Release mode
+    if(!StringUtilities::ends_with(path.string(), "_d.simplnx") && StringUtilities::ends_with(path.string(), ".simplnx"))
+#else
+    if(StringUtilities::ends_with(path.string(), "_d.simplnx"))
+#endif
+    {
+      pluginFiles.push_back(std::move(path));
+    }
+  }
+  return pluginFiles;
+}
 } // namespace
 
 std::shared_ptr<Application> Application::s_Instance = nullptr;
@@ -224,16 +243,75 @@ void Application::loadPlugins(const std::filesystem::path& pluginDir, bool verbo
   {
     fmt::print("Loading Plugins from {}\n", pluginDir.string());
   }
-  for(const auto& entry : std::filesystem::directory_iterator(pluginDir))
+  for(const auto& path : findPluginFiles(pluginDir))
   {
-    std::filesystem::path path = entry.path();
-#ifdef NDEBUG // Release mode
-    if(!StringUtilities::ends_with(path.string(), "_d.simplnx") && StringUtilities::ends_with(path.string(), ".simplnx"))
-#else
-    if(StringUtilities::ends_with(path.string(), "_d.simplnx"))
-#endif
+    loadPlugin(path, verbose);
+  }
+}
+
+void Application::loadPluginsFromManifest(const std::filesystem::path& pluginDir, bool verbose)
+{
+  if(!std::filesystem::exists(pluginDir))
+  {
+    if(verbose)
     {
-      loadPlugin(path, verbose);
+      fmt::print("Plugin Directory {} does not exist. Skipping", pluginDir.string());
+    }
+    return;
+  }
+  if(verbose)
+  {
+    fmt::print("Loading Plugins from {}\n", pluginDir.string());
+  }
+
+  const std::filesystem::path manifestPath = pluginDir / PluginManifest::k_DefaultFileName;
+  Result<PluginManifest> manifestResult = PluginManifest::ReadFile(manifestPath);
+  PluginManifest manifest = manifestResult.valid() ? std::move(manifestResult.value()) : PluginManifest();
+
+  // Only libraries that are still present are kept in the updated manifest
+  PluginManifest updatedManifest;
+  bool manifestChanged = manifestResult.invalid();
+  for(const auto& path : findPluginFiles(pluginDir))
+  {
+    const PluginManifest::Entry* entry = manifest.findCurrentEntry(path);
+    // DataIOManagers have to be registered up front, so those plugins are always loaded
+    if(entry != nullptr && !entry->hasDataIOManagers)
+    {
+      if(verbose)
+      {
+        fmt::print("Adding Plugin: {}\n", path.string());
+      }
+      if(getFilterList()->addPlugin(std::make_shared<LazyPluginLoader>(*entry)).invalid())
+      {
+        continue;
+      }
+      for(const auto& [simplUuid, simplnxUuid] : entry->simplToSimplnxUuids)
+      {
+        addSimplUuid(simplUuid, simplnxUuid, entry->name);
+      }
+      updatedManifest.setEntry(*entry);
+      continue;
+    }
+
+    const AbstractPlugin* plugin = loadPlugin(path, verbose, true);
+    if(plugin == nullptr)
+    {
+      continue;
+    }
+    updatedManifest.setEntry(PluginManifest::CreateEntry(*plugin, path));
+    manifestChanged = manifestChanged || entry == nullptr;
+  }
+  manifestChanged = manifestChanged || updatedManifest.getEntries().size() != manifest.getEntries().size();
+
+  if(manifestChanged)
+  {
+    Result<> writeResult = updatedManifest.writeFile(manifestPath);
+    if(writeResult.invalid() && verbose)
+    {
+      for(const auto& error : writeResult.errors())
+      {
+        fmt::print("{}\n", error.message);
+      }
     }
   }
 }
@@ -250,15 +328,7 @@ std::unordered_set<AbstractPlugin*> Application::getPluginList() const
 
 const AbstractPlugin* Application::getPlugin(const Uuid& uuid) const
 {
-  std::unordered_set<AbstractPlugin*> plugins = m_FilterList->getLoadedPlugins();
-  for(const auto* plugin : plugins)
-  {
-    if(plugin->getId() == uuid)
-    {
-      return plugin;
-    }
-  }
-  return nullptr;
+  return m_FilterList->getPlugin(uuid);
 }
 
 Preferences* Application::getPreferences()
@@ -281,47 +351,53 @@ std::shared_ptr<IDataIOManager> Application::getIOManager(const std::string& for
   return m_DataIOCollection->getManager(formatName);
 }
 
-void Application::loadPlugin(const std::filesystem::path& path, bool verbose)
+const AbstractPlugin* Application::loadPlugin(const std::filesystem::path& path, bool verbose, bool lazyBinding)
 {
   if(verbose)
   {
     fmt::print("Loading Plugin: {}\n", path.string());
   }
-  auto pluginLoader = std::make_shared<PluginLoader>(path);
+  auto pluginLoader = std::make_shared<PluginLoader>(path, lazyBinding);
   if(getFilterList()->addPlugin(pluginLoader).invalid())
   {
-    return;
+    return nullptr;
   }
 
   auto plugin = pluginLoader->getPlugin();
   if(plugin == nullptr)
   {
-    return;
+    return nullptr;
   }
 
   AbstractPlugin::SIMPLMapType simplToSimplnxUuids = plugin->getSimplToSimplnxMap();
   for(auto const& [simplUuid, simplData] : simplToSimplnxUuids)
   {
-    for(const auto& uuid : m_Simpl_Uuids)
+    addSimplUuid(simplUuid, simplData.simplnxUuid, plugin->getName());
+  }
+
+  for(const auto& pluginIO : plugin->getDataIOManagers())
+  {
+    m_DataIOCollection->addIOManager(pluginIO);
+  }
+  return plugin;
+}
+
+void Application::addSimplUuid(const Uuid& simplUuid, const Uuid& simplnxUuid, const std::string& pluginName)
+{
+  for(const auto& uuid : m_Simpl_Uuids)
+  {
+    if(uuid == simplUuid)
     {
-      if(uuid == simplUuid)
-      {
-        throw std::runtime_error(fmt::format("Duplicate UUIDs found in the SIMPL UUID maps! UUID: {} Plugin: {}", simplUuid.str(), plugin->getName()));
-      }
+      throw std::runtime_error(fmt::format("Duplicate UUIDs found in the SIMPL UUID maps! UUID: {} Plugin: {}", simplUuid.str(), pluginName));
     }
-    m_Simpl_Uuids.push_back(simplUuid);
-    m_Simplnx_Uuids.push_back(simplData.simplnxUuid);
   }
+  m_Simpl_Uuids.push_back(simplUuid);
+  m_Simplnx_Uuids.push_back(simplnxUuid);
 
   if(m_Simpl_Uuids.size() != m_Simplnx_Uuids.size())
   {
     throw std::runtime_error(fmt::format("UUID maps are not of the same size! SIMPL UUID Vector size: {} Simplnx UUID Vector size: {}", m_Simpl_Uuids.size(), m_Simplnx_Uuids.size()));
   }
-
-  for(const auto& pluginIO : plugin->getDataIOManagers())
-  {
-    m_DataIOCollection->addIOManager(pluginIO);
-  }
 }
 
 void Application::addDataType(DataObject::Type type, const std::string& name)
@@ -60,6 +60,17 @@ public:
    */
   void loadPlugins(const std::filesystem::path& pluginDir, bool verbose = false);
 
+  /**
+   * @brief Finds plugins in the target directory like loadPlugins() but uses the
+   * PluginManifest in that directory to avoid loading them. A plugin whose library
+   * is unchanged since it was recorded is only loaded when one of its filters is
+   * created. Other plugins, and plugins that provide DataIOManagers, are loaded
+   * now with lazy symbol binding and recorded. The manifest is rewritten if it changed.
+   * @param pluginDir
+   * @param verbose
+   */
+  void loadPluginsFromManifest(const std::filesystem::path& pluginDir, bool verbose = false);
+
   /**
    * @brief Returns a pointer to the Application's FilterList.
    *
@@ -171,10 +182,22 @@ private:
 
   /**
    * @brief Loads the plugin at the specified filepath and updates the
-   * FilterList with the new IFilters.
+   * FilterList with the new IFilters. Returns the plugin if it was added.
    * @param path
+   * @param verbose
+   * @param lazyBinding
+   * @return const AbstractPlugin*
+   */
+  const AbstractPlugin* loadPlugin(const std::filesystem::path& path, bool verbose = false, bool lazyBinding = false);
+
+  /**
+   * @brief Records the conversion of a SIMPL filter UUID to a simplnx filter UUID.
+   * Throws if the SIMPL UUID has already been recorded.
+   * @param simplUuid
+   * @param simplnxUuid
+   * @param pluginName
    */
-  void loadPlugin(const std::filesystem::path& path, bool verbose = false);
+  void addSimplUuid(const Uuid& simplUuid, const Uuid& simplnxUuid, const std::string& pluginName);
 
   //////////////////
   // Static Variable
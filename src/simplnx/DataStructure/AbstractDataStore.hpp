@@ -829,6 +829,51 @@ public:
     return {};
   }
 
+  /**
+   * @brief Copies buffer.size() values starting at startIndex into the buffer. The base
+   * implementation reads one value at a time. Stores that can read a whole range at once
+   * override this so that callers can process the store in blocks without a virtual call
+   * per element.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} out of a data store with {} values.", buffer.size(), startIndex, getSize()));
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      buffer[i] = getValue(startIndex + i);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Copies the values in the buffer into the store starting at startIndex. The base
+   * implementation writes one value at a time. Stores that can write a whole range at once
+   * override this.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer)
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values starting at index {} into a data store with {} values.", buffer.size(), startIndex, getSize()));
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      setValue(startIndex + i, buffer[i]);
+    }
+    return {};
+  }
+
   /**
    * @brief Sets all the components of tuple i to value.
    * @param i
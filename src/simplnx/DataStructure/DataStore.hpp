@@ -79,7 +79,7 @@ public:
   : parent_type()
   , m_ComponentShape(std::move(componentShape))
   , m_TupleShape(std::move(tupleShape))
-  , m_Data(std::move(buffer))
+  , m_Data(buffer.release())
   , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
   , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
   {
@@ -87,6 +87,26 @@ public:
     m_InitValue = GetMudflap<T>();
   }
 
+  /**
+   * @brief Constructs a DataStore that uses a buffer it does not own, such as a NumPy array, without copying it.
+   * The bufferOwner is released once the buffer is no longer used, which is when the DataStore is destroyed or
+   * resized to a different number of values. Resizing copies the values into a buffer owned by the DataStore.
+   * @param buffer
+   * @param bufferOwner Keeps the buffer alive. Must not be nullptr.
+   * @param tupleShape
+   * @param componentShape
+   */
+  DataStore(value_type* buffer, std::shared_ptr<void> bufferOwner, ShapeType tupleShape, ShapeType componentShape)
+  : parent_type()
+  , m_ComponentShape(std::move(componentShape))
+  , m_TupleShape(std::move(tupleShape))
+  , m_Data(buffer, BufferDeleter{std::move(bufferOwner)})
+  , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<size_t>(1), std::multiplies<>()))
+  {
+    m_InitValue = GetMudflap<T>();
+  }
+
   /**
    * @brief Copy constructor
    * @param other
@@ -230,7 +250,7 @@ public:
     if(m_Data.get() == nullptr) // Data was never allocated
     {
       auto data = new value_type[newSize];
-      m_Data.reset(data);
+      m_Data = BufferPtr(data);
       return;
     }
 
@@ -258,7 +278,26 @@ public:
       data[i] = initValue;
     }
 
-    m_Data.reset(data);
+    // Assigning a new pointer also releases the owner of a buffer that was not allocated here
+    m_Data = BufferPtr(data);
+  }
+
+  /**
+   * @brief Returns true if the values are held in a buffer owned by another object, such as a NumPy array.
+   * @return bool
+   */
+  bool usesExternalBuffer() const
+  {
+    return m_Data.get_deleter().owner != nullptr;
+  }
+
+  /**
+   * @brief Sets the value used to initialize new elements when the DataStore is resized.
+   * @param initValue
+   */
+  void setInitValue(std::optional<T> initValue)
+  {
+    m_InitValue = initValue;
   }
 
   /**
@@ -319,6 +358,40 @@ public:
     return m_Data.get()[index];
   }
 
+  /**
+   * @brief Copies buffer.size() values starting at startIndex into the buffer.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} out of a data store with {} values.", buffer.size(), startIndex, this->getSize()));
+    }
+
+    std::copy_n(data() + startIndex, buffer.size(), buffer.data());
+    return {};
+  }
+
+  /**
+   * @brief Copies the values in the buffer into the store starting at startIndex.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer) override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values starting at index {} into a data store with {} values.", buffer.size(), startIndex, this->getSize()));
+    }
+
+    std::copy_n(buffer.data(), buffer.size(), data() + startIndex);
+    return {};
+  }
+
   /**
    * @brief Returns a deep copy of the data store and all its data.
    * @return std::unique_ptr<IDataStore>
@@ -373,9 +446,28 @@ public:
   }
 
 private:
+  /**
+   * @brief Deletes buffers allocated by the DataStore. A buffer owned by another object is released
+   * by dropping the reference to its owner instead.
+   */
+  struct BufferDeleter
+  {
+    std::shared_ptr<void> owner;
+
+    void operator()(value_type* buffer) const
+    {
+      if(owner == nullptr)
+      {
+        delete[] buffer;
+      }
+    }
+  };
+
+  using BufferPtr = std::unique_ptr<value_type[], BufferDeleter>;
+
   ShapeType m_ComponentShape;
   ShapeType m_TupleShape;
-  std::unique_ptr<value_type[]> m_Data = nullptr;
+  BufferPtr m_Data = nullptr;
   size_t m_NumComponents = {0};
   size_t m_NumTuples = {0};
   std::optional<T> m_InitValue;
@@ -193,6 +193,30 @@ public:
     throw std::runtime_error("");
   }
 
+  /**
+   * @brief Throws an exception because this should never be called. The
+   * EmptyDataStore class contains no data other than its target getSize.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    throw std::runtime_error("");
+  }
+
+  /**
+   * @brief Throws an exception because this should never be called. The
+   * EmptyDataStore class contains no data other than its target getSize.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer) override
+  {
+    throw std::runtime_error("");
+  }
+
   /**
    * @brief Returns a deep copy of the data store and all its data.
    * @return std::unique_ptr<IDataStore>
@@ -34,6 +34,11 @@ Result<> AttributeMatrixIO::readData(DataStructureReader& structureReader, const
   {
     return MakeErrorResult(-1550, fmt::format("Failed to read AttributeMatrix tuple shape"));
   }
+  // Cell data of an Image Geometry that is only partially read takes the shape of the selection
+  if(const auto& selection = structureReader.getActiveImageSelection(); selection.has_value() && tupleShape == selection->sourceTupleShape())
+  {
+    tupleShape = selection->tupleShape();
+  }
   auto* dataObject = data_type::Import(structureReader.getDataStructure(), objectName, tupleShape, importId, parentId);
 
   Result<> result = BaseGroupIO::ReadBaseGroupData(structureReader, *dataObject, parentGroup, objectName, importId, parentId, useEmptyDataStore);
@@ -36,13 +36,14 @@ public:
    * @param err
    * @param parentId
    * @param preflight
+   * @param imageSelection
    */
   template <typename K>
   static void importDataArray(DataStructure& dataStructure, const nx::core::HDF5::DatasetReader& datasetReader, const std::string dataArrayName, DataObject::IdType importId,
-                              nx::core::HDF5::ErrorType& err, const std::optional<DataObject::IdType>& parentId, bool preflight)
+                              nx::core::HDF5::ErrorType& err, const std::optional<DataObject::IdType>& parentId, bool preflight, const std::optional<ImageSelection>& imageSelection = std::nullopt)
   {
-    std::unique_ptr<AbstractDataStore<K>> dataStore =
-        preflight ? std::unique_ptr<AbstractDataStore<K>>(EmptyDataStoreIO::ReadDataStore<K>(datasetReader)) : std::unique_ptr<AbstractDataStore<K>>(DataStoreIO::ReadDataStore<K>(datasetReader));
+    std::unique_ptr<AbstractDataStore<K>> dataStore = preflight ? std::unique_ptr<AbstractDataStore<K>>(EmptyDataStoreIO::ReadDataStore<K>(datasetReader, imageSelection))
+                                                                : std::unique_ptr<AbstractDataStore<K>>(DataStoreIO::ReadDataStore<K>(datasetReader, imageSelection));
     DataArray<K>* data = DataArray<K>::Import(dataStructure, dataArrayName, importId, std::move(dataStore), parentId);
     err = (data == nullptr) ? -400 : 0;
   }
@@ -86,45 +87,46 @@ public:
     }
 
     nx::core::HDF5::ErrorType err = 0;
+    const std::optional<ImageSelection>& imageSelection = dataStructureReader.getActiveImageSelection();
 
     switch(type)
     {
     case nx::core::HDF5::Type::float32:
-      importDataArray<float32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<float32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::float64:
-      importDataArray<float64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<float64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::int8:
-      importDataArray<int8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::int16:
-      importDataArray<int16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::int32:
-      importDataArray<int32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::int64:
-      importDataArray<int64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::uint8:
       if(isBoolArray)
       {
-        importDataArray<bool>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+        importDataArray<bool>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       }
       else
       {
-        importDataArray<uint8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+        importDataArray<uint8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       }
       break;
     case nx::core::HDF5::Type::uint16:
-      importDataArray<uint16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::uint32:
-      importDataArray<uint32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     case nx::core::HDF5::Type::uint64:
-      importDataArray<uint64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, imageSelection);
       break;
     default:
       err = -777;
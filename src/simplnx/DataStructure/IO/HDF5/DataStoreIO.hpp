@@ -1,6 +1,8 @@
 #pragma once
 
 #include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
+#include "simplnx/DataStructure/IO/HDF5/DataStructureReader.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IDataStoreIO.hpp"
 
 #include "simplnx/Utilities/Parsing/HDF5/Writers/DatasetWriter.hpp"
@@ -219,19 +221,41 @@ inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, con
 }
 
 /**
- * @brief Attempts to read a DataStore<T> from the dataset reader
+ * @brief Attempts to read a DataStore<T> from the dataset reader. If an image selection is
+ * given and the dataset has the selection's source tuple shape then only the selected
+ * hyperslab is read.
  * @param datasetReader
+ * @param imageSelection
  * @return std::unique_ptr<DataStore<T>>
  */
 template <typename T>
-inline std::unique_ptr<DataStore<T>> ReadDataStore(const nx::core::HDF5::DatasetReader& datasetReader)
+inline std::unique_ptr<DataStore<T>> ReadDataStore(const nx::core::HDF5::DatasetReader& datasetReader, const std::optional<ImageSelection>& imageSelection = std::nullopt)
 {
   auto tupleShape = IDataStoreIO::ReadTupleShape(datasetReader);
   auto componentShape = IDataStoreIO::ReadComponentShape(datasetReader);
 
-  // Create DataStore
-  auto dataStore = std::make_unique<DataStore<T>>(tupleShape, componentShape, static_cast<T>(0));
-  Result<> result = datasetReader.readIntoSpan(dataStore->createSpan());
+  std::optional<std::vector<hsize_t>> start;
+  std::optional<std::vector<hsize_t>> count;
+  std::optional<std::vector<hsize_t>> stride;
+  if(imageSelection.has_value() && tupleShape == imageSelection->sourceTupleShape())
+  {
+    // Tuple dimensions are stored ZYX followed by the component dimensions
+    start = std::vector<hsize_t>{imageSelection->Start[2], imageSelection->Start[1], imageSelection->Start[0]};
+    count = std::vector<hsize_t>{imageSelection->Count[2], imageSelection->Count[1], imageSelection->Count[0]};
+    stride = std::vector<hsize_t>{imageSelection->Stride[2], imageSelection->Stride[1], imageSelection->Stride[0]};
+    for(const auto& value : componentShape)
+    {
+      start->push_back(0);
+      count->push_back(static_cast<hsize_t>(value));
+      stride->push_back(1);
+    }
+    tupleShape = imageSelection->tupleShape();
+  }
+
+  // Create DataStore. The read overwrites every element so the buffer is not initialized first.
+  auto dataStore = std::make_unique<DataStore<T>>(tupleShape, componentShape, std::nullopt);
+  dataStore->setInitValue(static_cast<T>(0));
+  Result<> result = datasetReader.readIntoSpan(dataStore->createSpan(), start, count, stride);
   if(result.invalid())
   {
     throw std::runtime_error(fmt::format("Error reading data array from DataStore from HDF5 at {}/{}:\n\n{}", nx::core::HDF5::Support::GetObjectPath(datasetReader.getParentId()),
@@ -20,11 +20,16 @@ DataStructureReader::~DataStructureReader() noexcept = default;
 Result<DataStructure> DataStructureReader::ReadFile(const std::filesystem::path& path, bool useEmptyDataStores)
 {
   const nx::core::HDF5::FileReader fileReader(path);
-  return ReadFile(fileReader);
+  return ReadFile(fileReader, useEmptyDataStores);
 }
 Result<DataStructure> DataStructureReader::ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores)
+{
+  return ReadFile(fileReader, useEmptyDataStores, std::nullopt);
+}
+Result<DataStructure> DataStructureReader::ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores, const std::optional<ImageSubvolume>& imageSubvolume)
 {
   DataStructureReader dataStructureReader;
+  dataStructureReader.setImageSubvolume(imageSubvolume);
   auto groupReader = fileReader.openGroup(Constants::k_DataStructureTag);
   return dataStructureReader.readGroup(groupReader, useEmptyDataStores);
 }
@@ -133,6 +138,26 @@ void DataStructureReader::clearDataStructure()
   m_CurrentStructure = DataStructure();
 }
 
+void DataStructureReader::setImageSubvolume(const std::optional<ImageSubvolume>& imageSubvolume)
+{
+  m_ImageSubvolume = imageSubvolume;
+}
+
+const std::optional<ImageSubvolume>& DataStructureReader::getImageSubvolume() const
+{
+  return m_ImageSubvolume;
+}
+
+void DataStructureReader::setActiveImageSelection(const std::optional<ImageSelection>& imageSelection)
+{
+  m_ActiveImageSelection = imageSelection;
+}
+
+const std::optional<ImageSelection>& DataStructureReader::getActiveImageSelection() const
+{
+  return m_ActiveImageSelection;
+}
+
 std::shared_ptr<DataIOManager> DataStructureReader::getDataReader() const
 {
   if(m_IOManager != nullptr)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/IO/Generic/IDataIOManager.hpp"
 
@@ -7,11 +8,58 @@
 
 #include "simplnx/simplnx_export.hpp"
 
+#include <array>
+#include <limits>
+#include <optional>
+#include <vector>
+
 namespace nx::core::HDF5
 {
 class IDataIO;
 class DataIOManager;
 
+/**
+ * @brief Index space region to read from Image Geometries. All values are in XYZ order, the
+ * max index is inclusive and clamped to the geometry dimensions and a stride above 1 decimates
+ * that axis. If no geometry path is given the region is applied to every Image Geometry.
+ */
+struct ImageSubvolume
+{
+  std::optional<DataPath> GeometryPath;
+  std::array<usize, 3> MinIndex = {0, 0, 0};
+  std::array<usize, 3> MaxIndex = {std::numeric_limits<usize>::max(), std::numeric_limits<usize>::max(), std::numeric_limits<usize>::max()};
+  std::array<usize, 3> Stride = {1, 1, 1};
+};
+
+/**
+ * @brief The hyperslab of the Image Geometry that is currently being read. All values are in XYZ order.
+ */
+struct ImageSelection
+{
+  std::array<usize, 3> SourceDims = {0, 0, 0};
+  std::array<usize, 3> Start = {0, 0, 0};
+  std::array<usize, 3> Count = {0, 0, 0};
+  std::array<usize, 3> Stride = {1, 1, 1};
+
+  /**
+   * @brief Returns the tuple shape of the cell data in the file.
+   * @return std::vector<usize>
+   */
+  std::vector<usize> sourceTupleShape() const
+  {
+    return {SourceDims[2], SourceDims[1], SourceDims[0]};
+  }
+
+  /**
+   * @brief Returns the tuple shape of the cell data after the selection is applied.
+   * @return std::vector<usize>
+   */
+  std::vector<usize> tupleShape() const
+  {
+    return {Count[2], Count[1], Count[0]};
+  }
+};
+
 /**
  * @brief The DataStructureReader class exists to read DataStructures from an HDF5 file or group.
  */
@@ -37,6 +85,16 @@ public:
    */
   static Result<DataStructure> ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores = false);
 
+  /**
+   * @brief Attempts to read a DataStructure from the corresponding HDF5 file while only
+   * reading the given subvolume of the Image Geometries' cell data.
+   * @param fileReader
+   * @param useEmptyDataStores
+   * @param imageSubvolume
+   * @return Result<DataStructure>
+   */
+  static Result<DataStructure> ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores, const std::optional<ImageSubvolume>& imageSubvolume);
+
   /**
    * @brief Imports and returns a DataStructure from a target nx::core::HDF5::GroupReader.
    * Returns any HDF5 error code that occur by reference. Otherwise, this value
@@ -70,6 +128,31 @@ public:
    */
   void clearDataStructure();
 
+  /**
+   * @brief Sets the subvolume of the Image Geometries that should be read.
+   * @param imageSubvolume
+   */
+  void setImageSubvolume(const std::optional<ImageSubvolume>& imageSubvolume);
+
+  /**
+   * @brief Returns the subvolume of the Image Geometries that should be read.
+   * @return const std::optional<ImageSubvolume>&
+   */
+  const std::optional<ImageSubvolume>& getImageSubvolume() const;
+
+  /**
+   * @brief Sets the selection of the Image Geometry whose children are currently being read.
+   * @param imageSelection
+   */
+  void setActiveImageSelection(const std::optional<ImageSelection>& imageSelection);
+
+  /**
+   * @brief Returns the selection of the Image Geometry whose children are currently being read.
+   * Data inside of it with the geometry's cell tuple shape is read using this selection.
+   * @return const std::optional<ImageSelection>&
+   */
+  const std::optional<ImageSelection>& getActiveImageSelection() const;
+
 protected:
   /**
    * @brief Returns a pointer to the nx::core::HDF5::DataFactoryManager used for finding the
@@ -89,5 +172,7 @@ protected:
 private:
   std::shared_ptr<DataIOManager> m_IOManager = nullptr;
   DataStructure m_CurrentStructure;
+  std::optional<ImageSubvolume> m_ImageSubvolume;
+  std::optional<ImageSelection> m_ActiveImageSelection;
 };
 } // namespace nx::core::HDF5
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "simplnx/DataStructure/EmptyDataStore.hpp"
+#include "simplnx/DataStructure/IO/HDF5/DataStructureReader.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IDataStoreIO.hpp"
 
 #include <memory>
@@ -10,15 +11,21 @@ namespace nx::core::HDF5
 namespace EmptyDataStoreIO
 {
 /**
- * @brief Attempts to read an EmptyDataStore from HDF5.
+ * @brief Attempts to read an EmptyDataStore from HDF5. If an image selection is given and
+ * the dataset has the selection's source tuple shape then the selection's tuple shape is used.
  * @param datasetReader
+ * @param imageSelection
  * @return std::unique_ptr<EmptyDataStore<T>>
  */
 template <typename T>
-static std::unique_ptr<EmptyDataStore<T>> ReadDataStore(const nx::core::HDF5::DatasetReader& datasetReader)
+static std::unique_ptr<EmptyDataStore<T>> ReadDataStore(const nx::core::HDF5::DatasetReader& datasetReader, const std::optional<ImageSelection>& imageSelection = std::nullopt)
 {
   auto tupleShape = IDataStoreIO::ReadTupleShape(datasetReader);
   auto componentShape = IDataStoreIO::ReadComponentShape(datasetReader);
+  if(imageSelection.has_value() && tupleShape == imageSelection->sourceTupleShape())
+  {
+    tupleShape = imageSelection->tupleShape();
+  }
 
   // Create DataStore
   auto dataStore = std::make_unique<EmptyDataStore<T>>(tupleShape, componentShape);
@@ -13,6 +13,8 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+
 using namespace nx::core;
 
 namespace
@@ -25,6 +27,38 @@ constexpr StringLiteral k_ReadingGroupError_Message = "Error opening HDF5 group
 constexpr StringLiteral k_ReadingDimensionsError_Message = "Error opening HDF5 dimensions attribute while reading ImageGeom";
 constexpr StringLiteral k_ReadingSpacingError_Message = "Error opening HDF5 spacing attribute while reading ImageGeom";
 constexpr StringLiteral k_ReadingOriginError_Message = "Error opening HDF5 origin attribute while reading ImageGeom";
+constexpr int32 k_InvalidSubvolumeError_Code = -524;
+
+/**
+ * @brief Clamps the requested subvolume to the geometry dimensions and returns the
+ * hyperslab that will be read.
+ */
+Result<HDF5::ImageSelection> ResolveImageSelection(const HDF5::ImageSubvolume& subvolume, const std::vector<usize>& volDims, const std::string& geometryName)
+{
+  HDF5::ImageSelection selection;
+  for(usize i = 0; i < 3; i++)
+  {
+    // An empty axis has no voxels to select and would wrap around below
+    if(volDims[i] == 0)
+    {
+      return MakeErrorResult<HDF5::ImageSelection>(k_InvalidSubvolumeError_Code, fmt::format("Unable to read a subvolume of Image Geometry '{}' with dimensions [{}, {}, {}]", geometryName,
+                                                                                              volDims[0], volDims[1], volDims[2]));
+    }
+    const usize maxIndex = std::min(subvolume.MaxIndex[i], volDims[i] - 1);
+    if(subvolume.Stride[i] == 0 || subvolume.MinIndex[i] > maxIndex)
+    {
+      return MakeErrorResult<HDF5::ImageSelection>(
+          k_InvalidSubvolumeError_Code,
+          fmt::format("The subvolume min index [{}, {}, {}] and stride [{}, {}, {}] do not select any voxels of Image Geometry '{}' with dimensions [{}, {}, {}]", subvolume.MinIndex[0],
+                      subvolume.MinIndex[1], subvolume.MinIndex[2], subvolume.Stride[0], subvolume.Stride[1], subvolume.Stride[2], geometryName, volDims[0], volDims[1], volDims[2]));
+    }
+    selection.SourceDims[i] = volDims[i];
+    selection.Start[i] = subvolume.MinIndex[i];
+    selection.Stride[i] = subvolume.Stride[i];
+    selection.Count[i] = (maxIndex - subvolume.MinIndex[i]) / subvolume.Stride[i] + 1;
+  }
+  return {selection};
+}
 } // namespace
 
 namespace nx::core::HDF5
@@ -85,11 +119,37 @@ Result<> ImageGeomIO::readData(DataStructureReader& dataStructureReader, const g
     origin[i] = originVector[i];
   }
 
+  // Only read the requested subvolume of this geometry's cell data
+  const std::optional<ImageSelection> parentSelection = dataStructureReader.getActiveImageSelection();
+  const auto& subvolume = dataStructureReader.getImageSubvolume();
+  if(subvolume.has_value())
+  {
+    const std::vector<DataPath> geometryPaths = dataStructureReader.getDataStructure().getDataPathsForId(importId);
+    if(!subvolume->GeometryPath.has_value() || std::find(geometryPaths.cbegin(), geometryPaths.cend(), subvolume->GeometryPath.value()) != geometryPaths.cend())
+    {
+      Result<ImageSelection> selectionResult = ResolveImageSelection(*subvolume, volDimsVector, objectName);
+      if(selectionResult.invalid())
+      {
+        return ConvertResult(std::move(selectionResult));
+      }
+      const ImageSelection& selection = selectionResult.value();
+      for(usize i = 0; i < 3; i++)
+      {
+        origin[i] += static_cast<float32>(selection.Start[i]) * spacing[i];
+        spacing[i] *= static_cast<float32>(selection.Stride[i]);
+        volDims[i] = selection.Count[i];
+      }
+      dataStructureReader.setActiveImageSelection(selection);
+    }
+  }
+
   imageGeom->setDimensions(volDims);
   imageGeom->setSpacing(spacing);
   imageGeom->setOrigin(origin);
 
-  return IGridGeometryIO::ReadGridGeometryData(dataStructureReader, *imageGeom, parentGroup, objectName, importId, parentId, useEmptyDataStore);
+  Result<> result = IGridGeometryIO::ReadGridGeometryData(dataStructureReader, *imageGeom, parentGroup, objectName, importId, parentId, useEmptyDataStore);
+  dataStructureReader.setActiveImageSelection(parentSelection);
+  return result;
 }
 
 Result<> ImageGeomIO::writeData(DataStructureWriter& dataStructureWriter, const ImageGeom& geometry, group_writer_type& parentGroupWriter, bool importable) const
@@ -32,10 +32,11 @@ std::vector<DataPath> getImportPaths(const DataStructure& importStructure, const
 
 namespace nx::core
 {
-ImportH5ObjectPathsAction::ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths)
+ImportH5ObjectPathsAction::ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths, const std::optional<HDF5::ImageSubvolume>& imageSubvolume)
 : IDataCreationAction(DataPath{})
 , m_H5FilePath(importFile)
 , m_Paths(paths)
+, m_ImageSubvolume(imageSubvolume)
 {
   if(m_Paths.has_value())
   {
@@ -51,7 +52,7 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
   bool preflighting = (mode == Mode::Preflight);
 
   nx::core::HDF5::FileReader fileReader(m_H5FilePath);
-  Result<DataStructure> dataStructureResult = DREAM3D::ImportDataStructureFromFile(fileReader, preflighting);
+  Result<DataStructure> dataStructureResult = DREAM3D::ImportDataStructureFromFile(fileReader, preflighting, m_ImageSubvolume);
   if(dataStructureResult.invalid())
   {
     return ConvertResult(std::move(dataStructureResult));
@@ -99,7 +100,7 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
 
 IDataAction::UniquePointer ImportH5ObjectPathsAction::clone() const
 {
-  return std::make_unique<ImportH5ObjectPathsAction>(m_H5FilePath, m_Paths);
+  return std::make_unique<ImportH5ObjectPathsAction>(m_H5FilePath, m_Paths, m_ImageSubvolume);
 }
 
 std::vector<DataPath> ImportH5ObjectPathsAction::getAllCreatedPaths() const
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/IO/HDF5/DataStructureReader.hpp"
 #include "simplnx/Filter/Output.hpp"
 
 #include <optional>
@@ -26,8 +27,9 @@ public:
    * <b>IMPORTANT NOTE</b>. If the std::optional<> paths argument does NOT have a value then
    * then entire file will be imported. If it has a value, but the std::vector<> has a size of
    * zero (0), then NOTHING will be imported.
+   * @param imageSubvolume Optional subvolume of the Image Geometries' cell data to read instead of the whole volume.
    */
-  ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths);
+  ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths, const std::optional<HDF5::ImageSubvolume>& imageSubvolume = std::nullopt);
 
   ~ImportH5ObjectPathsAction() noexcept override;
 
@@ -60,5 +62,6 @@ public:
 private:
   std::filesystem::path m_H5FilePath;
   PathsType m_Paths;
+  std::optional<HDF5::ImageSubvolume> m_ImageSubvolume;
 };
 } // namespace nx::core
@@ -48,6 +48,17 @@ public:
    */
   FilterHandle(const FilterIdType& filterId, const PluginIdType& pluginId);
 
+  /**
+   * @brief Constructs a FilterHandle from previously recorded filter information, such as a
+   * plugin manifest, without creating the filter.
+   * @param filterId
+   * @param pluginId
+   * @param filterName
+   * @param className
+   * @param defaultTags
+   */
+  FilterHandle(const FilterIdType& filterId, const PluginIdType& pluginId, std::string filterName, std::string className, std::vector<std::string> defaultTags);
+
   /**
    * @brief Copy constructor
    * @param rhs
@@ -23,7 +23,10 @@ FilterList::SearchContainerType FilterList::search(const std::string& text) cons
   std::vector<FilterHandle> handles;
   for(const auto& handle : getFilterHandles())
   {
-    if(handle.getFilterName().find(text) != std::string::npos || getPlugin(handle)->getName().find(text) != std::string::npos || handle.getClassName().find(text) != std::string::npos)
+    // Plugin names come from the loaders so that searching does not load lazily loaded plugins
+    auto loaderIter = m_PluginMap.find(handle.getPluginId());
+    std::string pluginName = loaderIter != m_PluginMap.cend() ? loaderIter->second->getPluginName() : std::string();
+    if(handle.getFilterName().find(text) != std::string::npos || pluginName.find(text) != std::string::npos || handle.getClassName().find(text) != std::string::npos)
     {
       handles.push_back(handle);
     }
@@ -55,35 +58,42 @@ IFilter::UniquePointer FilterList::createFilter(const FilterHandle& handle) cons
 
   // Plugin filter
   const auto& loader = m_PluginMap.at(handle.getPluginId());
-  if(!loader->isLoaded())
+  AbstractPlugin* plugin = loader->getPlugin();
+  if(plugin == nullptr)
   {
     return nullptr;
   }
-  return loader->getPlugin()->createFilter(handle.getFilterId());
+  return plugin->createFilter(handle.getFilterId());
 }
 
 IFilter::UniquePointer FilterList::createFilter(const Uuid& uuid) const
 {
-  auto iter = std::find_if(m_PluginMap.cbegin(), m_PluginMap.cend(), [uuid](decltype(*m_PluginMap.cbegin())& item) { return item.second->getPlugin()->containsFilterId(uuid); });
+  auto iter = std::find_if(m_PluginMap.cbegin(), m_PluginMap.cend(), [uuid](decltype(*m_PluginMap.cbegin())& item) { return item.second->containsFilterId(uuid); });
 
   if(iter == m_PluginMap.cend())
   {
     return nullptr;
   }
 
-  if(!iter->second->isLoaded())
+  AbstractPlugin* plugin = iter->second->getPlugin();
+  if(plugin == nullptr)
   {
     return nullptr;
   }
 
-  return iter->second->getPlugin()->createFilter(uuid);
+  return plugin->createFilter(uuid);
 }
 
 AbstractPlugin* FilterList::getPlugin(const FilterHandle& handle) const
+{
+  return getPluginById(handle.getPluginId());
+}
+
+const AbstractPlugin* FilterList::getPluginForSimplFilter(const Uuid& simplFilterId) const
 {
   for(const auto& iter : m_PluginMap)
   {
-    if(iter.second->getPlugin()->getId() == handle.getPluginId())
+    if(iter.second->containsSimplFilterId(simplFilterId))
     {
       return iter.second->getPlugin();
     }
@@ -93,18 +103,18 @@ AbstractPlugin* FilterList::getPlugin(const FilterHandle& handle) const
 
 Result<> FilterList::addPlugin(const std::shared_ptr<IPluginLoader>& loader)
 {
-  if(!loader->isLoaded())
+  // Lazily loaded plugins are added from their manifest entry without loading them
+  Uuid pluginUuid = loader->getPluginId();
+  if(pluginUuid == Uuid{})
   {
     return MakeErrorResult(-444, "Plugin was not loaded");
   }
-  AbstractPlugin* plugin = loader->getPlugin();
-  Uuid pluginUuid = plugin->getId();
   if(m_PluginMap.count(pluginUuid) > 0)
   {
-    return MakeErrorResult(-445, fmt::format("Attempted to add plugin '{}' with uuid '{}', but plugin '{}' already exists with that uuid", plugin->getName(), pluginUuid.str(),
-                                             m_PluginMap[pluginUuid]->getPlugin()->getName()));
+    return MakeErrorResult(-445, fmt::format("Attempted to add plugin '{}' with uuid '{}', but plugin '{}' already exists with that uuid", loader->getPluginName(), pluginUuid.str(),
+                                             m_PluginMap[pluginUuid]->getPluginName()));
   }
-  auto pluginHandles = plugin->getFilterHandles();
+  auto pluginHandles = loader->getFilterHandles();
   m_FilterHandles.merge(pluginHandles);
   m_PluginMap[pluginUuid] = loader;
   return {};
@@ -143,7 +153,7 @@ void FilterList::removePlugin(const Uuid& pluginId)
 
   const auto& plugin = m_PluginMap.at(pluginId);
 
-  auto handlesToRemove = plugin->getPlugin()->getFilterHandles();
+  auto handlesToRemove = plugin->getFilterHandles();
 
   for(const auto& handle : handlesToRemove)
   {
@@ -86,6 +86,14 @@ public:
    */
   AbstractPlugin* getPlugin(const FilterHandle& handle) const;
 
+  /**
+   * @brief Returns the plugin that converts the SIMPL filter with the given ID.
+   * Returns nullptr if no plugin converts it. Only that plugin is loaded.
+   * @param simplFilterId
+   * @return const AbstractPlugin*
+   */
+  const AbstractPlugin* getPluginForSimplFilter(const Uuid& simplFilterId) const;
+
   /**
    * @brief
    * @param uuid
@@ -145,7 +153,8 @@ public:
   void removePlugin(const Uuid& pluginId);
 
   /**
-   * @brief Returns a set of pointers to loaded plugins.
+   * @brief Returns a set of pointers to loaded plugins. Plugins added with a
+   * LazyPluginLoader are only included once they have been loaded.
    * @return std::unordered_set<AbstractPlugin*>
    */
   std::unordered_set<AbstractPlugin*> getLoadedPlugins() const;
@@ -951,3 +951,8 @@ uint64 Pipeline::checkMemoryRequired()
   preflight();
   return m_MemoryRequired;
 }
+
+uint64 Pipeline::getMemoryRequired() const
+{
+  return m_MemoryRequired;
+}
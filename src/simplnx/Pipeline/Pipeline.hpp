@@ -606,6 +606,12 @@ public:
    */
   uint64 checkMemoryRequired();
 
+  /**
+   * @brief Returns the maximum amount of memory required by the DataStructure during the last preflight.
+   * @return Memory size in Bytes
+   */
+  uint64 getMemoryRequired() const;
+
 protected:
   /**
    * @brief Returns implementation-specific json value for the node.
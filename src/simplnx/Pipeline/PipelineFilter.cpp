@@ -45,14 +45,15 @@ nlohmann::json CreateFilterJson(std::string_view uuid, std::string_view name, nl
 
 std::optional<AbstractPlugin::SIMPLData> FindComplexConversionFromSIMPL(const Uuid& uuid, const FilterList& filterList)
 {
-  auto plugins = filterList.getLoadedPlugins();
-  for(const auto* plugin : plugins)
+  const AbstractPlugin* plugin = filterList.getPluginForSimplFilter(uuid);
+  if(plugin == nullptr)
   {
-    auto filterMap = plugin->getSimplToSimplnxMap();
-    if(filterMap.count(uuid) > 0)
-    {
-      return filterMap.at(uuid);
-    }
+    return {};
+  }
+  auto filterMap = plugin->getSimplToSimplnxMap();
+  if(filterMap.count(uuid) > 0)
+  {
+    return filterMap.at(uuid);
   }
   return {};
 }
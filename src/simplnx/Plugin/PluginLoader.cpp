@@ -2,6 +2,7 @@
 
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <memory>
 
 // fmt >= 8.0.0
@@ -32,12 +33,12 @@ namespace
 template <class T>
 constexpr bool is_function_ptr_v = (std::is_pointer_v<T> && std::is_function_v<std::remove_pointer_t<T>>);
 
-void* LoadSharedLibrary(const std::filesystem::path& path)
+void* LoadSharedLibrary(const std::filesystem::path& path, bool lazyBinding)
 {
 #if defined(_WIN32)
   return LoadLibraryW(path.c_str());
 #elif defined(__linux__) || defined(__APPLE__)
-  return dlopen(path.c_str(), RTLD_NOW);
+  return dlopen(path.c_str(), lazyBinding ? RTLD_LAZY : RTLD_NOW);
 #endif
 }
 
@@ -87,8 +88,39 @@ auto GetErrorMessage()
 }
 } // namespace
 
-PluginLoader::PluginLoader(const std::filesystem::path& path)
+Uuid IPluginLoader::getPluginId() const
+{
+  const AbstractPlugin* plugin = getPlugin();
+  return plugin != nullptr ? plugin->getId() : Uuid{};
+}
+
+std::string IPluginLoader::getPluginName() const
+{
+  const AbstractPlugin* plugin = getPlugin();
+  return plugin != nullptr ? plugin->getName() : std::string();
+}
+
+AbstractPlugin::FilterContainerType IPluginLoader::getFilterHandles() const
+{
+  const AbstractPlugin* plugin = getPlugin();
+  return plugin != nullptr ? plugin->getFilterHandles() : AbstractPlugin::FilterContainerType{};
+}
+
+bool IPluginLoader::containsFilterId(const Uuid& filterId) const
+{
+  const AbstractPlugin* plugin = getPlugin();
+  return plugin != nullptr && plugin->containsFilterId(filterId);
+}
+
+bool IPluginLoader::containsSimplFilterId(const Uuid& simplFilterId) const
+{
+  const AbstractPlugin* plugin = getPlugin();
+  return plugin != nullptr && plugin->getSimplToSimplnxMap().count(simplFilterId) > 0;
+}
+
+PluginLoader::PluginLoader(const std::filesystem::path& path, bool lazyBinding)
 : m_Path(path)
+, m_LazyBinding(lazyBinding)
 , m_Plugin(nullptr)
 {
   loadPlugin();
@@ -98,7 +130,7 @@ PluginLoader::~PluginLoader() noexcept = default;
 
 void PluginLoader::loadPlugin()
 {
-  m_Handle = LoadSharedLibrary(m_Path);
+  m_Handle = LoadSharedLibrary(m_Path, m_LazyBinding);
   if(m_Handle == nullptr)
   {
     fmt::print(SIMPLNX_TEXT("Could not load library '{}' with the following error:\n"), m_Path.c_str());
@@ -156,3 +188,70 @@ const AbstractPlugin* PluginLoader::getPlugin() const
 {
   return m_Plugin.get();
 }
+
+LazyPluginLoader::LazyPluginLoader(PluginManifest::Entry entry)
+: IPluginLoader()
+, m_Entry(std::move(entry))
+{
+}
+
+LazyPluginLoader::~LazyPluginLoader() noexcept = default;
+
+AbstractPlugin* LazyPluginLoader::loadPlugin() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if(!m_LoadAttempted)
+  {
+    m_LoadAttempted = true;
+    auto loader = std::make_unique<PluginLoader>(m_Entry.libraryPath, true);
+    const AbstractPlugin* plugin = loader->getPlugin();
+    if(plugin != nullptr && plugin->getId() != m_Entry.pluginId)
+    {
+      fmt::print("Library '{}' contains plugin '{}' instead of plugin '{}' recorded in the plugin manifest\n", m_Entry.libraryPath.string(), plugin->getId().str(), m_Entry.pluginId.str());
+      return nullptr;
+    }
+    m_Loader = std::move(loader);
+  }
+  return m_Loader != nullptr ? m_Loader->getPlugin() : nullptr;
+}
+
+bool LazyPluginLoader::isLoaded() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Loader != nullptr && m_Loader->isLoaded();
+}
+
+AbstractPlugin* LazyPluginLoader::getPlugin()
+{
+  return loadPlugin();
+}
+
+const AbstractPlugin* LazyPluginLoader::getPlugin() const
+{
+  return loadPlugin();
+}
+
+Uuid LazyPluginLoader::getPluginId() const
+{
+  return m_Entry.pluginId;
+}
+
+std::string LazyPluginLoader::getPluginName() const
+{
+  return m_Entry.name;
+}
+
+AbstractPlugin::FilterContainerType LazyPluginLoader::getFilterHandles() const
+{
+  return AbstractPlugin::FilterContainerType(m_Entry.filterHandles.cbegin(), m_Entry.filterHandles.cend());
+}
+
+bool LazyPluginLoader::containsFilterId(const Uuid& filterId) const
+{
+  return std::any_of(m_Entry.filterHandles.cbegin(), m_Entry.filterHandles.cend(), [&filterId](const FilterHandle& handle) { return handle.getFilterId() == filterId; });
+}
+
+bool LazyPluginLoader::containsSimplFilterId(const Uuid& simplFilterId) const
+{
+  return m_Entry.simplToSimplnxUuids.count(simplFilterId) > 0;
+}
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "simplnx/Plugin/AbstractPlugin.hpp"
+#include "simplnx/Plugin/PluginManifest.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
 
 namespace nx::core
 {
@@ -19,6 +21,39 @@ public:
 
   virtual const AbstractPlugin* getPlugin() const = 0;
 
+  /**
+   * @brief Returns the ID of the plugin. Returns an empty Uuid if the plugin is not available.
+   * The default implementation asks the loaded plugin.
+   * @return Uuid
+   */
+  virtual Uuid getPluginId() const;
+
+  /**
+   * @brief Returns the name of the plugin. The default implementation asks the loaded plugin.
+   * @return std::string
+   */
+  virtual std::string getPluginName() const;
+
+  /**
+   * @brief Returns the FilterHandles of the plugin's filters. The default implementation asks the loaded plugin.
+   * @return AbstractPlugin::FilterContainerType
+   */
+  virtual AbstractPlugin::FilterContainerType getFilterHandles() const;
+
+  /**
+   * @brief Returns true if the plugin contains the filter with the given ID. The default implementation asks the loaded plugin.
+   * @param filterId
+   * @return bool
+   */
+  virtual bool containsFilterId(const Uuid& filterId) const;
+
+  /**
+   * @brief Returns true if the plugin converts the SIMPL filter with the given ID. The default implementation asks the loaded plugin.
+   * @param simplFilterId
+   * @return bool
+   */
+  virtual bool containsSimplFilterId(const Uuid& simplFilterId) const;
+
 protected:
   IPluginLoader() = default;
 };
@@ -65,10 +100,13 @@ public:
   /**
    * @brief Constructs a PluginLoader targeting the specified path.
    * The plugin is loaded upon construction and unloaded when the object is
-   * destroyed.
+   * destroyed. If lazyBinding is true, the library's symbols are resolved when
+   * they are first used instead of when the library is loaded where the
+   * platform supports it.
    * @param path
+   * @param lazyBinding
    */
-  PluginLoader(const std::filesystem::path& path);
+  PluginLoader(const std::filesystem::path& path, bool lazyBinding = false);
 
   ~PluginLoader() noexcept override;
 
@@ -104,7 +142,71 @@ private:
   ////////////
   // Variables
   std::filesystem::path m_Path;
+  bool m_LazyBinding = false;
   void* m_Handle = nullptr;
   std::shared_ptr<AbstractPlugin> m_Plugin;
 };
+
+/**
+ * @class LazyPluginLoader
+ * @brief The LazyPluginLoader class answers questions about a plugin from its PluginManifest entry and
+ * only loads the plugin library, with lazy symbol binding, the first time the plugin itself is requested,
+ * such as when one of its filters is created.
+ */
+class SIMPLNX_EXPORT LazyPluginLoader : public IPluginLoader
+{
+public:
+  /**
+   * @brief Constructs a LazyPluginLoader for the library described by the manifest entry. The library is not loaded.
+   * @param entry
+   */
+  LazyPluginLoader(PluginManifest::Entry entry);
+
+  ~LazyPluginLoader() noexcept override;
+
+  /**
+   * @brief Returns true if the plugin library has been loaded. Returns false otherwise.
+   * @return bool
+   */
+  bool isLoaded() const override;
+
+  /**
+   * @brief Loads the plugin library if it has not been loaded yet and returns the plugin.
+   * Returns nullptr if the library could not be loaded.
+   * @return AbstractPlugin*
+   */
+  AbstractPlugin* getPlugin() override;
+
+  /**
+   * @brief Loads the plugin library if it has not been loaded yet and returns the plugin.
+   * Returns nullptr if the library could not be loaded.
+   * @return const AbstractPlugin*
+   */
+  const AbstractPlugin* getPlugin() const override;
+
+  Uuid getPluginId() const override;
+
+  std::string getPluginName() const override;
+
+  AbstractPlugin::FilterContainerType getFilterHandles() const override;
+
+  bool containsFilterId(const Uuid& filterId) const override;
+
+  bool containsSimplFilterId(const Uuid& simplFilterId) const override;
+
+private:
+  /**
+   * @brief Loads the plugin library the first time it is called. Returns nullptr if the library could not be
+   * loaded or does not contain the plugin recorded in the manifest.
+   * @return AbstractPlugin*
+   */
+  AbstractPlugin* loadPlugin() const;
+
+  ////////////
+  // Variables
+  PluginManifest::Entry m_Entry;
+  mutable std::mutex m_Mutex;
+  mutable std::unique_ptr<PluginLoader> m_Loader;
+  mutable bool m_LoadAttempted = false;
+};
 } // namespace nx::core
@@ -0,0 +1,275 @@
+#include "PluginManifest.hpp"
+
+#include "simplnx/Plugin/AbstractPlugin.hpp"
+
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <random>
+#include <system_error>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_FileCouldNotOpen_Code = -4560;
+constexpr int32 k_JsonParseError_Code = -4561;
+constexpr int32 k_InvalidEntry_Code = -4562;
+constexpr int32 k_FileCouldNotWrite_Code = -4563;
+
+constexpr StringLiteral k_VersionKey = "version";
+constexpr StringLiteral k_PluginsKey = "plugins";
+constexpr StringLiteral k_LibraryKey = "library";
+constexpr StringLiteral k_LibrarySizeKey = "library_size";
+constexpr StringLiteral k_LibraryWriteTimeKey = "library_write_time";
+constexpr StringLiteral k_PluginIdKey = "uuid";
+constexpr StringLiteral k_NameKey = "name";
+constexpr StringLiteral k_DescriptionKey = "description";
+constexpr StringLiteral k_VendorKey = "vendor";
+constexpr StringLiteral k_HasDataIOManagersKey = "has_data_io_managers";
+constexpr StringLiteral k_FiltersKey = "filters";
+constexpr StringLiteral k_FilterIdKey = "uuid";
+constexpr StringLiteral k_FilterNameKey = "name";
+constexpr StringLiteral k_ClassNameKey = "class_name";
+constexpr StringLiteral k_DefaultTagsKey = "default_tags";
+constexpr StringLiteral k_SimplUuidsKey = "simpl_uuids";
+
+/**
+ * @brief Returns the size and modification time of a file, or {0, 0} if they cannot be read.
+ */
+std::pair<uintmax_t, int64> GetFileStamp(const std::filesystem::path& path)
+{
+  std::error_code errorCode;
+  const uintmax_t size = std::filesystem::file_size(path, errorCode);
+  if(errorCode)
+  {
+    return {0, 0};
+  }
+  const auto writeTime = std::filesystem::last_write_time(path, errorCode);
+  if(errorCode)
+  {
+    return {0, 0};
+  }
+  return {size, static_cast<int64>(writeTime.time_since_epoch().count())};
+}
+
+Result<Uuid> ParseUuid(const nlohmann::json& json, std::string_view key)
+{
+  if(!json.contains(key) || !json[key].is_string())
+  {
+    return MakeErrorResult<Uuid>(k_InvalidEntry_Code, fmt::format("Plugin manifest entry is missing the UUID '{}'", key));
+  }
+  std::optional<Uuid> uuid = Uuid::FromString(json[key].get<std::string>());
+  if(!uuid.has_value())
+  {
+    return MakeErrorResult<Uuid>(k_InvalidEntry_Code, fmt::format("Plugin manifest entry has an invalid UUID '{}'", json[key].get<std::string>()));
+  }
+  return {*uuid};
+}
+} // namespace
+
+bool PluginManifest::Entry::isCurrent() const
+{
+  const auto [size, writeTime] = GetFileStamp(libraryPath);
+  return size != 0 && size == librarySize && writeTime == libraryWriteTime;
+}
+
+PluginManifest::Entry PluginManifest::CreateEntry(const AbstractPlugin& plugin, const std::filesystem::path& libraryPath)
+{
+  Entry entry;
+  entry.libraryPath = libraryPath;
+  std::tie(entry.librarySize, entry.libraryWriteTime) = GetFileStamp(libraryPath);
+  entry.pluginId = plugin.getId();
+  entry.name = plugin.getName();
+  entry.description = plugin.getDescription();
+  entry.vendor = plugin.getVendor();
+  entry.hasDataIOManagers = !plugin.getDataIOManagers().empty();
+
+  AbstractPlugin::FilterContainerType filterHandles = plugin.getFilterHandles();
+  entry.filterHandles.assign(filterHandles.cbegin(), filterHandles.cend());
+  for(const auto& [simplUuid, simplData] : plugin.getSimplToSimplnxMap())
+  {
+    entry.simplToSimplnxUuids[simplUuid] = simplData.simplnxUuid;
+  }
+  return entry;
+}
+
+Result<PluginManifest> PluginManifest::ReadFile(const std::filesystem::path& filepath)
+{
+  std::ifstream fileStream(filepath);
+  if(!fileStream.is_open())
+  {
+    return MakeErrorResult<PluginManifest>(k_FileCouldNotOpen_Code, fmt::format("Could not open plugin manifest '{}'", filepath.string()));
+  }
+
+  nlohmann::json json = nlohmann::json::parse(fileStream, nullptr, false);
+  if(json.is_discarded())
+  {
+    return MakeErrorResult<PluginManifest>(k_JsonParseError_Code, fmt::format("Could not parse plugin manifest '{}'", filepath.string()));
+  }
+  return FromJson(json);
+}
+
+Result<> PluginManifest::writeFile(const std::filesystem::path& filepath) const
+{
+  // The manifest is written next to the target and renamed over it, so a concurrent reader or an interrupted write never sees a partial file.
+  // The random suffix keeps processes that write the same manifest at once from sharing a temporary file.
+  std::random_device randomDevice;
+  std::filesystem::path tempPath = filepath;
+  tempPath += fmt::format(".{:08x}.tmp", randomDevice());
+  {
+    std::ofstream fileStream(tempPath, std::ios_base::out | std::ios_base::trunc);
+    if(!fileStream.is_open())
+    {
+      return MakeErrorResult(k_FileCouldNotOpen_Code, fmt::format("Could not open plugin manifest '{}' for writing", tempPath.string()));
+    }
+    fileStream << toJson().dump(2);
+    fileStream.close();
+    if(fileStream.fail())
+    {
+      std::error_code errorCode;
+      std::filesystem::remove(tempPath, errorCode);
+      return MakeErrorResult(k_FileCouldNotWrite_Code, fmt::format("Could not write plugin manifest '{}'", tempPath.string()));
+    }
+  }
+
+  std::error_code errorCode;
+  std::filesystem::rename(tempPath, filepath, errorCode);
+  if(errorCode)
+  {
+    std::error_code removeErrorCode;
+    std::filesystem::remove(tempPath, removeErrorCode);
+    return MakeErrorResult(k_FileCouldNotWrite_Code, fmt::format("Could not replace plugin manifest '{}': {}", filepath.string(), errorCode.message()));
+  }
+  return {};
+}
+
+const PluginManifest::Entry* PluginManifest::findCurrentEntry(const std::filesystem::path& libraryPath) const
+{
+  auto iter = m_Entries.find(libraryPath.filename().string());
+  if(iter == m_Entries.cend())
+  {
+    return nullptr;
+  }
+  const Entry& entry = iter->second;
+  if(entry.libraryPath != libraryPath || !entry.isCurrent())
+  {
+    return nullptr;
+  }
+  return &entry;
+}
+
+void PluginManifest::setEntry(Entry entry)
+{
+  std::string fileName = entry.libraryPath.filename().string();
+  m_Entries.insert_or_assign(std::move(fileName), std::move(entry));
+}
+
+const std::map<std::string, PluginManifest::Entry>& PluginManifest::getEntries() const
+{
+  return m_Entries;
+}
+
+nlohmann::json PluginManifest::toJson() const
+{
+  nlohmann::json pluginsJson = nlohmann::json::array();
+  for(const auto& [fileName, entry] : m_Entries)
+  {
+    nlohmann::json filtersJson = nlohmann::json::array();
+    for(const FilterHandle& handle : entry.filterHandles)
+    {
+      nlohmann::json filterJson;
+      filterJson[k_FilterIdKey] = handle.getFilterId().str();
+      filterJson[k_FilterNameKey] = handle.getFilterName();
+      filterJson[k_ClassNameKey] = handle.getClassName();
+      filterJson[k_DefaultTagsKey] = handle.getDefaultTags();
+      filtersJson.push_back(std::move(filterJson));
+    }
+
+    nlohmann::json simplUuidsJson = nlohmann::json::object();
+    for(const auto& [simplUuid, simplnxUuid] : entry.simplToSimplnxUuids)
+    {
+      simplUuidsJson[simplUuid.str()] = simplnxUuid.str();
+    }
+
+    nlohmann::json pluginJson;
+    pluginJson[k_LibraryKey] = entry.libraryPath.string();
+    pluginJson[k_LibrarySizeKey] = entry.librarySize;
+    pluginJson[k_LibraryWriteTimeKey] = entry.libraryWriteTime;
+    pluginJson[k_PluginIdKey] = entry.pluginId.str();
+    pluginJson[k_NameKey] = entry.name;
+    pluginJson[k_DescriptionKey] = entry.description;
+    pluginJson[k_VendorKey] = entry.vendor;
+    pluginJson[k_HasDataIOManagersKey] = entry.hasDataIOManagers;
+    pluginJson[k_FiltersKey] = std::move(filtersJson);
+    pluginJson[k_SimplUuidsKey] = std::move(simplUuidsJson);
+    pluginsJson.push_back(std::move(pluginJson));
+  }
+
+  nlohmann::json json;
+  json[k_VersionKey] = k_Version;
+  json[k_PluginsKey] = std::move(pluginsJson);
+  return json;
+}
+
+Result<PluginManifest> PluginManifest::FromJson(const nlohmann::json& json)
+{
+  PluginManifest manifest;
+  // A manifest from another version is treated as empty so that it is rebuilt
+  if(!json.is_object() || json.value(k_VersionKey.str(), 0) != k_Version || !json.contains(k_PluginsKey) || !json[k_PluginsKey].is_array())
+  {
+    return {std::move(manifest)};
+  }
+
+  try
+  {
+    for(const auto& pluginJson : json[k_PluginsKey])
+    {
+      Result<Uuid> pluginIdResult = ParseUuid(pluginJson, k_PluginIdKey);
+      if(pluginIdResult.invalid())
+      {
+        return ConvertResultTo<PluginManifest>(ConvertResult(std::move(pluginIdResult)), {});
+      }
+
+      Entry entry;
+      entry.libraryPath = pluginJson.at(k_LibraryKey).get<std::string>();
+      entry.librarySize = pluginJson.at(k_LibrarySizeKey).get<uintmax_t>();
+      entry.libraryWriteTime = pluginJson.at(k_LibraryWriteTimeKey).get<int64>();
+      entry.pluginId = pluginIdResult.value();
+      entry.name = pluginJson.at(k_NameKey).get<std::string>();
+      entry.description = pluginJson.at(k_DescriptionKey).get<std::string>();
+      entry.vendor = pluginJson.at(k_VendorKey).get<std::string>();
+      entry.hasDataIOManagers = pluginJson.at(k_HasDataIOManagersKey).get<bool>();
+
+      for(const auto& filterJson : pluginJson.at(k_FiltersKey))
+      {
+        Result<Uuid> filterIdResult = ParseUuid(filterJson, k_FilterIdKey);
+        if(filterIdResult.invalid())
+        {
+          return ConvertResultTo<PluginManifest>(ConvertResult(std::move(filterIdResult)), {});
+        }
+        entry.filterHandles.emplace_back(filterIdResult.value(), entry.pluginId, filterJson.at(k_FilterNameKey).get<std::string>(), filterJson.at(k_ClassNameKey).get<std::string>(),
+                                         filterJson.at(k_DefaultTagsKey).get<std::vector<std::string>>());
+      }
+
+      for(const auto& [simplUuidString, simplnxUuidJson] : pluginJson.at(k_SimplUuidsKey).items())
+      {
+        std::optional<Uuid> simplUuid = Uuid::FromString(simplUuidString);
+        std::optional<Uuid> simplnxUuid = Uuid::FromString(simplnxUuidJson.get<std::string>());
+        if(!simplUuid.has_value() || !simplnxUuid.has_value())
+        {
+          return MakeErrorResult<PluginManifest>(k_InvalidEntry_Code, fmt::format("Plugin manifest entry '{}' has an invalid SIMPL UUID conversion", entry.name));
+        }
+        entry.simplToSimplnxUuids[*simplUuid] = *simplnxUuid;
+      }
+
+      manifest.setEntry(std::move(entry));
+    }
+  } catch(const nlohmann::json::exception& exception)
+  {
+    return MakeErrorResult<PluginManifest>(k_InvalidEntry_Code, fmt::format("Invalid plugin manifest entry: {}", exception.what()));
+  }
+
+  return {std::move(manifest)};
+}
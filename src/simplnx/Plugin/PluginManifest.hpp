@@ -0,0 +1,112 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Uuid.hpp"
+#include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+class AbstractPlugin;
+
+/**
+ * @class PluginManifest
+ * @brief The PluginManifest class caches what the Application needs to know about each plugin library
+ * without loading it: the plugin's UUID and names, the FilterHandles of its filters and its SIMPL to
+ * simplnx UUID conversions. Entries are keyed by the library file name and are only used while the
+ * size and modification time of the library match the recorded ones.
+ */
+class SIMPLNX_EXPORT PluginManifest
+{
+public:
+  static inline constexpr int32 k_Version = 1;
+  static inline constexpr char k_DefaultFileName[] = "simplnx_plugin_manifest.json";
+
+  struct SIMPLNX_EXPORT Entry
+  {
+    std::filesystem::path libraryPath;
+    uintmax_t librarySize = 0;
+    int64 libraryWriteTime = 0;
+
+    Uuid pluginId;
+    std::string name;
+    std::string description;
+    std::string vendor;
+    bool hasDataIOManagers = false;
+
+    std::vector<FilterHandle> filterHandles;
+    std::map<Uuid, Uuid> simplToSimplnxUuids;
+
+    /**
+     * @brief Returns true if the library at libraryPath still has the recorded size and modification time.
+     * @return bool
+     */
+    bool isCurrent() const;
+  };
+
+  /**
+   * @brief Records the information of a loaded plugin along with the size and modification time of its library.
+   * @param plugin
+   * @param libraryPath
+   * @return Entry
+   */
+  static Entry CreateEntry(const AbstractPlugin& plugin, const std::filesystem::path& libraryPath);
+
+  /**
+   * @brief Reads a manifest written by writeFile(). Manifests written by another version are returned empty.
+   * @param filepath
+   * @return Result<PluginManifest>
+   */
+  static Result<PluginManifest> ReadFile(const std::filesystem::path& filepath);
+
+  /**
+   * @brief Writes the manifest as JSON to a temporary file in the same directory and renames it over filepath.
+   * @param filepath
+   * @return Result<>
+   */
+  Result<> writeFile(const std::filesystem::path& filepath) const;
+
+  /**
+   * @brief Returns the entry of the library at libraryPath if there is one and it is still current. Returns nullptr otherwise.
+   * @param libraryPath
+   * @return const Entry*
+   */
+  const Entry* findCurrentEntry(const std::filesystem::path& libraryPath) const;
+
+  /**
+   * @brief Adds the entry, replacing any entry for a library with the same file name.
+   * @param entry
+   */
+  void setEntry(Entry entry);
+
+  /**
+   * @brief Returns the entries keyed by library file name.
+   * @return const std::map<std::string, Entry>&
+   */
+  const std::map<std::string, Entry>& getEntries() const;
+
+  /**
+   * @brief Returns the manifest as JSON.
+   * @return nlohmann::json
+   */
+  nlohmann::json toJson() const;
+
+  /**
+   * @brief Creates a manifest from JSON returned by toJson().
+   * @param json
+   * @return Result<PluginManifest>
+   */
+  static Result<PluginManifest> FromJson(const nlohmann::json& json);
+
+private:
+  std::map<std::string, Entry> m_Entries;
+};
+} // namespace nx::core
@@ -0,0 +1,408 @@
+#include "ArrayThresholdEvaluator.hpp"
+
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <functional>
+#include <memory>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_MissingArrayError = -4010;
+constexpr int32 k_NonScalarArrayError = -4011;
+constexpr int32 k_UnequalTuplesError = -4012;
+constexpr int32 k_UnknownComparisonError = -4013;
+constexpr int32 k_UnknownThresholdError = -4014;
+constexpr int32 k_EvaluateBlockError = -4015;
+
+/**
+ * @brief Creates the kernel for a single comparison. In memory DataStores are compared
+ * directly on their contiguous buffer so the loop can be vectorized by the compiler. Any
+ * other store is copied into a buffer one block at a time first.
+ */
+template <typename T, class CompareT>
+ArrayThresholdEvaluator::KernelType CreateComparisonKernel(const AbstractDataStore<T>& store, T value)
+{
+  const T* data = DataStoreUtilities::GetContiguousData(store);
+  if(data != nullptr)
+  {
+    return [data, value](usize start, usize count, uint8* output) -> Result<> {
+      const CompareT compare;
+      const T* values = data + start;
+      for(usize i = 0; i < count; i++)
+      {
+        output[i] = static_cast<uint8>(compare(values[i], value));
+      }
+      return {};
+    };
+  }
+
+  return [&store, value](usize start, usize count, uint8* output) -> Result<> {
+    return DataStoreUtilities::ReadBlocks(store, start, start + count, [value, start, output](usize blockStart, nonstd::span<const T> values) {
+      const CompareT compare;
+      uint8* blockOutput = output + (blockStart - start);
+      for(usize i = 0; i < values.size(); i++)
+      {
+        blockOutput[i] = static_cast<uint8>(compare(values[i], value));
+      }
+    });
+  };
+}
+
+struct CreateComparisonKernelFunctor
+{
+  template <typename T>
+  Result<ArrayThresholdEvaluator::KernelType> operator()(const IDataArray& inputArray, ArrayThreshold::ComparisonType comparisonType, ArrayThreshold::ComparisonValue comparisonValue)
+  {
+    const auto& store = inputArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    const T value = static_cast<T>(comparisonValue);
+    switch(comparisonType)
+    {
+    case ArrayThreshold::ComparisonType::LessThan:
+      return {CreateComparisonKernel<T, std::less<T>>(store, value)};
+    case ArrayThreshold::ComparisonType::GreaterThan:
+      return {CreateComparisonKernel<T, std::greater<T>>(store, value)};
+    case ArrayThreshold::ComparisonType::Operator_Equal:
+      return {CreateComparisonKernel<T, std::equal_to<T>>(store, value)};
+    case ArrayThreshold::ComparisonType::Operator_NotEqual:
+      return {CreateComparisonKernel<T, std::not_equal_to<T>>(store, value)};
+    }
+    return MakeErrorResult<ArrayThresholdEvaluator::KernelType>(k_UnknownComparisonError,
+                                                                fmt::format("Threshold Comparison Operator not understood: '{}'", static_cast<int>(comparisonType)));
+  }
+};
+
+template <typename T>
+class EvaluateThresholdBlocksImpl
+{
+public:
+  EvaluateThresholdBlocksImpl(const ArrayThresholdEvaluator& evaluator, AbstractDataStore<T>& outputStore, T trueValue, T falseValue, std::atomic_bool& failed,
+                              const std::atomic_bool& shouldCancel)
+  : m_Evaluator(evaluator)
+  , m_OutputStore(outputStore)
+  , m_OutputData(nullptr)
+  , m_TrueValue(trueValue)
+  , m_FalseValue(falseValue)
+  , m_Failed(failed)
+  , m_ShouldCancel(shouldCancel)
+  {
+    m_OutputData = DataStoreUtilities::GetContiguousData(outputStore);
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numTuples = m_Evaluator.getNumberOfTuples();
+    std::vector<uint8> block(ArrayThresholdEvaluator::k_BlockSize);
+    std::vector<uint8> scratch(m_Evaluator.getScratchSize());
+    std::unique_ptr<T[]> outputBlock = m_OutputData == nullptr ? std::make_unique<T[]>(ArrayThresholdEvaluator::k_BlockSize) : nullptr;
+    for(usize blockIndex = range.min(); blockIndex < range.max(); blockIndex++)
+    {
+      if(m_ShouldCancel || m_Failed)
+      {
+        return;
+      }
+      const usize start = blockIndex * ArrayThresholdEvaluator::k_BlockSize;
+      const usize count = std::min(ArrayThresholdEvaluator::k_BlockSize, numTuples - start);
+      if(m_Evaluator.evaluateBlock(start, count, block.data(), scratch.data()).invalid())
+      {
+        m_Failed = true;
+        return;
+      }
+
+      T* output = m_OutputData != nullptr ? m_OutputData + start : outputBlock.get();
+      for(usize i = 0; i < count; i++)
+      {
+        output[i] = block[i] != 0 ? m_TrueValue : m_FalseValue;
+      }
+      if(m_OutputData == nullptr && m_OutputStore.copyFromBuffer(start, nonstd::span<const T>(output, count)).invalid())
+      {
+        m_Failed = true;
+        return;
+      }
+    }
+  }
+
+private:
+  const ArrayThresholdEvaluator& m_Evaluator;
+  AbstractDataStore<T>& m_OutputStore;
+  T* m_OutputData = nullptr;
+  T m_TrueValue;
+  T m_FalseValue;
+  std::atomic_bool& m_Failed;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+class EvaluatePackedBlocksImpl
+{
+public:
+  EvaluatePackedBlocksImpl(const ArrayThresholdEvaluator& evaluator, std::vector<uint64>& output, std::atomic_bool& failed, const std::atomic_bool& shouldCancel)
+  : m_Evaluator(evaluator)
+  , m_Output(output)
+  , m_Failed(failed)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numTuples = m_Evaluator.getNumberOfTuples();
+    std::vector<uint8> block(ArrayThresholdEvaluator::k_BlockSize);
+    std::vector<uint8> scratch(m_Evaluator.getScratchSize());
+    for(usize blockIndex = range.min(); blockIndex < range.max(); blockIndex++)
+    {
+      if(m_ShouldCancel || m_Failed)
+      {
+        return;
+      }
+      const usize start = blockIndex * ArrayThresholdEvaluator::k_BlockSize;
+      const usize count = std::min(ArrayThresholdEvaluator::k_BlockSize, numTuples - start);
+      if(m_Evaluator.evaluateBlock(start, count, block.data(), scratch.data()).invalid())
+      {
+        m_Failed = true;
+        return;
+      }
+
+      // k_BlockSize is a multiple of 64 so this block owns all the words it writes
+      uint64* words = m_Output.data() + (start / 64);
+      for(usize i = 0; i < count; i += 64)
+      {
+        const usize bitCount = std::min<usize>(64, count - i);
+        uint64 word = 0;
+        for(usize bit = 0; bit < bitCount; bit++)
+        {
+          word |= static_cast<uint64>(block[i + bit]) << bit;
+        }
+        words[i / 64] = word;
+      }
+    }
+  }
+
+private:
+  const ArrayThresholdEvaluator& m_Evaluator;
+  std::vector<uint64>& m_Output;
+  std::atomic_bool& m_Failed;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+struct EvaluateThresholdFunctor
+{
+  template <typename T>
+  void operator()(const ArrayThresholdEvaluator& evaluator, IDataArray& outputArray, float64 trueValue, float64 falseValue, std::atomic_bool& failed, const std::atomic_bool& shouldCancel)
+  {
+    auto& outputStore = outputArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    const usize numBlocks = (evaluator.getNumberOfTuples() + ArrayThresholdEvaluator::k_BlockSize - 1) / ArrayThresholdEvaluator::k_BlockSize;
+
+    IParallelAlgorithm::AlgorithmArrays algArrays = evaluator.getInputArrays();
+    algArrays.push_back(&outputArray);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.requireArraysInMemory(algArrays);
+    dataAlg.execute(EvaluateThresholdBlocksImpl<T>(evaluator, outputStore, static_cast<T>(trueValue), static_cast<T>(falseValue), failed, shouldCancel));
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<ArrayThresholdEvaluator> ArrayThresholdEvaluator::Create(const DataStructure& dataStructure, const ArrayThresholdSet& thresholds)
+{
+  ArrayThresholdEvaluator evaluator;
+  auto compileResult = evaluator.compile(dataStructure, thresholds, 0);
+  if(compileResult.invalid())
+  {
+    return ConvertInvalidResult<ArrayThresholdEvaluator>(std::move(compileResult));
+  }
+  return {std::move(evaluator)};
+}
+
+// -----------------------------------------------------------------------------
+Result<usize> ArrayThresholdEvaluator::compile(const DataStructure& dataStructure, const IArrayThreshold& threshold, usize depth)
+{
+  m_MaxDepth = std::max(m_MaxDepth, depth);
+
+  const usize nodeIndex = m_Nodes.size();
+  m_Nodes.push_back({});
+  m_Nodes[nodeIndex].unionOperator = threshold.getUnionOperator();
+  m_Nodes[nodeIndex].inverted = threshold.isInverted();
+
+  if(const auto* thresholdSet = dynamic_cast<const ArrayThresholdSet*>(&threshold); thresholdSet != nullptr)
+  {
+    for(const std::shared_ptr<IArrayThreshold>& childThreshold : thresholdSet->getArrayThresholds())
+    {
+      if(childThreshold == nullptr)
+      {
+        continue;
+      }
+      auto childResult = compile(dataStructure, *childThreshold, depth + 1);
+      if(childResult.invalid())
+      {
+        return childResult;
+      }
+      // 'm_Nodes' may have been reallocated by the recursive call
+      m_Nodes[nodeIndex].children.push_back(childResult.value());
+    }
+    return {nodeIndex};
+  }
+
+  const auto* arrayThreshold = dynamic_cast<const ArrayThreshold*>(&threshold);
+  if(arrayThreshold == nullptr)
+  {
+    return MakeErrorResult<usize>(k_UnknownThresholdError, "Threshold is neither an ArrayThreshold nor an ArrayThresholdSet");
+  }
+
+  const DataPath arrayPath = arrayThreshold->getArrayPath();
+  const auto* inputArray = dataStructure.getDataAs<IDataArray>(arrayPath);
+  if(inputArray == nullptr)
+  {
+    return MakeErrorResult<usize>(k_MissingArrayError, fmt::format("Could not find DataArray at path {}.", arrayPath.toString()));
+  }
+  if(inputArray->getNumberOfComponents() != 1)
+  {
+    return MakeErrorResult<usize>(k_NonScalarArrayError, fmt::format("Data Array '{}' is not a scalar Data Array.", arrayPath.toString()));
+  }
+  if(m_InputArrays.empty())
+  {
+    m_NumTuples = inputArray->getNumberOfTuples();
+  }
+  else if(m_NumTuples != inputArray->getNumberOfTuples())
+  {
+    return MakeErrorResult<usize>(k_UnequalTuplesError,
+                                  fmt::format("Data Array '{}' has {} tuples but {} tuples were expected.", arrayPath.toString(), inputArray->getNumberOfTuples(), m_NumTuples));
+  }
+  m_InputArrays.push_back(inputArray);
+
+  auto kernelResult = ExecuteDataFunction(CreateComparisonKernelFunctor{}, inputArray->getDataType(), *inputArray, arrayThreshold->getComparisonType(), arrayThreshold->getComparisonValue());
+  if(kernelResult.invalid())
+  {
+    return ConvertInvalidResult<usize>(std::move(kernelResult));
+  }
+  m_Nodes[nodeIndex].kernel = std::move(kernelResult.value());
+  return {nodeIndex};
+}
+
+// -----------------------------------------------------------------------------
+usize ArrayThresholdEvaluator::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+const IParallelAlgorithm::AlgorithmArrays& ArrayThresholdEvaluator::getInputArrays() const
+{
+  return m_InputArrays;
+}
+
+// -----------------------------------------------------------------------------
+usize ArrayThresholdEvaluator::getScratchSize() const
+{
+  return (m_MaxDepth + 1) * k_BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+Result<> ArrayThresholdEvaluator::evaluateBlock(usize start, usize count, uint8* output, uint8* scratch) const
+{
+  if(m_Nodes.empty())
+  {
+    std::fill_n(output, count, static_cast<uint8>(0));
+    return {};
+  }
+  return evaluateNode(0, 0, start, count, output, scratch);
+}
+
+// -----------------------------------------------------------------------------
+Result<> ArrayThresholdEvaluator::evaluateNode(usize nodeIndex, usize depth, usize start, usize count, uint8* output, uint8* scratch) const
+{
+  const Node& node = m_Nodes[nodeIndex];
+  if(node.kernel)
+  {
+    Result<> kernelResult = node.kernel(start, count, output);
+    if(kernelResult.invalid())
+    {
+      return kernelResult;
+    }
+  }
+  else if(node.children.empty())
+  {
+    std::fill_n(output, count, static_cast<uint8>(0));
+  }
+  else
+  {
+    // The first threshold of a set is written straight into the output, every following
+    // threshold is evaluated into this depth's scratch block and then merged in.
+    Result<> childResult = evaluateNode(node.children.front(), depth + 1, start, count, output, scratch);
+    if(childResult.invalid())
+    {
+      return childResult;
+    }
+    uint8* childOutput = scratch + (depth * k_BlockSize);
+    for(usize childIndex = 1; childIndex < node.children.size(); childIndex++)
+    {
+      const usize child = node.children[childIndex];
+      childResult = evaluateNode(child, depth + 1, start, count, childOutput, scratch);
+      if(childResult.invalid())
+      {
+        return childResult;
+      }
+      if(m_Nodes[child].unionOperator == IArrayThreshold::UnionOperator::Or)
+      {
+        for(usize i = 0; i < count; i++)
+        {
+          output[i] |= childOutput[i];
+        }
+      }
+      else
+      {
+        for(usize i = 0; i < count; i++)
+        {
+          output[i] &= childOutput[i];
+        }
+      }
+    }
+  }
+
+  if(node.inverted)
+  {
+    for(usize i = 0; i < count; i++)
+    {
+      output[i] ^= 1;
+    }
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> ArrayThresholdEvaluator::evaluate(IDataArray& outputArray, float64 trueValue, float64 falseValue, const std::atomic_bool& shouldCancel) const
+{
+  std::atomic_bool failed = false;
+  ExecuteDataFunction(EvaluateThresholdFunctor{}, outputArray.getDataType(), *this, outputArray, trueValue, falseValue, failed, shouldCancel);
+  if(failed)
+  {
+    return MakeErrorResult(k_EvaluateBlockError, "Unable to read the threshold arrays or write the threshold output array.");
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<std::vector<uint64>> ArrayThresholdEvaluator::evaluatePacked(const std::atomic_bool& shouldCancel) const
+{
+  std::vector<uint64> output((m_NumTuples + 63) / 64, 0);
+  const usize numBlocks = (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.requireArraysInMemory(m_InputArrays);
+  std::atomic_bool failed = false;
+  dataAlg.execute(EvaluatePackedBlocksImpl(*this, output, failed, shouldCancel));
+  if(failed)
+  {
+    return MakeErrorResult<std::vector<uint64>>(k_EvaluateBlockError, "Unable to read the values of one of the threshold arrays.");
+  }
+  return {std::move(output)};
+}
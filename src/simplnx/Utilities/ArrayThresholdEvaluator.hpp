@@ -0,0 +1,126 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Utilities/ArrayThreshold.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class ArrayThresholdEvaluator
+ * @brief The ArrayThresholdEvaluator class compiles an ArrayThresholdSet into a flat
+ * expression tree where every ArrayThreshold becomes a typed comparison kernel. The whole
+ * tree is then evaluated one block of tuples at a time, so each input array is read once,
+ * no full size temporary arrays are created and the blocks can be evaluated in parallel.
+ *
+ * The value of a set is the result of its own thresholds combined from top to bottom using
+ * the union operator of each threshold. The union operator of the first threshold in a set
+ * is ignored. A threshold or set that is inverted has its result inverted before it is
+ * combined with the rest of its parent set.
+ */
+class SIMPLNX_EXPORT ArrayThresholdEvaluator
+{
+public:
+  /**
+   * @brief Number of tuples evaluated together. This is a multiple of 64 so that the
+   * blocks of a bit-packed result never share a word.
+   */
+  static inline constexpr usize k_BlockSize = 4096;
+
+  /**
+   * @brief Writes the comparison result (1 = true, 0 = false) for 'count' tuples
+   * starting at 'start' into 'output'. Fails if the input values could not be read.
+   */
+  using KernelType = std::function<Result<>(usize start, usize count, uint8* output)>;
+
+  struct Node
+  {
+    KernelType kernel;
+    std::vector<usize> children;
+    IArrayThreshold::UnionOperator unionOperator = IArrayThreshold::UnionOperator::And;
+    bool inverted = false;
+  };
+
+  ArrayThresholdEvaluator() = default;
+  ~ArrayThresholdEvaluator() noexcept = default;
+
+  ArrayThresholdEvaluator(const ArrayThresholdEvaluator&) = default;
+  ArrayThresholdEvaluator(ArrayThresholdEvaluator&&) noexcept = default;
+  ArrayThresholdEvaluator& operator=(const ArrayThresholdEvaluator&) = default;
+  ArrayThresholdEvaluator& operator=(ArrayThresholdEvaluator&&) noexcept = default;
+
+  /**
+   * @brief Compiles the threshold set against the arrays in the DataStructure. Every
+   * threshold array must exist, be scalar and have the same number of tuples.
+   * @param dataStructure
+   * @param thresholds
+   * @return Result<ArrayThresholdEvaluator>
+   */
+  static Result<ArrayThresholdEvaluator> Create(const DataStructure& dataStructure, const ArrayThresholdSet& thresholds);
+
+  /**
+   * @brief Returns the number of tuples the compiled thresholds operate over.
+   * @return usize
+   */
+  usize getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the input arrays read by the compiled thresholds.
+   * @return IParallelAlgorithm::AlgorithmArrays
+   */
+  const IParallelAlgorithm::AlgorithmArrays& getInputArrays() const;
+
+  /**
+   * @brief Returns the number of scratch bytes needed to evaluate a single block.
+   * @return usize
+   */
+  usize getScratchSize() const;
+
+  /**
+   * @brief Evaluates the tuples [start, start + count) into 'output' where count <= k_BlockSize.
+   * 'scratch' must hold at least getScratchSize() bytes.
+   * @param start
+   * @param count
+   * @param output
+   * @param scratch
+   * @return Result<>
+   */
+  Result<> evaluateBlock(usize start, usize count, uint8* output, uint8* scratch) const;
+
+  /**
+   * @brief Evaluates every tuple and writes trueValue/falseValue into the scalar output array.
+   * @param outputArray
+   * @param trueValue
+   * @param falseValue
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> evaluate(IDataArray& outputArray, float64 trueValue, float64 falseValue, const std::atomic_bool& shouldCancel) const;
+
+  /**
+   * @brief Evaluates every tuple into a bit-packed mask where bit (i % 64) of word (i / 64)
+   * is set when tuple i passes the thresholds.
+   * @param shouldCancel
+   * @return Result<std::vector<uint64>>
+   */
+  Result<std::vector<uint64>> evaluatePacked(const std::atomic_bool& shouldCancel) const;
+
+private:
+  Result<usize> compile(const DataStructure& dataStructure, const IArrayThreshold& threshold, usize depth);
+
+  Result<> evaluateNode(usize nodeIndex, usize depth, usize start, usize count, uint8* output, uint8* scratch) const;
+
+  std::vector<Node> m_Nodes;
+  IParallelAlgorithm::AlgorithmArrays m_InputArrays;
+  usize m_NumTuples = 0;
+  usize m_MaxDepth = 0;
+};
+} // namespace nx::core
@@ -812,7 +812,8 @@ SIMPLNX_EXPORT void InitializeNeighborList(DataStructure& dataStructure, const D
 
 /**
  * @brief These structs and functions are meant to make using a "mask array" or "Good Voxels Array" easier
- * for the developer. There is virtual function call overhead with using these structs and functions.
+ * for the developer. There is virtual function call overhead with using these structs and functions. Loops
+ * that test the mask for every element should use the mask views in simplnx/Utilities/MaskView.hpp instead.
  *
  * An example use of these functions would be the following:
  * @code
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace nx::core::DataStoreUtilities
+{
+/**
+ * @brief Number of values staged at once when a store is not held in contiguous memory.
+ */
+inline constexpr usize k_DefaultBlockSize = 65536;
+
+/**
+ * @brief Returns a pointer to the values of the store if they are held in contiguous memory, otherwise nullptr.
+ * @param store
+ * @return const T*
+ */
+template <typename T>
+const T* GetContiguousData(const AbstractDataStore<T>& store)
+{
+  if(store.getStoreType() != IDataStore::StoreType::InMemory)
+  {
+    return nullptr;
+  }
+  const auto* dataStore = dynamic_cast<const DataStore<T>*>(&store);
+  return dataStore != nullptr ? dataStore->data() : nullptr;
+}
+
+/**
+ * @brief Returns a pointer to the values of the store if they are held in contiguous memory, otherwise nullptr.
+ * @param store
+ * @return T*
+ */
+template <typename T>
+T* GetContiguousData(AbstractDataStore<T>& store)
+{
+  if(store.getStoreType() != IDataStore::StoreType::InMemory)
+  {
+    return nullptr;
+  }
+  auto* dataStore = dynamic_cast<DataStore<T>*>(&store);
+  return dataStore != nullptr ? dataStore->data() : nullptr;
+}
+
+/**
+ * @brief Calls kernel(blockStart, nonstd::span<const T> values) over the values [startIndex, endIndex) of the store.
+ * A contiguous store is handed to the kernel as a single span over its memory. Any other store is copied
+ * into a buffer of at most blockSize values at a time with AbstractDataStore::copyIntoBuffer().
+ * @param store
+ * @param startIndex
+ * @param endIndex
+ * @param kernel
+ * @param blockSize
+ * @return Result<>
+ */
+template <typename T, class KernelT>
+Result<> ReadBlocks(const AbstractDataStore<T>& store, usize startIndex, usize endIndex, KernelT&& kernel, usize blockSize = k_DefaultBlockSize)
+{
+  if(startIndex > endIndex || endIndex > store.getSize())
+  {
+    return MakeErrorResult(-14610, fmt::format("Unable to read the values [{}, {}) of a data store with {} values.", startIndex, endIndex, store.getSize()));
+  }
+  if(startIndex == endIndex)
+  {
+    return {};
+  }
+
+  if(const T* data = GetContiguousData(store); data != nullptr)
+  {
+    kernel(startIndex, nonstd::span<const T>(data + startIndex, endIndex - startIndex));
+    return {};
+  }
+
+  blockSize = std::max<usize>(blockSize, 1);
+  const usize bufferSize = std::min(blockSize, endIndex - startIndex);
+  auto buffer = std::make_unique<T[]>(bufferSize);
+  for(usize blockStart = startIndex; blockStart < endIndex; blockStart += blockSize)
+  {
+    const nonstd::span<T> block(buffer.get(), std::min(blockSize, endIndex - blockStart));
+    Result<> result = store.copyIntoBuffer(blockStart, block);
+    if(result.invalid())
+    {
+      return result;
+    }
+    kernel(blockStart, nonstd::span<const T>(block.data(), block.size()));
+  }
+  return {};
+}
+
+/**
+ * @brief Calls kernel(blockStart, nonstd::span<const T> values) over every value of the store.
+ * @param store
+ * @param kernel
+ * @param blockSize
+ * @return Result<>
+ */
+template <typename T, class KernelT>
+Result<> ReadBlocks(const AbstractDataStore<T>& store, KernelT&& kernel, usize blockSize = k_DefaultBlockSize)
+{
+  return ReadBlocks(store, 0, store.getSize(), std::forward<KernelT>(kernel), blockSize);
+}
+
+/**
+ * @brief Calls kernel(blockStart, nonstd::span<T> values) over the values [startIndex, endIndex) of the store
+ * so that the kernel can modify them in place. A contiguous store is handed to the kernel as a single span over
+ * its memory. Any other store is staged through a buffer of at most blockSize values at a time, which is
+ * written back with AbstractDataStore::copyFromBuffer() after the kernel returns.
+ * @param store
+ * @param startIndex
+ * @param endIndex
+ * @param kernel
+ * @param blockSize
+ * @return Result<>
+ */
+template <typename T, class KernelT>
+Result<> ModifyBlocks(AbstractDataStore<T>& store, usize startIndex, usize endIndex, KernelT&& kernel, usize blockSize = k_DefaultBlockSize)
+{
+  if(startIndex > endIndex || endIndex > store.getSize())
+  {
+    return MakeErrorResult(-14611, fmt::format("Unable to modify the values [{}, {}) of a data store with {} values.", startIndex, endIndex, store.getSize()));
+  }
+  if(startIndex == endIndex)
+  {
+    return {};
+  }
+
+  if(T* data = GetContiguousData(store); data != nullptr)
+  {
+    kernel(startIndex, nonstd::span<T>(data + startIndex, endIndex - startIndex));
+    return {};
+  }
+
+  blockSize = std::max<usize>(blockSize, 1);
+  const usize bufferSize = std::min(blockSize, endIndex - startIndex);
+  auto buffer = std::make_unique<T[]>(bufferSize);
+  for(usize blockStart = startIndex; blockStart < endIndex; blockStart += blockSize)
+  {
+    const nonstd::span<T> block(buffer.get(), std::min(blockSize, endIndex - blockStart));
+    Result<> result = store.copyIntoBuffer(blockStart, block);
+    if(result.invalid())
+    {
+      return result;
+    }
+    kernel(blockStart, block);
+    result = store.copyFromBuffer(blockStart, nonstd::span<const T>(block.data(), block.size()));
+    if(result.invalid())
+    {
+      return result;
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Calls kernel(blockStart, nonstd::span<T> values) over every value of the store.
+ * @param store
+ * @param kernel
+ * @param blockSize
+ * @return Result<>
+ */
+template <typename T, class KernelT>
+Result<> ModifyBlocks(AbstractDataStore<T>& store, KernelT&& kernel, usize blockSize = k_DefaultBlockSize)
+{
+  return ModifyBlocks(store, 0, store.getSize(), std::forward<KernelT>(kernel), blockSize);
+}
+} // namespace nx::core::DataStoreUtilities
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class ConcurrentUnionFind
+ * @brief Disjoint set forest over the elements [0, size) whose find() and unite() may be called from
+ * several threads at once. A union always links the larger root below the smaller one, so once every
+ * union has completed the root of each set is its smallest element, whatever order the unions ran in.
+ */
+class ConcurrentUnionFind
+{
+public:
+  explicit ConcurrentUnionFind(usize size)
+  : m_Parents(size)
+  {
+    for(usize element = 0; element < size; element++)
+    {
+      m_Parents[element].store(element, std::memory_order_relaxed);
+    }
+  }
+
+  ~ConcurrentUnionFind() noexcept = default;
+
+  ConcurrentUnionFind(const ConcurrentUnionFind&) = delete;
+  ConcurrentUnionFind(ConcurrentUnionFind&&) noexcept = delete;
+  ConcurrentUnionFind& operator=(const ConcurrentUnionFind&) = delete;
+  ConcurrentUnionFind& operator=(ConcurrentUnionFind&&) noexcept = delete;
+
+  /**
+   * @brief Returns the current root of the set holding element, halving the path to it on the way.
+   * @param element
+   * @return usize
+   */
+  usize find(usize element)
+  {
+    while(true)
+    {
+      usize parent = m_Parents[element].load(std::memory_order_acquire);
+      if(parent == element)
+      {
+        return element;
+      }
+      const usize grandParent = m_Parents[parent].load(std::memory_order_acquire);
+      if(grandParent != parent)
+      {
+        // Any ancestor is still in the same set, so a failed exchange only skips the shortcut.
+        m_Parents[element].compare_exchange_weak(parent, grandParent, std::memory_order_acq_rel, std::memory_order_relaxed);
+      }
+      element = grandParent;
+    }
+  }
+
+  /**
+   * @brief Merges the sets holding elementA and elementB.
+   * @param elementA
+   * @param elementB
+   */
+  void unite(usize elementA, usize elementB)
+  {
+    while(true)
+    {
+      usize rootA = find(elementA);
+      usize rootB = find(elementB);
+      if(rootA == rootB)
+      {
+        return;
+      }
+      if(rootA < rootB)
+      {
+        std::swap(rootA, rootB);
+      }
+      // Only succeeds if rootA is still a root, otherwise another thread linked it first and the roots are looked up again.
+      usize expected = rootA;
+      if(m_Parents[rootA].compare_exchange_strong(expected, rootB, std::memory_order_acq_rel, std::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the number of elements.
+   * @return usize
+   */
+  usize getSize() const
+  {
+    return m_Parents.size();
+  }
+
+private:
+  std::vector<std::atomic<usize>> m_Parents;
+};
+
+/**
+ * @class FeatureGrouping
+ * @brief The FeatureGrouping class groups features into parents, such as twins into parent grains. Every
+ * pair of neighboring features is tested once with a caller supplied predicate, in parallel over the features,
+ * and the features of every passing pair are merged with a ConcurrentUnionFind. A group is therefore a
+ * connected component of the passing pairs, which is the same set of features a breadth first search from
+ * any of its members would collect.
+ *
+ * A pair is only tested from the list of its smaller feature, so the NeighborList must list every pair from
+ * both sides, as the lists of ComputeFeatureNeighbors do, and the predicate must be symmetric. The predicate
+ * runs concurrently, so any array it reads must be passed to requireArraysInMemory().
+ */
+class FeatureGrouping : public IParallelAlgorithm
+{
+public:
+  FeatureGrouping(const NeighborList<int32>& neighborList, usize numFeatures)
+  : m_NeighborList(neighborList)
+  , m_NumFeatures(numFeatures)
+  {
+  }
+
+  ~FeatureGrouping() noexcept = default;
+
+  FeatureGrouping(const FeatureGrouping&) = delete;
+  FeatureGrouping(FeatureGrouping&&) noexcept = delete;
+  FeatureGrouping& operator=(const FeatureGrouping&) = delete;
+  FeatureGrouping& operator=(FeatureGrouping&&) noexcept = delete;
+
+  /**
+   * @brief Tests shouldGroup(int32 feature, int32 neighbor) for every entry of the NeighborList whose neighbor is larger than
+   * the feature and returns, for every feature, the smallest feature of its group. The predicate must be thread safe.
+   * @param shouldGroup
+   * @param shouldCancel
+   * @return Result<std::vector<int32>>
+   */
+  template <class PredicateT>
+  Result<std::vector<int32>> execute(const PredicateT& shouldGroup, const std::atomic_bool& shouldCancel) const
+  {
+    const usize numLists = std::min(static_cast<usize>(m_NeighborList.getNumberOfLists()), m_NumFeatures);
+    ConcurrentUnionFind unionFind(m_NumFeatures);
+    std::atomic_bool invalidNeighbor = false;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(getParallelizationEnabled());
+    dataAlg.setRange(0, numLists);
+    dataAlg.execute(GroupNeighborsImpl<PredicateT>(m_NeighborList, m_NumFeatures, shouldGroup, unionFind, invalidNeighbor, shouldCancel));
+
+    if(invalidNeighbor)
+    {
+      return MakeErrorResult<std::vector<int32>>(-14630, fmt::format("A neighbor in '{}' is not a valid Feature Id. The number of features is {}.", m_NeighborList.getName(), m_NumFeatures));
+    }
+
+    std::vector<int32> groupRoots(m_NumFeatures);
+    for(usize feature = 0; feature < m_NumFeatures; feature++)
+    {
+      groupRoots[feature] = static_cast<int32>(unionFind.find(feature));
+    }
+    return {std::move(groupRoots)};
+  }
+
+  /**
+   * @brief Gives every feature whose label is -1 the label of its group. Groups are numbered nextLabel, nextLabel + 1, ...
+   * in the order their first unlabeled feature is met when visiting the features cyclically from startFeature, so the
+   * numbering matches seeding a search at that feature. Features that already have a label keep it.
+   * @param groupRoots
+   * @param startFeature
+   * @param nextLabel
+   * @param featureLabels
+   * @return The next unused label.
+   */
+  static int32 LabelGroups(const std::vector<int32>& groupRoots, usize startFeature, int32 nextLabel, AbstractDataStore<int32>& featureLabels)
+  {
+    const usize numFeatures = std::min(groupRoots.size(), featureLabels.getNumberOfTuples());
+    std::vector<int32> rootLabels(groupRoots.size(), -1);
+    for(usize offset = 0; offset < numFeatures; offset++)
+    {
+      const usize feature = (startFeature + offset) % numFeatures;
+      if(featureLabels[feature] != -1)
+      {
+        continue;
+      }
+      int32& rootLabel = rootLabels[groupRoots[feature]];
+      if(rootLabel == -1)
+      {
+        rootLabel = nextLabel++;
+      }
+      featureLabels[feature] = rootLabel;
+    }
+    return nextLabel;
+  }
+
+private:
+  template <class PredicateT>
+  class GroupNeighborsImpl
+  {
+  public:
+    GroupNeighborsImpl(const NeighborList<int32>& neighborList, usize numFeatures, const PredicateT& shouldGroup, ConcurrentUnionFind& unionFind, std::atomic_bool& invalidNeighbor,
+                       const std::atomic_bool& shouldCancel)
+    : m_NeighborList(neighborList)
+    , m_NumFeatures(numFeatures)
+    , m_ShouldGroup(shouldGroup)
+    , m_UnionFind(unionFind)
+    , m_InvalidNeighbor(invalidNeighbor)
+    , m_ShouldCancel(shouldCancel)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize feature = range.min(); feature < range.max(); feature++)
+      {
+        if(m_ShouldCancel || m_InvalidNeighbor)
+        {
+          return;
+        }
+        const auto featureId = static_cast<int32>(feature);
+        for(const int32 neighbor : m_NeighborList.getListReference(featureId))
+        {
+          if(neighbor < 0 || static_cast<usize>(neighbor) >= m_NumFeatures)
+          {
+            m_InvalidNeighbor = true;
+            return;
+          }
+          // The pair is tested from the list of the smaller feature, which also skips the feature itself
+          if(neighbor <= featureId)
+          {
+            continue;
+          }
+          if(m_ShouldGroup(featureId, neighbor))
+          {
+            m_UnionFind.unite(feature, static_cast<usize>(neighbor));
+          }
+        }
+      }
+    }
+
+  private:
+    const NeighborList<int32>& m_NeighborList;
+    usize m_NumFeatures = 0;
+    const PredicateT& m_ShouldGroup;
+    ConcurrentUnionFind& m_UnionFind;
+    std::atomic_bool& m_InvalidNeighbor;
+    const std::atomic_bool& m_ShouldCancel;
+  };
+
+  const NeighborList<int32>& m_NeighborList;
+  usize m_NumFeatures = 0;
+};
+} // namespace nx::core
@@ -0,0 +1,383 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class FeatureReduction
+ * @brief The FeatureReduction class reduces per-element values into one accumulator per feature,
+ * where the feature of every element is given by a Feature Ids store. Elements with a negative
+ * Feature Id are skipped.
+ *
+ * Small inputs are reduced in a single serial sweep. Larger inputs are split into one contiguous
+ * range of elements per thread, each accumulating into a private copy of the feature accumulators
+ * that are then combined per feature with a pairwise tree of merge calls. When the private copies
+ * would be too large compared to the number of elements, or when the caller needs every feature to
+ * see its elements in ascending order, the elements are instead counting-sorted by feature, in chunks of
+ * features that bound the sorted indices to k_MaxSortedElements, and each thread accumulates a disjoint
+ * range of features directly into the shared result.
+ *
+ * The callbacks run concurrently, so any other array they read must be passed to requireArraysInMemory()
+ * together with the Feature Ids array.
+ */
+template <typename AccumulatorT>
+class FeatureReduction : public IParallelAlgorithm
+{
+public:
+  /**
+   * @brief Smallest number of elements handed to a single task.
+   */
+  static inline constexpr usize k_MinElementsPerTask = 32768;
+
+  /**
+   * @brief Private accumulators are only used while numFeatures * numTasks stays below numElements / k_PrivatizationRatio.
+   */
+  static inline constexpr usize k_PrivatizationRatio = 4;
+
+  /**
+   * @brief Largest number of element indices the sorted strategy holds at once (256 MiB with 32-bit indices).
+   */
+  static inline constexpr usize k_MaxSortedElements = usize{1} << 26;
+
+  /**
+   * @brief Error code returned when a Feature Id is greater than or equal to the number of features.
+   */
+  static inline constexpr int32 k_FeatureIdOutOfRangeError = -14620;
+
+  enum class Strategy : uint8
+  {
+    Serial,
+    Privatized,
+    SortedByFeature
+  };
+
+  FeatureReduction(const Int32AbstractDataStore& featureIds, usize numFeatures, const AccumulatorT& identity)
+  : m_FeatureIds(featureIds)
+  , m_NumFeatures(numFeatures)
+  , m_Identity(identity)
+  {
+    requireStoresInMemory({&featureIds});
+  }
+
+  ~FeatureReduction() noexcept = default;
+
+  FeatureReduction(const FeatureReduction&) = delete;
+  FeatureReduction(FeatureReduction&&) noexcept = delete;
+  FeatureReduction& operator=(const FeatureReduction&) = delete;
+  FeatureReduction& operator=(FeatureReduction&&) noexcept = delete;
+
+  /**
+   * @brief Returns the strategy execute() (preserveElementOrder = false) or executeInElementOrder()
+   * (preserveElementOrder = true) will use for the current inputs.
+   * @param preserveElementOrder
+   * @return Strategy
+   */
+  Strategy getStrategy(bool preserveElementOrder) const
+  {
+    const usize numTasks = getNumberOfTasks();
+    if(numTasks < 2)
+    {
+      return Strategy::Serial;
+    }
+    if(!preserveElementOrder && m_NumFeatures * numTasks <= m_FeatureIds.getSize() / k_PrivatizationRatio)
+    {
+      return Strategy::Privatized;
+    }
+    return Strategy::SortedByFeature;
+  }
+
+  /**
+   * @brief Calls accumulate(AccumulatorT& featureValue, usize featureId, usize elementIndex) for every element and returns the
+   * accumulator of each feature. Partial accumulators of the same feature are combined with
+   * merge(AccumulatorT& featureValue, const AccumulatorT& otherValue), so the reduction must be associative.
+   * @param accumulate
+   * @param merge
+   * @param shouldCancel
+   * @return Result<std::vector<AccumulatorT>>
+   */
+  template <class AccumulateT, class MergeT>
+  Result<std::vector<AccumulatorT>> execute(const AccumulateT& accumulate, const MergeT& merge, const std::atomic_bool& shouldCancel) const
+  {
+    switch(getStrategy(false))
+    {
+    case Strategy::Privatized:
+      return reducePrivatized(accumulate, merge, shouldCancel);
+    case Strategy::SortedByFeature:
+      return reduceSorted(accumulate, shouldCancel);
+    case Strategy::Serial:
+      break;
+    }
+    return reduceSerial(accumulate, shouldCancel);
+  }
+
+  /**
+   * @brief Calls accumulate(AccumulatorT& featureValue, usize featureId, usize elementIndex) for every element and returns the
+   * accumulator of each feature. The elements of each feature are visited in ascending order, so the result
+   * is identical to a serial sweep even when the reduction is order dependent, e.g. floating point or
+   * compensated sums and running averages.
+   * @param accumulate
+   * @param shouldCancel
+   * @return Result<std::vector<AccumulatorT>>
+   */
+  template <class AccumulateT>
+  Result<std::vector<AccumulatorT>> executeInElementOrder(const AccumulateT& accumulate, const std::atomic_bool& shouldCancel) const
+  {
+    if(getStrategy(true) == Strategy::SortedByFeature)
+    {
+      return reduceSorted(accumulate, shouldCancel);
+    }
+    return reduceSerial(accumulate, shouldCancel);
+  }
+
+private:
+  usize getNumberOfTasks() const
+  {
+    if(!getParallelizationEnabled())
+    {
+      return 1;
+    }
+    const ParallelTaskAlgorithm taskRunner;
+    const usize maxTasks = std::max<usize>(taskRunner.getMaxThreads(), 1);
+    return std::min(maxTasks, m_FeatureIds.getSize() / k_MinElementsPerTask);
+  }
+
+  Result<std::vector<AccumulatorT>> makeInvalidIdError() const
+  {
+    return MakeErrorResult<std::vector<AccumulatorT>>(k_FeatureIdOutOfRangeError, fmt::format("A Feature Id is greater than or equal to the number of features ({}).", m_NumFeatures));
+  }
+
+  template <class AccumulateT>
+  Result<> accumulateRange(usize startIndex, usize endIndex, std::vector<AccumulatorT>& featureValues, const AccumulateT& accumulate, std::atomic_bool& invalidId,
+                           const std::atomic_bool& shouldCancel) const
+  {
+    return DataStoreUtilities::ReadBlocks(m_FeatureIds, startIndex, endIndex, [&](usize blockStart, nonstd::span<const int32> ids) {
+      if(shouldCancel || invalidId)
+      {
+        return;
+      }
+      for(usize offset = 0; offset < ids.size(); offset++)
+      {
+        const int32 featureId = ids[offset];
+        if(featureId < 0)
+        {
+          continue;
+        }
+        if(static_cast<usize>(featureId) >= m_NumFeatures)
+        {
+          invalidId = true;
+          return;
+        }
+        accumulate(featureValues[featureId], static_cast<usize>(featureId), blockStart + offset);
+      }
+    });
+  }
+
+  template <class AccumulateT>
+  Result<std::vector<AccumulatorT>> reduceSerial(const AccumulateT& accumulate, const std::atomic_bool& shouldCancel) const
+  {
+    std::vector<AccumulatorT> featureValues(m_NumFeatures, m_Identity);
+    std::atomic_bool invalidId = false;
+    Result<> result = accumulateRange(0, m_FeatureIds.getSize(), featureValues, accumulate, invalidId, shouldCancel);
+    if(result.invalid())
+    {
+      return ConvertInvalidResult<std::vector<AccumulatorT>>(std::move(result));
+    }
+    if(invalidId)
+    {
+      return makeInvalidIdError();
+    }
+    return {std::move(featureValues)};
+  }
+
+  template <class AccumulateT, class MergeT>
+  Result<std::vector<AccumulatorT>> reducePrivatized(const AccumulateT& accumulate, const MergeT& merge, const std::atomic_bool& shouldCancel) const
+  {
+    const usize numTasks = getNumberOfTasks();
+    const usize numElements = m_FeatureIds.getSize();
+    const usize elementsPerTask = (numElements + numTasks - 1) / numTasks;
+
+    std::vector<std::vector<AccumulatorT>> partials(numTasks, std::vector<AccumulatorT>(m_NumFeatures, m_Identity));
+    std::vector<Result<>> results(numTasks);
+    std::atomic_bool invalidId = false;
+
+    ParallelTaskAlgorithm taskRunner;
+    taskRunner.setParallelizationEnabled(getParallelizationEnabled());
+    for(usize task = 0; task < numTasks; task++)
+    {
+      const usize startIndex = std::min(task * elementsPerTask, numElements);
+      const usize endIndex = std::min(startIndex + elementsPerTask, numElements);
+      taskRunner.execute([&, task, startIndex, endIndex]() { results[task] = accumulateRange(startIndex, endIndex, partials[task], accumulate, invalidId, shouldCancel); });
+    }
+    taskRunner.wait();
+
+    for(auto& result : results)
+    {
+      if(result.invalid())
+      {
+        return ConvertInvalidResult<std::vector<AccumulatorT>>(std::move(result));
+      }
+    }
+    if(invalidId)
+    {
+      return makeInvalidIdError();
+    }
+
+    // Every task combines the partials of its own range of features, pairing partials that are
+    // 1, 2, 4, ... tasks apart so the result does not depend on how the tasks were scheduled.
+    const usize featuresPerTask = (m_NumFeatures + numTasks - 1) / numTasks;
+    for(usize task = 0; task < numTasks; task++)
+    {
+      const usize startFeature = std::min(task * featuresPerTask, m_NumFeatures);
+      const usize endFeature = std::min(startFeature + featuresPerTask, m_NumFeatures);
+      taskRunner.execute([&, startFeature, endFeature]() {
+        for(usize stride = 1; stride < numTasks; stride *= 2)
+        {
+          for(usize target = 0; target + stride < numTasks; target += 2 * stride)
+          {
+            for(usize featureId = startFeature; featureId < endFeature; featureId++)
+            {
+              merge(partials[target][featureId], partials[target + stride][featureId]);
+            }
+          }
+        }
+      });
+    }
+    taskRunner.wait();
+
+    return {std::move(partials[0])};
+  }
+
+  template <class AccumulateT>
+  Result<std::vector<AccumulatorT>> reduceSorted(const AccumulateT& accumulate, const std::atomic_bool& shouldCancel) const
+  {
+    if(m_FeatureIds.getSize() <= std::numeric_limits<uint32>::max())
+    {
+      return reduceSorted<uint32>(accumulate, shouldCancel);
+    }
+    return reduceSorted<usize>(accumulate, shouldCancel);
+  }
+
+  template <typename IndexT, class AccumulateT>
+  Result<std::vector<AccumulatorT>> reduceSorted(const AccumulateT& accumulate, const std::atomic_bool& shouldCancel) const
+  {
+    // Count the elements of each feature so the element indices can be counting-sorted by feature.
+    std::vector<usize> featureOffsets(m_NumFeatures + 1, 0);
+    bool invalidId = false;
+    Result<> result = DataStoreUtilities::ReadBlocks(m_FeatureIds, [&](usize, nonstd::span<const int32> ids) {
+      for(const int32 featureId : ids)
+      {
+        if(featureId < 0)
+        {
+          continue;
+        }
+        if(static_cast<usize>(featureId) >= m_NumFeatures)
+        {
+          invalidId = true;
+          return;
+        }
+        featureOffsets[featureId + 1]++;
+      }
+    });
+    if(result.invalid())
+    {
+      return ConvertInvalidResult<std::vector<AccumulatorT>>(std::move(result));
+    }
+    if(invalidId)
+    {
+      return makeInvalidIdError();
+    }
+    for(usize featureId = 0; featureId < m_NumFeatures; featureId++)
+    {
+      featureOffsets[featureId + 1] += featureOffsets[featureId];
+    }
+
+    const usize numTasks = std::max<usize>(getNumberOfTasks(), 1);
+    std::vector<AccumulatorT> featureValues(m_NumFeatures, m_Identity);
+    std::vector<IndexT> sortedElements;
+    std::vector<usize> insertPositions;
+
+    ParallelTaskAlgorithm taskRunner;
+    taskRunner.setParallelizationEnabled(getParallelizationEnabled());
+
+    // The features are processed in chunks holding at most k_MaxSortedElements elements (or a single larger feature),
+    // each chunk re-reading the Feature Ids to sort only the elements of its own features.
+    usize chunkStart = 0;
+    while(chunkStart < m_NumFeatures)
+    {
+      if(shouldCancel)
+      {
+        return {std::move(featureValues)};
+      }
+      auto chunkEndIter = std::upper_bound(featureOffsets.cbegin() + chunkStart + 1, featureOffsets.cend(), featureOffsets[chunkStart] + k_MaxSortedElements);
+      const usize chunkEnd = std::max(static_cast<usize>(std::distance(featureOffsets.cbegin(), chunkEndIter)) - 1, chunkStart + 1);
+      const usize chunkOffset = featureOffsets[chunkStart];
+      const usize chunkSize = featureOffsets[chunkEnd] - chunkOffset;
+
+      sortedElements.resize(chunkSize);
+      insertPositions.assign(featureOffsets.cbegin() + chunkStart, featureOffsets.cbegin() + chunkEnd);
+      result = DataStoreUtilities::ReadBlocks(m_FeatureIds, [&](usize blockStart, nonstd::span<const int32> ids) {
+        for(usize offset = 0; offset < ids.size(); offset++)
+        {
+          const int32 featureId = ids[offset];
+          if(featureId >= 0 && static_cast<usize>(featureId) >= chunkStart && static_cast<usize>(featureId) < chunkEnd)
+          {
+            sortedElements[insertPositions[featureId - chunkStart]++ - chunkOffset] = static_cast<IndexT>(blockStart + offset);
+          }
+        }
+      });
+      if(result.invalid())
+      {
+        return ConvertInvalidResult<std::vector<AccumulatorT>>(std::move(result));
+      }
+
+      // Split the features of the chunk into ranges holding roughly the same number of elements.
+      const usize elementsPerTask = std::max<usize>((chunkSize + numTasks - 1) / numTasks, 1);
+      usize startFeature = chunkStart;
+      while(startFeature < chunkEnd)
+      {
+        const usize targetOffset = featureOffsets[startFeature] + elementsPerTask;
+        auto endIter = std::lower_bound(featureOffsets.cbegin() + startFeature + 1, featureOffsets.cbegin() + chunkEnd, targetOffset);
+        const auto endFeature = static_cast<usize>(std::distance(featureOffsets.cbegin(), endIter));
+        taskRunner.execute([&, startFeature, endFeature]() {
+          for(usize featureId = startFeature; featureId < endFeature; featureId++)
+          {
+            if(shouldCancel)
+            {
+              return;
+            }
+            AccumulatorT& featureValue = featureValues[featureId];
+            for(usize index = featureOffsets[featureId]; index < featureOffsets[featureId + 1]; index++)
+            {
+              accumulate(featureValue, featureId, static_cast<usize>(sortedElements[index - chunkOffset]));
+            }
+          }
+        });
+        startFeature = endFeature;
+      }
+      taskRunner.wait();
+
+      chunkStart = chunkEnd;
+    }
+
+    return {std::move(featureValues)};
+  }
+
+  const Int32AbstractDataStore& m_FeatureIds;
+  usize m_NumFeatures = 0;
+  AccumulatorT m_Identity;
+};
+} // namespace nx::core
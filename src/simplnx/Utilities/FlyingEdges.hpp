@@ -47,6 +47,8 @@ Supporting Paper: https://www.researchgate.net/publication/308703724_Flying_edge
 #include "simplnx/Common/TypesUtility.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <algorithm>
@@ -604,8 +606,15 @@ const nx::core::uint8 edgeVertices[12][2] = { {0,1}, {1,2}, {3,2},
 
 namespace nx::core
 {
+/**
+ * @class FlyingEdgesAlgorithm
+ * @brief Contours an image with the four Flying Edges passes. Within a pass every x-row (j, k) of the image
+ * only writes data that belongs to that row, and the output of every row is written at offsets computed by
+ * the exclusive scans of pass 3, so the passes run in parallel over the rows and the output does not depend
+ * on the number of threads.
+ */
 template <typename T>
-class FlyingEdgesAlgorithm
+class FlyingEdgesAlgorithm : public IParallelAlgorithm
 {
   using cube = std::array<std::array<float32, 3>, 8>;
   using TCube = std::array<T, 8>;
@@ -627,6 +636,7 @@ public:
   , m_PointsStore(m_TriangleGeom.getVertices()->getDataStoreRef())
   , m_NormalsStore(normals)
   {
+    requireStoresInMemory({&m_DataStore, &m_PointsStore, &m_TrisStore, &m_NormalsStore});
   }
 
   ///////////////////////////////////////////////////////////////////////////////
@@ -640,45 +650,44 @@ public:
     //  - find the locations for computational trimming, xl and xr
     //  To properly find xl and xr, have to check along the x-axis,
     //  the y-axis and the z-axis!
-    for(usize k = 0; k != m_NZ; ++k)
-    {
-      for(usize j = 0; j != m_NY; ++j)
-      {
-        auto curEdgeCases = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
-        T curPointValue = m_DataStore[m_NX * (k * m_NY + j)];
+    runParallel(m_NZ * m_NY, [this](usize row) {
+      const usize k = row / m_NY;
+      const usize j = row % m_NY;
 
-        std::array<bool, 2> isGE = {};
-        isGE[0] = (curPointValue >= m_IsoVal);
-        for(int i = 1; i != m_NX; ++i)
-        {
-          isGE[i % 2] = (m_DataStore[(m_NX * (k * m_NY + j)) + i] >= m_IsoVal);
+      auto curEdgeCases = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
+      T curPointValue = m_DataStore[m_NX * (k * m_NY + j)];
 
-          curEdgeCases[i - 1] = calcCaseEdge(isGE[(i + 1) % 2], isGE[i % 2]);
-        }
+      std::array<bool, 2> isGE = {};
+      isGE[0] = (curPointValue >= m_IsoVal);
+      for(int i = 1; i != m_NX; ++i)
+      {
+        isGE[i % 2] = (m_DataStore[(m_NX * (k * m_NY + j)) + i] >= m_IsoVal);
+
+        curEdgeCases[i - 1] = calcCaseEdge(isGE[(i + 1) % 2], isGE[i % 2]);
       }
-    }
+    });
 
-    for(usize k = 0; k != m_NZ; ++k)
-    {
-      for(usize j = 0; j != m_NY; ++j)
+    // The trim values read the edge cases of the neighboring rows, so they wait until every row has its edge cases.
+    runParallel(m_NZ * m_NY, [this](usize row) {
+      const usize k = row / m_NY;
+      const usize j = row % m_NY;
+
+      GridEdge& curGridEdge = m_GridEdges[k * m_NY + j];
+      curGridEdge.xl = m_NX;
+      for(int i = 1; i != m_NX; ++i)
       {
-        GridEdge& curGridEdge = m_GridEdges[k * m_NY + j];
-        curGridEdge.xl = m_NX;
-        for(int i = 1; i != m_NX; ++i)
+        // If the edge is cut
+        if(isCutEdge(i - 1, j, k))
         {
-          // If the edge is cut
-          if(isCutEdge(i - 1, j, k))
+          if(curGridEdge.xl == m_NX)
           {
-            if(curGridEdge.xl == m_NX)
-            {
-              curGridEdge.xl = i - 1;
-            }
-
-            curGridEdge.xr = i;
+            curGridEdge.xl = i - 1;
           }
+
+          curGridEdge.xr = i;
         }
       }
-    }
+    });
   }
   ///////////////////////////////////////////////////////////////////////////////
 
@@ -690,121 +699,120 @@ public:
     // For each (j, k):
     //  - for each cube (i, j, k) calculate caseId and number of GridEdge cuts
     //    in the x, y and z direction.
-    for(usize k = 0; k != m_NZ - 1; ++k)
-    {
-      for(usize j = 0; j != m_NY - 1; ++j)
-      {
-        // find adjusted trim values
-        usize xl, xr;
-        calcTrimValues(xl, xr, j, k); // xl, xr set in this function
+    runParallel((m_NZ - 1) * (m_NY - 1), [this](usize row) {
+      const usize k = row / (m_NY - 1);
+      const usize j = row % (m_NY - 1);
 
-        // ge0 is owned by this (i, j, k). ge1, ge2 and ge3 are only used for
-        // boundary cells.
-        GridEdge& ge0 = m_GridEdges[k * m_NY + j];
-        GridEdge& ge1 = m_GridEdges[k * m_NY + j + 1];
-        GridEdge& ge2 = m_GridEdges[(k + 1) * m_NY + j];
-        GridEdge& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
+      // find adjusted trim values
+      usize xl, xr;
+      calcTrimValues(xl, xr, j, k); // xl, xr set in this function
 
-        // ec0, ec1, ec2 and ec3 were set in pass 1. They are used
-        // to calculate the cell caseId.
-        auto const& ec0 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
-        auto const& ec1 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j + 1);
-        auto const& ec2 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j);
-        auto const& ec3 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j + 1);
+      // ge0 is owned by this (i, j, k). ge1, ge2 and ge3 are only used for
+      // boundary cells.
+      GridEdge& ge0 = m_GridEdges[k * m_NY + j];
+      GridEdge& ge1 = m_GridEdges[k * m_NY + j + 1];
+      GridEdge& ge2 = m_GridEdges[(k + 1) * m_NY + j];
+      GridEdge& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
 
-        // Count the number of triangles along this row of cubes.
-        usize& curTriCounter = *(m_TriCounter.begin() + k * (m_NY - 1) + static_cast<int64>(j));
+      // ec0, ec1, ec2 and ec3 were set in pass 1. They are used
+      // to calculate the cell caseId.
+      auto const& ec0 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j);
+      auto const& ec1 = m_EdgeCases.begin() + (m_NX - 1) * (k * m_NY + j + 1);
+      auto const& ec2 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j);
+      auto const& ec3 = m_EdgeCases.begin() + (m_NX - 1) * ((k + 1) * m_NY + j + 1);
 
-        auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
+      // Count the number of triangles along this row of cubes.
+      usize& curTriCounter = *(m_TriCounter.begin() + k * (m_NY - 1) + static_cast<int64>(j));
 
-        bool isYEnd = (j == m_NY - 2);
-        bool isZEnd = (k == m_NZ - 2);
+      auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
 
-        for(usize i = xl; i != xr; ++i)
-        {
-          bool isXEnd = (i == m_NX - 2);
+      bool isYEnd = (j == m_NY - 2);
+      bool isZEnd = (k == m_NZ - 2);
 
-          // using m_EdgeCases from pass 2, compute m_CubeCases for this cube
-          uint8 caseId = calcCubeCase(ec0[static_cast<int64>(i)], ec1[static_cast<int64>(i)], ec2[static_cast<int64>(i)], ec3[static_cast<int64>(i)]);
+      for(usize i = xl; i != xr; ++i)
+      {
+        bool isXEnd = (i == m_NX - 2);
 
-          curCubeCaseIds[static_cast<int64>(i)] = caseId;
+        // using m_EdgeCases from pass 2, compute m_CubeCases for this cube
+        uint8 caseId = calcCubeCase(ec0[static_cast<int64>(i)], ec1[static_cast<int64>(i)], ec2[static_cast<int64>(i)], ec3[static_cast<int64>(i)]);
 
-          // If the cube has no triangles through it
-          if(caseId == 0 || caseId == 255)
-          {
-            continue;
-          }
+        curCubeCaseIds[static_cast<int64>(i)] = caseId;
 
-          curTriCounter += util::numTris[caseId];
-
-          const uint8* isCut = util::isCut[caseId]; // size 12
-
-          ge0.xstart += isCut[0];
-          ge0.ystart += isCut[3];
-          ge0.zstart += isCut[8];
-
-          // Note: Each 'gridCell' contains four m_GridEdges running along it,
-          //       ge0, ge1, ge2 and ge3. Each gridCell can access its own
-          //       ge0 but ge1, ge2 and ge3 are owned by other gridCells.
-          //       Accessing ge1, ge2 and ge3 leads to a race condition
-          //       unless gridCell is along the boundary of the image.
-          //
-          //       To really make sense of the indices, it helps to draw
-          //       out the following picture of a cube with the appropriate
-          //       labels:
-          //         v0 is at (i,   j,   k)
-          //         v1       (i+1, j,   k)
-          //         v2       (i+1, j+1, k)
-          //         v3       (i,   j+1, k)
-          //         v4       (i,   j,   k+1)
-          //         v5       (i+1, j,   k+1)
-          //         v6       (i+1, j+1, k+1)
-          //         v7       (i,   j+1, k+1)
-          //         e0  connects v0 to v1 and is parallel to the x-axis
-          //         e1           v1    v2                        y
-          //         e2           v2    v3                        x
-          //         e3           v0    v3                        y
-          //         e4           v4    v5                        x
-          //         e5           v5    v6                        y
-          //         e6           v6    v7                        x
-          //         e7           v4    v7                        y
-          //         e8           v0    v4                        z
-          //         e9           v1    v5                        z
-          //         e10          v3    v7                        z
-          //         e11          v2    v6                        z
-
-          // Handle cubes along the edge of the image
-          if(isXEnd)
-          {
-            ge0.ystart += isCut[1];
-            ge0.zstart += isCut[9];
-          }
-          if(isYEnd)
-          {
-            ge1.xstart += isCut[2];
-            ge1.zstart += isCut[10];
-          }
-          if(isZEnd)
-          {
-            ge2.xstart += isCut[4];
-            ge2.ystart += isCut[7];
-          }
+        // If the cube has no triangles through it
+        if(caseId == 0 || caseId == 255)
+        {
+          continue;
+        }
 
-          if(isXEnd and isYEnd)
-          {
-            ge1.zstart += isCut[11];
-          }
-          if(isXEnd and isZEnd)
-          {
-            ge2.ystart += isCut[5];
-          }
-          if(isYEnd and isZEnd)
-          {
-            ge3.xstart += isCut[6];
-          }
+        curTriCounter += util::numTris[caseId];
+
+        const uint8* isCut = util::isCut[caseId]; // size 12
+
+        ge0.xstart += isCut[0];
+        ge0.ystart += isCut[3];
+        ge0.zstart += isCut[8];
+
+        // Note: Each 'gridCell' contains four m_GridEdges running along it,
+        //       ge0, ge1, ge2 and ge3. Each gridCell can access its own
+        //       ge0 but ge1, ge2 and ge3 are owned by other gridCells.
+        //       Accessing ge1, ge2 and ge3 leads to a race condition
+        //       unless gridCell is along the boundary of the image.
+        //
+        //       To really make sense of the indices, it helps to draw
+        //       out the following picture of a cube with the appropriate
+        //       labels:
+        //         v0 is at (i,   j,   k)
+        //         v1       (i+1, j,   k)
+        //         v2       (i+1, j+1, k)
+        //         v3       (i,   j+1, k)
+        //         v4       (i,   j,   k+1)
+        //         v5       (i+1, j,   k+1)
+        //         v6       (i+1, j+1, k+1)
+        //         v7       (i,   j+1, k+1)
+        //         e0  connects v0 to v1 and is parallel to the x-axis
+        //         e1           v1    v2                        y
+        //         e2           v2    v3                        x
+        //         e3           v0    v3                        y
+        //         e4           v4    v5                        x
+        //         e5           v5    v6                        y
+        //         e6           v6    v7                        x
+        //         e7           v4    v7                        y
+        //         e8           v0    v4                        z
+        //         e9           v1    v5                        z
+        //         e10          v3    v7                        z
+        //         e11          v2    v6                        z
+
+        // Handle cubes along the edge of the image
+        if(isXEnd)
+        {
+          ge0.ystart += isCut[1];
+          ge0.zstart += isCut[9];
+        }
+        if(isYEnd)
+        {
+          ge1.xstart += isCut[2];
+          ge1.zstart += isCut[10];
+        }
+        if(isZEnd)
+        {
+          ge2.xstart += isCut[4];
+          ge2.ystart += isCut[7];
+        }
+
+        if(isXEnd and isYEnd)
+        {
+          ge1.zstart += isCut[11];
+        }
+        if(isXEnd and isZEnd)
+        {
+          ge2.ystart += isCut[5];
+        }
+        if(isYEnd and isZEnd)
+        {
+          ge3.xstart += isCut[6];
         }
       }
-    }
+    });
   }
   ///////////////////////////////////////////////////////////////////////////////
 
@@ -814,42 +822,23 @@ public:
   void pass3()
   {
     // Accumulate triangles into triCounter
-    usize tmp;
-    usize triAccum = 0;
-    for(usize k = 0; k != m_NZ - 1; ++k)
-    {
-      for(usize j = 0; j != m_NY - 1; ++j)
-      {
-        usize& curTriCounter = m_TriCounter[k * (m_NY - 1) + j];
-
-        tmp = curTriCounter;
-        curTriCounter = triAccum;
-        triAccum += tmp;
-      }
-    }
+    const usize triAccum = exclusiveScan(m_TriCounter.size(), [this](usize index) -> usize& { return m_TriCounter[index]; });
 
     // accumulate points, filling out starting locations of each GridEdge
-    // in the process.
-    usize pointAccum = 0;
-    for(usize k = 0; k != m_NZ; ++k)
-    {
-      for(usize j = 0; j != m_NY; ++j)
+    // in the process. The counts are scanned in the order xstart, ystart,
+    // zstart of each GridEdge in turn.
+    const usize pointAccum = exclusiveScan(m_GridEdges.size() * 3, [this](usize index) -> usize& {
+      GridEdge& curGridEdge = m_GridEdges[index / 3];
+      switch(index % 3)
       {
-        GridEdge& curGridEdge = m_GridEdges[k * m_NY + j];
-
-        tmp = curGridEdge.xstart;
-        curGridEdge.xstart = pointAccum;
-        pointAccum += tmp;
-
-        tmp = curGridEdge.ystart;
-        curGridEdge.ystart = pointAccum;
-        pointAccum += tmp;
-
-        tmp = curGridEdge.zstart;
-        curGridEdge.zstart = pointAccum;
-        pointAccum += tmp;
+      case 0:
+        return curGridEdge.xstart;
+      case 1:
+        return curGridEdge.ystart;
+      default:
+        return curGridEdge.zstart;
       }
-    }
+    });
 
     /* Saving jic. Same thing as above just scanned in different order
      *
@@ -900,211 +889,212 @@ public:
     //  - For each cube at i, fill out points, normals and triangles owned by
     //    the cube. Each cube is in charge of filling out e0, e3 and e8. Only
     //    in edge cases does it also fill out other edges.
-    for(usize k = 0; k != m_NZ - 1; ++k)
-    {
-      for(usize j = 0; j != m_NY - 1; ++j)
-      {
-        // find adjusted trim values
-        usize xl, xr;
-        calcTrimValues(xl, xr, j, k); // xl, xr set in this function
+    runParallel((m_NZ - 1) * (m_NY - 1), [this](usize row) {
+      const usize k = row / (m_NY - 1);
+      const usize j = row % (m_NY - 1);
 
-        if(xl == xr)
-          continue;
+      // find adjusted trim values
+      usize xl, xr;
+      calcTrimValues(xl, xr, j, k); // xl, xr set in this function
 
-        usize triIdx = m_TriCounter[k * (m_NY - 1) + j];
-        auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
+      if(xl == xr)
+      {
+        return;
+      }
 
-        GridEdge const& ge0 = m_GridEdges[k * m_NY + j];
-        GridEdge const& ge1 = m_GridEdges[k * m_NY + j + 1];
-        GridEdge const& ge2 = m_GridEdges[(k + 1) * m_NY + j];
-        GridEdge const& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
+      usize triIdx = m_TriCounter[k * (m_NY - 1) + j];
+      auto curCubeCaseIds = m_CubeCases.begin() + (m_NX - 1) * (k * (m_NY - 1) + j);
 
-        usize x0counter = 0;
-        usize y0counter = 0;
-        usize z0counter = 0;
+      GridEdge const& ge0 = m_GridEdges[k * m_NY + j];
+      GridEdge const& ge1 = m_GridEdges[k * m_NY + j + 1];
+      GridEdge const& ge2 = m_GridEdges[(k + 1) * m_NY + j];
+      GridEdge const& ge3 = m_GridEdges[(k + 1) * m_NY + j + 1];
 
-        usize x1counter = 0;
-        usize z1counter = 0;
+      usize x0counter = 0;
+      usize y0counter = 0;
+      usize z0counter = 0;
 
-        usize x2counter = 0;
-        usize y2counter = 0;
+      usize x1counter = 0;
+      usize z1counter = 0;
 
-        usize x3counter = 0;
+      usize x2counter = 0;
+      usize y2counter = 0;
 
-        bool isYEnd = (j == m_NY - 2);
-        bool isZEnd = (k == m_NZ - 2);
+      usize x3counter = 0;
 
-        for(usize i = xl; i != xr; ++i)
-        {
-          bool isXEnd = (i == m_NX - 2);
+      bool isYEnd = (j == m_NY - 2);
+      bool isZEnd = (k == m_NZ - 2);
 
-          uint8 caseId = curCubeCaseIds[static_cast<int64>(i)];
+      for(usize i = xl; i != xr; ++i)
+      {
+        bool isXEnd = (i == m_NX - 2);
 
-          if(caseId == 0 || caseId == 255)
-          {
-            continue;
-          }
+        uint8 caseId = curCubeCaseIds[static_cast<int64>(i)];
 
-          const uint8* isCut = util::isCut[caseId]; // has 12 elements
+        if(caseId == 0 || caseId == 255)
+        {
+          continue;
+        }
 
-          // Most of the information contained in pointCube, isoValCube
-          // and gradCube will be used--but not necessarily all. It has
-          // not been tested whether obtaining only the information
-          // needed will provide a significant speedup--but
-          // most likely not.
-          cube pointCube = getPosCube(i, j, k);
-          TCube isoValCube = getValCube(i, j, k);
-          cube gradCube = getGradCube(i, j, k);
+        const uint8* isCut = util::isCut[caseId]; // has 12 elements
 
-          // Add Points and normals.
-          // Calculate global indices for triangles
-          std::array<usize, 12> globalIdxs = {};
+        // Most of the information contained in pointCube, isoValCube
+        // and gradCube will be used--but not necessarily all. It has
+        // not been tested whether obtaining only the information
+        // needed will provide a significant speedup--but
+        // most likely not.
+        cube pointCube = getPosCube(i, j, k);
+        TCube isoValCube = getValCube(i, j, k);
+        cube gradCube = getGradCube(i, j, k);
 
-          if(isCut[0])
-          {
-            usize idx = ge0.xstart + x0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 0, idx * 3);
-            globalIdxs[0] = idx;
-            ++x0counter;
-          }
+        // Add Points and normals.
+        // Calculate global indices for triangles
+        std::array<usize, 12> globalIdxs = {};
 
-          if(isCut[3])
-          {
-            usize idx = ge0.ystart + y0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 3, idx * 3);
-            globalIdxs[3] = idx;
-            ++y0counter;
-          }
+        if(isCut[0])
+        {
+          usize idx = ge0.xstart + x0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 0, idx * 3);
+          globalIdxs[0] = idx;
+          ++x0counter;
+        }
 
-          if(isCut[8])
-          {
-            usize idx = ge0.zstart + z0counter;
-            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 8, idx * 3);
-            globalIdxs[8] = idx;
-            ++z0counter;
-          }
+        if(isCut[3])
+        {
+          usize idx = ge0.ystart + y0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 3, idx * 3);
+          globalIdxs[3] = idx;
+          ++y0counter;
+        }
 
-          // Note:
-          //   e1, e5, e9 and e11 will be visited in the next iteration
-          //   when they are e3, e7, e8 and 10 respectively. So don't
-          //   increment their counters. When the cube is an edge cube,
-          //   their counters don't need to be incremented because they
-          //   won't be used again.
+        if(isCut[8])
+        {
+          usize idx = ge0.zstart + z0counter;
+          InterpolateIntoArrays(pointCube, gradCube, isoValCube, 8, idx * 3);
+          globalIdxs[8] = idx;
+          ++z0counter;
+        }
 
-          // Manage boundary cases if needed, otherwise just update
-          // globalIdx.
-          if(isCut[1])
-          {
-            usize idx = ge0.ystart + y0counter;
-            if(isXEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 1, idx * 3);
-              // y0counter counter doesn't need to be incremented
-              // because it won't be used again.
-            }
-            globalIdxs[1] = idx;
-          }
+        // Note:
+        //   e1, e5, e9 and e11 will be visited in the next iteration
+        //   when they are e3, e7, e8 and 10 respectively. So don't
+        //   increment their counters. When the cube is an edge cube,
+        //   their counters don't need to be incremented because they
+        //   won't be used again.
 
-          if(isCut[9])
+        // Manage boundary cases if needed, otherwise just update
+        // globalIdx.
+        if(isCut[1])
+        {
+          usize idx = ge0.ystart + y0counter;
+          if(isXEnd)
           {
-            usize idx = ge0.zstart + z0counter;
-            if(isXEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 9, idx * 3);
-              // z0counter doesn't need to in incremented.
-            }
-            globalIdxs[9] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 1, idx * 3);
+            // y0counter counter doesn't need to be incremented
+            // because it won't be used again.
           }
+          globalIdxs[1] = idx;
+        }
 
-          if(isCut[2])
+        if(isCut[9])
+        {
+          usize idx = ge0.zstart + z0counter;
+          if(isXEnd)
           {
-            usize idx = ge1.xstart + x1counter;
-            if(isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 2, idx * 3);
-            }
-            globalIdxs[2] = idx;
-            ++x1counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 9, idx * 3);
+            // z0counter doesn't need to in incremented.
           }
+          globalIdxs[9] = idx;
+        }
 
-          if(isCut[10])
+        if(isCut[2])
+        {
+          usize idx = ge1.xstart + x1counter;
+          if(isYEnd)
           {
-            usize idx = ge1.zstart + z1counter;
-            if(isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 10, idx * 3);
-            }
-            globalIdxs[10] = idx;
-            ++z1counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 2, idx * 3);
           }
+          globalIdxs[2] = idx;
+          ++x1counter;
+        }
 
-          if(isCut[4])
+        if(isCut[10])
+        {
+          usize idx = ge1.zstart + z1counter;
+          if(isYEnd)
           {
-            usize idx = ge2.xstart + x2counter;
-            if(isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 4, idx * 3);
-            }
-            globalIdxs[4] = idx;
-            ++x2counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 10, idx * 3);
           }
+          globalIdxs[10] = idx;
+          ++z1counter;
+        }
 
-          if(isCut[7])
+        if(isCut[4])
+        {
+          usize idx = ge2.xstart + x2counter;
+          if(isZEnd)
           {
-            usize idx = ge2.ystart + y2counter;
-            if(isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 7, idx * 3);
-            }
-            globalIdxs[7] = idx;
-            ++y2counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 4, idx * 3);
           }
+          globalIdxs[4] = idx;
+          ++x2counter;
+        }
 
-          if(isCut[11])
+        if(isCut[7])
+        {
+          usize idx = ge2.ystart + y2counter;
+          if(isZEnd)
           {
-            usize idx = ge1.zstart + z1counter;
-            if(isXEnd and isYEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 11, idx * 3);
-              // z1counter does not need to be incremented.
-            }
-            globalIdxs[11] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 7, idx * 3);
           }
+          globalIdxs[7] = idx;
+          ++y2counter;
+        }
 
-          if(isCut[5])
+        if(isCut[11])
+        {
+          usize idx = ge1.zstart + z1counter;
+          if(isXEnd and isYEnd)
           {
-            usize idx = ge2.ystart + y2counter;
-            if(isXEnd and isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 5, idx * 3);
-              // y2 counter does not need to be incremented.
-            }
-            globalIdxs[5] = idx;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 11, idx * 3);
+            // z1counter does not need to be incremented.
           }
+          globalIdxs[11] = idx;
+        }
 
-          if(isCut[6])
+        if(isCut[5])
+        {
+          usize idx = ge2.ystart + y2counter;
+          if(isXEnd and isZEnd)
           {
-            usize idx = ge3.xstart + x3counter;
-            if(isYEnd and isZEnd)
-            {
-              InterpolateIntoArrays(pointCube, gradCube, isoValCube, 6, idx * 3);
-            }
-            globalIdxs[6] = idx;
-            ++x3counter;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 5, idx * 3);
+            // y2 counter does not need to be incremented.
           }
+          globalIdxs[5] = idx;
+        }
 
-          // Add triangles
-          const char* caseTri = util::caseTriangles[caseId]; // size 16
-          for(int idx = 0; caseTri[idx] != -1; idx += 3)
+        if(isCut[6])
+        {
+          usize idx = ge3.xstart + x3counter;
+          if(isYEnd and isZEnd)
           {
-            m_TrisStore[triIdx * 3] = globalIdxs[caseTri[idx]];
-            m_TrisStore[triIdx * 3 + 1] = globalIdxs[caseTri[idx + 1]];
-            m_TrisStore[triIdx * 3 + 2] = globalIdxs[caseTri[idx + 2]];
-            triIdx++;
+            InterpolateIntoArrays(pointCube, gradCube, isoValCube, 6, idx * 3);
           }
+          globalIdxs[6] = idx;
+          ++x3counter;
+        }
+
+        // Add triangles
+        const char* caseTri = util::caseTriangles[caseId]; // size 16
+        for(int idx = 0; caseTri[idx] != -1; idx += 3)
+        {
+          m_TrisStore[triIdx * 3] = globalIdxs[caseTri[idx]];
+          m_TrisStore[triIdx * 3 + 1] = globalIdxs[caseTri[idx + 1]];
+          m_TrisStore[triIdx * 3 + 2] = globalIdxs[caseTri[idx + 2]];
+          triIdx++;
         }
       }
-    }
+    });
   }
   ///////////////////////////////////////////////////////////////////////////////
 
@@ -1158,6 +1148,92 @@ private:
   // Private helper functions
   ///////////////////////////////////////////////////////////////////////////////
 
+  static inline constexpr usize k_ScanBlockSize = 4096;
+
+  template <class FuncT>
+  class RowsImpl
+  {
+  public:
+    explicit RowsImpl(const FuncT& func)
+    : m_Func(func)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize index = range.min(); index < range.max(); index++)
+      {
+        m_Func(index);
+      }
+    }
+
+  private:
+    const FuncT& m_Func;
+  };
+
+  /**
+   * @brief Calls func(index) for every index in [0, count), in parallel when parallelization is enabled.
+   * @param count
+   * @param func
+   */
+  template <class FuncT>
+  void runParallel(usize count, const FuncT& func) const
+  {
+    if(count == 0)
+    {
+      return;
+    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(getParallelizationEnabled());
+    dataAlg.setRange(0, count);
+    dataAlg.execute(RowsImpl<FuncT>(func));
+  }
+
+  /**
+   * @brief Replaces the values value(0), ..., value(count - 1) with their exclusive prefix sums and returns the total.
+   * The values are summed per block in parallel, the block sums are scanned serially and every block is then scanned
+   * from its offset in parallel, which gives the same result as a serial scan.
+   * @param count
+   * @param value Returns a reference to the value at an index.
+   * @return usize
+   */
+  template <class ValueFuncT>
+  usize exclusiveScan(usize count, const ValueFuncT& value) const
+  {
+    const usize numBlocks = (count + k_ScanBlockSize - 1) / k_ScanBlockSize;
+    std::vector<usize> blockOffsets(numBlocks, 0);
+    runParallel(numBlocks, [&](usize block) {
+      const usize end = std::min(count, (block + 1) * k_ScanBlockSize);
+      usize sum = 0;
+      for(usize index = block * k_ScanBlockSize; index < end; index++)
+      {
+        sum += value(index);
+      }
+      blockOffsets[block] = sum;
+    });
+
+    usize total = 0;
+    for(usize& blockOffset : blockOffsets)
+    {
+      const usize sum = blockOffset;
+      blockOffset = total;
+      total += sum;
+    }
+
+    runParallel(numBlocks, [&](usize block) {
+      const usize end = std::min(count, (block + 1) * k_ScanBlockSize);
+      usize accum = blockOffsets[block];
+      for(usize index = block * k_ScanBlockSize; index < end; index++)
+      {
+        usize& current = value(index);
+        const usize tmp = current;
+        current = accum;
+        accum += tmp;
+      }
+    });
+    return total;
+  }
+
   void InterpolateIntoArrays(cube& pointCube, cube& gradCube, TCube& isoValCube, uint8 edgeNum, usize idx)
   {
     auto pointsArray = interpolateOnCube(pointCube, isoValCube, edgeNum);
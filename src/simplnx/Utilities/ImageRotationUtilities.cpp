@@ -1,7 +1,267 @@
 
 #include "ImageRotationUtilities.hpp"
 
+#include "simplnx/Common/Range3D.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
+
 #include <algorithm>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+using namespace nx::core;
+
+namespace
+{
+// Transformed cells are resampled in blocks of this size so that the original cells they read stay in cache
+constexpr usize k_BlockSizeX = 32;
+constexpr usize k_BlockSizeY = 8;
+constexpr usize k_BlockSizeZ = 8;
+
+/**
+ * @brief Where a transformed cell samples the original geometry: the tuple of the original cell that contains it and
+ * the 8 surrounding original cell centers with their trilinear weights.
+ */
+struct CellSample
+{
+  bool Valid = false;
+  usize NearestIndex = 0;
+  std::array<usize, 8> CornerIndices = {};
+  std::array<float64, 8> CornerWeights = {};
+};
+
+/**
+ * @brief Writes one row of transformed cells of a DataArray from the CellSamples of the row.
+ */
+class IRowResampler
+{
+public:
+  virtual ~IRowResampler() = default;
+
+  virtual void writeRow(usize destStartIndex, const std::vector<CellSample>& samples) const = 0;
+};
+
+template <typename T>
+class RowResampler : public IRowResampler
+{
+public:
+  RowResampler(const IDataArray& sourceArray, IDataArray& destArray, bool trilinear)
+  : m_SourceStore(sourceArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
+  , m_DestStore(destArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
+  , m_SourceData(DataStoreUtilities::GetContiguousData(m_SourceStore))
+  , m_DestData(DataStoreUtilities::GetContiguousData(m_DestStore))
+  , m_NumComps(m_SourceStore.getNumberOfComponents())
+  , m_Trilinear(trilinear)
+  {
+  }
+
+  void writeRow(usize destStartIndex, const std::vector<CellSample>& samples) const override
+  {
+    for(usize i = 0; i < samples.size(); i++)
+    {
+      const CellSample& sample = samples[i];
+      const usize destOffset = (destStartIndex + i) * m_NumComps;
+      for(usize comp = 0; comp < m_NumComps; comp++)
+      {
+        T value = static_cast<T>(0);
+        if(sample.Valid && m_Trilinear)
+        {
+          float64 interpolated = 0.0;
+          for(usize corner = 0; corner < 8; corner++)
+          {
+            interpolated += sample.CornerWeights[corner] * static_cast<float64>(getSourceValue(sample.CornerIndices[corner] * m_NumComps + comp));
+          }
+          value = static_cast<T>(interpolated);
+        }
+        else if(sample.Valid)
+        {
+          value = getSourceValue(sample.NearestIndex * m_NumComps + comp);
+        }
+        setDestValue(destOffset + comp, value);
+      }
+    }
+  }
+
+private:
+  T getSourceValue(usize index) const
+  {
+    return m_SourceData != nullptr ? m_SourceData[index] : m_SourceStore.getValue(index);
+  }
+
+  void setDestValue(usize index, T value) const
+  {
+    if(m_DestData != nullptr)
+    {
+      m_DestData[index] = value;
+    }
+    else
+    {
+      m_DestStore.setValue(index, value);
+    }
+  }
+
+  const AbstractDataStore<T>& m_SourceStore;
+  AbstractDataStore<T>& m_DestStore;
+  const T* m_SourceData = nullptr;
+  T* m_DestData = nullptr;
+  usize m_NumComps = 0;
+  bool m_Trilinear = false;
+};
+
+struct CreateRowResamplerFunctor
+{
+  template <typename T>
+  std::unique_ptr<IRowResampler> operator()(const IDataArray& sourceArray, IDataArray& destArray, bool trilinear)
+  {
+    // Interpolating labels, phases or masks would create values that do not exist in the original array
+    return std::make_unique<RowResampler<T>>(sourceArray, destArray, trilinear && std::is_floating_point_v<T>);
+  }
+};
+
+usize ClampIndex(int64 index, usize dim)
+{
+  return static_cast<usize>(std::clamp<int64>(index, 0, static_cast<int64>(dim) - 1));
+}
+
+class TransformCellArraysImpl
+{
+public:
+  TransformCellArraysImpl(const std::vector<std::unique_ptr<IRowResampler>>& resamplers, const ImageRotationUtilities::RotateArgs& args, const Eigen::Matrix<float64, 3, 4>& destToSourceIndex,
+                          bool computeWeights, bool sliceBySlice, std::atomic<usize>& cellsCompleted, const std::atomic_bool& shouldCancel)
+  : m_Resamplers(resamplers)
+  , m_SourceDims(args.OriginalDims)
+  , m_DestDims(args.TransformedDims)
+  , m_DestToSourceIndex(destToSourceIndex)
+  , m_ComputeWeights(computeWeights)
+  , m_SliceBySlice(sliceBySlice)
+  , m_CellsCompleted(cellsCompleted)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range3D& range) const
+  {
+    std::vector<CellSample> samples;
+    samples.reserve(k_BlockSizeX);
+
+    for(usize zBlock = range[4]; zBlock < range[5]; zBlock += k_BlockSizeZ)
+    {
+      const usize zEnd = std::min(zBlock + k_BlockSizeZ, range[5]);
+      for(usize yBlock = range[2]; yBlock < range[3]; yBlock += k_BlockSizeY)
+      {
+        const usize yEnd = std::min(yBlock + k_BlockSizeY, range[3]);
+        for(usize xBlock = range[0]; xBlock < range[1]; xBlock += k_BlockSizeX)
+        {
+          if(m_ShouldCancel)
+          {
+            return;
+          }
+          const usize xEnd = std::min(xBlock + k_BlockSizeX, range[1]);
+          for(usize z = zBlock; z < zEnd; z++)
+          {
+            for(usize y = yBlock; y < yEnd; y++)
+            {
+              computeRow(xBlock, xEnd, y, z, samples);
+              const usize destStartIndex = (z * m_DestDims[1] + y) * m_DestDims[0] + xBlock;
+              for(const auto& resampler : m_Resamplers)
+              {
+                resampler->writeRow(destStartIndex, samples);
+              }
+            }
+          }
+          m_CellsCompleted.fetch_add((xEnd - xBlock) * (yEnd - yBlock) * (zEnd - zBlock), std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief Computes the samples of the transformed cells [xStart, xEnd) of a row. Only the first cell center goes through
+   * the transformation, the following ones are one X step of the transformed geometry further along in the original one.
+   */
+  void computeRow(usize xStart, usize xEnd, usize y, usize z, std::vector<CellSample>& samples) const
+  {
+    samples.resize(xEnd - xStart);
+    Eigen::Vector3d position = m_DestToSourceIndex * Eigen::Vector4d(static_cast<float64>(xStart) + 0.5, static_cast<float64>(y) + 0.5, static_cast<float64>(z) + 0.5, 1.0);
+    const Eigen::Vector3d step = m_DestToSourceIndex.col(0);
+    for(CellSample& sample : samples)
+    {
+      computeSample(position, z, sample);
+      position += step;
+    }
+  }
+
+  /**
+   * @brief position is in continuous indices of the original geometry, i.e. original cell i covers [i, i + 1) along each axis.
+   */
+  void computeSample(const Eigen::Vector3d& position, usize z, CellSample& sample) const
+  {
+    std::array<usize, 3> nearest = {0, 0, 0};
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      if(!(position[axis] >= 0.0 && position[axis] < static_cast<float64>(m_SourceDims[axis])))
+      {
+        sample.Valid = false;
+        return;
+      }
+      nearest[axis] = std::min(static_cast<usize>(position[axis]), m_SourceDims[axis] - 1);
+    }
+    if(m_SliceBySlice)
+    {
+      if(z >= m_SourceDims[2])
+      {
+        sample.Valid = false;
+        return;
+      }
+      nearest[2] = z;
+    }
+    sample.Valid = true;
+    sample.NearestIndex = (nearest[2] * m_SourceDims[1] + nearest[1]) * m_SourceDims[0] + nearest[0];
+    if(!m_ComputeWeights)
+    {
+      return;
+    }
+
+    // Interpolate between the surrounding cell centers, which sit at i + 0.5. Centers outside of the geometry are clamped to the border cells.
+    std::array<std::array<usize, 2>, 3> cornerIndices = {};
+    std::array<std::array<float64, 2>, 3> axisWeights = {};
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      const float64 lower = std::floor(position[axis] - 0.5);
+      const float64 fraction = position[axis] - 0.5 - lower;
+      const auto lowerIndex = static_cast<int64>(lower);
+      cornerIndices[axis] = {ClampIndex(lowerIndex, m_SourceDims[axis]), ClampIndex(lowerIndex + 1, m_SourceDims[axis])};
+      axisWeights[axis] = {1.0 - fraction, fraction};
+    }
+    if(m_SliceBySlice)
+    {
+      cornerIndices[2] = {z, z};
+      axisWeights[2] = {1.0, 0.0};
+    }
+    for(usize corner = 0; corner < 8; corner++)
+    {
+      const usize xi = corner & 1;
+      const usize yi = (corner >> 1) & 1;
+      const usize zi = (corner >> 2) & 1;
+      sample.CornerIndices[corner] = (cornerIndices[2][zi] * m_SourceDims[1] + cornerIndices[1][yi]) * m_SourceDims[0] + cornerIndices[0][xi];
+      sample.CornerWeights[corner] = axisWeights[0][xi] * axisWeights[1][yi] * axisWeights[2][zi];
+    }
+  }
+
+  const std::vector<std::unique_ptr<IRowResampler>>& m_Resamplers;
+  const SizeVec3 m_SourceDims;
+  const SizeVec3 m_DestDims;
+  const Eigen::Matrix<float64, 3, 4> m_DestToSourceIndex;
+  const bool m_ComputeWeights;
+  const bool m_SliceBySlice;
+  std::atomic<usize>& m_CellsCompleted;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
 
 namespace nx::core::ImageRotationUtilities
 {
@@ -237,43 +497,56 @@ ImageRotationUtilities::Matrix4fR GenerateScaleTransformationMatrix(const Vector
 }
 
 //------------------------------------------------------------------------------
-size_t FindOctant(const RotateArgs& params, const Point3Df& centerPoint, const Eigen::Array4f& coord)
+void TransformCellArrays(const std::vector<std::pair<const IDataArray*, IDataArray*>>& arrays, const RotateArgs& args, const Matrix4fR& transformationMatrix, InterpolationType interpolation,
+                         bool sliceBySlice, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
 {
-
-  const float xResHalf = params.xRes * 0.5F;
-  const float yResHalf = params.yRes * 0.5F;
-  const float zResHalf = params.zRes * 0.5F;
-
-  // Form the 8 corner coords for the voxel
-  // clang-format off
-  std::array<FloatVec3, 8> unitSquareCoords = {
-  /* P1 */ FloatVec3(centerPoint[0]-xResHalf, centerPoint[1]-yResHalf, centerPoint[2]-zResHalf),
-  /* P2 */ FloatVec3(centerPoint[0]+xResHalf, centerPoint[1]-yResHalf, centerPoint[2]-zResHalf),
-  /* P3 */ FloatVec3(centerPoint[0]+xResHalf, centerPoint[1]+yResHalf, centerPoint[2]-zResHalf),
-  /* P4 */ FloatVec3(centerPoint[0]-xResHalf, centerPoint[1]+yResHalf, centerPoint[2]-zResHalf),
-  /* P5 */ FloatVec3(centerPoint[0]-xResHalf, centerPoint[1]-yResHalf, centerPoint[2]+zResHalf),
-  /* P6 */ FloatVec3(centerPoint[0]+xResHalf, centerPoint[1]-yResHalf, centerPoint[2]+zResHalf),
-  /* P7 */ FloatVec3(centerPoint[0]+xResHalf, centerPoint[1]+yResHalf, centerPoint[2]+zResHalf),
-  /* P8 */ FloatVec3(centerPoint[0]-xResHalf, centerPoint[1]+yResHalf, centerPoint[2]+zResHalf),
-  };
-  // clang-format on
-
-  //  Now figure out which corner the inverse transformed point is closest to
-  //  this will give us which octant the point lies.
-  float minDistance = std::numeric_limits<float>::max();
-  size_t minIndex = 0;
-  for(size_t i = 0; i < 8; i++)
+  const bool trilinear = interpolation == InterpolationType::Trilinear;
+  bool computeWeights = false;
+  std::vector<std::unique_ptr<IRowResampler>> resamplers;
+  IParallelAlgorithm::AlgorithmArrays algArrays;
+  for(const auto& [sourceArray, destArray] : arrays)
   {
-    float const distance = unitSquareCoords[i][0] * coord[0] + unitSquareCoords[i][1] * coord[1] + unitSquareCoords[i][2] * coord[2];
-
-    if(distance < minDistance)
-    {
-      minDistance = distance;
-      minIndex = i;
-    }
+    const DataType dataType = sourceArray->getDataType();
+    computeWeights = computeWeights || (trilinear && (dataType == DataType::float32 || dataType == DataType::float64));
+    resamplers.push_back(ExecuteDataFunction(CreateRowResamplerFunctor{}, dataType, *sourceArray, *destArray, trilinear));
+    algArrays.push_back(sourceArray);
+    algArrays.push_back(destArray);
+  }
+  if(resamplers.empty())
+  {
+    return;
   }
 
-  return minIndex;
+  // Maps continuous indices of the transformed geometry to continuous indices of the original geometry
+  Eigen::Matrix4d destIndexToCoords = Eigen::Matrix4d::Identity();
+  Eigen::Matrix4d sourceCoordsToIndex = Eigen::Matrix4d::Identity();
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    destIndexToCoords(axis, axis) = args.TransformedSpacing[axis];
+    destIndexToCoords(axis, 3) = args.TransformedOrigin[axis];
+    sourceCoordsToIndex(axis, axis) = 1.0 / args.OriginalSpacing[axis];
+    sourceCoordsToIndex(axis, 3) = -args.OriginalOrigin[axis] / args.OriginalSpacing[axis];
+  }
+  const Eigen::Matrix4d inverseTransform = transformationMatrix.cast<float64>().inverse();
+  const Eigen::Matrix<float64, 3, 4> destToSourceIndex = (sourceCoordsToIndex * inverseTransform * destIndexToCoords).topRows<3>();
+
+  ParallelData3DAlgorithm dataAlg;
+  dataAlg.setRange(args.TransformedDims[0], args.TransformedDims[1], args.TransformedDims[2]);
+  dataAlg.requireArraysInMemory(algArrays);
+
+  // The worker threads only count the cells they finish. Progress is sent from this thread once a second, so the
+  // message handler is never called from the worker threads.
+  const usize totalCells = std::max<usize>(args.TransformedDims[0] * args.TransformedDims[1] * args.TransformedDims[2], 1);
+  std::atomic<usize> cellsCompleted = 0;
+  auto resampleFuture = std::async(std::launch::async, [&]() {
+    dataAlg.execute(TransformCellArraysImpl(resamplers, args, destToSourceIndex, computeWeights, sliceBySlice, cellsCompleted, shouldCancel));
+  });
+  while(resampleFuture.wait_for(std::chrono::seconds(1)) != std::future_status::ready)
+  {
+    const auto progress = static_cast<int32>(cellsCompleted.load(std::memory_order_relaxed) * 100 / totalCells);
+    messageHandler(IFilter::ProgressMessage{IFilter::Message::Type::Progress, fmt::format("Resampling Cell Arrays || {}% Complete", progress), progress});
+  }
+  resampleFuture.get();
 }
 
 } // namespace nx::core::ImageRotationUtilities
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The mask views are the compile-time counterpart of MaskCompare. They all provide isTrue(),
+ * bothTrue() and bothFalse() as non-virtual inline functions, so a loop that takes the view as a
+ * template parameter has no per element call overhead. Use ExecuteWithMaskView() to select the view
+ * that matches a mask array, or PackedMaskView when the same mask is queried many times.
+ *
+ * An example use of these classes would be the following:
+ * @code
+ *  const IDataArray* maskArray = useMask ? m_DataStructure.getDataAs<IDataArray>(maskArrayPath) : nullptr;
+ *  ExecuteWithMaskView(maskArray, [&](const auto& maskView) {
+ *    for(usize i = 0; i < numTuples; i++)
+ *    {
+ *      if(maskView.isTrue(i))
+ *      {
+ *        // Do something with the good voxel...
+ *      }
+ *    }
+ *  });
+ * @endcode
+ */
+
+/**
+ * @brief Mask view used when no mask is selected. Every element is true.
+ */
+struct AlwaysTrueMaskView
+{
+  static inline constexpr bool k_AlwaysTrue = true;
+
+  constexpr bool isTrue(usize) const
+  {
+    return true;
+  }
+
+  constexpr bool bothTrue(usize, usize) const
+  {
+    return true;
+  }
+
+  constexpr bool bothFalse(usize, usize) const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Mask view over a bool or uint8 data store. Stores held in contiguous memory are read
+ * directly, any other store is read through AbstractDataStore::getValue().
+ */
+template <typename T>
+class DataStoreMaskView
+{
+public:
+  static_assert(std::is_same_v<T, bool> || std::is_same_v<T, uint8>, "DataStoreMaskView only supports bool and uint8 masks");
+
+  static inline constexpr bool k_AlwaysTrue = false;
+
+  explicit DataStoreMaskView(const AbstractDataStore<T>& dataStore)
+  : m_DataStore(dataStore)
+  , m_Data(DataStoreUtilities::GetContiguousData(dataStore))
+  {
+  }
+
+  bool isTrue(usize index) const
+  {
+    return (m_Data != nullptr ? m_Data[index] : m_DataStore.getValue(index)) != static_cast<T>(0);
+  }
+
+  bool bothTrue(usize indexA, usize indexB) const
+  {
+    return isTrue(indexA) && isTrue(indexB);
+  }
+
+  bool bothFalse(usize indexA, usize indexB) const
+  {
+    return !isTrue(indexA) && !isTrue(indexB);
+  }
+
+private:
+  const AbstractDataStore<T>& m_DataStore;
+  const T* m_Data = nullptr;
+};
+
+/**
+ * @brief Mask view over a copy of a mask packed into 64 bit words, where bit (i % 64) of word (i / 64)
+ * holds element i. Packing reads the mask once, after which the view does not depend on the store type
+ * and uses an eighth of the memory of a bool mask.
+ */
+class PackedMaskView
+{
+public:
+  static inline constexpr bool k_AlwaysTrue = false;
+
+  PackedMaskView() = default;
+
+  /**
+   * @brief Packs a bool or uint8 mask array. Fails for any other type or if the mask could not be read.
+   * @param maskArray
+   * @return Result<PackedMaskView>
+   */
+  static Result<PackedMaskView> Create(const IDataArray& maskArray)
+  {
+    switch(maskArray.getDataType())
+    {
+    case DataType::boolean:
+      return Create(dynamic_cast<const BoolArray&>(maskArray).getDataStoreRef());
+    case DataType::uint8:
+      return Create(dynamic_cast<const UInt8Array&>(maskArray).getDataStoreRef());
+    default:
+      return MakeErrorResult<PackedMaskView>(-14640, "PackedMaskView: The Mask Array being used is NOT of type bool or uint8.");
+    }
+  }
+
+  /**
+   * @brief Packs a bool or uint8 mask store. Fails if the store could not be read.
+   * @param dataStore
+   * @return Result<PackedMaskView>
+   */
+  template <typename T>
+  static Result<PackedMaskView> Create(const AbstractDataStore<T>& dataStore)
+  {
+    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, uint8>, "PackedMaskView only supports bool and uint8 masks");
+
+    PackedMaskView maskView;
+    maskView.m_Size = dataStore.getSize();
+    maskView.m_Words.assign((maskView.m_Size + 63) / 64, 0);
+    // The block size is a multiple of 64, so every block starts on a word boundary.
+    Result<> readResult = DataStoreUtilities::ReadBlocks(dataStore, [&maskView](usize blockStart, nonstd::span<const T> values) {
+      uint64* words = maskView.m_Words.data() + blockStart / 64;
+      for(usize offset = 0; offset < values.size(); offset++)
+      {
+        words[offset / 64] |= static_cast<uint64>(values[offset] != static_cast<T>(0)) << (offset % 64);
+      }
+    });
+    if(readResult.invalid())
+    {
+      return ConvertInvalidResult<PackedMaskView>(std::move(readResult));
+    }
+    return {std::move(maskView)};
+  }
+
+  bool isTrue(usize index) const
+  {
+    return ((m_Words[index / 64] >> (index % 64)) & 1) != 0;
+  }
+
+  bool bothTrue(usize indexA, usize indexB) const
+  {
+    return isTrue(indexA) && isTrue(indexB);
+  }
+
+  bool bothFalse(usize indexA, usize indexB) const
+  {
+    return !isTrue(indexA) && !isTrue(indexB);
+  }
+
+  /**
+   * @brief Returns the number of elements in the mask.
+   * @return usize
+   */
+  usize getSize() const
+  {
+    return m_Size;
+  }
+
+  /**
+   * @brief Returns the number of true elements in the mask.
+   * @return usize
+   */
+  usize countTrueValues() const
+  {
+    usize count = 0;
+    for(uint64 word : m_Words)
+    {
+      count += static_cast<usize>(std::popcount(word));
+    }
+    return count;
+  }
+
+  /**
+   * @brief Returns the packed words of the mask.
+   * @return const std::vector<uint64>&
+   */
+  const std::vector<uint64>& getWords() const
+  {
+    return m_Words;
+  }
+
+private:
+  std::vector<uint64> m_Words;
+  usize m_Size = 0;
+};
+
+/**
+ * @brief Calls func(maskView) with the mask view that matches the mask array: AlwaysTrueMaskView
+ * when maskArray is nullptr, otherwise a DataStoreMaskView<bool> or DataStoreMaskView<uint8>.
+ * Throws std::runtime_error if the mask array is neither bool nor uint8, like InstantiateMaskCompare().
+ * @param maskArray
+ * @param func
+ * @return The value returned by func, which must be the same type for every view.
+ */
+template <class FuncT>
+decltype(auto) ExecuteWithMaskView(const IDataArray* maskArray, FuncT&& func)
+{
+  if(maskArray == nullptr)
+  {
+    return func(AlwaysTrueMaskView{});
+  }
+  switch(maskArray->getDataType())
+  {
+  case DataType::boolean:
+    return func(DataStoreMaskView<bool>(dynamic_cast<const BoolArray*>(maskArray)->getDataStoreRef()));
+  case DataType::uint8:
+    return func(DataStoreMaskView<uint8>(dynamic_cast<const UInt8Array*>(maskArray)->getDataStoreRef()));
+  default:
+    throw std::runtime_error("ExecuteWithMaskView: The Mask Array being used is NOT of type bool or uint8.");
+  }
+}
+} // namespace nx::core
@@ -112,18 +112,13 @@ float findMedian(const C<T, Ts...>& source)
   {
     return 0.0f;
   }
-  std::sort(tmpList.begin(), tmpList.end());
-  float medVal = 0.0f;
-  if(tmpList.size() % 2 == 1)
-  {
-    size_t halfElements = static_cast<size_t>(std::floor(tmpList.size() / 2.0f));
-    medVal = tmpList[halfElements];
-  }
-  else
+  // A selection is enough to find the middle element(s), a full sort is not needed
+  const auto upper = tmpList.begin() + static_cast<std::ptrdiff_t>(tmpList.size() / 2);
+  std::nth_element(tmpList.begin(), upper, tmpList.end());
+  float medVal = *upper;
+  if(tmpList.size() % 2 == 0)
   {
-    size_t idxLow = (tmpList.size() / 2) - 1;
-    size_t idxHigh = tmpList.size() / 2;
-    medVal = (tmpList[idxLow] + tmpList[idxHigh]) * 0.5f;
+    medVal = (*std::max_element(tmpList.begin(), upper) + *upper) * 0.5f;
   }
   return medVal;
 }
@@ -230,8 +225,9 @@ size_t findNumUniqueValues(const C<T, Ts...>& source)
   {
     return 0;
   }
-  std::set<T> sourceSet(std::begin(source), std::end(source));
-  return sourceSet.size();
+  std::vector<T> tmpList{std::cbegin(source), std::cend(source)};
+  std::sort(tmpList.begin(), tmpList.end());
+  return static_cast<size_t>(std::distance(tmpList.begin(), std::unique(tmpList.begin(), tmpList.end())));
 }
 
 // -----------------------------------------------------------------------------
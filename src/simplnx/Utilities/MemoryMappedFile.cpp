@@ -0,0 +1,157 @@
+#include "MemoryMappedFile.hpp"
+
+#include <fmt/core.h>
+
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_FileSizeError = -4570;
+constexpr int32 k_OpenFileError = -4571;
+constexpr int32 k_MapFileError = -4572;
+} // namespace
+
+Result<MemoryMappedFile> MemoryMappedFile::Open(const std::filesystem::path& filePath)
+{
+  std::error_code errorCode;
+  const uintmax_t fileSize = std::filesystem::file_size(filePath, errorCode);
+  if(errorCode)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_FileSizeError, fmt::format("Could not get the size of '{}': {}", filePath.string(), errorCode.message()));
+  }
+
+  MemoryMappedFile mappedFile;
+  mappedFile.m_Size = static_cast<usize>(fileSize);
+  if(fileSize == 0)
+  {
+    return {std::move(mappedFile)};
+  }
+
+#if defined(_WIN32)
+  HANDLE fileHandle = CreateFileW(filePath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if(fileHandle == INVALID_HANDLE_VALUE)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_OpenFileError, fmt::format("Could not open '{}' for memory mapping", filePath.string()));
+  }
+  mappedFile.m_FileHandle = fileHandle;
+
+  HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if(mappingHandle == nullptr)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_MapFileError, fmt::format("Could not memory map '{}'", filePath.string()));
+  }
+  mappedFile.m_MappingHandle = mappingHandle;
+
+  const void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if(view == nullptr)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_MapFileError, fmt::format("Could not memory map '{}'", filePath.string()));
+  }
+  mappedFile.m_Data = static_cast<const uint8*>(view);
+#else
+  const int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+  if(fileDescriptor < 0)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_OpenFileError, fmt::format("Could not open '{}' for memory mapping", filePath.string()));
+  }
+  mappedFile.m_FileDescriptor = fileDescriptor;
+
+  void* view = ::mmap(nullptr, mappedFile.m_Size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  if(view == MAP_FAILED)
+  {
+    return MakeErrorResult<MemoryMappedFile>(k_MapFileError, fmt::format("Could not memory map '{}'", filePath.string()));
+  }
+  // The file is parsed front to back by the readers so let the kernel read ahead
+  std::ignore = ::madvise(view, mappedFile.m_Size, MADV_SEQUENTIAL);
+  mappedFile.m_Data = static_cast<const uint8*>(view);
+#endif
+
+  return {std::move(mappedFile)};
+}
+
+MemoryMappedFile::~MemoryMappedFile() noexcept
+{
+  close();
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+: m_Data(std::exchange(other.m_Data, nullptr))
+, m_Size(std::exchange(other.m_Size, 0))
+#if defined(_WIN32)
+, m_FileHandle(std::exchange(other.m_FileHandle, nullptr))
+, m_MappingHandle(std::exchange(other.m_MappingHandle, nullptr))
+#else
+, m_FileDescriptor(std::exchange(other.m_FileDescriptor, -1))
+#endif
+{
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+{
+  if(this != &other)
+  {
+    close();
+    m_Data = std::exchange(other.m_Data, nullptr);
+    m_Size = std::exchange(other.m_Size, 0);
+#if defined(_WIN32)
+    m_FileHandle = std::exchange(other.m_FileHandle, nullptr);
+    m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#else
+    m_FileDescriptor = std::exchange(other.m_FileDescriptor, -1);
+#endif
+  }
+  return *this;
+}
+
+const uint8* MemoryMappedFile::data() const
+{
+  return m_Data;
+}
+
+usize MemoryMappedFile::size() const
+{
+  return m_Size;
+}
+
+void MemoryMappedFile::close()
+{
+#if defined(_WIN32)
+  if(m_Data != nullptr)
+  {
+    UnmapViewOfFile(m_Data);
+  }
+  if(m_MappingHandle != nullptr)
+  {
+    CloseHandle(m_MappingHandle);
+  }
+  if(m_FileHandle != nullptr)
+  {
+    CloseHandle(m_FileHandle);
+  }
+  m_MappingHandle = nullptr;
+  m_FileHandle = nullptr;
+#else
+  if(m_Data != nullptr)
+  {
+    ::munmap(const_cast<uint8*>(m_Data), m_Size);
+  }
+  if(m_FileDescriptor >= 0)
+  {
+    ::close(m_FileDescriptor);
+  }
+  m_FileDescriptor = -1;
+#endif
+  m_Data = nullptr;
+  m_Size = 0;
+}
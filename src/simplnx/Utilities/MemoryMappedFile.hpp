@@ -0,0 +1,62 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <filesystem>
+
+namespace nx::core
+{
+/**
+ * @class MemoryMappedFile
+ * @brief The MemoryMappedFile class maps a whole file read-only into memory so that it can be parsed
+ * by several threads at once without copying it through a stream. The mapping is released when the
+ * object is destroyed.
+ */
+class SIMPLNX_EXPORT MemoryMappedFile
+{
+public:
+  /**
+   * @brief Maps the file at filePath read-only. Empty files are valid and have no data.
+   * @param filePath
+   * @return Result<MemoryMappedFile>
+   */
+  static Result<MemoryMappedFile> Open(const std::filesystem::path& filePath);
+
+  /**
+   * @brief Creates an object that does not map any file.
+   */
+  MemoryMappedFile() = default;
+  ~MemoryMappedFile() noexcept;
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+  /**
+   * @brief Returns the first byte of the file or nullptr if the file is empty.
+   * @return const uint8*
+   */
+  const uint8* data() const;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   * @return usize
+   */
+  usize size() const;
+
+private:
+  void close();
+
+  const uint8* m_Data = nullptr;
+  usize m_Size = 0;
+#if defined(_WIN32)
+  void* m_FileHandle = nullptr;
+  void* m_MappingHandle = nullptr;
+#else
+  int m_FileDescriptor = -1;
+#endif
+};
+} // namespace nx::core
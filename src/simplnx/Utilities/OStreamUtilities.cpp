@@ -4,7 +4,6 @@
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
 #include <chrono>
-#include <iomanip>
 #include <ostream>
 #include <string>
 
@@ -143,61 +142,33 @@ struct PrintDataArray
                       int32 tuplesPerLine = 0)
   {
     auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
-    auto start = std::chrono::steady_clock::now();
-    auto numTuples = dataStore.getNumberOfTuples();
-    if(tuplesPerLine == 0)
-    {
-      tuplesPerLine = 1;
-    }
+    const usize numTuples = dataStore.getNumberOfTuples();
+    const usize numComps = dataStore.getNumberOfComponents();
+    const usize numTuplesPerLine = tuplesPerLine <= 0 ? 1 : static_cast<usize>(tuplesPerLine);
 
-    usize numComps = dataStore.getNumberOfComponents();
-    int32 tuplesWritten = 0;
-    for(size_t tuple = 0; tuple < numTuples; tuple++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        auto string = fmt::format("Processing {}: {}% completed", inputDataArray->getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-        mesgHandler(IFilter::Message::Type::Info, string);
-        start = now;
-        if(shouldCancel)
+    auto formatBlock = [&](std::string& buffer, usize tupleBegin, usize tupleEnd) -> Result<> {
+      return DataStoreUtilities::ReadBlocks(dataStore, tupleBegin * numComps, tupleEnd * numComps, [&](usize blockStart, nonstd::span<const ScalarType> values) {
+        for(usize i = 0; i < values.size(); i++)
         {
-          return {};
-        }
-      }
-      // Write out all the components for this tuple
-      for(size_t index = 0; index < numComps; index++)
-      {
-        if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-        {
-          outputStrm << static_cast<int32>(dataStore[tuple * numComps + index]);
-        }
-        else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-        {
-          outputStrm << fmt::format("{}", dataStore[tuple * numComps + index]);
-        }
-        else
-        {
-          outputStrm << dataStore[tuple * numComps + index];
-        }
-        if(index != numComps - 1)
-        {
-          outputStrm << delimiter;
+          const usize index = blockStart + i;
+          OStreamUtilities::AppendValue(buffer, values[i]);
+          if(index % numComps != numComps - 1)
+          {
+            buffer.append(delimiter);
+          }
+          // At the end of a tuple figure out if we need a new line character or if we need the delimiter instead.
+          else if((index / numComps + 1) % numTuplesPerLine == 0)
+          {
+            buffer.push_back('\n');
+          }
+          else
+          {
+            buffer.append(delimiter);
+          }
         }
-      }
-      // Now figure out if we need a new line character or if we need the delimiter instead.
-      tuplesWritten++;
-      if(tuplesWritten == tuplesPerLine)
-      {
-        outputStrm << '\n';
-        tuplesWritten = 0;
-      }
-      else
-      {
-        outputStrm << delimiter;
-      }
-    }
-    return {};
+      });
+    };
+    return OStreamUtilities::WriteBlocks(outputStrm, numTuples, formatBlock, mesgHandler, fmt::format("Processing {}", inputDataArray->getName()), shouldCancel, {&dataStore});
   }
 };
 
@@ -240,7 +211,8 @@ class ITupleWriter
 public:
   ITupleWriter() = default;
   virtual ~ITupleWriter() = default;
-  virtual void write(std::ostream& outputStrm, usize tupleIndex) const = 0;
+  virtual void write(std::string& buffer, usize tupleIndex) const = 0;
+  virtual const IDataStore* getDataStore() const = 0;
   virtual void writeHeader(std::ostream& outputStrm) const = 0;
 };
 
@@ -262,9 +234,16 @@ public:
   StringTupleWriter& operator=(const StringTupleWriter&) = delete;
   StringTupleWriter& operator=(StringTupleWriter&&) noexcept = delete;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(std::string& buffer, usize tupleIndex) const override
   {
-    outputStrm << m_Delimiter << m_DataArray[tupleIndex] << m_Delimiter;
+    buffer.append(m_Delimiter);
+    buffer.append(m_DataArray[tupleIndex]);
+    buffer.append(m_Delimiter);
+  }
+
+  const IDataStore* getDataStore() const override
+  {
+    return nullptr;
   }
 
   void writeHeader(std::ostream& outputStrm) const override
@@ -292,33 +271,34 @@ public:
   }
   ~TupleWriter() override = default;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  void write(std::string& buffer, usize tupleIndex) const override
   {
     for(usize comp = 0; comp < m_NumComps; comp++)
     {
-      if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-      {
-        outputStrm << static_cast<int32>(m_DataStore[tupleIndex * m_NumComps + comp]);
-      }
-      else if constexpr(std::is_same_v<ScalarType, float32>)
+      if constexpr(std::is_same_v<ScalarType, float32>)
       {
-        outputStrm << std::setprecision(8) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
+        fmt::format_to(std::back_inserter(buffer), "{:.8g}", m_DataStore[tupleIndex * m_NumComps + comp]);
       }
       else if constexpr(std::is_same_v<ScalarType, float64>)
       {
-        outputStrm << std::setprecision(16) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
+        fmt::format_to(std::back_inserter(buffer), "{:.16g}", m_DataStore[tupleIndex * m_NumComps + comp]);
       }
       else
       {
-        outputStrm << m_DataStore[tupleIndex * m_NumComps + comp];
+        OStreamUtilities::AppendInteger(buffer, m_DataStore[tupleIndex * m_NumComps + comp]);
       }
       if(comp < m_NumComps - 1)
       {
-        outputStrm << m_Delimiter;
+        buffer.append(m_Delimiter);
       }
     }
   }
 
+  const IDataStore* getDataStore() const override
+  {
+    return &m_DataStore;
+  }
+
   void writeHeader(std::ostream& outputStrm) const override
   {
     // If there is only 1 component then write the name of the array and return
@@ -420,7 +400,11 @@ Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths,
         }
         else
         {
-          ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outStrm, dataArray, mesgHandler, shouldCancel, delimiter, tuplesPerLine);
+          Result<> printResult = ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outStrm, dataArray, mesgHandler, shouldCancel, delimiter, tuplesPerLine);
+          if(printResult.invalid())
+          {
+            return printResult;
+          }
         }
       }
       auto* stringArray = dataStructure.getDataAs<StringArray>(dataPath);
@@ -503,14 +487,14 @@ void PrintSingleDataObject(std::ostream& outputStrm, const DataPath& objectPath,
  * @param includeHeaders The boolean that determines if headers are printed
  * @param componentsPerLine The amount of elements to be inserted before newline character
  * @param neighborLists The list of dataPaths of neighborlists to include
+ * @return Result<>
  */
-void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
-                               const std::atomic_bool& shouldCancel, const std::string& delimiter, bool includeIndex, bool includeHeaders, bool writeFirstIndex, const std::string& indexName,
-                               const std::vector<DataPath>& neighborLists, bool writeNumOfFeatures)
+Result<> PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
+                                   const std::atomic_bool& shouldCancel, const std::string& delimiter, bool includeIndex, bool includeHeaders, bool writeFirstIndex, const std::string& indexName,
+                                   const std::vector<DataPath>& neighborLists, bool writeNumOfFeatures)
 {
   const auto& firstDataArray = dataStructure.getDataRefAs<IArray>(objectPaths[0]);
   usize numTuples = firstDataArray.getNumberOfTuples();
-  auto start = std::chrono::steady_clock::now();
 
   // Create our wrapper classes for each DataArray
   std::vector<std::shared_ptr<ITupleWriter>> writers;
@@ -533,7 +517,7 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
 
   if(shouldCancel)
   {
-    return;
+    return {};
   }
 
   if(writeNumOfFeatures)
@@ -568,41 +552,49 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
 
   if(shouldCancel)
   {
-    return;
+    return {};
   }
 
-  // Loop on ever tuple using our predefined writer for each data array
+  // Loop on every tuple using our predefined writer for each data array
   size_t writerIndexStart = 0;
   if(!writeFirstIndex)
   {
     writerIndexStart = 1;
   }
-  for(usize tupleIndex = writerIndexStart; tupleIndex < numTuples; tupleIndex++)
+  IParallelAlgorithm::AlgorithmStores stores;
+  for(const auto& writer : writers)
   {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    stores.push_back(writer->getDataStore());
+  }
+  auto formatBlock = [&](std::string& buffer, usize begin, usize end) -> Result<> {
+    for(usize tupleIndex = writerIndexStart + begin; tupleIndex < writerIndexStart + end; tupleIndex++)
     {
-      auto string = fmt::format("Printing tuples: {}% completed", static_cast<int32>(100 * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
+      if(includeIndex)
       {
-        return;
+        OStreamUtilities::AppendInteger(buffer, tupleIndex);
+        buffer.append(delimiter);
       }
-    }
-    if(includeIndex)
-    {
-      outputStrm << tupleIndex << delimiter;
-    }
-    for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
-    {
-      writers[writerIndex]->write(outputStrm, tupleIndex);
-      if(writerIndex != writersCount - 1)
+      for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
       {
-        outputStrm << delimiter;
+        writers[writerIndex]->write(buffer, tupleIndex);
+        if(writerIndex != writersCount - 1)
+        {
+          buffer.append(delimiter);
+        }
       }
+      buffer.push_back('\n');
     }
-    outputStrm << '\n';
+    return {};
+  };
+  const usize numTuplesToWrite = numTuples > writerIndexStart ? numTuples - writerIndexStart : 0;
+  Result<> writeResult = OStreamUtilities::WriteBlocks(outputStrm, numTuplesToWrite, formatBlock, mesgHandler, "Printing tuples", shouldCancel, stores);
+  if(writeResult.invalid())
+  {
+    return writeResult;
+  }
+  if(shouldCancel)
+  {
+    return {};
   }
 
   if(!neighborLists.empty())
@@ -612,13 +604,20 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
       auto* neighborList = dataStructure.getDataAs<INeighborList>(dataPath);
       if(neighborList != nullptr)
       {
-        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+        Result<> neighborResult =
+            ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+        if(neighborResult.invalid())
+        {
+          return neighborResult;
+        }
       }
       if(shouldCancel)
       {
-        return;
+        return {};
       }
     }
   }
-};
+
+  return {};
+}
 } // namespace nx::core::OStreamUtilities
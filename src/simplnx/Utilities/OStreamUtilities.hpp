@@ -1,5 +1,7 @@
 #pragma once
 
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/Common/Range.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataObject.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
@@ -9,9 +11,192 @@
 #include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
 
 namespace nx::core::OStreamUtilities
 {
+/**
+ * @brief Number of items WriteBlocks() formats into one buffer by default.
+ */
+inline constexpr usize k_DefaultBlockSize = 8192;
+
+/**
+ * @brief Number of blocks WriteBlocks() formats in parallel before writing them out.
+ */
+inline constexpr usize k_BlocksPerBatch = 64;
+
+inline constexpr int32 k_StreamWriteError = -4580;
+
+/**
+ * @brief Appends the decimal representation of an integer, the same characters std::ostream writes.
+ * int8, uint8 and bool are written as numbers rather than characters.
+ * @param buffer
+ * @param value
+ */
+template <typename T>
+void AppendInteger(std::string& buffer, T value)
+{
+  static_assert(std::is_integral_v<T>, "AppendInteger only works on integer types");
+  std::array<char, 24> chars = {};
+  std::to_chars_result result;
+  if constexpr(std::is_same_v<T, bool> || sizeof(T) == 1)
+  {
+    result = std::to_chars(chars.data(), chars.data() + chars.size(), static_cast<int32>(value));
+  }
+  else
+  {
+    result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+  }
+  buffer.append(chars.data(), result.ptr);
+}
+
+/**
+ * @brief Appends a value the way the text writers have always written it: integers as numbers and floating
+ * point values in their shortest round trip representation.
+ * @param buffer
+ * @param value
+ */
+template <typename T>
+void AppendValue(std::string& buffer, T value)
+{
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    fmt::format_to(std::back_inserter(buffer), "{}", value);
+  }
+  else
+  {
+    AppendInteger(buffer, value);
+  }
+}
+
+/**
+ * @brief Writes numItems items to outputStrm. The items are split into blocks of blockSize items that are
+ * formatted in parallel by Result<> formatBlock(std::string& buffer, usize begin, usize end), each block into
+ * its own buffer. The buffers are then written in order with a single write() each, so the output is the same
+ * as formatting every item in sequence. Blocks are only formatted in parallel if all stores are in memory.
+ * Nothing more is written once formatBlock fails and its first error is returned.
+ * @param outputStrm
+ * @param numItems
+ * @param formatBlock
+ * @param mesgHandler
+ * @param label Prefix of the progress messages
+ * @param shouldCancel
+ * @param stores The stores read by formatBlock
+ * @param blockSize
+ * @return Result<>
+ */
+template <class FormatBlockFunc>
+Result<> WriteBlocks(std::ostream& outputStrm, usize numItems, const FormatBlockFunc& formatBlock, const IFilter::MessageHandler& mesgHandler, const std::string& label,
+                     const std::atomic_bool& shouldCancel, const IParallelAlgorithm::AlgorithmStores& stores = {}, usize blockSize = k_DefaultBlockSize)
+{
+  blockSize = std::max<usize>(blockSize, 1);
+  const usize numBlocks = (numItems + blockSize - 1) / blockSize;
+  std::vector<std::string> buffers(std::min(numBlocks, k_BlocksPerBatch));
+  auto start = std::chrono::steady_clock::now();
+  for(usize batchStart = 0; batchStart < numBlocks; batchStart += buffers.size())
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const usize batchSize = std::min(buffers.size(), numBlocks - batchStart);
+
+    std::atomic_bool formatFailed = false;
+    std::mutex formatErrorMutex;
+    Result<> formatError;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, batchSize);
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute([&](const Range& range) {
+      for(usize block = range.min(); block < range.max() && !formatFailed; block++)
+      {
+        const usize begin = (batchStart + block) * blockSize;
+        buffers[block].clear();
+        Result<> blockResult = formatBlock(buffers[block], begin, std::min(begin + blockSize, numItems));
+        if(blockResult.invalid())
+        {
+          const std::lock_guard<std::mutex> lock(formatErrorMutex);
+          if(!formatFailed)
+          {
+            formatError = std::move(blockResult);
+            formatFailed = true;
+          }
+          return;
+        }
+      }
+    });
+    if(formatFailed)
+    {
+      return formatError;
+    }
+
+    for(usize block = 0; block < batchSize; block++)
+    {
+      outputStrm.write(buffers[block].data(), static_cast<std::streamsize>(buffers[block].size()));
+    }
+    if(outputStrm.fail())
+    {
+      return MakeErrorResult(k_StreamWriteError, fmt::format("{}: Error writing to the output stream", label));
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      const usize itemsWritten = std::min((batchStart + batchSize) * blockSize, numItems);
+      mesgHandler(IFilter::Message::Type::Info, fmt::format("{}: {}% completed", label, static_cast<int32>(100 * static_cast<float>(itemsWritten) / static_cast<float>(numItems))));
+      start = now;
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Writes the values of dataStore as big endian binary. The values are swapped block by block while
+ * they are copied into the write buffers, so the store itself is never modified.
+ * @param outputStrm
+ * @param dataStore
+ * @param mesgHandler
+ * @param label Prefix of the progress messages
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <typename T>
+Result<> WriteBigEndianValues(std::ostream& outputStrm, const AbstractDataStore<T>& dataStore, const IFilter::MessageHandler& mesgHandler, const std::string& label,
+                              const std::atomic_bool& shouldCancel)
+{
+  auto formatBlock = [&dataStore](std::string& buffer, usize begin, usize end) -> Result<> {
+    buffer.resize((end - begin) * sizeof(T));
+    char* bytes = buffer.data();
+    return DataStoreUtilities::ReadBlocks(dataStore, begin, end, [bytes, begin](usize blockStart, nonstd::span<const T> values) {
+      char* blockBytes = bytes + (blockStart - begin) * sizeof(T);
+      for(usize i = 0; i < values.size(); i++)
+      {
+        T value = values[i];
+        if constexpr(endian::little == endian::native)
+        {
+          value = byteswap(value);
+        }
+        std::memcpy(blockBytes + i * sizeof(T), &value, sizeof(T));
+      }
+    });
+  };
+  return WriteBlocks(outputStrm, dataStore.getSize(), formatBlock, mesgHandler, label, shouldCancel, {&dataStore}, DataStoreUtilities::k_DefaultBlockSize);
+}
+
 /**
  * @brief enum for accepted output delimiters in DREAM3D
  */
@@ -80,8 +265,10 @@ SIMPLNX_EXPORT void PrintSingleDataObject(std::ostream& outputStrm, const DataPa
  * @param includeHeaders The boolean that determines if headers are printed
  * @param neighborLists The list of dataPaths of neighborlists to include
  * @param writeNumOfFeatures The amount of elements per tuple printed at top
+ * @return Result<>
  */
-SIMPLNX_EXPORT void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
-                                              const std::atomic_bool& shouldCancel, const std::string& delimiter = "", bool includeIndex = false, bool includeHeaders = false,
-                                              bool writeFirstIndex = true, const std::string& indexName = "Index", const std::vector<DataPath>& neighborLists = {}, bool writeNumOfFeatures = false);
+SIMPLNX_EXPORT Result<> PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataPath>& objectPaths, DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler,
+                                                  const std::atomic_bool& shouldCancel, const std::string& delimiter = "", bool includeIndex = false, bool includeHeaders = false,
+                                                  bool writeFirstIndex = true, const std::string& indexName = "Index", const std::vector<DataPath>& neighborLists = {},
+                                                  bool writeNumOfFeatures = false);
 } // namespace nx::core::OStreamUtilities
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class BoundedQueue
+ * @brief The BoundedQueue class is a blocking first-in first-out queue that holds at most a fixed
+ * number of values. push() waits while the queue is full and pop() waits while it is empty. Once
+ * the queue is closed, push() discards its value and pop() drains the values that are left.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+  explicit BoundedQueue(usize capacity)
+  : m_Capacity(std::max(capacity, usize{1}))
+  {
+  }
+
+  ~BoundedQueue() noexcept = default;
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue(BoundedQueue&&) noexcept = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(BoundedQueue&&) noexcept = delete;
+
+  /**
+   * @brief Appends the value, waiting for a free slot. Returns false if the queue was closed instead.
+   * @param value
+   * @return bool
+   */
+  bool push(T&& value)
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_NotFull.wait(lock, [this] { return m_Closed || m_Values.size() < m_Capacity; });
+    if(m_Closed)
+    {
+      return false;
+    }
+    m_Values.push_back(std::move(value));
+    m_NotEmpty.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Removes the oldest value, waiting for one to arrive. Returns an empty optional once the
+   * queue is closed and drained.
+   * @return std::optional<T>
+   */
+  std::optional<T> pop()
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_NotEmpty.wait(lock, [this] { return m_Closed || !m_Values.empty(); });
+    if(m_Values.empty())
+    {
+      return std::nullopt;
+    }
+    std::optional<T> value(std::move(m_Values.front()));
+    m_Values.pop_front();
+    m_NotFull.notify_one();
+    return value;
+  }
+
+  /**
+   * @brief Wakes every waiting thread. No further values are accepted.
+   */
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Closed = true;
+    m_NotFull.notify_all();
+    m_NotEmpty.notify_all();
+  }
+
+  usize capacity() const
+  {
+    return m_Capacity;
+  }
+
+private:
+  usize m_Capacity = 1;
+  std::deque<T> m_Values;
+  bool m_Closed = false;
+  std::mutex m_Mutex;
+  std::condition_variable m_NotFull;
+  std::condition_variable m_NotEmpty;
+};
+
+/**
+ * @class OrderedPipeline
+ * @brief The OrderedPipeline class processes a numbered sequence of items, such as the slices of a
+ * stack, in three stages: a single reader produces the items in index order, a pool of workers converts
+ * them concurrently and a single writer consumes them, again in index order, on the calling thread.
+ * The stages are connected by BoundedQueues, and the reader never runs more than the queue capacity plus
+ * one item per worker ahead of the writer, so the number of items held in memory stays bounded no matter
+ * how unevenly the conversions finish.
+ *
+ * The first stage that returns an invalid Result stops the pipeline and that Result is returned. When
+ * parallelization is disabled, or there is a single item, each item is read, converted and written in turn.
+ *
+ * Only the conversion callback runs concurrently with itself. The reader and the writer each run on a
+ * single thread, but on different threads from each other, so they must not share unsynchronized state.
+ */
+template <typename ItemT>
+class OrderedPipeline : public IParallelAlgorithm
+{
+public:
+  /**
+   * @brief Number of items each queue holds when no capacity is set.
+   */
+  static inline constexpr usize k_DefaultQueueCapacity = 2;
+
+  explicit OrderedPipeline(usize numItems)
+  : m_NumItems(numItems)
+  {
+  }
+
+  ~OrderedPipeline() noexcept = default;
+
+  OrderedPipeline(const OrderedPipeline&) = delete;
+  OrderedPipeline(OrderedPipeline&&) noexcept = delete;
+  OrderedPipeline& operator=(const OrderedPipeline&) = delete;
+  OrderedPipeline& operator=(OrderedPipeline&&) noexcept = delete;
+
+  /**
+   * @brief Sets how many items each queue between two stages holds.
+   * @param capacity
+   */
+  void setQueueCapacity(usize capacity)
+  {
+    m_QueueCapacity = std::max(capacity, usize{1});
+  }
+
+  /**
+   * @brief Sets the maximum number of conversion workers. This amount is automatically reduced to
+   * the max hardware concurrency and to the number of items.
+   * @param threads
+   */
+  void setMaxThreads(usize threads)
+  {
+    m_MaxThreads = std::max(threads, usize{1});
+  }
+
+  /**
+   * @brief Returns the number of conversion workers execute() will start.
+   * @return usize
+   */
+  usize getNumberOfWorkers() const
+  {
+    if(!getParallelizationEnabled() || m_NumItems < 2)
+    {
+      return 0;
+    }
+    const usize hardwareThreads = std::max(static_cast<usize>(std::thread::hardware_concurrency()), usize{1});
+    return std::min({m_MaxThreads, hardwareThreads, m_NumItems});
+  }
+
+  /**
+   * @brief Calls read(usize index) -> Result<ItemT>, then convert(usize index, ItemT& item) -> Result<> and
+   * finally write(usize index, ItemT& item) -> Result<> for every index in [0, numItems). The writes happen
+   * in ascending index order. Returns early with an empty Result when shouldCancel is set.
+   * @param read
+   * @param convert
+   * @param write
+   * @param shouldCancel
+   * @return Result<>
+   */
+  template <class ReadT, class ConvertT, class WriteT>
+  Result<> execute(const ReadT& read, const ConvertT& convert, const WriteT& write, const std::atomic_bool& shouldCancel) const
+  {
+    if(getNumberOfWorkers() == 0)
+    {
+      return executeSerial(read, convert, write, shouldCancel);
+    }
+    return executePipelined(read, convert, write, shouldCancel);
+  }
+
+private:
+  using IndexedItem = std::pair<usize, ItemT>;
+
+  /**
+   * @brief Shared state of one pipelined run. The first stage to fail records its Result and closes
+   * both queues, which unblocks every other stage.
+   */
+  struct PipelineState
+  {
+    explicit PipelineState(usize capacity)
+    : readQueue(capacity)
+    , convertedQueue(capacity)
+    {
+    }
+
+    void fail(Result<>&& error)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!failed)
+        {
+          result = std::move(error);
+          failed = true;
+        }
+      }
+      stop();
+    }
+
+    void stop()
+    {
+      stopped = true;
+      readQueue.close();
+      convertedQueue.close();
+      std::lock_guard<std::mutex> lock(mutex);
+      windowChanged.notify_all();
+    }
+
+    BoundedQueue<IndexedItem> readQueue;
+    BoundedQueue<IndexedItem> convertedQueue;
+    std::atomic_bool stopped = false;
+    std::atomic<usize> runningWorkers = 0;
+    std::mutex mutex;
+    std::condition_variable windowChanged;
+    usize numWritten = 0;
+    bool failed = false;
+    Result<> result;
+  };
+
+  template <class ReadT, class ConvertT, class WriteT>
+  Result<> executeSerial(const ReadT& read, const ConvertT& convert, const WriteT& write, const std::atomic_bool& shouldCancel) const
+  {
+    for(usize index = 0; index < m_NumItems; index++)
+    {
+      if(shouldCancel)
+      {
+        return {};
+      }
+      Result<ItemT> readResult = read(index);
+      if(readResult.invalid())
+      {
+        return ConvertResult(std::move(readResult));
+      }
+      ItemT& item = readResult.value();
+      Result<> convertResult = convert(index, item);
+      if(convertResult.invalid())
+      {
+        return convertResult;
+      }
+      Result<> writeResult = write(index, item);
+      if(writeResult.invalid())
+      {
+        return writeResult;
+      }
+    }
+    return {};
+  }
+
+  template <class ReadT, class ConvertT, class WriteT>
+  Result<> executePipelined(const ReadT& read, const ConvertT& convert, const WriteT& write, const std::atomic_bool& shouldCancel) const
+  {
+    const usize numWorkers = getNumberOfWorkers();
+    // Items between the reader and the writer: both queues, one per worker and the one being read
+    const usize window = 2 * m_QueueCapacity + numWorkers + 1;
+
+    PipelineState state(m_QueueCapacity);
+    state.runningWorkers = numWorkers;
+
+    std::thread readerThread([&]() {
+      for(usize index = 0; index < m_NumItems; index++)
+      {
+        {
+          std::unique_lock<std::mutex> lock(state.mutex);
+          state.windowChanged.wait(lock, [&]() { return state.stopped || index < state.numWritten + window; });
+        }
+        if(state.stopped || shouldCancel)
+        {
+          break;
+        }
+        Result<ItemT> readResult = read(index);
+        if(readResult.invalid())
+        {
+          state.fail(ConvertResult(std::move(readResult)));
+          break;
+        }
+        if(!state.readQueue.push({index, std::move(readResult.value())}))
+        {
+          break;
+        }
+      }
+      state.readQueue.close();
+    });
+
+    std::vector<std::thread> workerThreads;
+    workerThreads.reserve(numWorkers);
+    for(usize i = 0; i < numWorkers; i++)
+    {
+      workerThreads.emplace_back([&]() {
+        while(std::optional<IndexedItem> indexedItem = state.readQueue.pop())
+        {
+          if(state.stopped)
+          {
+            break;
+          }
+          Result<> convertResult = convert(indexedItem->first, indexedItem->second);
+          if(convertResult.invalid())
+          {
+            state.fail(std::move(convertResult));
+            break;
+          }
+          if(!state.convertedQueue.push(std::move(*indexedItem)))
+          {
+            break;
+          }
+        }
+        // The last worker to finish lets the writer know no more items are coming
+        if(--state.runningWorkers == 0)
+        {
+          state.convertedQueue.close();
+        }
+      });
+    }
+
+    // Items that were converted before the ones preceding them are held until it is their turn
+    std::map<usize, ItemT> pendingItems;
+    usize nextIndex = 0;
+    while(nextIndex < m_NumItems)
+    {
+      std::optional<IndexedItem> indexedItem = state.convertedQueue.pop();
+      if(!indexedItem.has_value() || state.stopped)
+      {
+        break;
+      }
+      pendingItems.emplace(indexedItem->first, std::move(indexedItem->second));
+      for(auto iter = pendingItems.begin(); iter != pendingItems.end() && iter->first == nextIndex; iter = pendingItems.begin())
+      {
+        if(shouldCancel)
+        {
+          state.stop();
+          break;
+        }
+        Result<> writeResult = write(nextIndex, iter->second);
+        if(writeResult.invalid())
+        {
+          state.fail(std::move(writeResult));
+          break;
+        }
+        pendingItems.erase(iter);
+        nextIndex++;
+        {
+          std::lock_guard<std::mutex> lock(state.mutex);
+          state.numWritten = nextIndex;
+        }
+        state.windowChanged.notify_all();
+      }
+    }
+    // A cancelled reader stops early, so make sure no stage is left waiting on the other ones
+    state.stop();
+
+    readerThread.join();
+    for(std::thread& workerThread : workerThreads)
+    {
+      workerThread.join();
+    }
+
+    return std::move(state.result);
+  }
+
+  usize m_NumItems = 0;
+  usize m_QueueCapacity = k_DefaultQueueCapacity;
+  usize m_MaxThreads = std::max(static_cast<usize>(std::thread::hardware_concurrency()), usize{1});
+};
+} // namespace nx::core
@@ -778,9 +778,9 @@ DREAM3D::PipelineVersionType DREAM3D::GetPipelineVersion(const nx::core::HDF5::F
   return pipelineVersionAttribute.readAsValue<PipelineVersionType>();
 }
 
-Result<DataStructure> ImportDataStructureV8(const nx::core::HDF5::FileReader& fileReader, bool preflight)
+Result<DataStructure> ImportDataStructureV8(const nx::core::HDF5::FileReader& fileReader, bool preflight, const std::optional<HDF5::ImageSubvolume>& imageSubvolume)
 {
-  return HDF5::DataStructureReader::ReadFile(fileReader, preflight);
+  return HDF5::DataStructureReader::ReadFile(fileReader, preflight, imageSubvolume);
 }
 
 // Begin legacy DCA importing
@@ -1462,14 +1462,23 @@ Result<DataStructure> ImportLegacyDataStructure(const nx::core::HDF5::FileReader
 }
 
 Result<DataStructure> DREAM3D::ImportDataStructureFromFile(const nx::core::HDF5::FileReader& fileReader, bool preflight)
+{
+  return ImportDataStructureFromFile(fileReader, preflight, std::nullopt);
+}
+
+Result<DataStructure> DREAM3D::ImportDataStructureFromFile(const nx::core::HDF5::FileReader& fileReader, bool preflight, const std::optional<HDF5::ImageSubvolume>& imageSubvolume)
 {
   const auto fileVersion = GetFileVersion(fileReader);
   if(fileVersion == k_CurrentFileVersion)
   {
-    return ImportDataStructureV8(fileReader, preflight);
+    return ImportDataStructureV8(fileReader, preflight, imageSubvolume);
   }
   else if(fileVersion == k_LegacyFileVersion)
   {
+    if(imageSubvolume.has_value())
+    {
+      return MakeErrorResult<DataStructure>(k_UnsupportedSubvolumeImport, "Reading an Image Geometry subvolume is not supported for legacy DREAM3D files.");
+    }
     return ImportLegacyDataStructure(fileReader, preflight);
   }
   // Unsupported file version
@@ -1,11 +1,13 @@
 #pragma once
 
+#include "simplnx/DataStructure/IO/HDF5/DataStructureReader.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -28,6 +30,7 @@ using PipelineVersionType = int32;
 inline constexpr int32 k_InvalidPipelineVersion = -404;
 inline constexpr int32 k_InvalidDataStructureVersion = -405;
 inline constexpr int32 k_PipelineGroupUnavailable = -406;
+inline constexpr int32 k_UnsupportedSubvolumeImport = -407;
 inline constexpr StringLiteral k_CurrentFileVersion = "8.0";
 inline constexpr StringLiteral k_LegacyFileVersion = "7.0";
 
@@ -110,6 +113,17 @@ SIMPLNX_EXPORT Result<> WriteFile(const std::filesystem::path& path, const DataS
  */
 SIMPLNX_EXPORT Result<DataStructure> ImportDataStructureFromFile(const nx::core::HDF5::FileReader& fileReader, bool preflight = false);
 
+/**
+ * @brief Imports and returns the DataStructure from the target .dream3d file while only
+ * reading the given subvolume of the Image Geometries' cell data. Subvolumes are only
+ * supported for current (non-legacy) files.
+ * @param fileReader
+ * @param preflight
+ * @param imageSubvolume
+ * @return DataStructure
+ */
+SIMPLNX_EXPORT Result<DataStructure> ImportDataStructureFromFile(const nx::core::HDF5::FileReader& fileReader, bool preflight, const std::optional<HDF5::ImageSubvolume>& imageSubvolume);
+
 /**
  * @brief Imports and returns the DataStructure from the target .dream3d file.
  * This method imports both current and legacy DataStructures.
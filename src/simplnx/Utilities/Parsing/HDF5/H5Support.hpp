@@ -273,27 +273,71 @@ Result<> FillDataStore(DataArray<T>& dataArray, const DataPath& dataArrayPath, c
   return {};
 }
 
+/**
+ * @brief Number of elements read from the file at a time when filling an out-of-core DataStore.
+ */
+inline constexpr hsize_t k_OocReadSlabElements = 1024 * 1024 * 16;
+
+/**
+ * @brief Fills an out-of-core DataStore from the dataset. The selection is read one slab of
+ * rows (the slowest varying dimension) at a time into a bounded buffer so that the whole
+ * dataset never has to fit in memory.
+ */
 template <typename T>
 Result<> FillOocDataStore(DataArray<T>& dataArray, const DataPath& dataArrayPath, const nx::core::HDF5::DatasetReader& datasetReader, const std::optional<std::vector<hsize_t>>& start = std::nullopt,
                           const std::optional<std::vector<hsize_t>>& count = std::nullopt)
 {
-  if(Memory::GetTotalMemory() <= dataArray.getSize() * sizeof(T))
+  auto& absDataStore = dataArray.getDataStoreRef();
+
+  const std::vector<hsize_t> dims = datasetReader.getDimensions();
+  if(dims.empty())
   {
-    return MakeErrorResult(-21004, fmt::format("Error reading dataset '{}' with '{}' total elements. Not enough memory to import data.", dataArray.getName(), datasetReader.getNumElements()));
+    return MakeErrorResult(-21004, fmt::format("Error reading dataset '{}'. The dataset does not have any dimensions.", dataArrayPath.getTargetName()));
+  }
+  std::vector<hsize_t> slabStart = start.value_or(std::vector<hsize_t>(dims.size(), 0));
+  std::vector<hsize_t> slabCount(dims.size());
+  for(usize i = 0; i < dims.size(); i++)
+  {
+    slabCount[i] = count.has_value() ? count->at(i) : dims[i] - slabStart[i];
   }
 
-  auto& absDataStore = dataArray.getDataStoreRef();
-  std::vector<T> data(absDataStore.getSize());
-  nonstd::span<T> span{data.data(), data.size()};
-  Result<> result = datasetReader.readIntoSpan<T>(span, start, count);
-  if(result.invalid())
+  const hsize_t totalElements = std::accumulate(slabCount.cbegin(), slabCount.cend(), static_cast<hsize_t>(1), std::multiplies<>());
+  if(totalElements != absDataStore.getSize())
   {
-    return {
-        MakeErrorResult(-21003, fmt::format("Error reading dataset '{}' with '{}' total elements into data store for data array '{}' with '{}' total elements ('{}' tuples and '{}' components):\n\n{}",
-                                            dataArrayPath.getTargetName(), datasetReader.getNumElements(), dataArrayPath.toString(), dataArray.getSize(), dataArray.getNumberOfTuples(),
-                                            dataArray.getNumberOfComponents(), result.errors()[0].message))};
+    return MakeErrorResult(-21003, fmt::format("Error reading dataset '{}' with '{}' total elements into data store for data array '{}' with '{}' total elements ('{}' tuples and '{}' components)",
+                                               dataArrayPath.getTargetName(), totalElements, dataArrayPath.toString(), dataArray.getSize(), dataArray.getNumberOfTuples(),
+                                               dataArray.getNumberOfComponents()));
+  }
+  if(totalElements == 0)
+  {
+    return {};
+  }
+
+  const hsize_t firstRow = slabStart[0];
+  const hsize_t numRows = slabCount[0];
+  const hsize_t rowElements = totalElements / numRows;
+  const hsize_t rowsPerSlab = std::max<hsize_t>(1, k_OocReadSlabElements / rowElements);
+
+  std::vector<T> buffer(std::min(rowsPerSlab, numRows) * rowElements);
+  for(hsize_t row = 0; row < numRows; row += rowsPerSlab)
+  {
+    const hsize_t slabRows = std::min(rowsPerSlab, numRows - row);
+    slabStart[0] = firstRow + row;
+    slabCount[0] = slabRows;
+
+    nonstd::span<T> span{buffer.data(), static_cast<usize>(slabRows * rowElements)};
+    Result<> result = datasetReader.readIntoSpan<T>(span, slabStart, slabCount);
+    if(result.invalid())
+    {
+      return {MakeErrorResult(-21003, fmt::format("Error reading dataset '{}' rows [{}, {}) into data store for data array '{}':\n\n{}", dataArrayPath.getTargetName(), firstRow + row,
+                                                  firstRow + row + slabRows, dataArrayPath.toString(), result.errors()[0].message))};
+    }
+    result = absDataStore.copyFromBuffer(static_cast<usize>(row * rowElements), nonstd::span<const T>(span.data(), span.size()));
+    if(result.invalid())
+    {
+      return result;
+    }
   }
-  std::copy(data.begin(), data.end(), absDataStore.begin());
 
   return {};
 }
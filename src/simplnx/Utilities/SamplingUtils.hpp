@@ -1,14 +1,171 @@
 #pragma once
 
+#include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Filter/IFilter.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace nx::core::Sampling
 {
+/**
+ * @brief Maps every cell (x, y, z) of a destination image geometry to the cell (map[0][x], map[1][y], map[2][z])
+ * of a source image geometry. Axis aligned crops and nearest neighbor resamples are separable like this, so
+ * the map holds nx + ny + nz indices instead of one index per destination cell.
+ */
+using SeparableIndexMap = std::array<std::vector<usize>, 3>;
+
+namespace detail
+{
+/**
+ * @brief A run of destination cells along X that read consecutive source cells.
+ */
+struct IndexRun
+{
+  usize destX = 0;
+  usize srcX = 0;
+  usize length = 0;
+};
+
+inline std::vector<IndexRun> FindIndexRuns(const std::vector<usize>& indices)
+{
+  std::vector<IndexRun> runs;
+  for(usize x = 0; x < indices.size(); x++)
+  {
+    if(!runs.empty() && runs.back().srcX + runs.back().length == indices[x])
+    {
+      runs.back().length++;
+      continue;
+    }
+    runs.push_back({x, indices[x], 1});
+  }
+  return runs;
+}
+
+/**
+ * @brief The first failed block copy. The flag lets the other rows stop without taking the lock.
+ */
+struct CopyError
+{
+  std::atomic_bool failed = false;
+  std::mutex mutex;
+  Result<> result;
+};
+
+/**
+ * @brief Copies the destination rows (z * ny + y) in the given range. Each run of a row is a single block copy.
+ */
+template <typename T>
+class CopyTupleUsingSeparableIndexMap
+{
+public:
+  CopyTupleUsingSeparableIndexMap(const AbstractDataStore<T>& srcStore, AbstractDataStore<T>& destStore, const SizeVec3& srcDims, const SeparableIndexMap& indexMap, const std::vector<IndexRun>& runs,
+                                  CopyError& copyError, const std::atomic_bool& shouldCancel)
+  : m_SrcStore(srcStore)
+  , m_DestStore(destStore)
+  , m_SrcDims(srcDims)
+  , m_IndexMap(indexMap)
+  , m_Runs(runs)
+  , m_CopyError(copyError)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComps = m_DestStore.getNumberOfComponents();
+    const usize destDimX = m_IndexMap[0].size();
+    const usize destDimY = m_IndexMap[1].size();
+    const T* srcData = DataStoreUtilities::GetContiguousData(m_SrcStore);
+    T* destData = DataStoreUtilities::GetContiguousData(m_DestStore);
+
+    for(usize row = range.min(); row < range.max(); row++)
+    {
+      if(m_ShouldCancel || m_CopyError.failed)
+      {
+        return;
+      }
+      const usize srcRowStart = (m_IndexMap[2][row / destDimY] * m_SrcDims[1] + m_IndexMap[1][row % destDimY]) * m_SrcDims[0];
+      const usize destRowStart = row * destDimX;
+      for(const IndexRun& run : m_Runs)
+      {
+        if(srcData != nullptr && destData != nullptr)
+        {
+          std::copy_n(srcData + (srcRowStart + run.srcX) * numComps, run.length * numComps, destData + (destRowStart + run.destX) * numComps);
+        }
+        else
+        {
+          Result<> copyResult = m_DestStore.copyFrom(destRowStart + run.destX, m_SrcStore, srcRowStart + run.srcX, run.length);
+          if(copyResult.invalid())
+          {
+            std::lock_guard<std::mutex> lock(m_CopyError.mutex);
+            if(!m_CopyError.failed)
+            {
+              m_CopyError.result = std::move(copyResult);
+              m_CopyError.failed = true;
+            }
+            return;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<T>& m_SrcStore;
+  AbstractDataStore<T>& m_DestStore;
+  SizeVec3 m_SrcDims;
+  const SeparableIndexMap& m_IndexMap;
+  const std::vector<IndexRun>& m_Runs;
+  CopyError& m_CopyError;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+struct CopyTupleUsingSeparableIndexMapFunctor
+{
+  template <typename T>
+  Result<> operator()(const IDataArray& srcArray, IDataArray& destArray, const SizeVec3& srcDims, const SeparableIndexMap& indexMap, const std::vector<IndexRun>& runs,
+                      const std::atomic_bool& shouldCancel)
+  {
+    const auto& srcStore = srcArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& destStore = destArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, indexMap[1].size() * indexMap[2].size());
+    dataAlg.requireArraysInMemory({&srcArray, &destArray});
+    CopyError copyError;
+    dataAlg.execute(CopyTupleUsingSeparableIndexMap<T>(srcStore, destStore, srcDims, indexMap, runs, copyError, shouldCancel));
+    return std::move(copyError.result);
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Copies the cell array of a source image geometry with dimensions srcDims into the cell array of a destination
+ * image geometry using the separable index map. The rows of the destination are copied in parallel.
+ * @param srcArray
+ * @param destArray Must have (indexMap[0].size() * indexMap[1].size() * indexMap[2].size()) tuples
+ * @param srcDims
+ * @param indexMap
+ * @param shouldCancel
+ * @return The first failed block copy
+ */
+inline Result<> CopyTuplesUsingSeparableIndexMap(const IDataArray& srcArray, IDataArray& destArray, const SizeVec3& srcDims, const SeparableIndexMap& indexMap, const std::atomic_bool& shouldCancel)
+{
+  const std::vector<detail::IndexRun> runs = detail::FindIndexRuns(indexMap[0]);
+  return ExecuteDataFunction(detail::CopyTupleUsingSeparableIndexMapFunctor{}, srcArray.getDataType(), srcArray, destArray, srcDims, indexMap, runs, shouldCancel);
+}
+
 inline Result<> RenumberFeatures(DataStructure& dataStructure, const DataPath& newGeomPath, const DataPath& destCellFeatAttributeMatrixPath, const DataPath& featureIdsArrayPath,
                                  const DataPath& destFeatureIdsArrayPath, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel = false)
 {
@@ -0,0 +1,283 @@
+#include "TupleRemap.hpp"
+
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_TupleCountMismatchError = -7820;
+constexpr int32 k_MissingGroupError = -7821;
+constexpr int32 k_MissingArrayError = -7822;
+
+template <typename T>
+void CopyTuplesDirect(T* data, usize numComponents, const usize* targets, const usize* sources, usize count)
+{
+  if(numComponents == 1)
+  {
+    for(usize index = 0; index < count; index++)
+    {
+      data[targets[index]] = data[sources[index]];
+    }
+    return;
+  }
+  for(usize index = 0; index < count; index++)
+  {
+    std::copy_n(data + sources[index] * numComponents, numComponents, data + targets[index] * numComponents);
+  }
+}
+
+template <typename T>
+void CopyTuplesStaged(AbstractDataStore<T>& store, usize numComponents, const usize* targets, const usize* sources, usize count)
+{
+  // Some sources are also targets, so every source value is gathered before any target is written.
+  auto buffer = std::make_unique<T[]>(count * numComponents);
+  for(usize index = 0; index < count; index++)
+  {
+    const usize sourceOffset = sources[index] * numComponents;
+    for(usize comp = 0; comp < numComponents; comp++)
+    {
+      buffer[index * numComponents + comp] = store.getValue(sourceOffset + comp);
+    }
+  }
+  for(usize index = 0; index < count; index++)
+  {
+    const usize targetOffset = targets[index] * numComponents;
+    for(usize comp = 0; comp < numComponents; comp++)
+    {
+      store.setValue(targetOffset + comp, buffer[index * numComponents + comp]);
+    }
+  }
+}
+
+struct CopyTuplesFunctor
+{
+  template <typename T>
+  void operator()(IDataArray& dataArray, const usize* targets, const usize* sources, usize count, bool staged)
+  {
+    auto& store = dataArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    const usize numComponents = store.getNumberOfComponents();
+    if(staged)
+    {
+      CopyTuplesStaged(store, numComponents, targets, sources, count);
+      return;
+    }
+
+    if(auto* dataStore = dynamic_cast<DataStore<T>*>(&store); dataStore != nullptr)
+    {
+      CopyTuplesDirect(dataStore->data(), numComponents, targets, sources, count);
+      return;
+    }
+
+    for(usize index = 0; index < count; index++)
+    {
+      const usize sourceOffset = sources[index] * numComponents;
+      const usize targetOffset = targets[index] * numComponents;
+      for(usize comp = 0; comp < numComponents; comp++)
+      {
+        store.setValue(targetOffset + comp, store.getValue(sourceOffset + comp));
+      }
+    }
+  }
+};
+
+class TupleRemapImpl
+{
+public:
+  TupleRemapImpl(IDataArray& dataArray, const usize* targets, const usize* sources, usize count, bool staged, const std::atomic_bool& shouldCancel)
+  : m_DataArray(dataArray)
+  , m_Targets(targets)
+  , m_Sources(sources)
+  , m_Count(count)
+  , m_Staged(staged)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
+
+  void operator()() const
+  {
+    if(m_ShouldCancel)
+    {
+      return;
+    }
+    ExecuteDataFunction(CopyTuplesFunctor{}, m_DataArray.getDataType(), m_DataArray, m_Targets, m_Sources, m_Count, m_Staged);
+  }
+
+private:
+  IDataArray& m_DataArray;
+  const usize* m_Targets = nullptr;
+  const usize* m_Sources = nullptr;
+  usize m_Count = 0;
+  bool m_Staged = false;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+template <typename IndexType>
+TupleRemap TupleRemap::CreateImpl(const std::vector<IndexType>& sourceIndices)
+{
+  TupleRemap remap;
+  remap.m_NumTuples = sourceIndices.size();
+
+  // resolved[i] is the tuple whose original value ends up in tuple i, or -1 if tuple i is unchanged.
+  // A source that comes before its target has already been reassigned, so its resolved value is used.
+  const auto numTuples = static_cast<int64>(remap.m_NumTuples);
+  std::vector<int64> resolved(remap.m_NumTuples, -1);
+  for(int64 tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+  {
+    const auto source = static_cast<int64>(sourceIndices[tupleIndex]);
+    if(source < 0 || source >= numTuples || source == tupleIndex)
+    {
+      continue;
+    }
+    const int64 resolvedSource = (source < tupleIndex && resolved[source] >= 0) ? resolved[source] : source;
+    if(resolvedSource == tupleIndex)
+    {
+      continue;
+    }
+    resolved[tupleIndex] = resolvedSource;
+    remap.m_Targets.push_back(static_cast<usize>(tupleIndex));
+    remap.m_Sources.push_back(static_cast<usize>(resolvedSource));
+  }
+
+  remap.m_ReadsChangedTuples = std::any_of(remap.m_Sources.cbegin(), remap.m_Sources.cend(), [&resolved](usize source) { return resolved[source] >= 0; });
+  return remap;
+}
+
+// -----------------------------------------------------------------------------
+TupleRemap TupleRemap::Create(const std::vector<int32>& sourceIndices)
+{
+  return CreateImpl(sourceIndices);
+}
+
+// -----------------------------------------------------------------------------
+TupleRemap TupleRemap::Create(const std::vector<int64>& sourceIndices)
+{
+  return CreateImpl(sourceIndices);
+}
+
+// -----------------------------------------------------------------------------
+usize TupleRemap::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+usize TupleRemap::getNumberOfChangedTuples() const
+{
+  return m_Targets.size();
+}
+
+// -----------------------------------------------------------------------------
+bool TupleRemap::empty() const
+{
+  return m_Targets.empty();
+}
+
+// -----------------------------------------------------------------------------
+Result<> TupleRemap::apply(IDataArray& dataArray, const std::atomic_bool& shouldCancel) const
+{
+  if(dataArray.getNumberOfTuples() != m_NumTuples)
+  {
+    return MakeErrorResult(k_TupleCountMismatchError,
+                           fmt::format("TupleRemap: Array '{}' has {} tuples but the remap was created for {} tuples", dataArray.getName(), dataArray.getNumberOfTuples(), m_NumTuples));
+  }
+  if(m_Targets.empty())
+  {
+    return {};
+  }
+
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.requireArraysInMemory({&dataArray});
+  if(m_ReadsChangedTuples)
+  {
+    taskRunner.execute(TupleRemapImpl(dataArray, m_Targets.data(), m_Sources.data(), m_Targets.size(), true, shouldCancel));
+  }
+  else
+  {
+    for(usize start = 0; start < m_Targets.size(); start += k_RangeSize)
+    {
+      const usize count = std::min(k_RangeSize, m_Targets.size() - start);
+      taskRunner.execute(TupleRemapImpl(dataArray, m_Targets.data() + start, m_Sources.data() + start, count, false, shouldCancel));
+    }
+  }
+  taskRunner.wait();
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> TupleRemap::apply(const std::vector<std::shared_ptr<IDataArray>>& dataArrays, const std::atomic_bool& shouldCancel) const
+{
+  IParallelAlgorithm::AlgorithmArrays algArrays;
+  algArrays.reserve(dataArrays.size());
+  for(const auto& dataArray : dataArrays)
+  {
+    if(dataArray->getNumberOfTuples() != m_NumTuples)
+    {
+      return MakeErrorResult(k_TupleCountMismatchError,
+                             fmt::format("TupleRemap: Array '{}' has {} tuples but the remap was created for {} tuples", dataArray->getName(), dataArray->getNumberOfTuples(), m_NumTuples));
+    }
+    algArrays.push_back(dataArray.get());
+  }
+  if(m_Targets.empty())
+  {
+    return {};
+  }
+
+  // Every array is a separate task and large arrays are further split into ranges of changed tuples.
+  // The ranges of one array write disjoint tuples and, unless a source is also a target, only read
+  // tuples that are never written, so they can run concurrently.
+  ParallelTaskAlgorithm taskRunner;
+  taskRunner.requireArraysInMemory(algArrays);
+  for(const auto& dataArray : dataArrays)
+  {
+    if(shouldCancel)
+    {
+      break;
+    }
+    if(m_ReadsChangedTuples)
+    {
+      taskRunner.execute(TupleRemapImpl(*dataArray, m_Targets.data(), m_Sources.data(), m_Targets.size(), true, shouldCancel));
+      continue;
+    }
+    for(usize start = 0; start < m_Targets.size(); start += k_RangeSize)
+    {
+      const usize count = std::min(k_RangeSize, m_Targets.size() - start);
+      taskRunner.execute(TupleRemapImpl(*dataArray, m_Targets.data() + start, m_Sources.data() + start, count, false, shouldCancel));
+    }
+  }
+  taskRunner.wait();
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> TupleRemap::apply(DataStructure& dataStructure, const DataPath& attributeMatrixPath, const std::vector<DataPath>& ignoredDataPaths, const std::atomic_bool& shouldCancel) const
+{
+  std::optional<std::vector<DataPath>> childPaths = GetAllChildDataPaths(dataStructure, attributeMatrixPath, DataObject::Type::DataArray, ignoredDataPaths);
+  if(!childPaths.has_value())
+  {
+    return MakeErrorResult(k_MissingGroupError, fmt::format("TupleRemap: Could not find the group at path '{}'", attributeMatrixPath.toString()));
+  }
+
+  std::vector<std::shared_ptr<IDataArray>> dataArrays;
+  dataArrays.reserve(childPaths->size());
+  for(const auto& childPath : childPaths.value())
+  {
+    auto dataArray = dataStructure.getSharedDataAs<IDataArray>(childPath);
+    if(dataArray == nullptr)
+    {
+      return MakeErrorResult(k_MissingArrayError, fmt::format("TupleRemap: Could not find the array at path '{}'", childPath.toString()));
+    }
+    dataArrays.push_back(dataArray);
+  }
+  return apply(dataArrays, shouldCancel);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class TupleRemap
+ * @brief The TupleRemap class copies tuples within a set of arrays according to a source index map,
+ * where entry i holds the tuple that is copied into tuple i, or a negative value if tuple i is left unchanged.
+ *
+ * The result is the same as calling IDataArray::copyTuple(source, i) on every array for each changed tuple
+ * in ascending order of i. A tuple that copies from a tuple that was reassigned before it therefore receives
+ * the reassigned value. The chains are resolved once when the remap is created, after which the arrays are
+ * updated one at a time with typed kernels, in parallel across arrays and ranges of changed tuples.
+ */
+class SIMPLNX_EXPORT TupleRemap
+{
+public:
+  /**
+   * @brief Number of changed tuples copied by a single task.
+   */
+  static inline constexpr usize k_RangeSize = 65536;
+
+  TupleRemap() = default;
+  ~TupleRemap() noexcept = default;
+
+  TupleRemap(const TupleRemap&) = default;
+  TupleRemap(TupleRemap&&) noexcept = default;
+  TupleRemap& operator=(const TupleRemap&) = default;
+  TupleRemap& operator=(TupleRemap&&) noexcept = default;
+
+  /**
+   * @brief Creates the remap from a source index map with one entry per tuple.
+   * @param sourceIndices
+   * @return TupleRemap
+   */
+  static TupleRemap Create(const std::vector<int32>& sourceIndices);
+
+  /**
+   * @brief Creates the remap from a source index map with one entry per tuple.
+   * @param sourceIndices
+   * @return TupleRemap
+   */
+  static TupleRemap Create(const std::vector<int64>& sourceIndices);
+
+  /**
+   * @brief Returns the number of tuples the remap was created for.
+   * @return usize
+   */
+  usize getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the number of tuples that receive a value from another tuple.
+   * @return usize
+   */
+  usize getNumberOfChangedTuples() const;
+
+  /**
+   * @brief Returns true if no tuple is changed by the remap.
+   * @return bool
+   */
+  bool empty() const;
+
+  /**
+   * @brief Applies the remap to a single array.
+   * @param dataArray
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> apply(IDataArray& dataArray, const std::atomic_bool& shouldCancel) const;
+
+  /**
+   * @brief Applies the remap to every array in the list. Each array must have getNumberOfTuples() tuples.
+   * @param dataArrays
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> apply(const std::vector<std::shared_ptr<IDataArray>>& dataArrays, const std::atomic_bool& shouldCancel) const;
+
+  /**
+   * @brief Applies the remap to every DataArray in the AttributeMatrix (or other group) at the given path,
+   * skipping the ignored paths.
+   * @param dataStructure
+   * @param attributeMatrixPath
+   * @param ignoredDataPaths
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> apply(DataStructure& dataStructure, const DataPath& attributeMatrixPath, const std::vector<DataPath>& ignoredDataPaths, const std::atomic_bool& shouldCancel) const;
+
+private:
+  template <typename IndexType>
+  static TupleRemap CreateImpl(const std::vector<IndexType>& sourceIndices);
+
+  std::vector<usize> m_Targets;
+  std::vector<usize> m_Sources;
+  usize m_NumTuples = 0;
+  bool m_ReadsChangedTuples = false;
+};
+} // namespace nx::core
@@ -0,0 +1,100 @@
+#include "BatchRunner.hpp"
+
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/unit_test/simplnx_test_dirs.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace fs = std::filesystem;
+using namespace nx::core;
+using namespace nx::core::CLI;
+
+namespace
+{
+constexpr Uuid k_TestOnePluginId = *Uuid::FromString("01ff618b-781f-4ac0-b9ac-43f26ce1854f");
+constexpr Uuid k_ErrorWarningFilterId = *Uuid::FromString("3ede4bcd-944a-4bca-a0d4-ade65403641e");
+const FilterHandle k_ErrorWarningFilterHandle(k_ErrorWarningFilterId, k_TestOnePluginId);
+
+constexpr int32 k_OverrideError = -135;
+constexpr int32 k_PreflightError = -136;
+constexpr int32 k_JobsFailedError = -140;
+
+std::string ReadFile(const fs::path& filePath)
+{
+  std::ifstream file(filePath);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("nxrunner::BatchRunner: Run Jobs With Overrides", "[nxrunner][BatchRunner]")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  const fs::path batchDir = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "BatchRunnerTest";
+  fs::remove_all(batchDir);
+  fs::create_directories(batchDir);
+
+  // One pipeline with a single filter that only raises the warnings and errors it is told to
+  {
+    Pipeline pipeline("BatchRunnerTest");
+    REQUIRE(pipeline.push_back(k_ErrorWarningFilterHandle));
+    std::ofstream pipelineFile(batchDir / "error_warning.d3dpipeline");
+    pipelineFile << pipeline.toJson().dump(2);
+  }
+
+  nlohmann::json batchJson;
+  batchJson["jobs"] = nlohmann::json::array();
+  batchJson["jobs"].push_back({{"pipeline", "error_warning.d3dpipeline"}, {"name", "plain"}});
+  batchJson["jobs"].push_back(
+      {{"pipeline", "error_warning.d3dpipeline"}, {"name", "warning"}, {"overrides", nlohmann::json::array({{{"filter_index", 0}, {"arg", "execute_warning"}, {"value", true}}})}});
+  batchJson["jobs"].push_back(
+      {{"pipeline", "error_warning.d3dpipeline"}, {"name", "preflight_error"}, {"overrides", nlohmann::json::array({{{"filter_index", 0}, {"arg", "preflight_error"}, {"value", true}}})}});
+  batchJson["jobs"].push_back(
+      {{"pipeline", "error_warning.d3dpipeline"}, {"name", "missing_arg"}, {"overrides", nlohmann::json::array({{{"filter_index", 0}, {"arg", "no_such_arg"}, {"value", true}}})}});
+  batchJson["max_concurrent_pipelines"] = 2;
+  batchJson["max_threads"] = 2;
+  batchJson["memory_budget"] = 0;
+  batchJson["log_directory"] = "logs";
+
+  Result<BatchRunner> batchRunnerResult = BatchRunner::FromJson(batchJson, batchDir);
+  SIMPLNX_RESULT_REQUIRE_VALID(batchRunnerResult);
+  BatchRunner batchRunner = std::move(batchRunnerResult.value());
+
+  usize numMessages = 0;
+  Result<> executeResult = batchRunner.execute([&numMessages](const std::string&) { numMessages++; });
+  REQUIRE(executeResult.invalid());
+  REQUIRE(executeResult.errors().front().code == k_JobsFailedError);
+  REQUIRE(numMessages > 0);
+
+  const auto& reports = batchRunner.getReports();
+  REQUIRE(reports.size() == 4);
+
+  // Both jobs that preflight are admitted even though the memory budget is 0 since they need no memory
+  REQUIRE(reports[0].succeeded);
+  REQUIRE(reports[0].errors.empty());
+  REQUIRE(reports[1].succeeded);
+  REQUIRE(ReadFile(reports[0].logPath).find("Intentional execute warning generated") == std::string::npos);
+  REQUIRE(ReadFile(reports[1].logPath).find("Intentional execute warning generated") != std::string::npos);
+
+  REQUIRE_FALSE(reports[2].succeeded);
+  REQUIRE(reports[2].errors.back().code == k_PreflightError);
+
+  REQUIRE_FALSE(reports[3].succeeded);
+  REQUIRE(reports[3].errors.size() == 1);
+  REQUIRE(reports[3].errors.front().code == k_OverrideError);
+
+  const nlohmann::json reportJson = nlohmann::json::parse(ReadFile(batchDir / "logs" / "batch_report.json"));
+  REQUIRE(reportJson["succeeded"].get<usize>() == 2);
+  REQUIRE(reportJson["failed"].get<usize>() == 2);
+}
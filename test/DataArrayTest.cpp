@@ -4,6 +4,7 @@
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/DataStoreUtilities.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -130,6 +131,71 @@ TEST_CASE("DataStore Test")
   REQUIRE(dataStore.getComponentValue(2, 2) == 99);
 }
 
+TEST_CASE("DataStore Buffer Copy Test")
+{
+  DataStore<int32> dataStore({10}, {1}, 0);
+  std::vector<int32> values = {1, 2, 3, 4};
+
+  // DataStore override
+  REQUIRE(dataStore.copyFromBuffer(2, nonstd::span<const int32>(values.data(), values.size())).valid());
+  std::vector<int32> buffer(6, -1);
+  REQUIRE(dataStore.copyIntoBuffer(1, nonstd::span<int32>(buffer.data(), buffer.size())).valid());
+  REQUIRE(buffer == std::vector<int32>{0, 1, 2, 3, 4, 0});
+
+  // AbstractDataStore element-wise implementation used by stores without a bulk copy
+  REQUIRE(dataStore.AbstractDataStore<int32>::copyFromBuffer(6, nonstd::span<const int32>(values.data(), values.size())).valid());
+  REQUIRE(dataStore.AbstractDataStore<int32>::copyIntoBuffer(4, nonstd::span<int32>(buffer.data(), buffer.size())).valid());
+  REQUIRE(buffer == std::vector<int32>{3, 4, 1, 2, 3, 4});
+
+  REQUIRE(dataStore.copyIntoBuffer(5, nonstd::span<int32>(buffer.data(), buffer.size())).invalid());
+  REQUIRE(dataStore.AbstractDataStore<int32>::copyFromBuffer(8, nonstd::span<const int32>(values.data(), values.size())).invalid());
+
+  Result<> result = DataStoreUtilities::ModifyBlocks(dataStore, 2, 8, [](usize blockStart, nonstd::span<int32> blockValues) {
+    for(usize i = 0; i < blockValues.size(); i++)
+    {
+      blockValues[i] = static_cast<int32>(blockStart + i) * 10;
+    }
+  });
+  REQUIRE(result.valid());
+
+  int64 sum = 0;
+  result = DataStoreUtilities::ReadBlocks(dataStore, [&sum](usize blockStart, nonstd::span<const int32> blockValues) {
+    for(int32 value : blockValues)
+    {
+      sum += value;
+    }
+  });
+  REQUIRE(result.valid());
+  REQUIRE(sum == 0 + 0 + 20 + 30 + 40 + 50 + 60 + 70 + 3 + 4);
+  REQUIRE(DataStoreUtilities::ReadBlocks(dataStore, 4, 11, [](usize, nonstd::span<const int32>) {}).invalid());
+}
+
+TEST_CASE("DataStore External Buffer Test")
+{
+  auto values = std::make_shared<std::vector<float32>>(std::vector<float32>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+  std::weak_ptr<std::vector<float32>> valuesRef = values;
+  float32* buffer = values->data();
+  DataStore<float32> dataStore(buffer, std::move(values), {2}, {3});
+
+  REQUIRE(dataStore.usesExternalBuffer());
+  REQUIRE(dataStore.data() == buffer);
+  REQUIRE(dataStore.getComponentValue(1, 2) == 6.0f);
+  dataStore[0] = 10.0f;
+  REQUIRE(buffer[0] == 10.0f);
+
+  // Reshaping keeps the buffer, resizing copies the values and releases the owner
+  dataStore.resizeTuples({1, 2});
+  REQUIRE(dataStore.usesExternalBuffer());
+  dataStore.resizeTuples({3});
+  REQUIRE_FALSE(dataStore.usesExternalBuffer());
+  REQUIRE(valuesRef.expired());
+  REQUIRE(dataStore[0] == 10.0f);
+  REQUIRE(dataStore[5] == 6.0f);
+
+  DataStore<float32> copy(dataStore);
+  REQUIRE_FALSE(copy.usesExternalBuffer());
+}
+
 TEST_CASE("Copy DataStore", "DataArray")
 {
   IDataStore::ShapeType tupleShape{5};
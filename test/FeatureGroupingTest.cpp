@@ -0,0 +1,68 @@
+#include "simplnx/Utilities/FeatureGrouping.hpp"
+
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("nx::core::FeatureGrouping Test", "[simplnx][FeatureGrouping]")
+{
+  DataStructure dataStructure;
+  constexpr usize k_NumFeatures = 10;
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "Neighbors", k_NumFeatures);
+  for(int32 featureId = 0; featureId < static_cast<int32>(k_NumFeatures); featureId++)
+  {
+    auto neighbors = std::make_shared<std::vector<int32>>();
+    if(featureId > 0)
+    {
+      neighbors->push_back(featureId - 1);
+    }
+    neighbors->push_back(featureId);
+    if(featureId + 1 < static_cast<int32>(k_NumFeatures))
+    {
+      neighbors->push_back(featureId + 1);
+    }
+    neighborList->setList(featureId, neighbors);
+  }
+
+  // Neighbors are grouped in runs of 3: {0, 1, 2}, {3, 4, 5}, {6, 7, 8} and {9}
+  std::atomic<usize> numTests = 0;
+  const auto sameRun = [&numTests](int32 featureId, int32 neighborId) {
+    numTests++;
+    return featureId / 3 == neighborId / 3;
+  };
+  const std::atomic_bool shouldCancel = false;
+  for(const bool parallel : {false, true})
+  {
+    numTests = 0;
+    FeatureGrouping featureGrouping(*neighborList, k_NumFeatures);
+    featureGrouping.setParallelizationEnabled(parallel);
+    Result<std::vector<int32>> groupsResult = featureGrouping.execute(sameRun, shouldCancel);
+    REQUIRE(groupsResult.valid());
+    REQUIRE(groupsResult.value() == std::vector<int32>{0, 0, 0, 3, 3, 3, 6, 6, 6, 9});
+    // Each of the 9 neighboring pairs is tested once even though both of its features list it
+    REQUIRE(numTests == k_NumFeatures - 1);
+
+    // Feature 0 is already labeled, the other groups are numbered in the order they are met from feature 4
+    DataStore<int32> featureLabels({k_NumFeatures}, {1}, -1);
+    featureLabels[0] = 0;
+    const int32 nextLabel = FeatureGrouping::LabelGroups(groupsResult.value(), 4, 1, featureLabels);
+    REQUIRE(nextLabel == 5);
+    const std::vector<int32> expectedLabels = {0, 4, 4, 1, 1, 1, 2, 2, 2, 3};
+    for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+    {
+      REQUIRE(featureLabels[featureId] == expectedLabels[featureId]);
+    }
+  }
+
+  neighborList->addEntry(9, static_cast<int32>(k_NumFeatures));
+  FeatureGrouping invalidGrouping(*neighborList, k_NumFeatures);
+  REQUIRE(invalidGrouping.execute(sameRun, shouldCancel).invalid());
+}
@@ -0,0 +1,78 @@
+#include "simplnx/Utilities/FeatureReduction.hpp"
+
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("nx::core::FeatureReduction Test", "[simplnx][FeatureReduction]")
+{
+  constexpr usize k_NumElements = 300000;
+  std::atomic_bool shouldCancel = false;
+
+  struct CountSum
+  {
+    usize count = 0;
+    usize sum = 0;
+  };
+  auto accumulateCountSum = [](CountSum& value, usize, usize elementIndex) {
+    value.count++;
+    value.sum += elementIndex;
+  };
+  auto mergeCountSum = [](CountSum& value, const CountSum& other) {
+    value.count += other.count;
+    value.sum += other.sum;
+  };
+  // Depends on the order the elements of a feature are visited in
+  auto accumulateOrderHash = [](uint64& value, usize, usize elementIndex) { value = value * 31 + elementIndex; };
+
+  // Few features favor private accumulators, many features favor sorting the elements by feature
+  for(usize numFeatures : {usize{7}, usize{50000}})
+  {
+    DYNAMIC_SECTION("Features: " << numFeatures)
+    {
+      DataStore<int32> featureIds({k_NumElements}, {1}, 0);
+      std::vector<CountSum> expectedCountSums(numFeatures);
+      std::vector<uint64> expectedHashes(numFeatures, 0);
+      for(usize i = 0; i < k_NumElements; i++)
+      {
+        const int32 featureId = (i % 11 == 0) ? -1 : static_cast<int32>((i * 7919) % numFeatures);
+        featureIds[i] = featureId;
+        if(featureId >= 0)
+        {
+          accumulateCountSum(expectedCountSums[featureId], featureId, i);
+          accumulateOrderHash(expectedHashes[featureId], featureId, i);
+        }
+      }
+
+      for(bool parallel : {false, true})
+      {
+        FeatureReduction<CountSum> countSumReduction(featureIds, numFeatures, CountSum{});
+        countSumReduction.setParallelizationEnabled(parallel);
+        auto countSumResult = countSumReduction.execute(accumulateCountSum, mergeCountSum, shouldCancel);
+        REQUIRE(countSumResult.valid());
+        REQUIRE(countSumResult.value().size() == numFeatures);
+        for(usize featureId = 0; featureId < numFeatures; featureId++)
+        {
+          REQUIRE(countSumResult.value()[featureId].count == expectedCountSums[featureId].count);
+          REQUIRE(countSumResult.value()[featureId].sum == expectedCountSums[featureId].sum);
+        }
+
+        FeatureReduction<uint64> hashReduction(featureIds, numFeatures, 0);
+        hashReduction.setParallelizationEnabled(parallel);
+        auto hashResult = hashReduction.executeInElementOrder(accumulateOrderHash, shouldCancel);
+        REQUIRE(hashResult.valid());
+        REQUIRE(hashResult.value() == expectedHashes);
+      }
+
+      featureIds[k_NumElements / 2] = static_cast<int32>(numFeatures);
+      FeatureReduction<CountSum> invalidReduction(featureIds, numFeatures, CountSum{});
+      REQUIRE(invalidReduction.execute(accumulateCountSum, mergeCountSum, shouldCancel).invalid());
+      REQUIRE(invalidReduction.executeInElementOrder(accumulateCountSum, shouldCancel).invalid());
+    }
+  }
+}
@@ -0,0 +1,68 @@
+#include "simplnx/Utilities/MaskView.hpp"
+
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+#include "simplnx/Utilities/DataArrayUtilities.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+using namespace nx::core;
+
+TEST_CASE("nx::core::MaskView Test", "[simplnx][MaskView]")
+{
+  DataStructure dataStructure;
+  constexpr usize k_NumTuples = 130;
+  auto* boolMask = BoolArray::CreateWithStore<BoolDataStore>(dataStructure, "Bool Mask", {k_NumTuples}, {1});
+  auto* uint8Mask = UInt8Array::CreateWithStore<UInt8DataStore>(dataStructure, "UInt8 Mask", {k_NumTuples}, {1});
+  auto* int32Array = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Int32 Array", {k_NumTuples}, {1});
+  usize expectedTrueCount = 0;
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const bool value = (i % 3 == 0) || (i == 127);
+    (*boolMask)[i] = value;
+    (*uint8Mask)[i] = value ? 2 : 0;
+    expectedTrueCount += value ? 1 : 0;
+  }
+
+  for(const IDataArray* maskArray : {static_cast<const IDataArray*>(boolMask), static_cast<const IDataArray*>(uint8Mask)})
+  {
+    std::unique_ptr<MaskCompare> maskCompare = InstantiateMaskCompare(*const_cast<IDataArray*>(maskArray));
+    Result<PackedMaskView> packedMaskResult = PackedMaskView::Create(*maskArray);
+    SIMPLNX_RESULT_REQUIRE_VALID(packedMaskResult);
+    const PackedMaskView& packedMask = packedMaskResult.value();
+    REQUIRE(packedMask.getSize() == k_NumTuples);
+    REQUIRE(packedMask.countTrueValues() == expectedTrueCount);
+
+    usize viewTrueCount = ExecuteWithMaskView(maskArray, [&](const auto& maskView) {
+      usize count = 0;
+      for(usize i = 0; i < k_NumTuples; i++)
+      {
+        REQUIRE(maskView.isTrue(i) == maskCompare->isTrue(i));
+        REQUIRE(packedMask.isTrue(i) == maskCompare->isTrue(i));
+        REQUIRE(maskView.bothTrue(i, k_NumTuples - 1 - i) == maskCompare->bothTrue(i, k_NumTuples - 1 - i));
+        REQUIRE(maskView.bothFalse(i, k_NumTuples - 1 - i) == maskCompare->bothFalse(i, k_NumTuples - 1 - i));
+        REQUIRE(packedMask.bothFalse(i, k_NumTuples - 1 - i) == maskCompare->bothFalse(i, k_NumTuples - 1 - i));
+        count += maskView.isTrue(i) ? 1 : 0;
+      }
+      return count;
+    });
+    REQUIRE(viewTrueCount == expectedTrueCount);
+  }
+
+  usize allTrueCount = ExecuteWithMaskView(nullptr, [&](const auto& maskView) {
+    usize count = 0;
+    for(usize i = 0; i < k_NumTuples; i++)
+    {
+      count += maskView.isTrue(i) ? 1 : 0;
+    }
+    return count;
+  });
+  REQUIRE(allTrueCount == k_NumTuples);
+
+  SIMPLNX_RESULT_REQUIRE_INVALID(PackedMaskView::Create(*int32Array));
+  REQUIRE_THROWS(ExecuteWithMaskView(int32Array, [](const auto&) { return 0; }));
+}
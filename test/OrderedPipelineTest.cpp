@@ -0,0 +1,189 @@
+#include "simplnx/Utilities/OrderedPipeline.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+struct Slice
+{
+  usize index = 0;
+  std::vector<int32> values;
+  bool converted = false;
+};
+
+// Later slices finish converting first so that the writer has to put them back in order
+std::chrono::microseconds ConversionDelay(usize index)
+{
+  return std::chrono::microseconds(((index * 7919) % 13) * 50);
+}
+} // namespace
+
+TEST_CASE("nx::core::OrderedPipeline: Slice Order", "[simplnx][OrderedPipeline]")
+{
+  constexpr usize k_NumSlices = 97;
+  constexpr usize k_SliceSize = 64;
+  std::atomic_bool shouldCancel = false;
+
+  for(usize queueCapacity : {usize{1}, usize{4}})
+  {
+    for(bool parallel : {false, true})
+    {
+      DYNAMIC_SECTION("Queue Capacity: " << queueCapacity << " Parallel: " << parallel)
+      {
+        OrderedPipeline<Slice> pipeline(k_NumSlices);
+        pipeline.setParallelizationEnabled(parallel);
+        pipeline.setQueueCapacity(queueCapacity);
+        pipeline.setMaxThreads(4);
+
+        std::vector<usize> readOrder;
+        std::vector<usize> writeOrder;
+        std::vector<int32> output(k_NumSlices * k_SliceSize, -1);
+        std::atomic<usize> numConverted = 0;
+        std::atomic<usize> numWritten = 0;
+        std::atomic<usize> maxReadAhead = 0;
+
+        auto readSlice = [&](usize index) -> Result<Slice> {
+          const usize readAhead = index - numWritten;
+          maxReadAhead = std::max(maxReadAhead.load(), readAhead);
+          readOrder.push_back(index);
+          return {Slice{index, std::vector<int32>(k_SliceSize, static_cast<int32>(index)), false}};
+        };
+        auto convertSlice = [&](usize index, Slice& slice) -> Result<> {
+          std::this_thread::sleep_for(ConversionDelay(index));
+          for(int32& value : slice.values)
+          {
+            value = value * 2 + 1;
+          }
+          slice.converted = true;
+          numConverted++;
+          return {};
+        };
+        auto writeSlice = [&](usize index, Slice& slice) -> Result<> {
+          REQUIRE(slice.index == index);
+          REQUIRE(slice.converted);
+          std::copy(slice.values.begin(), slice.values.end(), output.begin() + index * k_SliceSize);
+          writeOrder.push_back(index);
+          numWritten++;
+          return {};
+        };
+
+        Result<> result = pipeline.execute(readSlice, convertSlice, writeSlice, shouldCancel);
+        REQUIRE(result.valid());
+        REQUIRE(numConverted == k_NumSlices);
+        REQUIRE(readOrder.size() == k_NumSlices);
+        REQUIRE(writeOrder.size() == k_NumSlices);
+        for(usize i = 0; i < k_NumSlices; i++)
+        {
+          REQUIRE(readOrder[i] == i);
+          REQUIRE(writeOrder[i] == i);
+          for(usize j = 0; j < k_SliceSize; j++)
+          {
+            REQUIRE(output[i * k_SliceSize + j] == static_cast<int32>(i * 2 + 1));
+          }
+        }
+        // The reader stays within both queues plus one slice per worker of the writer
+        REQUIRE(maxReadAhead <= 2 * queueCapacity + pipeline.getNumberOfWorkers());
+      }
+    }
+  }
+}
+
+TEST_CASE("nx::core::OrderedPipeline: Errors", "[simplnx][OrderedPipeline]")
+{
+  constexpr usize k_NumSlices = 50;
+  constexpr usize k_FailingSlice = 23;
+  constexpr int32 k_ErrorCode = -1234;
+  std::atomic_bool shouldCancel = false;
+
+  for(bool parallel : {false, true})
+  {
+    for(usize failingStage : {usize{0}, usize{1}, usize{2}})
+    {
+      DYNAMIC_SECTION("Parallel: " << parallel << " Failing Stage: " << failingStage)
+      {
+        OrderedPipeline<usize> pipeline(k_NumSlices);
+        pipeline.setParallelizationEnabled(parallel);
+        pipeline.setMaxThreads(4);
+
+        std::vector<usize> writeOrder;
+        auto readSlice = [&](usize index) -> Result<usize> {
+          if(failingStage == 0 && index == k_FailingSlice)
+          {
+            return MakeErrorResult<usize>(k_ErrorCode, "Read failed");
+          }
+          return {index};
+        };
+        auto convertSlice = [&](usize index, usize&) -> Result<> {
+          std::this_thread::sleep_for(ConversionDelay(index));
+          if(failingStage == 1 && index == k_FailingSlice)
+          {
+            return MakeErrorResult(k_ErrorCode, "Convert failed");
+          }
+          return {};
+        };
+        auto writeSlice = [&](usize index, usize&) -> Result<> {
+          if(failingStage == 2 && index == k_FailingSlice)
+          {
+            return MakeErrorResult(k_ErrorCode, "Write failed");
+          }
+          writeOrder.push_back(index);
+          return {};
+        };
+
+        Result<> result = pipeline.execute(readSlice, convertSlice, writeSlice, shouldCancel);
+        REQUIRE(result.invalid());
+        REQUIRE(result.errors().size() == 1);
+        REQUIRE(result.errors()[0].code == k_ErrorCode);
+        // Slices are never written past a failed one, and never out of order before it
+        REQUIRE(writeOrder.size() <= k_FailingSlice);
+        for(usize i = 0; i < writeOrder.size(); i++)
+        {
+          REQUIRE(writeOrder[i] == i);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("nx::core::OrderedPipeline: Cancel", "[simplnx][OrderedPipeline]")
+{
+  constexpr usize k_NumSlices = 50;
+  constexpr usize k_CancelSlice = 10;
+
+  for(bool parallel : {false, true})
+  {
+    DYNAMIC_SECTION("Parallel: " << parallel)
+    {
+      std::atomic_bool shouldCancel = false;
+      OrderedPipeline<usize> pipeline(k_NumSlices);
+      pipeline.setParallelizationEnabled(parallel);
+
+      std::vector<usize> writeOrder;
+      auto readSlice = [&](usize index) -> Result<usize> { return {index}; };
+      auto convertSlice = [&](usize, usize&) -> Result<> { return {}; };
+      auto writeSlice = [&](usize index, usize&) -> Result<> {
+        writeOrder.push_back(index);
+        if(index == k_CancelSlice)
+        {
+          shouldCancel = true;
+        }
+        return {};
+      };
+
+      Result<> result = pipeline.execute(readSlice, convertSlice, writeSlice, shouldCancel);
+      REQUIRE(result.valid());
+      REQUIRE(writeOrder.size() == k_CancelSlice + 1);
+      for(usize i = 0; i < writeOrder.size(); i++)
+      {
+        REQUIRE(writeOrder[i] == i);
+      }
+    }
+  }
+}
@@ -1,12 +1,20 @@
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
+#include "simplnx/Filter/FilterList.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Plugin/PluginLoader.hpp"
+#include "simplnx/Plugin/PluginManifest.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 #include "simplnx/unit_test/simplnx_test_dirs.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <iterator>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -105,3 +113,69 @@ TEST_CASE("Test Singleton")
   Application::DeleteInstance();
   REQUIRE(Application::Instance() == nullptr);
 }
+
+TEST_CASE("Test Plugin Manifest")
+{
+  // Record every plugin in the build directory
+  PluginManifest manifest;
+  for(const auto& dirEntry : std::filesystem::directory_iterator(unit_test::k_BuildDir.view()))
+  {
+    const std::filesystem::path& path = dirEntry.path();
+#ifdef NDEBUG
+    if(StringUtilities::ends_with(path.string(), "_d.simplnx") || !StringUtilities::ends_with(path.string(), ".simplnx"))
+#else
+    if(!StringUtilities::ends_with(path.string(), "_d.simplnx"))
+#endif
+    {
+      continue;
+    }
+    PluginLoader loader(path);
+    REQUIRE(loader.isLoaded());
+    manifest.setEntry(PluginManifest::CreateEntry(*loader.getPlugin(), path));
+  }
+  REQUIRE(manifest.getEntries().size() == SIMPLNX_PLUGIN_COUNT);
+
+  Result<PluginManifest> manifestResult = PluginManifest::FromJson(manifest.toJson());
+  REQUIRE(manifestResult.valid());
+  const PluginManifest& readManifest = manifestResult.value();
+  REQUIRE(readManifest.toJson() == manifest.toJson());
+
+  // Writing over an existing manifest replaces it and leaves no temporary file behind
+  {
+    const std::filesystem::path manifestDir = std::filesystem::path(unit_test::k_BinaryTestOutputDir.view()) / "PluginManifestTest";
+    std::filesystem::remove_all(manifestDir);
+    std::filesystem::create_directories(manifestDir);
+    const std::filesystem::path manifestPath = manifestDir / "plugin_manifest.json";
+    REQUIRE(PluginManifest().writeFile(manifestPath).valid());
+    REQUIRE(manifest.writeFile(manifestPath).valid());
+    Result<PluginManifest> fileResult = PluginManifest::ReadFile(manifestPath);
+    REQUIRE(fileResult.valid());
+    REQUIRE(fileResult.value().toJson() == manifest.toJson());
+    REQUIRE(std::distance(std::filesystem::directory_iterator(manifestDir), std::filesystem::directory_iterator()) == 1);
+  }
+
+  const PluginManifest::Entry* testOneEntry = nullptr;
+  for(const auto& [fileName, entry] : readManifest.getEntries())
+  {
+    REQUIRE(readManifest.findCurrentEntry(entry.libraryPath) == &entry);
+    if(entry.pluginId == k_TestOnePluginId)
+    {
+      testOneEntry = &entry;
+    }
+  }
+  REQUIRE(testOneEntry != nullptr);
+
+  // The plugin is added from the manifest and only loaded when a filter is created
+  auto loader = std::make_shared<LazyPluginLoader>(*testOneEntry);
+  FilterList filterList;
+  REQUIRE(filterList.addPlugin(loader).valid());
+  REQUIRE_FALSE(loader->isLoaded());
+  REQUIRE(filterList.getFilterHandles().count(k_TestFilterHandle) == 1);
+  REQUIRE(filterList.search("Test Filter").size() >= 1);
+  REQUIRE_FALSE(loader->isLoaded());
+
+  IFilter::UniquePointer filter = filterList.createFilter(k_TestFilterHandle);
+  REQUIRE(filter != nullptr);
+  REQUIRE(filter->humanName() == "Test Filter");
+  REQUIRE(loader->isLoaded());
+}
@@ -0,0 +1,68 @@
+#include "simplnx/Utilities/TupleRemap.hpp"
+
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("nx::core::TupleRemap Test", "[simplnx][TupleRemap]")
+{
+  const usize k_NumTuples = 8;
+  const std::atomic_bool k_ShouldCancel = false;
+
+  auto createArrays = [](DataStructure& dataStructure) {
+    auto* int32Array = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "Int32", {k_NumTuples}, {3});
+    auto* float32Array = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Float32", {k_NumTuples}, {1});
+    for(usize i = 0; i < k_NumTuples; i++)
+    {
+      int32Array->initializeTuple(i, static_cast<int32>(i));
+      (*float32Array)[i] = static_cast<float32>(i) * 0.5f;
+    }
+    return std::vector<std::shared_ptr<IDataArray>>{dataStructure.getSharedDataAs<IDataArray>(int32Array->getId()),
+                                                    dataStructure.getSharedDataAs<IDataArray>(float32Array->getId())};
+  };
+
+  // Tuple 1 reads tuple 2 before tuple 2 is reassigned and tuple 3 reads the reassigned tuple 1.
+  const std::vector<std::vector<int64>> sourceMaps = {{-1, 0, -1, 6, -1, 7, -1, -1}, {-1, 2, 0, 1, -1, 3, 5, 6}, {7, 0, 1, 2, 3, 4, 5, 6}};
+  for(const auto& sourceIndices : sourceMaps)
+  {
+    DataStructure expectedDataStructure;
+    auto expectedArrays = createArrays(expectedDataStructure);
+    for(usize i = 0; i < k_NumTuples; i++)
+    {
+      if(sourceIndices[i] >= 0)
+      {
+        for(const auto& dataArray : expectedArrays)
+        {
+          dataArray->copyTuple(sourceIndices[i], i);
+        }
+      }
+    }
+
+    DataStructure dataStructure;
+    auto dataArrays = createArrays(dataStructure);
+    Result<> result = TupleRemap::Create(sourceIndices).apply(dataArrays, k_ShouldCancel);
+    REQUIRE(result.valid());
+
+    for(usize index = 0; index < 3 * k_NumTuples; index++)
+    {
+      REQUIRE(dynamic_cast<Int32Array&>(*dataArrays[0])[index] == dynamic_cast<Int32Array&>(*expectedArrays[0])[index]);
+    }
+    for(usize index = 0; index < k_NumTuples; index++)
+    {
+      REQUIRE(dynamic_cast<Float32Array&>(*dataArrays[1])[index] == dynamic_cast<Float32Array&>(*expectedArrays[1])[index]);
+    }
+  }
+
+  DataStructure dataStructure;
+  auto dataArrays = createArrays(dataStructure);
+  Result<> result = TupleRemap::Create(std::vector<int32>(k_NumTuples + 1, -1)).apply(dataArrays, k_ShouldCancel);
+  REQUIRE(result.invalid());
+}
@@ -0,0 +1,74 @@
+"""
+Tests that DataArray.adopt_numpy() and DataStore.from_numpy() share the memory of the
+NumPy array they are given, and that arrays whose memory cannot be shared are rejected
+instead of being silently copied.
+"""
+import simplnx as nx
+import simplnx_test_dirs as nxtest
+
+import numpy as np
+
+# Create a Data Structure with a small float32 array
+data_structure = nx.DataStructure()
+
+array_path = nx.DataPath(['data'])
+result = nx.CreateDataArrayFilter.execute(data_structure,
+                                          numeric_type_index=nx.NumericType.float32,
+                                          component_count=1,
+                                          tuple_dimensions=[[3, 2]],
+                                          output_array_path=array_path,
+                                          initialization_value_str='0')
+nxtest.check_filter_result(nx.CreateDataArrayFilter, result)
+
+data_array = data_structure[array_path]
+shape = data_array.npview().shape
+
+#------------------------------------------------------------------------------
+# Writes through either side are seen by the other
+#------------------------------------------------------------------------------
+adopted = np.zeros(shape, dtype=np.float32)
+data_array.adopt_numpy(adopted)
+assert data_array.store.uses_external_buffer
+
+adopted[0, 0] = 42.0
+assert data_array.npview()[0, 0] == 42.0
+
+data_array.npview()[1, 1] = 7.0
+assert adopted[1, 1] == 7.0
+
+# A filter that modifies the array in place writes into the adopted NumPy array
+result = nx.ChangeAngleRepresentationFilter.execute(data_structure, conversion_type_index=0, angles_array_path=array_path)
+nxtest.check_filter_result(nx.ChangeAngleRepresentationFilter, result)
+assert np.isclose(adopted[0, 0], np.radians(42.0))
+assert np.isclose(adopted[1, 1], np.radians(7.0))
+
+store_array = np.arange(12, dtype=np.float32).reshape((4, 3))
+data_store = nx.Float32DataStore.from_numpy(store_array, component_shape=[3])
+assert data_store.uses_external_buffer
+store_array[2, 1] = -1.0
+assert data_store[7] == -1.0
+
+#------------------------------------------------------------------------------
+# Arrays that would have to be converted are rejected with a TypeError
+#------------------------------------------------------------------------------
+def expect_type_error(function, *args, **kwargs) -> None:
+  try:
+    function(*args, **kwargs)
+  except TypeError as error:
+    print(f'Rejected as expected: {error}')
+    return
+  raise AssertionError(f'{function} accepted an array it cannot share memory with')
+
+# Wrong dtype
+expect_type_error(data_array.adopt_numpy, np.zeros(shape, dtype=np.float64))
+expect_type_error(nx.Float32DataStore.from_numpy, np.zeros((4, 3), dtype=np.int32), component_shape=[3])
+
+# Not C contiguous
+expect_type_error(data_array.adopt_numpy, np.zeros(shape[::-1], dtype=np.float32).T)
+expect_type_error(nx.Float32DataStore.from_numpy, np.zeros((4, 6), dtype=np.float32)[:, ::2], component_shape=[3])
+
+# Not a NumPy array
+expect_type_error(nx.Float32DataStore.from_numpy, [[0.0, 1.0, 2.0]], component_shape=[3])
+
+# The rejected arrays did not replace the adopted one
+assert data_array.npview()[0, 0] == adopted[0, 0]